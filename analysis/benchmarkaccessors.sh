@@ -0,0 +1,69 @@
+#!/bin/bash
+
+# Compares the per-event bookkeeping cost of the generated readers (GetEntry and the loaded check of the accessors) between
+# a given revision and the working tree, e.g. before and after the per-event load epoch of wwwtree and frtree:
+#
+#   sh benchmarkaccessors.sh /path/to/baby.root BEFORE_REVISION
+#   sh benchmarkaccessors.sh /path/to/fakerate_baby.root BEFORE_REVISION t frtree
+#
+# BEFORE_REVISION is any git revision (branch, tag or commit) of the reader to compare to, e.g. the parent of the commit that
+# introduced the load epoch in the history being measured.
+# benchmarkaccessors.C is built against the reader sources of each version (with the rooutil of this checkout) and run on
+# the same baby, the working tree version last so that both read the baby from the page cache.
+
+#_____________________________________________________________________________________________
+# Help message
+help()
+{
+    echo "Error - Usage:"
+    echo "$0 INPUT_BABY BEFORE_REVISION [TREENAME=t] [READER=wwwtree] [NEVENTS=100000] [NREPEAT=20]"
+    exit 1
+}
+
+if [ -z $1 ]; then help; fi
+if [ -z $2 ]; then help; fi
+
+INPUT=$1
+BEFORE=$2
+TREENAME=${3:-t}
+READER=${4:-wwwtree}
+NEVENTS=${5:-100000}
+NREPEAT=${6:-20}
+
+if [ "${READER}" == "wwwtree" ]; then
+    READERDIR=analysis
+    READERINSTANCE=www
+elif [ "${READER}" == "frtree" ]; then
+    READERDIR=fakerate
+    READERINSTANCE=fr
+else
+    help
+fi
+
+HERE=$(cd $(dirname ${BASH_SOURCE[0]}) && pwd)
+TOP=$(cd ${HERE}/.. && pwd)
+WORKDIR=$(mktemp -d)
+git -C ${TOP} worktree add --detach ${WORKDIR}/before ${BEFORE} > /dev/null || exit 1
+
+#_____________________________________________________________________________________________
+# Build the benchmark against the reader sources of the given directory into the given executable
+build()
+{
+    SRCDIR=$1
+    mkdir -p ${WORKDIR}/$2
+    cp ${HERE}/benchmarkaccessors.C ${WORKDIR}/$2/benchmarkaccessors.cc
+    EXTRASOURCES=$(ls ${SRCDIR}/wwwcolumns.cc 2> /dev/null)
+    g++ -O2 -DREADERHEADER="\"${READER}.h\"" -DREADERINSTANCE=${READERINSTANCE} -I${SRCDIR} -I${TOP}/${READERDIR} $(root-config --cflags) \
+        ${WORKDIR}/$2/benchmarkaccessors.cc ${SRCDIR}/${READER}.cc ${EXTRASOURCES} $(root-config --libs) -lGenVector -o ${WORKDIR}/$2/benchmarkaccessors
+}
+
+build ${WORKDIR}/before/${READERDIR} before && build ${TOP}/${READERDIR} after
+if [ $? -eq 0 ]; then
+    echo "Before (${BEFORE}):"
+    ${WORKDIR}/before/benchmarkaccessors ${INPUT} ${TREENAME} ${NEVENTS} ${NREPEAT}
+    echo "After (working tree):"
+    ${WORKDIR}/after/benchmarkaccessors ${INPUT} ${TREENAME} ${NEVENTS} ${NREPEAT}
+fi
+
+git -C ${TOP} worktree remove --force ${WORKDIR}/before
+rm -rf ${WORKDIR}
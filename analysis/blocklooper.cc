@@ -0,0 +1,349 @@
+#include "blocklooper.h"
+
+//_______________________________________________________________________________________________________
+BlockLooper::BlockLooper(TChain* chain_, wwwtree* treeclass_, int nEventsToProcess_, int maxBlockSize_, Long64_t firstEntry, int prefetchDepth) :
+    chain(chain_),
+    treeclass(treeclass_),
+    tree(0),
+    treenumber(-1),
+    nEventsProcessed(0),
+    maxBlockSize(maxBlockSize_ > 0 ? maxBlockSize_ : 1000),
+    next_block_entry(firstEntry),
+    entry(0),
+    block_last(0),
+    isnewfileinchain(false),
+    isnewblock(false),
+    prefetch_depth(prefetchDepth),
+    reader_started(false),
+    reader_stop(false),
+    reader_done(false),
+    reader_seconds(0),
+    waiting_seconds(0),
+    nblocks_prefetched(0),
+    nblocks_not_prefetched(0)
+{
+    // Process the entries [firstEntry, firstEntry + nEventsToProcess) of the chain (up to the end if nEventsToProcess < 0)
+    Long64_t nEventsTotal = chain->GetEntries();
+    Long64_t nEventsLeft = std::max(nEventsTotal - firstEntry, (Long64_t) 0);
+    nEventsToProcess = (nEventsToProcess_ < 0 or nEventsToProcess_ > nEventsLeft) ? nEventsLeft : nEventsToProcess_;
+    end_entry = firstEntry + nEventsToProcess;
+    columns.select(column_selection);
+    treeclass->AttachColumns(&columns);
+    std::cout << "BlockLooper: looping over " << nEventsToProcess << " events from entry " << firstEntry << " in blocks of up to " << maxBlockSize << " entries" << std::endl;
+}
+
+//_______________________________________________________________________________________________________
+BlockLooper::~BlockLooper()
+{
+    if (reader_started)
+    {
+        stopReader();
+        printPrefetchStats();
+    }
+    treeclass->AttachColumns(0);
+    columns.release();
+}
+
+//_______________________________________________________________________________________________________
+bool BlockLooper::nextEvent()
+{
+    isnewfileinchain = false;
+    isnewblock = false;
+    if (entry >= block_last and not nextBlock())
+        return false;
+    treeclass->GetEntry(entry);
+    entry++;
+    nEventsProcessed++;
+    wwwtree::progress(nEventsProcessed, nEventsToProcess);
+    return true;
+}
+
+//_______________________________________________________________________________________________________
+bool BlockLooper::nextBlock()
+{
+    if (next_block_entry >= end_entry)
+        return false;
+
+    // The chain deletes the current tree when it moves on to the next file, so let go of its branches beforehand
+    if (tree and block_last >= tree->GetEntries())
+        columns.release();
+
+    Long64_t first = chain->LoadTree(next_block_entry);
+    if (first < 0)
+        return false;
+
+    if (chain->GetTreeNumber() != treenumber)
+    {
+        treenumber = chain->GetTreeNumber();
+        tree = chain->GetTree();
+        treeclass->Init(tree);
+        columns.setTree(tree);
+        isnewfileinchain = true;
+    }
+
+    // The reader thread is started once the branch tracing is over, as it reads the branches selected at that point
+    if (prefetch_depth > 0 and not reader_started and not treeclass->TracingBranches())
+        startReader();
+
+    Long64_t last = getBlockEnd(tree, first, maxBlockSize, end_entry - next_block_entry);
+
+    if (not reader_started or not takePrefetchedBlock(first, last))
+        columns.read(first, last);
+
+    entry = first;
+    block_last = last;
+    isnewblock = true;
+    next_block_entry += last - first;
+    return true;
+}
+
+//_______________________________________________________________________________________________________
+void BlockLooper::selectColumns(const std::set<TString>& names)
+{
+    // Only these branches are read in columns (to be called before the first event), every other branch stays lazy
+    // The columns are read from the baskets without the accessors, so the branch tracing of wwwtree would not see them:
+    // they are kept on and in the TTreeCache by the branch selection whatever the tracing records
+    column_selection = names;
+    columns.select(column_selection);
+    treeclass->KeepBranches(column_selection);
+}
+
+//_______________________________________________________________________________________________________
+Long64_t BlockLooper::getClusterStart(TChain* chain, Long64_t entry)
+{
+    if (entry <= 0)
+        return 0;
+    if (entry >= chain->GetEntries())
+        return chain->GetEntries();
+    Long64_t local = chain->LoadTree(entry);
+    if (local < 0)
+        return entry;
+    TTree::TClusterIterator clusters = chain->GetTree()->GetClusterIterator(local);
+    return entry - local + clusters();
+}
+
+//_______________________________________________________________________________________________________
+Long64_t BlockLooper::getBlockEnd(TTree* tree, Long64_t first, Long64_t maxBlockSize, Long64_t nEventsLeft)
+{
+    // Blocks never cross a cluster boundary so every basket is read once and unpacked in one go
+    TTree::TClusterIterator clusters = tree->GetClusterIterator(first);
+    clusters();
+    Long64_t last = std::min(clusters.GetNextEntry(), first + maxBlockSize);
+    last = std::min(last, tree->GetEntries());
+    last = std::min(last, first + nEventsLeft);
+    return last;
+}
+
+//_______________________________________________________________________________________________________
+void BlockLooper::startReader()
+{
+    // The reader thread opens its own instance of the files (ROOT::EnableThreadSafety() was called at the start of main())
+    bool selectall = not treeclass->BranchSelectionActive();
+    std::set<TString> selection;
+    if (not selectall)
+        selection = treeclass->TracedBranches();
+    TChain* readerchain = new TChain(chain->GetName());
+    readerchain->Add(chain);
+    reader_started = true;
+    reader = std::thread(&BlockLooper::readAhead, this, readerchain, next_block_entry, selection, selectall);
+    std::cout << "BlockLooper: prefetching up to " << prefetch_depth << " blocks ahead from entry " << next_block_entry << std::endl;
+}
+
+//_______________________________________________________________________________________________________
+void BlockLooper::stopReader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reader_stop = true;
+    }
+    ring_changed.notify_all();
+    reader.join();
+}
+
+//_______________________________________________________________________________________________________
+void BlockLooper::readAhead(TChain* readerchain, Long64_t firstEntry, std::set<TString> selection, bool selectall)
+{
+    // Same sequence of blocks as nextBlock(), read from a separate chain so that no TFile, TTree or TBranch is shared with the event loop.
+    // The columns are unpacked here and handed over as they are, so the event loop does not unpack them again. Of the other
+    // branches used by the event loop only the compressed bytes of their baskets are read (see prefetchBaskets()), which brings
+    // them through the file system (NFS in particular) into the page cache without unpacking anything twice.
+    WWWColumns readercolumns;
+    readercolumns.select(column_selection);
+    TTree* readertree = 0;
+    int readertreenumber = -1;
+    Long64_t readerlast = 0;
+    std::vector<std::pair<TBranch*, Int_t>> prefetched;
+    std::vector<char> buffer;
+    Long64_t next_entry = firstEntry;
+    while (next_entry < end_entry)
+    {
+        WWWColumns::Block block;
+        {
+            // Wait for a free slot in the ring
+            std::unique_lock<std::mutex> lock(mutex);
+            ring_changed.wait(lock, [&]() { return reader_stop or (int) ring.size() < prefetch_depth; });
+            if (reader_stop)
+                break;
+            if (spare_blocks.size())
+            {
+                block = std::move(spare_blocks.back());
+                spare_blocks.pop_back();
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        if (readertree and readerlast >= readertree->GetEntries())
+            readercolumns.release();
+        Long64_t first = readerchain->LoadTree(next_entry);
+        if (first < 0)
+            break;
+        if (readerchain->GetTreeNumber() != readertreenumber)
+        {
+            readertreenumber = readerchain->GetTreeNumber();
+            readertree = readerchain->GetTree();
+            readercolumns.setTree(readertree);
+
+            // Baskets to prefetch: every branch used by the event loop (all of them without the branch selection) but the columns
+            prefetched.clear();
+            TObjArray* branches = readertree->GetListOfBranches();
+            for (int ibranch = 0; ibranch < branches->GetEntries(); ++ibranch)
+            {
+                TBranch* branch = (TBranch*) branches->At(ibranch);
+                if (column_selection.count(branch->GetName()) or (not selectall and not selection.count(branch->GetName())))
+                    continue;
+                addBranchToPrefetch(branch, prefetched);
+            }
+        }
+        Long64_t last = getBlockEnd(readertree, first, maxBlockSize, end_entry - next_entry);
+        readercolumns.read(first, last);
+        prefetchBaskets(readertree->GetCurrentFile(), prefetched, first, last, buffer);
+        readercolumns.exportBlock(block);
+        block.entry = next_entry;
+        readerlast = last;
+        next_entry += last - first;
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            reader_seconds += elapsed.count();
+            ring.push_back(std::move(block));
+        }
+        ring_changed.notify_all();
+    }
+    readercolumns.release();
+    delete readerchain;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reader_done = true;
+    }
+    ring_changed.notify_all();
+}
+
+//_______________________________________________________________________________________________________
+void BlockLooper::addBranchToPrefetch(TBranch* branch, std::vector<std::pair<TBranch*, Int_t>>& prefetched)
+{
+    // The branch and its sub-branches (e.g. the coordinates of the LorentzVectors), each with the next basket to prefetch
+    prefetched.push_back(std::make_pair(branch, 0));
+    TObjArray* subbranches = branch->GetListOfBranches();
+    for (int ibranch = 0; ibranch < subbranches->GetEntriesFast(); ++ibranch)
+        addBranchToPrefetch((TBranch*) subbranches->At(ibranch), prefetched);
+}
+
+//_______________________________________________________________________________________________________
+void BlockLooper::prefetchBaskets(TFile* file, std::vector<std::pair<TBranch*, Int_t>>& prefetched, Long64_t first, Long64_t last, std::vector<char>& buffer)
+{
+    // Read the compressed bytes of the baskets holding entries [first, last) in one TFile::ReadBuffers call and throw them away.
+    // Each basket is read once even when it spans several blocks, and the baskets kept in the tree header (no seek) are skipped.
+    std::vector<Long64_t> positions;
+    std::vector<Int_t> lengths;
+    Long64_t size = 0;
+    for (auto& branch_basket : prefetched)
+    {
+        TBranch* branch = branch_basket.first;
+        Int_t nbaskets = branch->GetWriteBasket() + 1;
+        Long64_t* basket_entries = branch->GetBasketEntry();
+        Long64_t* basket_seeks = branch->GetBasketSeek();
+        Int_t* basket_bytes = branch->GetBasketBytes();
+        Int_t ibasket = std::max(branch_basket.second, (Int_t) TMath::BinarySearch((Long64_t) nbaskets, basket_entries, first));
+        for (; ibasket < nbaskets and basket_entries[ibasket] < last; ++ibasket)
+        {
+            if (basket_seeks[ibasket] == 0 or basket_bytes[ibasket] <= 0)
+                continue;
+            positions.push_back(basket_seeks[ibasket]);
+            lengths.push_back(basket_bytes[ibasket]);
+            size += basket_bytes[ibasket];
+        }
+        branch_basket.second = ibasket;
+    }
+    if (positions.empty())
+        return;
+
+    // TFile::ReadBuffers wants the buffers sorted by position
+    std::vector<unsigned int> order(positions.size());
+    for (unsigned int ibuffer = 0; ibuffer < order.size(); ++ibuffer)
+        order[ibuffer] = ibuffer;
+    std::sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) { return positions[a] < positions[b]; });
+    std::vector<Long64_t> sorted_positions;
+    std::vector<Int_t> sorted_lengths;
+    for (auto ibuffer : order)
+    {
+        sorted_positions.push_back(positions[ibuffer]);
+        sorted_lengths.push_back(lengths[ibuffer]);
+    }
+    buffer.resize(size);
+    file->ReadBuffers(buffer.data(), sorted_positions.data(), sorted_lengths.data(), sorted_positions.size());
+}
+
+//_______________________________________________________________________________________________________
+bool BlockLooper::takePrefetchedBlock(Long64_t first, Long64_t last)
+{
+    // Returns false if the block has to be read here (the reader stopped early or its blocks do not line up)
+    WWWColumns::Block block;
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(mutex);
+        ring_changed.wait(lock, [&]() { return reader_done or not ring.empty(); });
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        waiting_seconds += elapsed.count();
+        if (ring.empty())
+        {
+            nblocks_not_prefetched++;
+            return false;
+        }
+        block = std::move(ring.front());
+        ring.pop_front();
+    }
+    ring_changed.notify_all();
+
+    bool matches = block.entry == next_block_entry and block.last - block.first == last - first and block.first == first;
+    if (matches)
+    {
+        columns.importBlock(block);
+        nblocks_prefetched++;
+    }
+    else
+    {
+        nblocks_not_prefetched++;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    spare_blocks.push_back(std::move(block));
+    return matches;
+}
+
+//_______________________________________________________________________________________________________
+void BlockLooper::printPrefetchStats()
+{
+    // The overlap is the fraction of the reading done by the reader thread while the event loop was busy with the previous blocks
+    // (the reader unpacks the columns and only reads the compressed bytes of the other baskets, so none of it is repeated by the event loop)
+    double overlap = reader_seconds > 0 ? std::max(0., 1. - waiting_seconds / reader_seconds) : 0;
+    printf("BlockLooper: %d blocks prefetched (%d read by the event loop), reader busy for %.2f s, event loop waited %.2f s, %.1f%% of the reading overlapped\n",
+            nblocks_prefetched, nblocks_not_prefetched, reader_seconds, waiting_seconds, 100. * overlap);
+}
+
+//_______________________________________________________________________________________________________
+TString BlockLooper::getCurrentFileName()
+{
+    return TString(tree->GetCurrentFile()->GetName());
+}
@@ -0,0 +1,95 @@
+#ifndef blocklooper_h
+#define blocklooper_h
+
+#include "TChain.h"
+#include "TFile.h"
+#include "wwwtree.h"
+#include "wwwcolumns.h"
+#include "TROOT.h"
+#include "TMath.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <chrono>
+#include <algorithm>
+#include <utility>
+
+//_______________________________________________________________________________________________________
+// Alternative to RooUtil::Looper<wwwtree> that walks the chain in blocks of entries aligned to the TTree clusters
+// For each block the selected flat scalar branches (see selectColumns()) are read into a WWWColumns block which is attached
+// to wwwtree, so their accessors are served from the columns while every other branch is read per event on access as usual.
+// With a prefetch depth > 0 the blocks are read ahead by a reader thread with its own instance of the chain and
+// handed over through a ring of up to prefetchDepth blocks, so the reading overlaps with the event processing. The reader
+// only reads the compressed bytes of the other branches ahead of the event loop, which still unpacks them on access.
+class BlockLooper
+{
+    public:
+        BlockLooper(TChain* chain, wwwtree* treeclass, int nEventsToProcess = -1, int maxBlockSize = 1000, Long64_t firstEntry = 0, int prefetchDepth = 0);
+        ~BlockLooper();
+
+        // Same interface as RooUtil::Looper so the event loop can be written for either
+        bool nextEvent();
+        bool isNewFileInChain() { return isnewfileinchain; }
+        TString getCurrentFileName();
+        TTree* getTree() { return tree; }
+        unsigned int getNEventsProcessed() { return nEventsProcessed; }
+
+        // First entry of the TTree cluster that contains the given entry of the chain (number of entries if beyond the end)
+        static Long64_t getClusterStart(TChain* chain, Long64_t entry);
+
+        // Local entry after the last entry of the block starting at first (end of its cluster, at most maxBlockSize or nEventsLeft entries)
+        static Long64_t getBlockEnd(TTree* tree, Long64_t first, Long64_t maxBlockSize, Long64_t nEventsLeft);
+
+        // Block level access
+        bool nextBlock();
+        WWWColumns& getColumns() { return columns; }
+        bool isNewBlock() { return isnewblock; }
+        Long64_t getEntryInBlock() { return entry - 1 - columns.first(); }
+
+        // Branches read in columns for every block (none by default)
+        void selectColumns(const std::set<TString>& names);
+
+    private:
+        // Prefetching
+        void startReader();
+        void stopReader();
+        void readAhead(TChain* readerchain, Long64_t firstEntry, std::set<TString> selection, bool selectall);
+        static void addBranchToPrefetch(TBranch* branch, std::vector<std::pair<TBranch*, Int_t>>& prefetched);
+        static void prefetchBaskets(TFile* file, std::vector<std::pair<TBranch*, Int_t>>& prefetched, Long64_t first, Long64_t last, std::vector<char>& buffer);
+        bool takePrefetchedBlock(Long64_t first, Long64_t last);
+        void printPrefetchStats();
+
+        TChain* chain;
+        wwwtree* treeclass;
+        WWWColumns columns;
+        TTree* tree;
+        int treenumber;
+        Long64_t nEventsToProcess;
+        Long64_t end_entry;        // global entry after the last event to process
+        Long64_t nEventsProcessed;
+        Long64_t maxBlockSize;
+        Long64_t next_block_entry; // global entry of the first event of the next block
+        Long64_t entry;            // local entry of the next event in the current block
+        Long64_t block_last;       // local entry after the last event in the current block
+        bool isnewfileinchain;
+        bool isnewblock;
+        std::set<TString> column_selection;
+
+        // Ring of prefetched blocks (filled by the reader thread, everything below is guarded by the mutex)
+        int prefetch_depth;
+        bool reader_started;
+        std::thread reader;
+        std::mutex mutex;
+        std::condition_variable ring_changed;
+        std::deque<WWWColumns::Block> ring;
+        std::vector<WWWColumns::Block> spare_blocks;
+        bool reader_stop;
+        bool reader_done;
+        double reader_seconds;   // time the reader thread spent reading
+        double waiting_seconds;  // time the event loop spent waiting for a prefetched block
+        int nblocks_prefetched;
+        int nblocks_not_prefetched;
+};
+
+#endif
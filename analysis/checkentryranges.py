@@ -0,0 +1,58 @@
+#!/bin/env python
+
+# Check that doAnalysis outputs of jobs over parts of the same input (first/last options), merged with hadd, cover all the
+# entries of the input exactly once
+# Each output of a part of the input has an "entryranges" tree with one (first, last, nentries) row per range of entries
+# processed, and hadd concatenates the rows. Together the ranges have to make [0, nentries) without gaps or overlaps, with
+# the same nentries in every row (all the parts read the same input). Exits with 1 otherwise.
+#
+#   python checkentryranges.py MERGED.root [MERGED2.root ...]
+
+import sys
+import ROOT as r
+
+r.gROOT.SetBatch(True)
+
+def check(path):
+    f = r.TFile.Open(path)
+    if not f or f.IsZombie():
+        print("{}: could not open".format(path))
+        return False
+    entryranges = f.Get("entryranges")
+    if not entryranges:
+        print("{}: no entryranges tree (not the output of a part of the input)".format(path))
+        return False
+
+    ranges = []
+    nentries = set()
+    for row in entryranges:
+        ranges.append((row.first, row.last))
+        nentries.add(row.nentries)
+    if len(nentries) != 1:
+        print("{}: the parts read inputs of different sizes ({})".format(path, ", ".join(str(n) for n in sorted(nentries))))
+        return False
+    nentries = nentries.pop()
+
+    covered = 0
+    problems = []
+    for first, last in sorted(ranges):
+        if first > covered:
+            problems.append("entries [{}, {}) missing".format(covered, first))
+        elif first < covered:
+            problems.append("entries [{}, {}) processed twice".format(first, min(covered, last)))
+        covered = max(covered, last)
+    if covered != nentries:
+        problems.append("entries [{}, {}) missing".format(covered, nentries))
+
+    if problems:
+        print("{}: {}".format(path, ", ".join(problems)))
+        return False
+    print("{}: {} ranges cover the {} entries exactly once".format(path, len(ranges), nentries))
+    return True
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage: python {} MERGED.root [MERGED2.root ...]".format(sys.argv[0]))
+        sys.exit(1)
+    results = [check(path) for path in sys.argv[1:]]
+    sys.exit(0 if all(results) else 1)
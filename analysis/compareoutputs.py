@@ -0,0 +1,75 @@
+#!/bin/env python
+
+# Compare the histograms (cutflows included) of two doAnalysis output files
+# Every histogram of either file has to be in the other one with the same bin contents, errors and number of entries
+# (exactly unless a relative tolerance is given). Exits with 1 if anything differs.
+#
+#   python compareoutputs.py REFERENCE.root OTHER.root [TOLERANCE=0] [SKIP=entryranges,files]
+
+import sys
+import ROOT as r
+
+r.gROOT.SetBatch(True)
+
+def get_histograms(directory, prefix=""):
+    # All the histograms of the directory and its subdirectories by path
+    histograms = {}
+    for key in directory.GetListOfKeys():
+        obj = key.ReadObj()
+        path = prefix + key.GetName()
+        if obj.InheritsFrom("TDirectory"):
+            histograms.update(get_histograms(obj, path + "/"))
+        elif obj.InheritsFrom("TH1"):
+            obj.SetDirectory(0)
+            histograms[path] = obj
+    return histograms
+
+def differ(a, b, tolerance):
+    if tolerance == 0:
+        return a != b
+    return abs(a - b) > tolerance * max(abs(a), abs(b))
+
+def compare(reference_path, other_path, tolerance=0, skip=[]):
+    reference_file = r.TFile.Open(reference_path)
+    other_file = r.TFile.Open(other_path)
+    if not reference_file or reference_file.IsZombie() or not other_file or other_file.IsZombie():
+        print("Error: could not open {} or {}".format(reference_path, other_path))
+        return False
+    reference = get_histograms(reference_file)
+    other = get_histograms(other_file)
+    for name in skip:
+        reference.pop(name, None)
+        other.pop(name, None)
+
+    ndifferent = 0
+    for name in sorted(set(reference) | set(other)):
+        if name not in other or name not in reference:
+            print("{}: only in {}".format(name, reference_path if name in reference else other_path))
+            ndifferent += 1
+            continue
+        h_reference = reference[name]
+        h_other = other[name]
+        if h_reference.GetNcells() != h_other.GetNcells():
+            print("{}: {} bins vs {} bins".format(name, h_reference.GetNcells(), h_other.GetNcells()))
+            ndifferent += 1
+            continue
+        messages = []
+        if differ(h_reference.GetEntries(), h_other.GetEntries(), tolerance):
+            messages.append("entries {} vs {}".format(h_reference.GetEntries(), h_other.GetEntries()))
+        for ibin in range(h_reference.GetNcells()):
+            if differ(h_reference.GetBinContent(ibin), h_other.GetBinContent(ibin), tolerance) or differ(h_reference.GetBinError(ibin), h_other.GetBinError(ibin), tolerance):
+                messages.append("bin {} {} +- {} vs {} +- {}".format(ibin, h_reference.GetBinContent(ibin), h_reference.GetBinError(ibin), h_other.GetBinContent(ibin), h_other.GetBinError(ibin)))
+        if messages:
+            print("{}: {}".format(name, ", ".join(messages[:5]) + (" ..." if len(messages) > 5 else "")))
+            ndifferent += 1
+
+    print("{} histograms compared, {} differ ({} vs {})".format(len(set(reference) | set(other)), ndifferent, reference_path, other_path))
+    return ndifferent == 0
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("Usage: python {} REFERENCE.root OTHER.root [TOLERANCE=0] [SKIP=entryranges,files]".format(sys.argv[0]))
+        sys.exit(1)
+    tolerance = float(sys.argv[3]) if len(sys.argv) > 3 else 0
+    skip = sys.argv[4].split(",") if len(sys.argv) > 4 else []
+    sys.exit(0 if compare(sys.argv[1], sys.argv[2], tolerance, skip) else 1)
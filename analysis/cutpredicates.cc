@@ -0,0 +1,153 @@
+#include "cutpredicates.h"
+
+CutPredicates cutpredicates;
+
+//_______________________________________________________________________________________________________
+CutPredicates::CutPredicates() : epoch(1), block_entry(0), check_block(false), nblockchecks(0), nblockmismatches(0)
+{
+}
+
+//_______________________________________________________________________________________________________
+void CutPredicates::add(TString name, std::function<bool()> predicate)
+{
+    if (index.find(name) != index.end())
+        return;
+    index[name] = functions.size();
+    names.push_back(name);
+    functions.push_back(predicate);
+    epochs.push_back(0);
+    results.push_back(false);
+    in_block.push_back(false);
+    masks.push_back(std::vector<uint64_t>());
+}
+
+//_______________________________________________________________________________________________________
+void CutPredicates::addColumn(TString name, TString branch, Comparison comparison, double threshold, std::function<bool()> predicate)
+{
+    if (index.find(name) != index.end())
+        return;
+    add(name, predicate);
+    ColumnPredicate column_predicate;
+    column_predicate.ipredicate = index[name];
+    column_predicate.branch = branch;
+    column_predicate.comparison = comparison;
+    column_predicate.threshold = threshold;
+    column_predicates.push_back(column_predicate);
+}
+
+//_______________________________________________________________________________________________________
+std::set<TString> CutPredicates::getColumnBranches() const
+{
+    std::set<TString> branches;
+    for (auto& column_predicate : column_predicates)
+        branches.insert(column_predicate.branch);
+    return branches;
+}
+
+//_______________________________________________________________________________________________________
+// Bitmask of "values[i] comparison threshold" over n values, filled 64 events at a time so that the inner loop is branchless.
+// The values are compared as doubles just like in the expressions of the cuts (e.g. www.met_pt()>60.) so the bits are identical.
+template <class T, class Compare>
+static void fillMask(const T* values, Long64_t n, double threshold, std::vector<uint64_t>& mask, Compare compare)
+{
+    mask.resize((n + 63) / 64);
+    for (Long64_t iword = 0; iword < (Long64_t) mask.size(); ++iword)
+    {
+        const T* chunk = values + iword * 64;
+        Long64_t nchunk = std::min(n - iword * 64, (Long64_t) 64);
+        uint64_t word = 0;
+        for (Long64_t ibit = 0; ibit < nchunk; ++ibit)
+            word |= (uint64_t) compare((double) chunk[ibit], threshold) << ibit;
+        mask[iword] = word;
+    }
+}
+
+//_______________________________________________________________________________________________________
+template <class T>
+static void fillMask(const T* values, Long64_t n, CutPredicates::Comparison comparison, double threshold, std::vector<uint64_t>& mask)
+{
+    switch (comparison)
+    {
+        case CutPredicates::kLess:         fillMask(values, n, threshold, mask, [](double x, double y) { return x <  y; }); break;
+        case CutPredicates::kLessEqual:    fillMask(values, n, threshold, mask, [](double x, double y) { return x <= y; }); break;
+        case CutPredicates::kGreater:      fillMask(values, n, threshold, mask, [](double x, double y) { return x >  y; }); break;
+        case CutPredicates::kGreaterEqual: fillMask(values, n, threshold, mask, [](double x, double y) { return x >= y; }); break;
+        case CutPredicates::kEqual:        fillMask(values, n, threshold, mask, [](double x, double y) { return x == y; }); break;
+    }
+}
+
+//_______________________________________________________________________________________________________
+void CutPredicates::setBlock(const WWWColumns& columns)
+{
+    for (auto& column_predicate : column_predicates)
+    {
+        unsigned int ipredicate = column_predicate.ipredicate;
+        int icol = columns.getColumnIndex(column_predicate.branch);
+        in_block[ipredicate] = icol >= 0;
+        if (icol < 0)
+            continue;
+        if (columns.getColumns()[icol].isfloat)
+            fillMask(columns.getFloat(icol), columns.size(), column_predicate.comparison, column_predicate.threshold, masks[ipredicate]);
+        else
+            fillMask(columns.getInt(icol), columns.size(), column_predicate.comparison, column_predicate.threshold, masks[ipredicate]);
+    }
+    block_entry = 0;
+}
+
+//_______________________________________________________________________________________________________
+bool CutPredicates::getBit(unsigned int ipredicate)
+{
+    bool bit = (masks[ipredicate][block_entry >> 6] >> (block_entry & 63)) & 1;
+    if (check_block)
+    {
+        nblockchecks++;
+        if (bit != functions[ipredicate]())
+        {
+            if (nblockmismatches++ < 10)
+                printf("[CutPredicates::getBit] Predicate %s is %d for entry %lld of the block but %d for the event\n", names[ipredicate].Data(), bit, block_entry, not bit);
+        }
+    }
+    return bit;
+}
+
+//_______________________________________________________________________________________________________
+std::function<bool()> CutPredicates::get(TString name)
+{
+    if (index.find(name) == index.end())
+    {
+        printf("[CutPredicates::get] No predicate %s registered (see addCutPredicates())\n", name.Data());
+        exit(1);
+    }
+    unsigned int ipredicate = index[name];
+    return [this, ipredicate]() { return evaluate(ipredicate); };
+}
+
+//_______________________________________________________________________________________________________
+void addCutPredicates()
+{
+    // Predicates appearing in several regions of the region files
+    cutpredicates.add("SSmm"        , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                 ; } );
+    cutpredicates.add("SSem"        , [&]() { return (www.passSSem())*(www.MllSS()>30.)                 ; } );
+    cutpredicates.add("SSee"        , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)             ; } );
+    cutpredicates.add("MjjW"        , [&]() { return fabs(www.Mjj()-80.)<15.                            ; } );
+    cutpredicates.add("MjjSide"     , [&]() { return fabs(www.Mjj()-80.)>=15.                           ; } );
+    cutpredicates.add("ZeeVt"       , [&]() { return fabs(www.MllSS()-91.1876)>10.                      ; } );
+    cutpredicates.add("ZVt3l"       , [&]() { return abs(www.M3l()-91.1876) > 10.                       ; } );
+
+    // Single branch comparisons that can also be evaluated over whole blocks of columns
+    cutpredicates.addColumn("TVeto"     , "nisoTrack_mt2_cleaned_VVV_cutbased_veto" , CutPredicates::kEqual        , 0.    , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0   ; } );
+    cutpredicates.addColumn("Nj2"       , "nj30"                                    , CutPredicates::kGreaterEqual , 2.    , [&]() { return www.nj30()>= 2                                     ; } );
+    cutpredicates.addColumn("Nj1"       , "nj"                                      , CutPredicates::kLessEqual    , 1.    , [&]() { return www.nj()<=1                                        ; } );
+    cutpredicates.addColumn("Nb0"       , "nb"                                      , CutPredicates::kEqual        , 0.    , [&]() { return www.nb()==0                                        ; } );
+    cutpredicates.addColumn("Nb1"       , "nb"                                      , CutPredicates::kGreaterEqual , 1.    , [&]() { return www.nb()>=1                                        ; } );
+    cutpredicates.addColumn("MjjL"      , "MjjL"                                    , CutPredicates::kLess         , 400.  , [&]() { return www.MjjL()<400.                                    ; } );
+    cutpredicates.addColumn("DetajjL"   , "DetajjL"                                 , CutPredicates::kLess         , 1.5   , [&]() { return www.DetajjL()<1.5                                  ; } );
+    cutpredicates.addColumn("MET60"     , "met_pt"                                  , CutPredicates::kGreater      , 60.   , [&]() { return www.met_pt()>60.                                   ; } );
+    cutpredicates.addColumn("MllSS40"   , "MllSS"                                   , CutPredicates::kGreater      , 40.   , [&]() { return www.MllSS()>40.                                    ; } );
+    cutpredicates.addColumn("MllSS30"   , "MllSS"                                   , CutPredicates::kGreater      , 30.   , [&]() { return www.MllSS()>30.                                    ; } );
+    cutpredicates.addColumn("MTmax90"   , "MTmax"                                   , CutPredicates::kGreater      , 90.   , [&]() { return www.MTmax()>90.                                    ; } );
+    cutpredicates.addColumn("DPhi3lMET" , "DPhi3lMET"                               , CutPredicates::kGreater      , 2.5   , [&]() { return www.DPhi3lMET()>2.5                                ; } );
+    cutpredicates.addColumn("Pt3l60"    , "Pt3l"                                    , CutPredicates::kGreater      , 60.   , [&]() { return www.Pt3l()>60.                                     ; } );
+    cutpredicates.addColumn("Mll3L20"   , "Mll3L"                                   , CutPredicates::kGreater      , 20.   , [&]() { return www.Mll3L() > 20.                                  ; } );
+    cutpredicates.addColumn("NSFOSinZ0" , "nSFOSinZ"                                , CutPredicates::kEqual        , 0.    , [&]() { return www.nSFOSinZ() == 0                                ; } );
+}
@@ -0,0 +1,109 @@
+#ifndef cutpredicates_h
+#define cutpredicates_h
+
+#include "wwwtree.h"
+#include "globalvariables.h"
+#include "rooutil/rooutil.h"
+#include "wwwcolumns.h"
+#include <vector>
+#include <map>
+#include <set>
+#include <cstdint>
+#include <functional>
+
+//_______________________________________________________________________________________________________
+// Registry of the named cut predicates that are shared between the regions (e.g. "Nj2" for nj30()>=2)
+// The cut functions handed out by get() evaluate their predicate at most once per event and return the cached result
+// wherever else the predicate appears in the cut tree, so the same selection in dozens of regions costs a single evaluation.
+// Predicates that compare a flat branch to a constant can also be registered as column predicates. When the events are read
+// in blocks of columns (BlockLooper) these are evaluated for the whole block at once into bitmasks (one bit per event) and the
+// cut functions read the bit of the current event.
+class CutPredicates
+{
+    public:
+        enum Comparison { kLess, kLessEqual, kGreater, kGreaterEqual, kEqual };
+
+        CutPredicates();
+
+        // Register a named predicate (a name that is already registered keeps its first definition)
+        void add(TString name, std::function<bool()> predicate);
+
+        // Register a named predicate "branch comparison threshold" (predicate is the same selection for a single event)
+        void addColumn(TString name, TString branch, Comparison comparison, double threshold, std::function<bool()> predicate);
+
+        // Evaluate the column predicates over a block of columns (those whose branch is not in the block are evaluated per event)
+        void setBlock(const WWWColumns& columns);
+
+        // Branches of the column predicates (the ones to be read in columns for setBlock())
+        std::set<TString> getColumnBranches() const;
+
+        // Position of the current event in the block (to be called for every event of a block before the cuts are evaluated)
+        void setBlockEntry(Long64_t ientry) { block_entry = ientry; }
+
+        // Compare every bit read from the bitmasks to the predicate evaluated for the event (consistency check of the block evaluation)
+        void setCheckBlock(bool check) { check_block = check; }
+        unsigned long long getNBlockMismatches() const { return nblockmismatches; }
+        unsigned long long getNBlockChecks() const { return nblockchecks; }
+
+        // Cut function for the named predicate (to be passed to cutflow.addCut/addCutToLastActiveCut)
+        std::function<bool()> get(TString name);
+
+        // Forget the results of the previous event (to be called before every cutflow.fill())
+        void newEvent()
+        {
+            if (++epoch == 0)
+            {
+                std::fill(epochs.begin(), epochs.end(), 0);
+                epoch = 1;
+            }
+        }
+
+        inline bool evaluate(unsigned int ipredicate)
+        {
+            if (epochs[ipredicate] != epoch)
+            {
+                if (in_block[ipredicate])
+                    results[ipredicate] = getBit(ipredicate);
+                else
+                    results[ipredicate] = functions[ipredicate]();
+                epochs[ipredicate] = epoch;
+            }
+            return results[ipredicate];
+        }
+
+        unsigned int size() const { return functions.size(); }
+        const TString& getName(unsigned int ipredicate) const { return names[ipredicate]; }
+
+    private:
+        struct ColumnPredicate
+        {
+            unsigned int ipredicate;
+            TString branch;
+            Comparison comparison;
+            double threshold;
+        };
+
+        bool getBit(unsigned int ipredicate);
+
+        std::vector<TString> names;
+        std::vector<std::function<bool()>> functions;
+        std::vector<unsigned int> epochs;
+        std::vector<char> results;
+        std::map<TString, unsigned int> index;
+        unsigned int epoch;
+
+        // Block evaluation
+        std::vector<ColumnPredicate> column_predicates;
+        std::vector<char> in_block;                   // the predicate is read from its bitmask for the current block
+        std::vector<std::vector<uint64_t>> masks;     // one bit per event of the block
+        Long64_t block_entry;
+        bool check_block;
+        unsigned long long nblockchecks;
+        unsigned long long nblockmismatches;
+};
+
+extern CutPredicates cutpredicates;
+
+void addCutPredicates();
+
+#endif
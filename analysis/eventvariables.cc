@@ -0,0 +1,44 @@
+#include "eventvariables.h"
+
+EventVariables eventvariables;
+
+//_______________________________________________________________________________________________________
+EventVariables::EventVariables() : epoch(1)
+{
+}
+
+//_______________________________________________________________________________________________________
+void EventVariables::add(TString name, std::function<float()> variable)
+{
+    if (index.find(name) != index.end())
+        return;
+    index[name] = functions.size();
+    names.push_back(name);
+    functions.push_back(variable);
+    epochs.push_back(0);
+    values.push_back(0);
+}
+
+//_______________________________________________________________________________________________________
+std::function<float()> EventVariables::get(TString name)
+{
+    if (index.find(name) == index.end())
+    {
+        printf("[EventVariables::get] No variable %s registered (see addEventVariables())\n", name.Data());
+        exit(1);
+    }
+    unsigned int ivariable = index[name];
+    return [this, ivariable]() { return evaluate(ivariable); };
+}
+
+//_______________________________________________________________________________________________________
+void addEventVariables()
+{
+    // Variables appearing in several histograms
+    eventvariables.add("MllSS"          , [&]() { return www.MllSS()                  ; } );
+    eventvariables.add("MllOnOff"       , [&]() { return fabs(www.Mll3L()-91.1876)<fabs(www.Mll3L1()-91.1876)?www.Mll3L():www.Mll3L1(); } );
+    eventvariables.add("Pt3l"           , [&]() { return www.Pt3l()                   ; } );
+    eventvariables.add("Mjj"            , [&]() { return www.Mjj()                    ; } );
+    eventvariables.add("DetajjL"        , [&]() { return www.DetajjL()                ; } );
+    eventvariables.add("MET"            , [&]() { return www.met_pt()                 ; } );
+}
@@ -0,0 +1,60 @@
+#ifndef eventvariables_h
+#define eventvariables_h
+
+#include "wwwtree.h"
+#include "rooutil/rooutil.h"
+#include "scalefactors.h"
+#include <vector>
+#include <map>
+#include <functional>
+
+//_______________________________________________________________________________________________________
+// Registry of the named event variables that are shared between histograms (e.g. "MllSS" for the MllSS, MllSS_wide, MllZ and
+// MllZZoom binnings)
+// The variable functions handed out by get() evaluate their variable at most once per event and return the cached value to every
+// other histogram (and every cut the histogram is booked at) that uses it.
+class EventVariables
+{
+    public:
+        EventVariables();
+
+        // Register a named variable (a name that is already registered keeps its first definition)
+        void add(TString name, std::function<float()> variable);
+
+        // Variable function for the named variable (to be passed to histograms.addHistogram)
+        std::function<float()> get(TString name);
+
+        // Forget the values of the previous event (to be called before every cutflow.fill())
+        void newEvent()
+        {
+            if (++epoch == 0)
+            {
+                std::fill(epochs.begin(), epochs.end(), 0);
+                epoch = 1;
+            }
+        }
+
+        inline float evaluate(unsigned int ivariable)
+        {
+            if (epochs[ivariable] != epoch)
+            {
+                values[ivariable] = functions[ivariable]();
+                epochs[ivariable] = epoch;
+            }
+            return values[ivariable];
+        }
+
+    private:
+        std::vector<TString> names;
+        std::vector<std::function<float()>> functions;
+        std::vector<unsigned int> epochs;
+        std::vector<float> values;
+        std::map<TString, unsigned int> index;
+        unsigned int epoch;
+};
+
+extern EventVariables eventvariables;
+
+void addEventVariables();
+
+#endif
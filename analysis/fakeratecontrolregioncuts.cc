@@ -4,113 +4,113 @@ void addBtaggedControlRegionCuts(RooUtil::Cutflow& cutflow)
 {
     // Btagged CR for Same-sign Mjj on-W region
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTCRSSmm"              , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return mm_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSmmTVeto"         , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSmmNj2"           , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSmmNbgeq1"        , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSmmMjjW"          , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSmmMjjL"          , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSmmDetajjL"       , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmm"              , cutpredicates.get("SSmm")                                                                    , [&]() { return mm_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmmTVeto"         , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmmNj2"           , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmmNbgeq1"        , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmmMjjW"          , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmmMjjL"          , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmmDetajjL"       , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCRSSmmMET"           , [&]() { return 1.                                                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSmmMllSS"         , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSmmMllSS"         , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCRSSmmFull"          , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTCRSSem"              , [&]() { return (www.passSSem())*(www.MllSS()>30.)                                 ; }        , [&]() { return em_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemTVeto"         , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemNj2"           , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemNbgeq1"        , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemMjjW"          , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemMjjL"          , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemDetajjL"       , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemMET"           , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemMllSS"         , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSemMTmax"         , [&]() { return www.MTmax()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSem"              , cutpredicates.get("SSem")                                                                    , [&]() { return em_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemTVeto"         , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemNj2"           , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemNbgeq1"        , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemMjjW"          , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemMjjL"          , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemDetajjL"       , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemMET"           , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemMllSS"         , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSemMTmax"         , cutpredicates.get("MTmax90")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCRSSemFull"          , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTCRSSee"              , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return ee_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeZeeVt"         , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeTVeto"         , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeNj2"           , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeNbgeq1"        , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeMjjW"          , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeMjjL"          , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeDetajjL"       , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeMET"           , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSeeMllSS"         , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSee"              , cutpredicates.get("SSee")                                                                    , [&]() { return ee_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeZeeVt"         , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeTVeto"         , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeNj2"           , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeNbgeq1"        , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeMjjW"          , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeMjjL"          , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeDetajjL"       , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeMET"           , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSeeMllSS"         , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCRSSeeFull"          , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
     // Same-sign Mjj off-W region
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemm"          , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return mm_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmTVeto"     , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmNj2"       , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmNbgeq1"    , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmMjjW"      , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmMjjL"      , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmDetajjL"   , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmMET"       , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSidemmMllSS"     , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemm"          , cutpredicates.get("SSmm")                                                                    , [&]() { return mm_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmTVeto"     , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmNj2"       , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmNbgeq1"    , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmMjjW"      , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmMjjL"      , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmDetajjL"   , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmMET"       , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSidemmMllSS"     , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCRSSSidemmFull"      , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideem"          , [&]() { return (www.passSSem())*(www.MllSS()>30.)                                 ; }        , [&]() { return em_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemTVeto"     , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemNj2"       , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemNbgeq1"    , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemMjjW"      , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemMjjL"      , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemDetajjL"   , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemMET"       , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemMllSS"     , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideemMTmax"     , [&]() { return www.MTmax()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideem"          , cutpredicates.get("SSem")                                                                    , [&]() { return em_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemTVeto"     , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemNj2"       , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemNbgeq1"    , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemMjjW"      , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemMjjL"      , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemDetajjL"   , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemMET"       , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemMllSS"     , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideemMTmax"     , cutpredicates.get("MTmax90")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCRSSSideemFull"      , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideee"          , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return ee_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeZeeVt"     , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeTVeto"     , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeNj2"       , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeNbgeq1"    , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeMjjW"      , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeMjjL"      , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeDetajjL"   , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeMET"       , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCRSSSideeeMllSS"     , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideee"          , cutpredicates.get("SSee")                                                                    , [&]() { return ee_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeZeeVt"     , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeTVeto"     , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeNj2"       , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeNbgeq1"    , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeMjjW"      , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeMjjL"      , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeDetajjL"   , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeMET"       , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCRSSSideeeMllSS"     , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCRSSSideeeFull"      , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
     // Trilep regions
     cutflow.getCut("CutSRTrilep")                                                                                                             ;
     cutflow.addCutToLastActiveCut("BTCR0SFOS"             , [&]() { return (www.nSFOS()==0)                                                   ; }        , [&]() { return threelep_sf           ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR0SFOSNj1"          , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR0SFOSNbgeq1"       , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR0SFOSNj1"          , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR0SFOSNbgeq1"       , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR0SFOSPt3l"         , [&]() { return 1.                                                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR0SFOSDPhi3lMET"    , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR0SFOSDPhi3lMET"    , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR0SFOSMET"          , [&]() { return www.met_pt()>30.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR0SFOSMll"          , [&]() { return www.Mll3L() > 20.                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR0SFOSM3l"          , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR0SFOSMll"          , cutpredicates.get("Mll3L20")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR0SFOSM3l"          , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR0SFOSZVt"          , [&]() { return abs(www.Mee3L()-91.1876) > 15.                                     ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR0SFOSMTmax"        , [&]() { return www.MTmax3L()>90.                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR0SFOSFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRTrilep")                                                                                                             ;
     cutflow.addCutToLastActiveCut("BTCR1SFOS"             , [&]() { return (www.nSFOS()==1)                                                   ; }        , [&]() { return threelep_sf           ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR1SFOSNj1"          , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR1SFOSNbgeq1"       , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR1SFOSPt3l"         , [&]() { return www.Pt3l()>60.                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR1SFOSDPhi3lMET"    , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR1SFOSNj1"          , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR1SFOSNbgeq1"       , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR1SFOSPt3l"         , cutpredicates.get("Pt3l60")                                                                  , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR1SFOSDPhi3lMET"    , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR1SFOSMET"          , [&]() { return www.met_pt()>40.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR1SFOSMll"          , [&]() { return www.Mll3L() > 20.                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR1SFOSM3l"          , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR1SFOSZVt"          , [&]() { return www.nSFOSinZ() == 0                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR1SFOSMll"          , cutpredicates.get("Mll3L20")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR1SFOSM3l"          , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR1SFOSZVt"          , cutpredicates.get("NSFOSinZ0")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR1SFOSMT3rd"        , [&]() { return www.MT3rd()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR1SFOSFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRTrilep")                                                                                                             ;
     cutflow.addCutToLastActiveCut("BTCR2SFOS"             , [&]() { return (www.nSFOS()==2)                                                   ; }        , [&]() { return threelep_sf           ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR2SFOSNj1"          , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR2SFOSNbgeq1"       , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR2SFOSPt3l"         , [&]() { return www.Pt3l()>60.                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR2SFOSDPhi3lMET"    , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR2SFOSNj1"          , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR2SFOSNbgeq1"       , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR2SFOSPt3l"         , cutpredicates.get("Pt3l60")                                                                  , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR2SFOSDPhi3lMET"    , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR2SFOSMET"          , [&]() { return www.met_pt()>55.                                                   ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR2SFOSMll"          , [&]() { return (www.Mll3L() > 20. && www.Mll3L1() > 20.)                          ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR2SFOSM3l"          , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTCR2SFOSZVt"          , [&]() { return www.nSFOSinZ() == 0                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR2SFOSM3l"          , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTCR2SFOSZVt"          , cutpredicates.get("NSFOSinZ0")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTCR2SFOSFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
 }
@@ -119,32 +119,32 @@ void addLowMETControlRegionCuts(RooUtil::Cutflow& cutflow)
 {
     // Low MET mjj side band
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("LXECRSSmm"             , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return mm_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSmmTVeto"        , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSmmNj2"          , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSmmNb0"          , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSmmMjjW"         , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSmm"             , cutpredicates.get("SSmm")                                                                    , [&]() { return mm_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSmmTVeto"        , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSmmNj2"          , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSmmNb0"          , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSmmMjjW"         , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXECRSSmmMET"          , [&]() { return www.met_pt()<60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSmmMllSS"        , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSmmMllSS"        , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXECRSSmmFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("LXECRSSem"             , [&]() { return (www.passSSem())*(www.MllSS()>30.)                                 ; }        , [&]() { return em_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSemTVeto"        , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSemNj2"          , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSemNb0"          , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSemMjjW"         , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSem"             , cutpredicates.get("SSem")                                                                    , [&]() { return em_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSemTVeto"        , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSemNj2"          , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSemNb0"          , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSemMjjW"         , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXECRSSemMET"          , [&]() { return www.met_pt()<60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSemMllSS"        , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSemMllSS"        , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXECRSSemFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutSRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("LXECRSSee"             , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return ee_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSeeZeeVt"        , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSeeTVeto"        , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSeeNj2"          , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSeeNb0"          , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSeeMjjW"         , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSee"             , cutpredicates.get("SSee")                                                                    , [&]() { return ee_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSeeZeeVt"        , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSeeTVeto"        , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSeeNj2"          , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSeeNb0"          , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSeeMjjW"         , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXECRSSeeMET"          , [&]() { return www.met_pt()<60. and fabs(www.MllSS()-91.1876)>10.                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXECRSSeeMllSS"        , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXECRSSeeMllSS"        , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXECRSSeeFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
 }
@@ -153,113 +153,113 @@ void addBtaggedApplicationRegionCuts(RooUtil::Cutflow& cutflow)
 {
     // Btagged CR for Same-sign Mjj on-W region
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmm"            , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmmTVeto"       , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmmNj2"         , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmmNbgeq1"      , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmmMjjW"        , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmmMjjL"        , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmmDetajjL"     , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmm"            , cutpredicates.get("SSmm")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmmTVeto"       , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmmNj2"         , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmmNbgeq1"      , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmmMjjW"        , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmmMjjL"        , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmmDetajjL"     , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCRSSmmMET"         , [&]() { return 1.                                                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSmmMllSS"       , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSmmMllSS"       , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCRSSmmFull"        , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTARCRSSem"            , [&]() { return (www.passSSem())*(www.MllSS()>30.)                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemTVeto"       , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemNj2"         , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemNbgeq1"      , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemMjjW"        , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemMjjL"        , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemDetajjL"     , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemMET"         , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemMllSS"       , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSemMTmax"       , [&]() { return www.MTmax()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSem"            , cutpredicates.get("SSem")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemTVeto"       , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemNj2"         , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemNbgeq1"      , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemMjjW"        , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemMjjL"        , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemDetajjL"     , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemMET"         , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemMllSS"       , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSemMTmax"       , cutpredicates.get("MTmax90")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCRSSemFull"        , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTARCRSSee"            , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeZeeVt"       , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeTVeto"       , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeNj2"         , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeNbgeq1"      , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeMjjW"        , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeMjjL"        , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeDetajjL"     , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeMET"         , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSeeMllSS"       , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSee"            , cutpredicates.get("SSee")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeZeeVt"       , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeTVeto"       , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeNj2"         , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeNbgeq1"      , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeMjjW"        , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeMjjL"        , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeDetajjL"     , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeMET"         , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSeeMllSS"       , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCRSSeeFull"        , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
     // B-tagging CR application region
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemm"        , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmTVeto"   , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmNj2"     , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmNbgeq1"  , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMjjW"    , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMjjL"    , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmDetajjL" , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMET"     , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMllSS"   , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemm"        , cutpredicates.get("SSmm")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmTVeto"   , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmNj2"     , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmNbgeq1"  , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMjjW"    , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMjjL"    , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmDetajjL" , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMET"     , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSidemmMllSS"   , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCRSSSidemmFull"    , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideem"        , [&]() { return (www.passSSem())*(www.MllSS()>30.)                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemTVeto"   , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemNj2"     , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemNbgeq1"  , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemMjjW"    , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemMjjL"    , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemDetajjL" , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemMET"     , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemMllSS"   , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideemMTmax"   , [&]() { return www.MTmax()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideem"        , cutpredicates.get("SSem")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemTVeto"   , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemNj2"     , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemNbgeq1"  , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemMjjW"    , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemMjjL"    , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemDetajjL" , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemMET"     , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemMllSS"   , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideemMTmax"   , cutpredicates.get("MTmax90")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCRSSSideemFull"    , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideee"        , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeZeeVt"   , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeTVeto"   , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeNj2"     , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeNbgeq1"  , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMjjW"    , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMjjL"    , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeDetajjL" , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMET"     , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMllSS"   , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideee"        , cutpredicates.get("SSee")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeZeeVt"   , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeTVeto"   , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeNj2"     , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeNbgeq1"  , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMjjW"    , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMjjL"    , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeDetajjL" , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMET"     , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCRSSSideeeMllSS"   , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCRSSSideeeFull"    , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
     // Trilep regions
     cutflow.getCut("CutARTrilep")                                                                                                             ;
     cutflow.addCutToLastActiveCut("BTARCR0SFOS"           , [&]() { return (www.nSFOS()==0)                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR0SFOSNj1"        , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR0SFOSNbgeq1"     , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR0SFOSNj1"        , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR0SFOSNbgeq1"     , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR0SFOSPt3l"       , [&]() { return 1.                                                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR0SFOSDPhi3lMET"  , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR0SFOSDPhi3lMET"  , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR0SFOSMET"        , [&]() { return www.met_pt()>30.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR0SFOSMll"        , [&]() { return www.Mll3L() > 20.                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR0SFOSM3l"        , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR0SFOSMll"        , cutpredicates.get("Mll3L20")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR0SFOSM3l"        , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR0SFOSZVt"        , [&]() { return abs(www.Mee3L()-91.1876) > 15.                                     ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR0SFOSMTmax"      , [&]() { return www.MTmax3L()>90.                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR0SFOSFull"       , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARTrilep")                                                                                                             ;
     cutflow.addCutToLastActiveCut("BTARCR1SFOS"           , [&]() { return (www.nSFOS()==1)                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR1SFOSNj1"        , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR1SFOSNbgeq1"     , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR1SFOSPt3l"       , [&]() { return www.Pt3l()>60.                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR1SFOSDPhi3lMET"  , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR1SFOSNj1"        , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR1SFOSNbgeq1"     , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR1SFOSPt3l"       , cutpredicates.get("Pt3l60")                                                                  , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR1SFOSDPhi3lMET"  , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR1SFOSMET"        , [&]() { return www.met_pt()>40.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR1SFOSMll"        , [&]() { return www.Mll3L() > 20.                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR1SFOSM3l"        , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR1SFOSZVt"        , [&]() { return www.nSFOSinZ() == 0                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR1SFOSMll"        , cutpredicates.get("Mll3L20")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR1SFOSM3l"        , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR1SFOSZVt"        , cutpredicates.get("NSFOSinZ0")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR1SFOSMT3rd"      , [&]() { return www.MT3rd()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR1SFOSFull"       , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARTrilep")                                                                                                             ;
     cutflow.addCutToLastActiveCut("BTARCR2SFOS"           , [&]() { return (www.nSFOS()==2)                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR2SFOSNj1"        , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR2SFOSNbgeq1"     , [&]() { return www.nb()>=1                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR2SFOSPt3l"       , [&]() { return www.Pt3l()>60.                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR2SFOSDPhi3lMET"  , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR2SFOSNj1"        , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR2SFOSNbgeq1"     , cutpredicates.get("Nb1")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR2SFOSPt3l"       , cutpredicates.get("Pt3l60")                                                                  , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR2SFOSDPhi3lMET"  , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR2SFOSMET"        , [&]() { return www.met_pt()>55.                                                   ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR2SFOSMll"        , [&]() { return (www.Mll3L() > 20. && www.Mll3L1() > 20.)                          ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR2SFOSM3l"        , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("BTARCR2SFOSZVt"        , [&]() { return www.nSFOSinZ() == 0                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR2SFOSM3l"        , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("BTARCR2SFOSZVt"        , cutpredicates.get("NSFOSinZ0")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("BTARCR2SFOSFull"       , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
 }
@@ -268,32 +268,32 @@ void addLowMETApplicationRegionCuts(RooUtil::Cutflow& cutflow)
 {
     // Low MET mjj side band
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSmm"           , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSmmTVeto"      , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSmmNj2"        , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSmmNb0"        , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSmmMjjW"       , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSmm"           , cutpredicates.get("SSmm")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSmmTVeto"      , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSmmNj2"        , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSmmNb0"        , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSmmMjjW"       , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXEARCRSSmmMET"        , [&]() { return www.met_pt()<60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSmmMllSS"      , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSmmMllSS"      , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXEARCRSSmmFull"       , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSem"           , [&]() { return (www.passSSem())*(www.MllSS()>30.)                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSemTVeto"      , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSemNj2"        , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSemNb0"        , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSemMjjW"       , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSem"           , cutpredicates.get("SSem")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSemTVeto"      , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSemNj2"        , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSemNb0"        , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSemMjjW"       , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXEARCRSSemMET"        , [&]() { return www.met_pt()<60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSemMllSS"      , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSemMllSS"      , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXEARCRSSemFull"       , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutARDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSee"           , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSeeZeeVt"      , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSeeTVeto"      , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSeeNj2"        , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSeeNb0"        , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSeeMjjW"       , [&]() { return fabs(www.Mjj()-80.)>=15.                                           ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSee"           , cutpredicates.get("SSee")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSeeZeeVt"      , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSeeTVeto"      , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSeeNj2"        , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSeeNb0"        , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSeeMjjW"       , cutpredicates.get("MjjSide")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXEARCRSSeeMET"        , [&]() { return www.met_pt()<60. and fabs(www.MllSS()-91.1876)>10.                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LXEARCRSSeeMllSS"      , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LXEARCRSSeeMllSS"      , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LXEARCRSSeeFull"       , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
 }
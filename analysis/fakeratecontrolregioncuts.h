@@ -4,6 +4,7 @@
 #include "wwwtree.h"
 #include "globalvariables.h"
 #include "rooutil/rooutil.h"
+#include "cutpredicates.h"
 
 void addBtaggedControlRegionCuts(RooUtil::Cutflow& cutflow);
 void addLowMETControlRegionCuts(RooUtil::Cutflow& cutflow);
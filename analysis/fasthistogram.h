@@ -0,0 +1,128 @@
+#ifndef fasthistogram_h
+#define fasthistogram_h
+
+#include "TString.h"
+#include "TH1.h"
+#include "TH1F.h"
+#include "TH1D.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Header only so that it can also be used by the fake rate looper (fakerate/process.cc)
+
+//_______________________________________________________________________________________________________
+// Binning of a histogram with the bin lookup of the fill hot path
+// Fixed size bins are found with the same arithmetic as TAxis::FindFixBin() written with selects instead of branches,
+// variable size bins with a binary search of the boundaries. The bin numbering is the one of TAxis (0 underflow,
+// 1..nbins, nbins + 1 overflow) and every value, bin edges and NaN included, lands in the same bin as with TH1::Fill.
+class FastAxis
+{
+    public:
+        FastAxis() : nbins(0), min(0), max(0) {}
+        FastAxis(unsigned int nbins_, double min_, double max_) : nbins(nbins_), min(min_), max(max_) {}
+        FastAxis(const std::vector<float>& boundaries_) : nbins(boundaries_.size() - 1), min(boundaries_.front()), max(boundaries_.back()), boundaries(boundaries_.begin(), boundaries_.end()) {}
+
+        inline unsigned int findBin(double x) const
+        {
+            if (not boundaries.empty())
+                return std::upper_bound(boundaries.begin(), boundaries.end(), x) - boundaries.begin();
+            // 1 + int(nbins * (x - min) / (max - min)) in range, 0 if x < min, nbins + 1 if not x < max (so a NaN goes to the
+            // overflow). The clamp only keeps the conversion to int defined outside the range, it does not change the bins in it.
+            double u = std::min(std::max(-1., nbins * (x - min) / (max - min)), (double) nbins);
+            unsigned int bin = 1 + (int) u;
+            bin = x < min ? 0 : bin;
+            return x < max ? bin : nbins + 1;
+        }
+
+        // 1 for the bins of the range (those counted in the statistics of a TH1), 0 for the under/overflow
+        inline double inRange(unsigned int bin) const { return bin - 1u < nbins; }
+
+        unsigned int getNbins() const { return nbins; }
+
+        // An empty ROOT histogram with the same binning (not attached to any directory)
+        template <class TH> TH* createHistogram(TString name) const
+        {
+            TH* hist = boundaries.empty() ? new TH(name, name, nbins, min, max) : new TH(name, name, nbins, boundaries.data());
+            hist->SetDirectory(0);
+            hist->Sumw2();
+            return hist;
+        }
+
+        // Set the contents of a histogram of this binning from sums of weights stored every stride values (e.g. one of several
+        // variations stored together) and the statistics (entries, sumw, sumw2, sumwx, sumwx2) of the bins in range
+        void setContents(TH1* hist, const double* sumw, const double* sumw2, unsigned int stride, const double* stats) const
+        {
+            for (unsigned int ibin = 0; ibin < nbins + 2; ++ibin)
+            {
+                hist->SetBinContent(ibin, sumw[ibin * stride]);
+                hist->SetBinError(ibin, sqrt(sumw2[ibin * stride]));
+            }
+            double th1stats[4] = {stats[1], stats[2], stats[3], stats[4]};
+            hist->PutStats(th1stats);
+            hist->SetEntries(stats[0]);
+        }
+
+    private:
+        unsigned int nbins;
+        double min;
+        double max;
+        std::vector<double> boundaries; // variable bin boundaries (empty for fixed size bins)
+};
+
+//_______________________________________________________________________________________________________
+// Histogram of the event loop with flat arrays of the sums of weights instead of a TH1
+// The statistics are kept as TH1::Fill() does (entries of all the bins, sums of the bins in range), so the TH1F/TH1D
+// made at the end has the same contents up to float rounding for a TH1F: the sums are kept in double precision and rounded
+// once when written, where TH1F::Fill() rounds the bin contents at every fill.
+class FastHistogram
+{
+    public:
+        static const unsigned int kNStats = 5;
+
+        FastHistogram(TString name_, unsigned int nbins, double min, double max) : name(name_), axis(nbins, min, max) { reset(); }
+        FastHistogram(TString name_, const std::vector<float>& boundaries) : name(name_), axis(boundaries) { reset(); }
+        FastHistogram(TString name_, const FastAxis& axis_) : name(name_), axis(axis_) { reset(); }
+
+        inline void fill(double x, double w = 1.)
+        {
+            unsigned int bin = axis.findBin(x);
+            double win = w * axis.inRange(bin);
+            sumw[bin] += w;
+            sumw2[bin] += w * w;
+            stats[0] += 1;
+            stats[1] += win;
+            stats[2] += win * w;
+            stats[3] += win * x;
+            stats[4] += win * x * x;
+        }
+
+        TH1F* toTH1F() const { return toTH1<TH1F>(); }
+        TH1D* toTH1D() const { return toTH1<TH1D>(); }
+
+        void reset()
+        {
+            sumw.assign(axis.getNbins() + 2, 0);
+            sumw2.assign(axis.getNbins() + 2, 0);
+            std::fill(stats, stats + kNStats, 0);
+        }
+
+        const TString& getName() const { return name; }
+        const FastAxis& getAxis() const { return axis; }
+
+    private:
+        template <class TH> TH* toTH1() const
+        {
+            TH* hist = axis.createHistogram<TH>(name);
+            axis.setContents(hist, sumw.data(), sumw2.data(), 1, stats);
+            return hist;
+        }
+
+        TString name;
+        FastAxis axis;
+        std::vector<double> sumw;  // nbins + 2 (with the under/overflow)
+        std::vector<double> sumw2;
+        double stats[kNStats];
+};
+
+#endif
@@ -0,0 +1,54 @@
+#include "flatcuttree.h"
+
+//_______________________________________________________________________________________________________
+FlatCutTree::FlatCutTree(RooUtil::CutTree& root) : epoch(1)
+{
+    flatten(&root, -1);
+
+    // From now on the Cutflow reads the results of the flat evaluation
+    for (unsigned int icut = 0; icut < nodes.size(); ++icut)
+    {
+        if (not pass_funcs[icut] or not weight_funcs[icut])
+            continue;
+        nodes[icut]->pass_this_cut_func = [this, icut]() { return pass(icut); };
+        nodes[icut]->weight_this_cut_func = [this, icut]() { return weight(icut); };
+    }
+}
+
+//_______________________________________________________________________________________________________
+void FlatCutTree::flatten(RooUtil::CutTree* node, int parent)
+{
+    unsigned int icut = nodes.size();
+    nodes.push_back(node);
+    parents.push_back(parent);
+    subtree_end.push_back(0);
+    pass_funcs.push_back(node->pass_this_cut_func);
+    weight_funcs.push_back(node->weight_this_cut_func);
+    passes.push_back(true);
+    weights.push_back(1);
+    pass_epochs.push_back(0);
+    weight_epochs.push_back(0);
+    for (auto& child : node->children)
+        flatten(child, icut);
+    subtree_end[icut] = nodes.size();
+}
+
+//_______________________________________________________________________________________________________
+int FlatCutTree::getIndex(TString name) const
+{
+    for (unsigned int icut = 0; icut < nodes.size(); ++icut)
+        if (nodes[icut]->name == name)
+            return icut;
+    return -1;
+}
+
+//_______________________________________________________________________________________________________
+void FlatCutTree::newEvent()
+{
+    if (++epoch == 0)
+    {
+        std::fill(pass_epochs.begin(), pass_epochs.end(), 0);
+        std::fill(weight_epochs.begin(), weight_epochs.end(), 0);
+        epoch = 1;
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef flatcuttree_h
+#define flatcuttree_h
+
+#include "rooutil/rooutil.h"
+#include <vector>
+#include <functional>
+#include <algorithm>
+
+//_______________________________________________________________________________________________________
+// Flat version of the cut tree of a RooUtil::Cutflow with the results of the cuts cached per event
+// Only used by the multi-weight histograms (multiweight=1), which walk its arrays laid out in depth-first order (parent
+// index, index after the subtree, cut and weight functions) to follow the cuts of every variation down the tree. The cut
+// and weight functions of the nodes in the Cutflow are replaced by lookups of the cached results, so each cut is evaluated
+// at most once per event whether Cutflow::fill() or the multi-weight histograms reach it first.
+class FlatCutTree
+{
+    public:
+        FlatCutTree(RooUtil::CutTree& root);
+
+        // Forget the results of the previous event (to be called before every cutflow.fill())
+        void newEvent();
+
+        inline bool pass(unsigned int icut)
+        {
+            if (pass_epochs[icut] != epoch)
+            {
+                passes[icut] = pass_funcs[icut]();
+                pass_epochs[icut] = epoch;
+            }
+            return passes[icut];
+        }
+
+        inline float weight(unsigned int icut)
+        {
+            if (weight_epochs[icut] != epoch)
+            {
+                weights[icut] = weight_funcs[icut]();
+                weight_epochs[icut] = epoch;
+            }
+            return weights[icut];
+        }
+
+        unsigned int size() const { return parents.size(); }
+
+        // Structure of the flattened tree (e.g. for the multi-weight histograms that follow the cuts of a variation down the tree)
+        int getParent(unsigned int icut) const { return parents[icut]; }
+        unsigned int getSubtreeEnd(unsigned int icut) const { return subtree_end[icut]; }
+        bool hasPass(unsigned int icut) const { return bool(pass_funcs[icut]); }
+        bool hasWeight(unsigned int icut) const { return bool(weight_funcs[icut]); }
+        const TString& getName(unsigned int icut) const { return nodes[icut]->name; }
+        int getIndex(TString name) const;
+
+    private:
+        void flatten(RooUtil::CutTree* node, int parent);
+
+        std::vector<RooUtil::CutTree*> nodes;
+        std::vector<int> parents;              // index of the parent node (-1 for the root)
+        std::vector<unsigned int> subtree_end; // index after the last node of the subtree
+        std::vector<std::function<bool()>> pass_funcs;
+        std::vector<std::function<float()>> weight_funcs;
+        std::vector<char> passes;
+        std::vector<float> weights;
+        std::vector<unsigned int> pass_epochs;
+        std::vector<unsigned int> weight_epochs;
+        unsigned int epoch;
+};
+
+#endif
@@ -31,5 +31,23 @@ bool is2016_v122;
 
 float lumi;
 
-std::map<TString, std::function<bool()>> systematic_cuts;
-std::map<TString, std::function<float()>> systematic_wgts;
+int nBranchTraceEvents;
+int nBlockSize;
+int nPrefetchBlocks;
+bool useBlockCuts;
+bool checkBlockCuts;
+bool useInlineLeptons;
+int nWorkers;
+Long64_t firstEntryToProcess;
+Long64_t lastEntryToProcess;
+int nCheckpointEvents;
+int nCheckpointSeconds;
+int nStopAtCheckpoint;
+TString checkpointFileName;
+bool useEventLists;
+bool useMultiWeightHistograms;
+bool writeEmptyHistograms;
+bool doFillTiming;
+bool doJER;
+TString scaleFactorBundleFileName;
+int nTheoryWeightThreads;
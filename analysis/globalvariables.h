@@ -36,7 +36,25 @@ extern bool is2016_v122;
 
 extern float lumi;
 
-extern std::map<TString, std::function<bool()>> systematic_cuts;
-extern std::map<TString, std::function<float()>> systematic_wgts;
+extern int nBranchTraceEvents;
+extern int nBlockSize;
+extern int nPrefetchBlocks;
+extern bool useBlockCuts;
+extern bool checkBlockCuts;
+extern bool useInlineLeptons;
+extern int nWorkers;
+extern Long64_t firstEntryToProcess;
+extern Long64_t lastEntryToProcess;
+extern int nCheckpointEvents;
+extern int nCheckpointSeconds;
+extern int nStopAtCheckpoint;
+extern TString checkpointFileName;
+extern bool useEventLists;
+extern bool useMultiWeightHistograms;
+extern bool writeEmptyHistograms;
+extern bool doFillTiming;
+extern bool doJER;
+extern TString scaleFactorBundleFileName;
+extern int nTheoryWeightThreads;
 
 #endif
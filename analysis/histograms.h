@@ -4,7 +4,37 @@
 #include "rooutil/rooutil.h"
 #include "wwwtree.h"
 #include "scalefactors.h"
+#include "eventvariables.h"
 
+//_______________________________________________________________________________________________________
+// Definitions of the histograms (name, binning and variable) of the analysis
+// They are booked either as RooUtil::Histograms in the cutflow or as multi-weight histograms (see MultiWeightHistograms)
+class HistogramDefinitions
+{
+    public:
+        struct Definition
+        {
+            TString name;
+            unsigned int nbins;
+            float min;
+            float max;
+            std::vector<float> boundaries; // variable bin boundaries (empty for fixed size bins from min to max)
+            std::function<float()> variable;
+        };
+
+        void addHistogram(TString name, unsigned int nbins, float min, float max, std::function<float()> variable);
+        void addHistogram(TString name, std::vector<float> boundaries, std::function<float()> variable);
+
+        // Histogram of a named event variable, evaluated once per event for all the histograms of the variable (see EventVariables)
+        void addHistogram(TString name, unsigned int nbins, float min, float max, TString variable) { addHistogram(name, nbins, min, max, eventvariables.get(variable)); }
+
+        // The same histograms for the RooUtil::Cutflow
+        RooUtil::Histograms getRooUtilHistograms() const;
+
+        std::vector<Definition> definitions;
+};
+
+HistogramDefinitions createHistogramDefinitions();
 RooUtil::Histograms createHistograms();
 
 #ifndef __CINT__
@@ -0,0 +1,141 @@
+#include "jetvariationcuts.h"
+
+JetVariationCuts jetvariationcuts;
+
+//_______________________________________________________________________________________________________
+JetVariationCuts::JetVariationCuts() : passes(kNVariations * kMaxCuts, false), epoch(1), evaluated_epoch(0)
+{
+}
+
+//_______________________________________________________________________________________________________
+void JetVariationCuts::add(TString name, std::function<bool(const Variables&)> cut, std::function<float()> weight)
+{
+    if (index.find(name) != index.end())
+        return;
+    if (cuts.size() == kMaxCuts)
+    {
+        printf("[JetVariationCuts::add] Cannot register %s, already %d cuts registered\n", name.Data(), kMaxCuts);
+        exit(1);
+    }
+    index[name] = cuts.size();
+    names.push_back(name);
+    cuts.push_back(cut);
+    weights.push_back(weight);
+}
+
+//_______________________________________________________________________________________________________
+unsigned int JetVariationCuts::getIndex(TString name)
+{
+    if (index.find(name) == index.end())
+    {
+        printf("[JetVariationCuts::getIndex] No jet variation cut %s registered (see addJetVariationCuts())\n", name.Data());
+        exit(1);
+    }
+    return index[name];
+}
+
+//_______________________________________________________________________________________________________
+std::function<bool()> JetVariationCuts::get(TString name, Variation variation)
+{
+    unsigned int ipass = variation * kMaxCuts + getIndex(name);
+    if (std::find(variations.begin(), variations.end(), variation) == variations.end())
+        variations.push_back(variation);
+    return [this, ipass]() { return pass(ipass); };
+}
+
+//_______________________________________________________________________________________________________
+std::function<float()> JetVariationCuts::getWeight(TString name)
+{
+    return weights[getIndex(name)];
+}
+
+//_______________________________________________________________________________________________________
+void JetVariationCuts::evaluate()
+{
+    // The variables of a variation are read once and every cut is evaluated with them
+    evaluated_epoch = epoch;
+    Variables variables;
+    for (auto& variation : variations)
+    {
+        setVariables(variation, variables);
+        char* variation_passes = &passes[variation * kMaxCuts];
+        for (unsigned int icut = 0; icut < cuts.size(); ++icut)
+            variation_passes[icut] = cuts[icut](variables);
+    }
+}
+
+//_______________________________________________________________________________________________________
+TString JetVariationCuts::getName(Variation variation)
+{
+    switch (variation)
+    {
+        case kNominal:  return "Nominal";
+        case kJESUp:    return "JESUp";
+        case kJESDown:  return "JESDown";
+        case kJER:      return "JER";
+        case kJERUp:    return "JERUp";
+        case kJERDown:  return "JERDown";
+        default:        return "";
+    }
+}
+
+//_______________________________________________________________________________________________________
+void JetVariationCuts::setVariables(Variation variation, Variables& v)
+{
+    switch (variation)
+    {
+        case kNominal:
+            v.Mjj = www.Mjj();       v.MjjL = www.MjjL();       v.DetajjL = www.DetajjL();       v.met_pt = www.met_pt();       v.DPhi3lMET = www.DPhi3lMET();
+            v.nj = www.nj();         v.nj30 = www.nj30();       v.nb = www.nb();
+            break;
+        case kJESUp:
+            v.Mjj = www.Mjj_up();    v.MjjL = www.MjjL_up();    v.DetajjL = www.DetajjL_up();    v.met_pt = www.met_up_pt();    v.DPhi3lMET = www.DPhi3lMET_up();
+            v.nj = www.nj_up();      v.nj30 = www.nj30_up();    v.nb = www.nb_up();
+            break;
+        case kJESDown:
+            v.Mjj = www.Mjj_dn();    v.MjjL = www.MjjL_dn();    v.DetajjL = www.DetajjL_dn();    v.met_pt = www.met_dn_pt();    v.DPhi3lMET = www.DPhi3lMET_dn();
+            v.nj = www.nj_dn();      v.nj30 = www.nj30_dn();    v.nb = www.nb_dn();
+            break;
+        case kJER:
+            v.Mjj = www.Mjj_jer();   v.MjjL = www.MjjL_jer();   v.DetajjL = www.DetajjL_jer();   v.met_pt = www.met_jer_pt();   v.DPhi3lMET = www.DPhi3lMET_jer();
+            v.nj = www.nj_jer();     v.nj30 = www.nj30_jer();   v.nb = www.nb_jer();
+            break;
+        case kJERUp:
+            v.Mjj = www.Mjj_jerup(); v.MjjL = www.MjjL_jerup(); v.DetajjL = www.DetajjL_jerup(); v.met_pt = www.met_jerup_pt(); v.DPhi3lMET = www.DPhi3lMET_jerup();
+            v.nj = www.nj_jerup();   v.nj30 = www.nj30_jerup(); v.nb = www.nb_jerup();
+            break;
+        case kJERDown:
+            v.Mjj = www.Mjj_jerdn(); v.MjjL = www.MjjL_jerdn(); v.DetajjL = www.DetajjL_jerdn(); v.met_pt = www.met_jerdn_pt(); v.DPhi3lMET = www.DPhi3lMET_jerdn();
+            v.nj = www.nj_jerdn();   v.nj30 = www.nj30_jerdn(); v.nb = www.nb_jerdn();
+            break;
+        default:
+            break;
+    }
+}
+
+//_______________________________________________________________________________________________________
+void addJetVariationCuts()
+{
+    // Cuts of the regions that depend on the jets or the MET, written against the variables of a jet variation
+    typedef const JetVariationCuts::Variables& V;
+    jetvariationcuts.add("Pass"         , [&](V v) { return 1                                                   ; } , UNITY );
+    jetvariationcuts.add("MjjW"         , [&](V v) { return fabs(v.Mjj-80.)<15.                                 ; } , UNITY );
+    jetvariationcuts.add("MjjSide"      , [&](V v) { return fabs(v.Mjj-80.)>=15.                                ; } , UNITY );
+    jetvariationcuts.add("MjjL"         , [&](V v) { return v.MjjL<400.                                         ; } , UNITY );
+    jetvariationcuts.add("DetajjL"      , [&](V v) { return v.DetajjL<1.5                                       ; } , UNITY );
+    jetvariationcuts.add("VBF"          , [&](V v) { return v.MjjL > 400 or v.DetajjL > 1.5                     ; } , UNITY );
+    jetvariationcuts.add("MET30"        , [&](V v) { return v.met_pt>30.                                        ; } , UNITY );
+    jetvariationcuts.add("MET40"        , [&](V v) { return v.met_pt>40.                                        ; } , UNITY );
+    jetvariationcuts.add("MET55"        , [&](V v) { return v.met_pt>55.                                        ; } , UNITY );
+    jetvariationcuts.add("MET60"        , [&](V v) { return v.met_pt>60.                                        ; } , UNITY );
+    jetvariationcuts.add("METlt60"      , [&](V v) { return v.met_pt<60.                                        ; } , UNITY );
+    jetvariationcuts.add("METlt60ZeeVt" , [&](V v) { return v.met_pt<60. and fabs(www.MllSS()-91.1876)>10.      ; } , UNITY );
+    jetvariationcuts.add("DPhi3lMET"    , [&](V v) { return v.DPhi3lMET>2.5                                     ; } , UNITY );
+    jetvariationcuts.add("Nj2"          , [&](V v) { return v.nj30>= 2                                          ; } , UNITY );
+    jetvariationcuts.add("Nj4"          , [&](V v) { return v.nj30>= 4                                          ; } , UNITY );
+    jetvariationcuts.add("Nj1"          , [&](V v) { return v.nj<=1                                             ; } , UNITY );
+    jetvariationcuts.add("NjLeq2"       , [&](V v) { return v.nj<=2                                             ; } , UNITY );
+    jetvariationcuts.add("Nb0"          , [&](V v) { return v.nb==0                                             ; } , [&]() { return btag_sf ; } );
+    jetvariationcuts.add("Nb1"          , [&](V v) { return v.nb>=1                                             ; } , [&]() { return btag_sf ; } );
+    jetvariationcuts.add("NbEq1"        , [&](V v) { return v.nb==1                                             ; } , [&]() { return btag_sf ; } );
+}
@@ -0,0 +1,81 @@
+#ifndef jetvariationcuts_h
+#define jetvariationcuts_h
+
+#include "wwwtree.h"
+#include "globalvariables.h"
+#include "rooutil/rooutil.h"
+#include <vector>
+#include <map>
+#include <functional>
+#include <algorithm>
+
+//_______________________________________________________________________________________________________
+// Cuts on the jet and MET variables that are varied by the jet energy scale and resolution systematics
+// A cut is written once against the variables of a jet variation (e.g. v.Mjj instead of www.Mjj_up(), www.Mjj_dn(), ...)
+// and is evaluated with the branches of each variation in use (JESUp, JESDown, JER, JERUp, JERDown). All the cuts are
+// evaluated for all the variations in one pass the first time any of them is needed in an event. The cut functions handed
+// out by get() read the result and are passed to cutflow.setCutSyst().
+class JetVariationCuts
+{
+    public:
+        enum Variation { kNominal, kJESUp, kJESDown, kJER, kJERUp, kJERDown, kNVariations };
+
+        // Variables of the jets and the MET for a given variation
+        struct Variables
+        {
+            float Mjj;
+            float MjjL;
+            float DetajjL;
+            float met_pt;
+            float DPhi3lMET;
+            int nj;
+            int nj30;
+            int nb;
+        };
+
+        JetVariationCuts();
+
+        // Register a named cut with the weight applied along with it (a name that is already registered keeps its first definition)
+        void add(TString name, std::function<bool(const Variables&)> cut, std::function<float()> weight);
+
+        // Cut function and weight of the named cut evaluated with the variables of a variation (to be passed to cutflow.setCutSyst)
+        std::function<bool()> get(TString name, Variation variation);
+        std::function<float()> getWeight(TString name);
+
+        // Forget the results of the previous event (to be called before every cutflow.fill())
+        void newEvent() { ++epoch; }
+
+        inline bool pass(unsigned int ipass)
+        {
+            if (evaluated_epoch != epoch)
+                evaluate();
+            return passes[ipass];
+        }
+
+        // Name of the variation in the cutflow (e.g. "JESUp")
+        static TString getName(Variation variation);
+
+        // Bind the variables to the branches of a variation
+        static void setVariables(Variation variation, Variables& variables);
+
+    private:
+        unsigned int getIndex(TString name);
+        void evaluate();
+
+        std::vector<TString> names;
+        std::vector<std::function<bool(const Variables&)>> cuts;
+        std::vector<std::function<float()>> weights;
+        std::map<TString, unsigned int> index;
+        std::vector<Variation> variations;            // variations in use (those handed out by get())
+        std::vector<char> passes;                     // result of cut i with variation v at v * kMaxCuts + i
+        unsigned int epoch;
+        unsigned int evaluated_epoch;
+
+        static const unsigned int kMaxCuts = 64;
+};
+
+extern JetVariationCuts jetvariationcuts;
+
+void addJetVariationCuts();
+
+#endif
@@ -4,71 +4,71 @@ void addLostLepControlRegionCuts(RooUtil::Cutflow& cutflow)
 {
     // Same-sign WZ CR
     cutflow.getCut("CutWZCRDilep")                                                                                                            ;
-    cutflow.addCutToLastActiveCut("WZCRSSmm"              , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return threelep_sf ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSmmTVeto"         , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSmmNj2"           , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSmmNb0"           , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSmmMjjL"          , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSmmDetajjL"       , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSmm"              , cutpredicates.get("SSmm")                                                                    , [&]() { return threelep_sf ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSmmTVeto"         , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSmmNj2"           , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSmmNb0"           , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSmmMjjL"          , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSmmDetajjL"       , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCRSSmmMET"           , [&]() { return 1.                                                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSmmMllSS"         , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSmmMllSS"         , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCRSSmmFull"          , [&]() { return hasz_ss                                                            ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutWZCRDilep")                                                                                                            ;
-    cutflow.addCutToLastActiveCut("WZCRSSem"              , [&]() { return (www.passSSem())*(www.MllSS()>30.)                                 ; }        , [&]() { return threelep_sf ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemTVeto"         , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemNj2"           , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemNb0"           , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemMjjL"          , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemDetajjL"       , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemMET"           , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemMllSS"         , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSemMTmax"         , [&]() { return www.MTmax()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSem"              , cutpredicates.get("SSem")                                                                    , [&]() { return threelep_sf ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemTVeto"         , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemNj2"           , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemNb0"           , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemMjjL"          , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemDetajjL"       , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemMET"           , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemMllSS"         , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSemMTmax"         , cutpredicates.get("MTmax90")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCRSSemFull"          , [&]() { return hasz_ss                                                            ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutWZCRDilep")                                                                                                            ;
-    cutflow.addCutToLastActiveCut("WZCRSSee"              , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return threelep_sf ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeZeeVt"         , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeTVeto"         , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeNj2"           , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeNb0"           , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeMjjL"          , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeDetajjL"       , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeMET"           , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCRSSeeMllSS"         , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSee"              , cutpredicates.get("SSee")                                                                    , [&]() { return threelep_sf ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeZeeVt"         , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeTVeto"         , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeNj2"           , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeNb0"           , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeMjjL"          , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeDetajjL"       , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeMET"           , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCRSSeeMllSS"         , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCRSSeeFull"          , [&]() { return hasz_ss                                                            ; }        , [&]() { return 1                     ; } ) ;
 
     // Mjj selection validation region
     cutflow.getCut("WZCRSSeeMllSS");
     cutflow.addCutToLastActiveCut("WZVRSSee"    , [&]() { return hasz_ss;                 } ,  [&]() { return 1; } );
-    cutflow.addCutToLastActiveCut("WZVRSSeeFull", [&]() { return fabs(www.Mjj()-80.)<15.; } ,  [&]() { return 1; } );
+    cutflow.addCutToLastActiveCut("WZVRSSeeFull", cutpredicates.get("MjjW")                 ,  [&]() { return 1; } );
     cutflow.getCut("WZCRSSemMTmax");
     cutflow.addCutToLastActiveCut("WZVRSSem"    , [&]() { return hasz_ss;                 } ,  [&]() { return 1; } );
-    cutflow.addCutToLastActiveCut("WZVRSSemFull", [&]() { return fabs(www.Mjj()-80.)<15.; } ,  [&]() { return 1; } );
+    cutflow.addCutToLastActiveCut("WZVRSSemFull", cutpredicates.get("MjjW")                 ,  [&]() { return 1; } );
     cutflow.getCut("WZCRSSmmMllSS");
     cutflow.addCutToLastActiveCut("WZVRSSmm"    , [&]() { return hasz_ss;                 } ,  [&]() { return 1; } );
-    cutflow.addCutToLastActiveCut("WZVRSSmmFull", [&]() { return fabs(www.Mjj()-80.)<15.; } ,  [&]() { return 1; } );
+    cutflow.addCutToLastActiveCut("WZVRSSmmFull", cutpredicates.get("MjjW")                 ,  [&]() { return 1; } );
 
     // Trilep WZ CR
     cutflow.getCut("CutWZCRTrilep")                                                                                                           ;
     cutflow.addCutToLastActiveCut("WZCR1SFOS"             , [&]() { return (www.nSFOS()==1)                                                   ; }        , [&]() { return threelep_sf           ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR1SFOSNj1"          , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR1SFOSNb0"          , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR1SFOSPt3l"         , [&]() { return www.Pt3l()>60.                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR1SFOSDPhi3lMET"    , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR1SFOSNj1"          , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR1SFOSNb0"          , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR1SFOSPt3l"         , cutpredicates.get("Pt3l60")                                                                  , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR1SFOSDPhi3lMET"    , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR1SFOSMET"          , [&]() { return www.met_pt()>40.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR1SFOSMll"          , [&]() { return www.Mll3L() > 20.                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR1SFOSM3l"          , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR1SFOSMll"          , cutpredicates.get("Mll3L20")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR1SFOSM3l"          , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR1SFOSMT3rd"        , [&]() { return www.MT3rd()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR1SFOSZVt"          , [&]() { return hasz_3l                                                            ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR1SFOSFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutWZCRTrilep")                                                                                                           ;
     cutflow.addCutToLastActiveCut("WZCR2SFOS"             , [&]() { return (www.nSFOS()==2)                                                   ; }        , [&]() { return threelep_sf           ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR2SFOSNj1"          , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR2SFOSNb0"          , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR2SFOSPt3l"         , [&]() { return www.Pt3l()>60.                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR2SFOSDPhi3lMET"    , [&]() { return www.DPhi3lMET()>2.5                                                ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR2SFOSNj1"          , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR2SFOSNb0"          , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR2SFOSPt3l"         , cutpredicates.get("Pt3l60")                                                                  , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR2SFOSDPhi3lMET"    , cutpredicates.get("DPhi3lMET")                                                               , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR2SFOSMET"          , [&]() { return www.met_pt()>55.                                                   ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR2SFOSMll"          , [&]() { return (www.Mll3L() > 20. && www.Mll3L1() > 20.)                          ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("WZCR2SFOSM3l"          , [&]() { return abs(www.M3l()-91.1876) > 10.                                       ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("WZCR2SFOSM3l"          , cutpredicates.get("ZVt3l")                                                                   , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR2SFOSZVt"          , [&]() { return hasz_3l                                                            ; }        , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("WZCR2SFOSFull"         , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
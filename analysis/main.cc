@@ -1,26 +1,547 @@
 #include "main.h"
 
 //_______________________________________________________________________________________________________
-int process(const char* input_paths, const char* input_tree_name, const char* output_file_name, int nEvents, TString regions)
+int process(const char* input_paths, const char* input_tree_name, const char* output_file_names, int nEvents, TString regions, TString options)
 {
-    // Creating output file where we will put the outputs of the processing
-    TFile* ofile = new TFile(output_file_name, "recreate");
+    // The output files can be comma separated as well (e.g. "t_ss_data.root,t_ddfakes_data.root")
+    // Each output is configured from its own file name (see setOutputConfigurationVariables()) and all of them are filled in a single pass over the events
+    // An output can also be restricted to one background category with a ":bkgtype" suffix (e.g. "t_qflip_ttbar.root:qflip,t_fakes_ttbar.root:fakes")
+    std::vector<TString> output_file_name_list;
+    std::vector<TString> output_bkgtype_list;
+    for (auto& output_spec : RooUtil::StringUtil::split(output_file_names, ","))
+    {
+        std::vector<TString> name_and_bkgtype = RooUtil::StringUtil::split(output_spec, ":");
+        output_file_name_list.push_back(name_and_bkgtype[0]);
+        output_bkgtype_list.push_back(name_and_bkgtype.size() > 1 ? name_and_bkgtype[1] : "");
+    }
+
+    // Based on the input file name and the output file name set the global configuration variables
+    setGlobalConfigurationVariables(input_paths, output_file_name_list[0], options);
+    www.SetInlineLeptons(useInlineLeptons);
+
+    // Read the scale factor maps (from the ROOT files in scalefactors/, or from the bundle made with "packsf" if given)
+    scalefactortable.load(scaleFactorBundleFileName);
+
+    // Range of entries [first, last) of the chain to process
+    // The edges given by the options are moved to the start of their TTree cluster so that adjacent shards of a large input
+    // (e.g. first=0,last=500000 and first=500000,last=1000000) never decompress the same basket twice
+    TChain* ch = RooUtil::FileUtil::createTChain(input_tree_name, input_paths);
+    Long64_t nEntries = ch->GetEntries();
+    Long64_t firstEntry = BlockLooper::getClusterStart(ch, firstEntryToProcess);
+    Long64_t lastEntry = lastEntryToProcess < 0 ? nEntries : BlockLooper::getClusterStart(ch, lastEntryToProcess);
+    if (nEvents >= 0)
+        lastEntry = std::min(lastEntry, firstEntry + nEvents);
+
+    // Theory weight normalizations of the files with entries in the range, read once here (before the workers are forked, so they
+    // all inherit them) instead of at each new file of the event loop
+    if (not isData) theoryweight.loadFiles(ch, firstEntry, lastEntry, nTheoryWeightThreads);
+    delete ch;
+    std::cout <<  " Processing entries [" << firstEntry << ", " << lastEntry << ") out of " << nEntries << std::endl;
+
+    // Split the events over several worker processes (each one with its own shard of the outputs)
+    if (nWorkers > 1)
+        return processWithWorkers(input_paths, input_tree_name, output_file_name_list, output_bkgtype_list, firstEntry, lastEntry, regions);
 
+    return processEntries(input_paths, input_tree_name, output_file_name_list, output_bkgtype_list, firstEntry, lastEntry - firstEntry, regions);
+}
+
+//_______________________________________________________________________________________________________
+int processEntries(const char* input_paths, const char* input_tree_name, std::vector<TString> output_file_name_list, std::vector<TString> output_bkgtype_list, Long64_t firstEntry, Long64_t nEvents, TString regions)
+{
     // Create a TChain of the input files
     // The input files can be comma separated (e.g. "file1.root,file2.root")
     TChain* ch = RooUtil::FileUtil::createTChain(input_tree_name, input_paths);
 
-    // Create a Looper object to loop over input files
-    RooUtil::Looper<wwwtree> looper(ch, &www, nEvents);
+    // Create the cutflow and histograms for each output
+    std::vector<AnalysisOutput> outputs;
+    for (unsigned int ioutput = 0; ioutput < output_file_name_list.size(); ++ioutput)
+    {
+        const TString& output_file_name = output_file_name_list[ioutput];
 
-    // Based on the input file name and the output file name set the global configuration variables
-    setGlobalConfigurationVariables(input_paths, output_file_name);
+        AnalysisOutput output;
+        output.name = output_file_name;
+        output.bkgtype = output_bkgtype_list[ioutput];
+
+        // The cuts and the systematics that are booked depend on the mode of the output
+        setOutputConfigurationVariables(output_file_name);
+        output.doFakeEstimation = doFakeEstimation;
+        output.doEwkSubtraction = doEwkSubtraction;
+        output.nFilled = 0;
+        output.cutflowFillSeconds = 0;
+        output.histogramFillSeconds = 0;
+
+        // Creating output file where we will put the outputs of the processing
+        output.ofile = new TFile(output_file_name, "recreate");
+
+        // Cutflow utility object that creates a tree structure of cuts
+        output.cutflow = new RooUtil::Cutflow(output.ofile);
+
+        // Histogram utility object that is used to define the histograms
+        output.histograms = new RooUtil::Histograms(createHistograms());
+
+        // Adding a whole bunch of cuts!
+        addCuts(*output.cutflow);
+
+        // Now book the cutflow and histogram jobs
+        bookCutflowsAndHistogramsForGivenRegions(*output.cutflow, *output.histograms, regions);
+
+        // Flat arrays of the booked cut tree with the results of the cuts cached per event (shared by the cutflow and the multi-weight histograms)
+        output.flatcuttree = useMultiWeightHistograms ? new FlatCutTree(output.cutflow->cuttree) : 0;
+
+        // Histograms with all the systematic variations filled together (instead of the histograms of the cutflow)
+        output.multiweighthistograms = 0;
+        if (doHistogram and useMultiWeightHistograms)
+        {
+            output.multiweighthistograms = new MultiWeightHistograms(*output.flatcuttree, createHistogramDefinitions());
+            output.multiweighthistograms->setWriteEmptyHistograms(writeEmptyHistograms);
+            bookMultiWeightHistogramsForGivenRegions(*output.multiweighthistograms, *output.cutflow, regions);
+        }
+
+        // Print the cut structure for review
+        output.cutflow->printCuts();
+
+        outputs.push_back(output);
+    }
+
+    // For cutflow challenge, load the list of eventlist.txt
+    RooUtil::EventList eventlist("eventlist.txt");
+
+    // Periodic checkpoints of the outputs, and resume from the last one if a previous run of the same job was interrupted
+    Long64_t nEntries = ch->GetEntries();
+    Long64_t lastEntry = nEvents < 0 ? nEntries : std::min(nEntries, firstEntry + nEvents);
+    Checkpoint checkpoint;
+    checkpoint.file_name = checkpointFileName.IsNull() ? getCheckpointFileName(output_file_name_list[0]) : checkpointFileName;
+    checkpoint.chain = ch;
+    checkpoint.first_entry = firstEntry;
+    checkpoint.last_entry = lastEntry;
+    checkpoint.loop_entry = (nCheckpointEvents > 0 or nCheckpointSeconds > 0) ? readCheckpoint(outputs, checkpoint) : firstEntry;
+
+    // Loop over the events either one by one or in blocks of entries with the flat branches read in columns
+    // (a range of entries not starting from the first one and prefetching can only be done with the block looper)
+    if (nBlockSize > 0 or checkpoint.loop_entry > 0 or nPrefetchBlocks > 0)
+    {
+        BlockLooper looper(ch, &www, lastEntry - checkpoint.loop_entry, nBlockSize, checkpoint.loop_entry, nPrefetchBlocks);
+        if (useBlockCuts) looper.selectColumns(cutpredicates.getColumnBranches());
+        loopEvents(looper, outputs, eventlist, checkpoint);
+    }
+    else
+    {
+        RooUtil::Looper<wwwtree> looper(ch, &www, nEvents);
+        loopEvents(looper, outputs, eventlist, checkpoint);
+    }
+
+    // Consistency check of the block evaluation of the cut predicates against their evaluation per event
+    int status = 0;
+    if (checkBlockCuts)
+    {
+        std::cout << "CutPredicates: " << cutpredicates.getNBlockChecks() << " predicate results read from the block bitmasks, " << cutpredicates.getNBlockMismatches() << " differ from the evaluation per event" << std::endl;
+        if (cutpredicates.getNBlockMismatches() > 0)
+            status = 1;
+    }
+
+    // Record which entries went into the outputs so that merging shards of the same input can be checked (see checkEntryRanges())
+    // (only for the outputs of a part of the input, i.e. with the first/last options or as the shard of a worker)
+    if (nWorkers > 1 or firstEntryToProcess > 0 or lastEntryToProcess >= 0)
+    {
+        for (auto& output : outputs)
+        {
+            writeEntryRange(output.ofile, firstEntry, lastEntry, nEntries);
+        }
+    }
+
+    // Save output
+    for (auto& output : outputs)
+    {
+        if (output.multiweighthistograms) output.multiweighthistograms->saveOutput(output.ofile);
+        output.cutflow->saveOutput();
+    }
+
+    // The outputs are complete, so a checkpoint left over would only make a rerun of the job skip events
+    if (not gSystem->AccessPathName(checkpoint.file_name))
+        gSystem->Unlink(checkpoint.file_name);
+
+    // TString eventlist_output_file_name = output_file_name;
+    // eventlist_output_file_name.ReplaceAll(".root", "_eventlist.txt");
+    // cutflow.getCut("WZCRSSemFull").writeEventList(eventlist_output_file_name);
+
+    return status;
+}
+
+//_______________________________________________________________________________________________________
+int processWithWorkers(const char* input_paths, const char* input_tree_name, std::vector<TString> output_file_name_list, std::vector<TString> output_bkgtype_list, Long64_t firstEntry, Long64_t lastEntry, TString regions)
+{
+    // Every cut, weight and histogram is a lambda bound to the global wwwtree instance, the global event variables and the scale factor tools.
+    // So the event context of each worker is its own copy of those, obtained by forking the process once the configuration is set.
+    // Each worker loops over a contiguous range of entries and writes its own shard of every output, which are then merged into the outputs.
+    // The edges between the workers are aligned to the TTree clusters as well.
+    TChain* ch = RooUtil::FileUtil::createTChain(input_tree_name, input_paths);
+    Long64_t nEntries = ch->GetEntries();
+    std::vector<Long64_t> edges;
+    for (int iworker = 0; iworker <= nWorkers; ++iworker)
+    {
+        Long64_t edge = firstEntry + (lastEntry - firstEntry) * iworker / nWorkers;
+        edges.push_back((iworker == 0 or iworker == nWorkers) ? edge : std::max(firstEntry, BlockLooper::getClusterStart(ch, edge)));
+    }
+    delete ch;
+
+    std::vector<pid_t> pids;
+    for (int iworker = 0; iworker < nWorkers; ++iworker)
+    {
+        Long64_t workerFirstEntry = edges[iworker];
+        Long64_t workerLastEntry = edges[iworker + 1];
+
+        // Flush so that the buffered printouts are not repeated by the worker
+        std::cout << std::flush;
+        fflush(stdout);
+
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            std::cout << "Error: failed to fork worker " << iworker << std::endl;
+            exit(1);
+        }
+        else if (pid == 0)
+        {
+            // Worker: open its own chain and outputs and process its range of entries
+            std::cout << "Worker " << iworker << " processing entries [" << workerFirstEntry << ", " << workerLastEntry << ")" << std::endl;
+            std::vector<TString> shard_file_name_list;
+            for (auto& output_file_name : output_file_name_list)
+                shard_file_name_list.push_back(getShardFileName(output_file_name, iworker));
+            if (not checkpointFileName.IsNull())
+                checkpointFileName = getShardFileName(checkpointFileName, iworker);
+            exit(processEntries(input_paths, input_tree_name, shard_file_name_list, output_bkgtype_list, workerFirstEntry, workerLastEntry - workerFirstEntry, regions));
+        }
+        pids.push_back(pid);
+    }
+
+    // Wait for all the workers to finish
+    bool failed = false;
+    for (auto& pid : pids)
+    {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (not WIFEXITED(status) or WEXITSTATUS(status) != 0)
+            failed = true;
+    }
+    if (failed)
+    {
+        std::cout << "Error: at least one of the workers failed. The shards are left in place and the outputs are not written." << std::endl;
+        return 1;
+    }
+
+    // Merge the shards (the cutflow and the histograms are all added up)
+    for (auto& output_file_name : output_file_name_list)
+    {
+        TFileMerger merger(kFALSE);
+        merger.OutputFile(output_file_name, "RECREATE");
+        for (int iworker = 0; iworker < nWorkers; ++iworker)
+            merger.AddFile(getShardFileName(output_file_name, iworker));
+        if (not merger.Merge())
+        {
+            std::cout << "Error: failed to merge the shards of " << output_file_name << std::endl;
+            return 1;
+        }
+        if (not checkEntryRanges(output_file_name, firstEntry, lastEntry, nEntries))
+        {
+            std::cout << "Error: the shards merged into " << output_file_name << " do not cover the entries [" << firstEntry << ", " << lastEntry << ") of the " << nEntries << " entries of the input exactly once" << std::endl;
+            return 1;
+        }
+        for (int iworker = 0; iworker < nWorkers; ++iworker)
+            gSystem->Unlink(getShardFileName(output_file_name, iworker));
+    }
+
+    return 0;
+}
+
+//_______________________________________________________________________________________________________
+void writeEntryRange(TFile* ofile, Long64_t firstEntry, Long64_t lastEntry, Long64_t nEntries)
+{
+    // One row per processed range of entries [first, last) out of the nentries of the input chain
+    // hadd/TFileMerger concatenate the rows, so a merged output holds the ranges of all of its shards
+    ofile->cd();
+    TTree* entryranges = new TTree("entryranges", "Ranges of input entries processed");
+    entryranges->Branch("first", &firstEntry, "first/L");
+    entryranges->Branch("last", &lastEntry, "last/L");
+    entryranges->Branch("nentries", &nEntries, "nentries/L");
+    entryranges->Fill();
+    entryranges->Write();
+}
+
+//_______________________________________________________________________________________________________
+bool checkEntryRanges(TString output_file_name, Long64_t firstEntry, Long64_t lastEntry, Long64_t nEntries)
+{
+    // Check that the ranges recorded in the output cover [firstEntry, lastEntry) without gaps or overlaps, all of them out of the
+    // nEntries of the same input (checkentryranges.py does the same for [0, nentries) after merging jobs over parts of an input)
+    TFile* file = TFile::Open(output_file_name);
+    if (not file)
+        return false;
+    TTree* entryranges = (TTree*) file->Get("entryranges");
+    if (not entryranges)
+    {
+        file->Close();
+        delete file;
+        return false;
+    }
+    Long64_t first = 0;
+    Long64_t last = 0;
+    Long64_t rangeEntries = 0;
+    entryranges->SetBranchAddress("first", &first);
+    entryranges->SetBranchAddress("last", &last);
+    entryranges->SetBranchAddress("nentries", &rangeEntries);
+    std::vector<std::pair<Long64_t, Long64_t>> ranges;
+    bool sameinput = true;
+    for (Long64_t irange = 0; irange < entryranges->GetEntries(); ++irange)
+    {
+        entryranges->GetEntry(irange);
+        ranges.push_back(std::make_pair(first, last));
+        sameinput = sameinput and rangeEntries == nEntries;
+    }
+    file->Close();
+    delete file;
+    if (not sameinput or lastEntry > nEntries)
+        return false;
+    std::sort(ranges.begin(), ranges.end());
+    Long64_t covered = firstEntry;
+    for (auto& range : ranges)
+    {
+        if (range.first != covered)
+            return false;
+        covered = range.second;
+    }
+    return covered == lastEntry;
+}
+
+//_______________________________________________________________________________________________________
+TString getShardFileName(TString output_file_name, int iworker)
+{
+    // e.g. "t_ss_data.root" -> "t_ss_data_shard3.root" (the mode substrings like "ddfakes" are kept)
+    TString shard_file_name = output_file_name;
+    shard_file_name.ReplaceAll(".root", TString::Format("_shard%d.root", iworker));
+    return shard_file_name;
+}
+
+//_______________________________________________________________________________________________________
+TString getCheckpointFileName(TString output_file_name)
+{
+    // e.g. "t_ss_data.root" -> "t_ss_data_checkpoint.root"
+    TString checkpoint_file_name = output_file_name;
+    checkpoint_file_name.ReplaceAll(".root", "_checkpoint.root");
+    return checkpoint_file_name;
+}
+
+//_______________________________________________________________________________________________________
+bool isCheckpointDue(int nEventsSinceCheckpoint, std::chrono::steady_clock::time_point lastCheckpointTime)
+{
+    if (nCheckpointEvents > 0 and nEventsSinceCheckpoint >= nCheckpointEvents)
+        return true;
+    // The clock is only looked at every 1000 events
+    if (nCheckpointSeconds > 0 and nEventsSinceCheckpoint % 1000 == 0)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - lastCheckpointTime;
+        return elapsed.count() >= nCheckpointSeconds;
+    }
+    return false;
+}
 
-    // Cutflow utility object that creates a tree structure of cuts
-    RooUtil::Cutflow cutflow(ofile);
+//_______________________________________________________________________________________________________
+void writeCheckpoint(std::vector<AnalysisOutput>& outputs, Checkpoint& checkpoint, Long64_t nextEntry)
+{
+    // The checkpoint holds the range of entries of the job, the entry to resume from and the last entry processed in each file of the chain,
+    // as well as a copy of every histogram (cutflows included) of each output as filled up to nextEntry (not the event lists of the
+    // cuts, which are therefore not booked when checkpointing, see useEventLists).
+    // It is written next to its final location and then renamed, so an interruption while writing leaves the previous checkpoint intact.
+    // The current directory is put back afterwards (TContext) since the checkpoint file becomes the current directory while it is open.
+    TDirectory::TContext context;
+    TString tmp_file_name = checkpoint.file_name + ".tmp";
+    TFile* file = new TFile(tmp_file_name, "recreate");
+
+    Long64_t firstEntry = checkpoint.first_entry;
+    Long64_t lastEntry = checkpoint.last_entry;
+    Long64_t nEntries = checkpoint.chain->GetEntries();
+    TTree* range = new TTree("range", "Range of entries of the job and entry to resume from");
+    range->Branch("first", &firstEntry, "first/L");
+    range->Branch("last", &lastEntry, "last/L");
+    range->Branch("next", &nextEntry, "next/L");
+    range->Branch("nentries", &nEntries, "nentries/L");
+    range->Fill();
+    file->WriteTObject(range);
 
-    // Histogram utility object that is used to define the histograms
-    RooUtil::Histograms histograms = createHistograms();
+    char fileName[4096];
+    Long64_t fileEntries = 0;
+    Long64_t lastFileEntry = 0;
+    TTree* files = new TTree("files", "Last entry processed in each file of the chain (-1 if none)");
+    files->Branch("file", fileName, "file/C");
+    files->Branch("nentries", &fileEntries, "nentries/L");
+    files->Branch("last", &lastFileEntry, "last/L");
+    TObjArray* chainfiles = checkpoint.chain->GetListOfFiles();
+    Long64_t* offsets = checkpoint.chain->GetTreeOffset();
+    for (int ifile = 0; ifile < chainfiles->GetEntries(); ++ifile)
+    {
+        snprintf(fileName, sizeof(fileName), "%s", chainfiles->At(ifile)->GetTitle());
+        fileEntries = offsets[ifile + 1] - offsets[ifile];
+        lastFileEntry = std::min(std::max(nextEntry - offsets[ifile], (Long64_t) 0), fileEntries) - 1;
+        files->Fill();
+    }
+    file->WriteTObject(files);
+
+    for (unsigned int ioutput = 0; ioutput < outputs.size(); ++ioutput)
+    {
+        TDirectory* dir = file->mkdir(TString::Format("output%d", ioutput), outputs[ioutput].name);
+        writeCheckpointHistograms(outputs[ioutput].ofile, dir);
+        if (outputs[ioutput].multiweighthistograms)
+            outputs[ioutput].multiweighthistograms->writeCheckpoint(dir->mkdir("multiweight"));
+    }
+
+    file->Close();
+    delete file;
+    gSystem->Rename(tmp_file_name, checkpoint.file_name);
+    std::cout << "Checkpoint: wrote " << checkpoint.file_name << " to resume from entry " << nextEntry << std::endl;
+}
+
+//_______________________________________________________________________________________________________
+void writeCheckpointHistograms(TDirectory* from, TDirectory* to)
+{
+    TIter next(from->GetList());
+    while (TObject* obj = next())
+    {
+        if (obj->InheritsFrom("TH1"))
+            to->WriteTObject(obj);
+        else if (obj->InheritsFrom("TDirectory"))
+            writeCheckpointHistograms((TDirectory*) obj, to->mkdir(obj->GetName()));
+    }
+}
+
+//_______________________________________________________________________________________________________
+bool readCheckpointHistograms(TDirectory* to, TDirectory* from)
+{
+    // TH1::Add onto the reset histogram restores the contents, errors, entries and statistics exactly as they were saved
+    TIter next(to->GetList());
+    while (TObject* obj = next())
+    {
+        if (obj->InheritsFrom("TH1"))
+        {
+            TH1* saved = (TH1*) from->Get(obj->GetName());
+            if (not saved)
+                return false;
+            TH1* hist = (TH1*) obj;
+            hist->Reset();
+            hist->Add(saved);
+            delete saved;
+        }
+        else if (obj->InheritsFrom("TDirectory"))
+        {
+            TDirectory* subdir = from->GetDirectory(obj->GetName());
+            if (not subdir or not readCheckpointHistograms((TDirectory*) obj, subdir))
+                return false;
+        }
+    }
+    return true;
+}
+
+//_______________________________________________________________________________________________________
+Long64_t readCheckpoint(std::vector<AnalysisOutput>& outputs, Checkpoint& checkpoint)
+{
+    // Returns the entry to start the loop from (the first entry of the range if there is no checkpoint of this job to resume from)
+    if (gSystem->AccessPathName(checkpoint.file_name))
+        return checkpoint.first_entry;
+
+    TDirectory::TContext context;
+    TFile* file = TFile::Open(checkpoint.file_name);
+    TTree* range = file ? (TTree*) file->Get("range") : 0;
+    TTree* files = file ? (TTree*) file->Get("files") : 0;
+    if (not range or not files or range->GetEntries() != 1)
+    {
+        std::cout << "Checkpoint: " << checkpoint.file_name << " is not readable, starting from the beginning" << std::endl;
+        if (file)
+        {
+            file->Close();
+            delete file;
+        }
+        return checkpoint.first_entry;
+    }
+
+    // Only resume a checkpoint written by the same job: same range of entries of the same files
+    Long64_t firstEntry = 0;
+    Long64_t lastEntry = 0;
+    Long64_t nextEntry = 0;
+    Long64_t nEntries = 0;
+    range->SetBranchAddress("first", &firstEntry);
+    range->SetBranchAddress("last", &lastEntry);
+    range->SetBranchAddress("next", &nextEntry);
+    range->SetBranchAddress("nentries", &nEntries);
+    range->GetEntry(0);
+    bool matches = firstEntry == checkpoint.first_entry and lastEntry == checkpoint.last_entry and nEntries == checkpoint.chain->GetEntries();
+
+    char fileName[4096];
+    Long64_t fileEntries = 0;
+    files->SetBranchAddress("file", fileName);
+    files->SetBranchAddress("nentries", &fileEntries);
+    TObjArray* chainfiles = checkpoint.chain->GetListOfFiles();
+    Long64_t* offsets = checkpoint.chain->GetTreeOffset();
+    matches = matches and files->GetEntries() == chainfiles->GetEntries();
+    for (int ifile = 0; matches and ifile < chainfiles->GetEntries(); ++ifile)
+    {
+        files->GetEntry(ifile);
+        matches = TString(fileName).EqualTo(chainfiles->At(ifile)->GetTitle()) and fileEntries == offsets[ifile + 1] - offsets[ifile];
+    }
+
+    for (unsigned int ioutput = 0; matches and ioutput < outputs.size(); ++ioutput)
+    {
+        TDirectory* dir = file->GetDirectory(TString::Format("output%d", ioutput));
+        matches = dir and TString(dir->GetTitle()).EqualTo(outputs[ioutput].name) and readCheckpointHistograms(outputs[ioutput].ofile, dir);
+        MultiWeightHistograms* multiweighthistograms = outputs[ioutput].multiweighthistograms;
+        if (matches and multiweighthistograms)
+            matches = dir->GetDirectory("multiweight") and multiweighthistograms->readCheckpoint(dir->GetDirectory("multiweight"));
+    }
+    file->Close();
+    delete file;
+
+    if (not matches)
+    {
+        // Some histograms may have been restored before the mismatch was found
+        std::cout << "Checkpoint: " << checkpoint.file_name << " was written by a different job, starting from the beginning" << std::endl;
+        for (auto& output : outputs)
+        {
+            resetCheckpointHistograms(output.ofile);
+            if (output.multiweighthistograms) output.multiweighthistograms->reset();
+        }
+        return checkpoint.first_entry;
+    }
+
+    std::cout << "Checkpoint: resuming from entry " << nextEntry << " of [" << firstEntry << ", " << lastEntry << ") with the outputs restored from " << checkpoint.file_name << std::endl;
+    return nextEntry;
+}
+
+//_______________________________________________________________________________________________________
+void resetCheckpointHistograms(TDirectory* dir)
+{
+    TIter next(dir->GetList());
+    while (TObject* obj = next())
+    {
+        if (obj->InheritsFrom("TH1"))
+            ((TH1*) obj)->Reset();
+        else if (obj->InheritsFrom("TDirectory"))
+            resetCheckpointHistograms((TDirectory*) obj);
+    }
+}
+
+//_______________________________________________________________________________________________________
+void updateBlockPredicates(BlockLooper& looper)
+{
+    // The column predicates are evaluated once for every block and then read bit by bit for its events
+    if (not useBlockCuts)
+        return;
+    if (looper.isNewBlock())
+        cutpredicates.setBlock(looper.getColumns());
+    cutpredicates.setBlockEntry(looper.getEntryInBlock());
+}
+
+//_______________________________________________________________________________________________________
+void addCuts(RooUtil::Cutflow& cutflow)
+{
+    // The predicates shared between regions (registered once, the same cached results serve every output)
+    addCutPredicates();
+    addJetVariationCuts();
 
     // Adding a whole bunch of cuts!
     addBaseCuts(cutflow);
@@ -38,15 +559,22 @@ int process(const char* input_paths, const char* input_tree_name, const char* ou
 
     // Adding systematic cuts
     addSystematicCuts(cutflow);
+}
 
-    // Now book the cutflow and histogram jobs
-    bookCutflowsAndHistogramsForGivenRegions(cutflow, histograms, regions);
-
-    // Print the cut structure for review
-    cutflow.printCuts();
+//_______________________________________________________________________________________________________
+template <class Looper>
+void loopEvents(Looper& looper, std::vector<AnalysisOutput>& outputs, RooUtil::EventList& eventlist, Checkpoint& checkpoint)
+{
+    // Record which branches the booked cuts and histograms access during the first events
+    // Afterwards every other branch is switched off so that only the used branches are read
+    if (nBranchTraceEvents > 0) www.StartBranchTracing();
+    int nEventsLooped = 0;
 
-    // For cutflow challenge, load the list of eventlist.txt
-    RooUtil::EventList eventlist("eventlist.txt");
+    // Checkpoints are written in between events, once every nCheckpointEvents events or nCheckpointSeconds seconds
+    bool doCheckpoint = nCheckpointEvents > 0 or nCheckpointSeconds > 0;
+    int nEventsSinceCheckpoint = 0;
+    int nCheckpointsWritten = 0;
+    std::chrono::steady_clock::time_point lastCheckpointTime = std::chrono::steady_clock::now();
 
     //
     //
@@ -56,40 +584,107 @@ int process(const char* input_paths, const char* input_tree_name, const char* ou
     while (looper.nextEvent())
     {
 
-        setGlobalEventVariables();
+        if (nBranchTraceEvents > 0 and nEventsLooped++ == nBranchTraceEvents) www.ActivateTracedBranches();
+
+        // With blocks of columns the cut predicates on single branches come from bitmasks evaluated over the whole block
+        updateBlockPredicates(looper);
 
-        // Theory related weights from h_neventsinfile in each input root file but only set files when new file opens
+        // Theory related weights from h_neventsinfile in each input root file but only set files when new file opens (from the table read by loadFiles())
         // NOTE if there was a continue statement prior to this it can mess it up
         if (looper.isNewFileInChain() and not isData) theoryweight.setFile(looper.getCurrentFileName());
 
-        // Set the event list variables
-        cutflow.setEventID(www.run(), www.lumi(), www.evt());
+        // The lepton scale factors and the fake factors of the event are looked up once and shared by every output (and their systematics)
+        leptonScaleFactors.newEvent();
+        fakerates.newEvent();
+
+        // Fill every output with the same event (the branches are only read once since wwwtree caches them for the event)
+        for (auto& output : outputs)
+        {
+            // Outputs for a given background category only receive the events of that category
+            if (not output.bkgtype.IsNull() and not www.bkgtype().EqualTo(output.bkgtype))
+                continue;
+
+            // Switch to the mode of this output and compute the event variables (weights etc.) for it
+            doFakeEstimation = output.doFakeEstimation;
+            doEwkSubtraction = output.doEwkSubtraction;
+            setGlobalEventVariables();
 
-        // Once every cut bits are set, now fill the cutflows that are booked
-        cutflow.fill();
+            RooUtil::Cutflow& cutflow = *output.cutflow;
 
-        // Must come after .fill() so that the cuts are all evaulated
-        if (eventlist.has(www.run(), www.lumi(), www.evt()))
+            // Set the event list variables
+            cutflow.setEventID(www.run(), www.lumi(), www.evt());
+
+            // Once every cut bits are set, now fill the cutflows that are booked
+            // (the shared predicates and systematic weights are reevaluated for each output as they may depend on the mode of the output)
+            cutpredicates.newEvent();
+            eventvariables.newEvent();
+            systematicweights.newEvent();
+            jetvariationcuts.newEvent();
+            if (output.flatcuttree) output.flatcuttree->newEvent();
+            if (doFillTiming)
+            {
+                // Same fills, timed
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                cutflow.fill();
+                std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+                if (output.multiweighthistograms) output.multiweighthistograms->fill();
+                std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+                output.cutflowFillSeconds += std::chrono::duration<double>(middle - start).count();
+                output.histogramFillSeconds += std::chrono::duration<double>(end - middle).count();
+            }
+            else
+            {
+                cutflow.fill();
+                if (output.multiweighthistograms) output.multiweighthistograms->fill();
+            }
+            output.nFilled++;
+
+            // Must come after .fill() so that the cuts are all evaulated
+            if (eventlist.has(www.run(), www.lumi(), www.evt()))
+            {
+                std::cout <<  "***************************" << std::endl;
+                std::cout <<  "**** Cutflow Challenge ****" << std::endl;
+                std::cout <<  "***************************" << std::endl;
+                std::cout <<  " Checking following events:" << std::endl;
+                std::cout <<  " output: " << output.name <<  std::endl;
+                std::cout <<  " www.run(): " << www.run() <<  " www.lumi(): " << www.lumi() <<  " www.evt(): " << www.evt() <<  std::endl;
+                std::cout <<  " Below shows whether it passes or fails the cuts" << std::endl;
+                cutflow.printCuts();
+            }
+        }
+
+        // Save the state of the outputs after this event so that an interrupted job can resume from the next one
+        if (doCheckpoint and isCheckpointDue(++nEventsSinceCheckpoint, lastCheckpointTime))
         {
-            std::cout <<  "***************************" << std::endl;
-            std::cout <<  "**** Cutflow Challenge ****" << std::endl;
-            std::cout <<  "***************************" << std::endl;
-            std::cout <<  " Checking following events:" << std::endl;
-            std::cout <<  " www.run(): " << www.run() <<  " www.lumi(): " << www.lumi() <<  " www.evt(): " << www.evt() <<  std::endl;
-            std::cout <<  " Below shows whether it passes or fails the cuts" << std::endl;
-            cutflow.printCuts();
+            writeCheckpoint(outputs, checkpoint, checkpoint.loop_entry + looper.getNEventsProcessed());
+            nEventsSinceCheckpoint = 0;
+            lastCheckpointTime = std::chrono::steady_clock::now();
+
+            // Interruption right after a checkpoint, without saving or closing anything (to check the resumed job, see validate.sh)
+            if (nStopAtCheckpoint > 0 and ++nCheckpointsWritten == nStopAtCheckpoint)
+            {
+                std::cout << "Checkpoint: stopping after checkpoint " << nCheckpointsWritten << " as if the job was interrupted" << std::endl;
+                _exit(3);
+            }
         }
 
     }
 
-    // Save output
-    cutflow.saveOutput();
-
-    // TString eventlist_output_file_name = output_file_name;
-    // eventlist_output_file_name.ReplaceAll(".root", "_eventlist.txt");
-    // cutflow.getCut("WZCRSSemFull").writeEventList(eventlist_output_file_name);
+    if (doFillTiming) printFillTiming(outputs);
+}
 
-    return 0;
+//_______________________________________________________________________________________________________
+void printFillTiming(std::vector<AnalysisOutput>& outputs)
+{
+    // Per-event overhead of the fills (e.g. to compare the histograms booked in the cutflow with multiweight=1 for the same regions)
+    std::cout <<  " Fill timing per event (in microseconds) " << std::endl;
+    for (auto& output : outputs)
+    {
+        double nFilled = std::max(output.nFilled, (Long64_t) 1);
+        std::cout <<  " output: " << output.name <<  " events: " << output.nFilled;
+        std::cout <<  " cutflow.fill(): " << 1e6 * output.cutflowFillSeconds / nFilled;
+        std::cout <<  " multi-weight histograms: " << 1e6 * output.histogramFillSeconds / nFilled <<  std::endl;
+    }
 }
 
 //_______________________________________________________________________________________________________
@@ -235,7 +830,7 @@ void setGlobalEventVariables()
 }
 
 //_______________________________________________________________________________________________________
-void setGlobalConfigurationVariables(const char* input_paths, const char* output_file_name)
+void setGlobalConfigurationVariables(const char* input_paths, const char* output_file_name, TString options)
 {
     // Some case-by-case checking needed for WWW_v1.2.2 (should be no longer necessary later on)
     is2017 = TString(input_paths).Contains("2017");
@@ -249,13 +844,74 @@ void setGlobalConfigurationVariables(const char* input_paths, const char* output
     // When looping over data and the output_path is set to have a "fakes" substring included we turn on the fake-weight settings
     doSystematics = (not TString(input_paths).Contains("data_"));
     doHistogram = true;
-    doFakeEstimation = TString(output_file_name).Contains("ddfakes") or TString(output_file_name).Contains("ewksubt");
-    doEwkSubtraction = TString(output_file_name).Contains("ewksubt");
+    setOutputConfigurationVariables(output_file_name);
     isData = TString(input_paths).Contains("data_") || TString(input_paths).Contains("Run2017");
 
     // Luminosity setting
     lumi = isData ? 1 : (is2017 == 1 ? 41.3 : 35.9);
 
+    // Number of events used to trace which branches are accessed (0 to read all branches)
+    nBranchTraceEvents = getOption(options, "tracebranches", "1000").Atoi();
+
+    // Number of entries per block, the branches of the block cuts are read in columns (0 to loop event by event with RooUtil::Looper)
+    nBlockSize = getOption(options, "blocksize", "0").Atoi();
+
+    // Evaluate the single branch cut predicates over whole blocks of columns (only with the block looper)
+    useBlockCuts = getOption(options, "blockcuts", "1").Atoi();
+
+    // Check every predicate result read from a block bitmask against the evaluation per event
+    checkBlockCuts = getOption(options, "checkblockcuts", "0").Atoi();
+    cutpredicates.setCheckBlock(checkBlockCuts);
+
+    // Number of blocks read ahead by a separate reader thread (0 to read the blocks in the event loop)
+    nPrefetchBlocks = getOption(options, "prefetch", "0").Atoi();
+
+    // Read the per-lepton vector branches straight into the fixed capacity inline arrays of wwwleptons
+    useInlineLeptons = getOption(options, "inlineleptons", "0").Atoi();
+
+    // Number of worker processes the events are split over (1 to process everything in this process)
+    nWorkers = getOption(options, "workers", "1").Atoi();
+
+    // Range of entries [first, last) of the input chain to process (last=-1 for up to the end)
+    firstEntryToProcess = getOption(options, "first", "0").Atoll();
+    lastEntryToProcess = getOption(options, "last", "-1").Atoll();
+
+    // Checkpoint the outputs every N events and/or S seconds to resume an interrupted job (0 to disable)
+    nCheckpointEvents = getOption(options, "checkpointevents", "0").Atoi();
+    nCheckpointSeconds = getOption(options, "checkpointseconds", "0").Atoi();
+    checkpointFileName = getOption(options, "checkpoint", "");
+
+    // Stop the job abruptly (exit code 3) right after the N-th checkpoint, as an interruption would (0 to run to the end)
+    nStopAtCheckpoint = getOption(options, "stopatcheckpoint", "0").Atoi();
+
+    // Book the event lists of the cuts (off by default with checkpoints, which do not save them, and refused together with them)
+    bool doCheckpoint = nCheckpointEvents > 0 or nCheckpointSeconds > 0;
+    useEventLists = getOption(options, "eventlists", doCheckpoint ? "0" : "1").Atoi();
+    if (useEventLists and doCheckpoint)
+    {
+        printf("[setGlobalConfigurationVariables] The event lists of the cuts are not saved in the checkpoints, run with eventlists=0 to checkpoint\n");
+        exit(1);
+    }
+
+    // Fill all the systematic variations of a histogram together into one array, unpacked into the histograms at the end
+    // (so that the systematic histograms are also affordable with regions=all; multiweight=0 books them in the cutflow instead)
+    useMultiWeightHistograms = getOption(options, "multiweight", "1").Atoi();
+
+    // The multi-weight histograms are only allocated at their first fill: write the ones that were never filled as empty histograms or skip them
+    writeEmptyHistograms = getOption(options, "writeempty", "1").Atoi();
+
+    // Measure the time spent in the cutflow and histogram fills and print it per event at the end of the loop
+    doFillTiming = getOption(options, "timefill", "0").Atoi();
+
+    // Also vary the cuts with the jet energy resolution (JER, JERUp and JERDown) in addition to the jet energy scale
+    doJER = getOption(options, "jer", "0").Atoi();
+
+    // Read the scale factor maps from a bundle made with "packsf" (mapped in memory and shared by the jobs on the node) instead of the ROOT files
+    scaleFactorBundleFileName = getOption(options, "sfbundle", "");
+
+    // Number of threads reading the theory weight normalizations of the input files before the loop (for chains of many small files)
+    nTheoryWeightThreads = getOption(options, "theorythreads", "1").Atoi();
+
     std::cout <<  " Printing configuration " << std::endl;
     std::cout <<  " is2017: " << is2017 <<  std::endl;
     std::cout <<  " isWWW: " << isWWW <<  std::endl;
@@ -267,26 +923,62 @@ void setGlobalConfigurationVariables(const char* input_paths, const char* output
     std::cout <<  " input_paths: " << input_paths <<  std::endl;
     std::cout <<  " output_file_name: " << output_file_name <<  std::endl;
     std::cout <<  " lumi: " << lumi <<  std::endl;
+    std::cout <<  " nBranchTraceEvents: " << nBranchTraceEvents <<  std::endl;
+    std::cout <<  " nBlockSize: " << nBlockSize <<  std::endl;
+    std::cout <<  " useBlockCuts: " << useBlockCuts <<  std::endl;
+    std::cout <<  " checkBlockCuts: " << checkBlockCuts <<  std::endl;
+    std::cout <<  " nPrefetchBlocks: " << nPrefetchBlocks <<  std::endl;
+    std::cout <<  " useInlineLeptons: " << useInlineLeptons <<  std::endl;
+    std::cout <<  " nWorkers: " << nWorkers <<  std::endl;
+    std::cout <<  " firstEntryToProcess: " << firstEntryToProcess <<  std::endl;
+    std::cout <<  " lastEntryToProcess: " << lastEntryToProcess <<  std::endl;
+    std::cout <<  " nCheckpointEvents: " << nCheckpointEvents <<  std::endl;
+    std::cout <<  " nCheckpointSeconds: " << nCheckpointSeconds <<  std::endl;
+    std::cout <<  " nStopAtCheckpoint: " << nStopAtCheckpoint <<  std::endl;
+    std::cout <<  " useEventLists: " << useEventLists <<  std::endl;
+    std::cout <<  " checkpointFileName: " << checkpointFileName <<  std::endl;
+    std::cout <<  " useMultiWeightHistograms: " << useMultiWeightHistograms <<  std::endl;
+    std::cout <<  " writeEmptyHistograms: " << writeEmptyHistograms <<  std::endl;
+    std::cout <<  " doFillTiming: " << doFillTiming <<  std::endl;
+    std::cout <<  " doJER: " << doJER <<  std::endl;
+    std::cout <<  " scaleFactorBundleFileName: " << scaleFactorBundleFileName <<  std::endl;
+    std::cout <<  " nTheoryWeightThreads: " << nTheoryWeightThreads <<  std::endl;
 
 }
 
+//_______________________________________________________________________________________________________
+void setOutputConfigurationVariables(const char* output_file_name)
+{
+    // For fake estimations, we use data-driven method.
+    // When the output_path is set to have a "ddfakes" or "ewksubt" substring included we turn on the fake-weight settings
+    doFakeEstimation = TString(output_file_name).Contains("ddfakes") or TString(output_file_name).Contains("ewksubt");
+    doEwkSubtraction = TString(output_file_name).Contains("ewksubt");
+}
+
+//_______________________________________________________________________________________________________
+TString getOption(TString options, TString key, TString default_value)
+{
+    // Options are provided as comma separated key=value pairs (e.g. "tracebranches=1000")
+    for (auto& option : RooUtil::StringUtil::split(options, ","))
+    {
+        std::vector<TString> keyvalue = RooUtil::StringUtil::split(option, "=");
+        if (keyvalue.size() == 2 and keyvalue[0].EqualTo(key))
+            return keyvalue[1];
+    }
+    return default_value;
+}
+
 //_______________________________________________________________________________________________________
 void bookCutflowsAndHistogramsForGivenRegions(RooUtil::Cutflow& cutflow, RooUtil::Histograms& histograms, TString regions)
 {
     if (regions.EqualTo("all"))
     {
-        // Because I named the end cuts to be "Full" for every one of them, I can use this fact to filter out a chunk more easily
-        // {"SRSSeeFull", "SRSSemFull", .... }
-        // --> {"SRSSee", "SRSSem", .... }
-        std::vector<TString> endcuts = cutflow.cuttree.getEndCuts();
-        std::vector<TString> list_of_cuts;
-        for (auto& endcut : endcuts)
-            list_of_cuts.push_back(endcut.ReplaceAll("Full", ""));
-        // Now replace with "SRSSee,SRSSem,SRSSmm,..."
-        regions = RooUtil::StringUtil::join(list_of_cuts);
+        regions = getAllRegions(cutflow);
 
-        // Also when processing all regios, skip histograms for systematics (to speed things up)
-        cutflow.setSkipSystematicHistograms(true);
+        // Also when processing all regios, skip the histograms for systematics booked in the cutflow (to speed things up)
+        // (the multi-weight histograms of the default multiweight=1 fill them at little extra cost, so they are not skipped)
+        if (not useMultiWeightHistograms)
+            cutflow.setSkipSystematicHistograms(true);
     }
     else if (not regions.IsNull())
     {
@@ -297,10 +989,11 @@ void bookCutflowsAndHistogramsForGivenRegions(RooUtil::Cutflow& cutflow, RooUtil
     cutflow.bookCutflows();
 
     // Book event lists
-    cutflow.bookEventLists();
+    if (useEventLists)
+        cutflow.bookEventLists();
 
     // Histogram booking is dependent on whether you ask for certain regions also when systematics is asked, do not run the entire histogramming otherwise too many will be booked (O(20k) histograms!)
-    if (doHistogram)
+    if (doHistogram and not useMultiWeightHistograms)
     {
         if (not regions.IsNull())
         {
@@ -319,37 +1012,126 @@ void bookCutflowsAndHistogramsForGivenRegions(RooUtil::Cutflow& cutflow, RooUtil
 }
 
 
+//_______________________________________________________________________________________________________
+void bookMultiWeightHistogramsForGivenRegions(MultiWeightHistograms& histograms, RooUtil::Cutflow& cutflow, TString regions)
+{
+    // Same histograms as booked in the cutflow by bookCutflowsAndHistogramsForGivenRegions(), with the variations of the output
+    for (auto& variation : SystematicWeights::getVariations())
+        histograms.addWeightVariation(variation);
+    if (doSystematics)
+    {
+        for (auto& variation : getJetVariations())
+            histograms.addJetVariation(variation, getJetVariedCuts());
+    }
+
+    if (regions.EqualTo("all"))
+        regions = getAllRegions(cutflow);
+
+    if (not regions.IsNull())
+    {
+        for (auto& region : RooUtil::StringUtil::split(regions, ","))
+        {
+            histograms.bookHistogramsForCutAndBelow(region);
+        }
+    }
+    else
+    {
+        histograms.bookHistogramsForEndCuts();
+    }
+}
+
+//_______________________________________________________________________________________________________
+TString getAllRegions(RooUtil::Cutflow& cutflow)
+{
+    // Because I named the end cuts to be "Full" for every one of them, I can use this fact to filter out a chunk more easily
+    // {"SRSSeeFull", "SRSSemFull", .... }
+    // --> {"SRSSee", "SRSSem", .... }
+    std::vector<TString> endcuts = cutflow.cuttree.getEndCuts();
+    std::vector<TString> list_of_cuts;
+    for (auto& endcut : endcuts)
+        list_of_cuts.push_back(endcut.ReplaceAll("Full", ""));
+    // Now replace with "SRSSee,SRSSem,SRSSmm,..."
+    return RooUtil::StringUtil::join(list_of_cuts);
+}
+
 //_______________________________________________________________________________________________________
 int help()
 {
     // Help function
     std::cout << "Usage:" << std::endl;
     std::cout << std::endl;
-    std::cout << "  $ ./process INPUTFILES INPUTTREENAME OUTPUTFILE [NEVENTS]" << std::endl;
+    std::cout << "  $ ./process INPUTFILES INPUTTREENAME OUTPUTFILE [NEVENTS] [REGIONS] [OPTIONS]" << std::endl;
     std::cout << std::endl;
     std::cout << "  INPUTFILES      comma separated file list" << std::endl;
     std::cout << "  INPUTTREENAME   tree name in the file" << std::endl;
-    std::cout << "  OUTPUTFILE      output file name" << std::endl;
+    std::cout << "  OUTPUTFILE      comma separated output file names (all filled in one pass, mode set by \"ddfakes\"/\"ewksubt\" in the name)" << std::endl;
+    std::cout << "                  a \":bkgtype\" suffix only fills the events with www.bkgtype() equal to it (e.g. out.root:fakes)" << std::endl;
     std::cout << "  [NEVENTS=-1]    # of events to run over" << std::endl;
     std::cout << "  [REGIONS]       comma separated regions" << std::endl;
+    std::cout << "  [OPTIONS]       comma separated key=value options" << std::endl;
+    std::cout << "                  tracebranches=N : trace branch usage over first N events and switch off the rest (default 1000, 0 to disable)" << std::endl;
+    std::cout << "                  blocksize=N     : loop over blocks of up to N entries, reading the branches of the block cuts in columns (default 0, event by event)" << std::endl;
+    std::cout << "                  blockcuts=0/1   : evaluate the single branch cut predicates into bitmasks over each block (default 1, with blocksize>0)" << std::endl;
+    std::cout << "                  checkblockcuts=1: check the bitmasks against the evaluation per event, fails if they differ (default 0)" << std::endl;
+    std::cout << "                  prefetch=N      : read up to N blocks ahead in a separate thread, e.g. for babies on NFS (default 0)" << std::endl;
+    std::cout << "                  inlineleptons=1 : use fixed capacity inline arrays for the per-lepton branches (default 0)" << std::endl;
+    std::cout << "                  workers=N       : split the events over N worker processes and merge their outputs (default 1)" << std::endl;
+    std::cout << "                  first=N,last=M  : only process the entries [N, M) of the input, moved to the TTree cluster boundaries and recorded in the entryranges tree of the outputs (default all)" << std::endl;
+    std::cout << "                  checkpointevents=N,checkpointseconds=S : save the outputs every N events and/or S seconds and resume from there after an interruption (default 0)" << std::endl;
+    std::cout << "                  eventlists=0/1  : book the event lists of the cuts, not possible with checkpoints (default 1, 0 with checkpoints)" << std::endl;
+    std::cout << "                  checkpoint=FILE : checkpoint file (default OUTPUTFILE with _checkpoint.root), should be on a disk that survives the interruption" << std::endl;
+    std::cout << "                  stopatcheckpoint=N : stop abruptly with exit code 3 right after the N-th checkpoint, to test the resume (default 0)" << std::endl;
+    std::cout << "                  multiweight=0/1 : fill all the systematic variations of a histogram together, also books them with regions=all (default 1)" << std::endl;
+    std::cout << "                  writeempty=0    : skip the multi-weight histograms that were never filled when writing the output (default 1)" << std::endl;
+    std::cout << "                  timefill=1      : print the time per event spent in the cutflow and histogram fills (default 0)" << std::endl;
+    std::cout << "                  jer=1           : also produce the JER, JERUp and JERDown variations of the jet cuts with the systematics (default 0)" << std::endl;
+    std::cout << "                  sfbundle=FILE   : read the scale factor maps from a bundle made with packsf instead of scalefactors/ (default none)" << std::endl;
+    std::cout << "                  theorythreads=N : read the theory weight normalizations of the input files with N threads before the loop (default 1)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "  $ ./process packsf BUNDLEFILE" << std::endl;
+    std::cout << std::endl;
+    std::cout << "  Packs the scale factor maps of scalefactors/ used by the looper into BUNDLEFILE (to be used with sfbundle=BUNDLEFILE)" << std::endl;
     std::cout << std::endl;
     return 1;
 }
 
+//_______________________________________________________________________________________________________
+int packScaleFactors(TString bundle_file_name)
+{
+    // The maps are registered by the scale factor tools at startup, so the bundle holds exactly the maps of this looper
+    scalefactortable.load();
+    scalefactortable.writeBundle(bundle_file_name);
+    return 0;
+}
+
 //_______________________________________________________________________________________________________
 int main(int argc, char** argv)
 {
-    if (argc == 4)
+    // ROOT has to be told that it is used from several threads before any file is opened
+    // (the prefetching reader thread and the threads reading the theory weight normalizations open their own files)
+    TString options = argc == 7 ? argv[6] : "";
+    if (getOption(options, "prefetch", "0").Atoi() > 0 or getOption(options, "theorythreads", "1").Atoi() > 1)
+        ROOT::EnableThreadSafety();
+
+    if (argc == 3 and TString(argv[1]).EqualTo("packsf"))
     {
-        return process(argv[1], argv[2], argv[3], -1, "");
+        return packScaleFactors(argv[2]);
+    }
+    else if (argc == 4)
+    {
+        return process(argv[1], argv[2], argv[3], -1, "", "");
     }
     else if (argc == 5)
     {
-        return process(argv[1], argv[2], argv[3], atoi(argv[4]), "");
+        return process(argv[1], argv[2], argv[3], atoi(argv[4]), "", "");
     }
     else if (argc == 6)
     {
-        return process(argv[1], argv[2], argv[3], atoi(argv[4]), argv[5]);
+        return process(argv[1], argv[2], argv[3], atoi(argv[4]), argv[5], "");
+    }
+    else if (argc == 7)
+    {
+        return process(argv[1], argv[2], argv[3], atoi(argv[4]), argv[5], argv[6]);
     }
     else
     {
@@ -2,23 +2,84 @@
 #define main_h
 
 #include "wwwtree.h"
+#include "blocklooper.h"
 #include "rooutil/rooutil.h"
+#include "TFileMerger.h"
+#include "TSystem.h"
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
 
 #include "applicationregioncuts.h"
 #include "basecuts.h"
+#include "cutpredicates.h"
+#include "eventvariables.h"
+#include "flatcuttree.h"
 #include "fakeratecontrolregioncuts.h"
 #include "globalvariables.h"
+#include "jetvariationcuts.h"
 #include "histograms.h"
 #include "lostlepcontrolregioncuts.h"
 #include "misccontrolregioncuts.h"
+#include "multiweighthistograms.h"
 #include "promptcontrolregioncuts.h"
 #include "scalefactors.h"
 #include "signalregioncuts.h"
 #include "systematiccuts.h"
+#include "systematicweights.h"
+
+// An output file of the looper with its own cutflow and histograms, filled in the mode set by its file name
+struct AnalysisOutput
+{
+    TString name;
+    TString bkgtype; // only events of this background category are filled (all events if empty)
+    TFile* ofile;
+    RooUtil::Cutflow* cutflow;
+    RooUtil::Histograms* histograms;
+    FlatCutTree* flatcuttree; // only with the multi-weight histograms (0 if the cuts are evaluated by the cutflow itself)
+    MultiWeightHistograms* multiweighthistograms; // 0 if the histograms are booked in the cutflow
+    Long64_t nFilled;            // events filled (the fill timing is only measured with timefill=1)
+    double cutflowFillSeconds;   // in cutflow.fill() (cutflows and the histograms booked in the cutflow)
+    double histogramFillSeconds; // in the fill of the multi-weight histograms
+    bool doFakeEstimation;
+    bool doEwkSubtraction;
+};
+
+// State of the periodic checkpointing of the outputs while looping over [first_entry, last_entry) of the chain
+struct Checkpoint
+{
+    TString file_name;
+    TChain* chain;
+    Long64_t first_entry;
+    Long64_t last_entry;
+    Long64_t loop_entry; // entry the loop started from (first_entry unless resumed from a checkpoint)
+};
 
 bool passTrigger2016();
+int processEntries(const char* input_paths, const char* input_tree_name, std::vector<TString> output_file_name_list, std::vector<TString> output_bkgtype_list, Long64_t firstEntry, Long64_t nEvents, TString regions);
+int processWithWorkers(const char* input_paths, const char* input_tree_name, std::vector<TString> output_file_name_list, std::vector<TString> output_bkgtype_list, Long64_t firstEntry, Long64_t lastEntry, TString regions);
+void printFillTiming(std::vector<AnalysisOutput>& outputs);
+void writeEntryRange(TFile* ofile, Long64_t firstEntry, Long64_t lastEntry, Long64_t nEntries);
+bool checkEntryRanges(TString output_file_name, Long64_t firstEntry, Long64_t lastEntry, Long64_t nEntries);
+TString getShardFileName(TString output_file_name, int iworker);
+TString getCheckpointFileName(TString output_file_name);
+bool isCheckpointDue(int nEventsSinceCheckpoint, std::chrono::steady_clock::time_point lastCheckpointTime);
+void writeCheckpoint(std::vector<AnalysisOutput>& outputs, Checkpoint& checkpoint, Long64_t nextEntry);
+void writeCheckpointHistograms(TDirectory* from, TDirectory* to);
+bool readCheckpointHistograms(TDirectory* to, TDirectory* from);
+Long64_t readCheckpoint(std::vector<AnalysisOutput>& outputs, Checkpoint& checkpoint);
+void resetCheckpointHistograms(TDirectory* dir);
+template <class Looper> void updateBlockPredicates(Looper&) {} // nothing to do without blocks of columns
+void updateBlockPredicates(BlockLooper& looper);
+void addCuts(RooUtil::Cutflow& cutflow);
 void bookCutflowsAndHistogramsForGivenRegions(RooUtil::Cutflow& cutflow, RooUtil::Histograms& histograms, TString regions);
-void setGlobalConfigurationVariables(const char* input_paths, const char* output_file_name);
+void bookMultiWeightHistogramsForGivenRegions(MultiWeightHistograms& histograms, RooUtil::Cutflow& cutflow, TString regions);
+TString getAllRegions(RooUtil::Cutflow& cutflow);
+void setGlobalConfigurationVariables(const char* input_paths, const char* output_file_name, TString options);
+void setOutputConfigurationVariables(const char* output_file_name);
+TString getOption(TString options, TString key, TString default_value);
 void setGlobalEventVariables();
+template <class Looper> void loopEvents(Looper& looper, std::vector<AnalysisOutput>& outputs, RooUtil::EventList& eventlist, Checkpoint& checkpoint);
 
 #endif
@@ -5,8 +5,8 @@ void addGammaControlRegionCuts(RooUtil::Cutflow& cutflow)
     // Gamma control region
     cutflow.getCut("CutSRTrilep")                                                                                                             ;
     cutflow.addCutToLastActiveCut("PhotonCR"              , [&]() { return (www.met_pt()<50)*(www.Mll3L()>20.)*(fabs(www.Mll3L1())>20.)       ; }        , [&]() { return threelep_sf           ; } ) ;
-    cutflow.addCutToLastActiveCut("PhotonCRNj1"           , [&]() { return www.nj()<=1                                                        ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("PhotonCRNb0"           , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("PhotonCRNj1"           , cutpredicates.get("Nj1")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("PhotonCRNb0"           , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
     cutflow.addCutToLastActiveCut("PhotonCRFull"          , [&]() { return passPhotonCRSFOS                                                   ; }        , [&]() { return 1                     ; } ) ;
 
 }
@@ -16,38 +16,38 @@ void addOppositeSignControlRegionCuts(RooUtil::Cutflow& cutflow)
     // Same-sign Mjj on-W region
     cutflow.getCut("CutOSDilep");
     cutflow.addCutToLastActiveCut("OSCRmm"                , [&]() { return (www.lep_pdgId()[0]*www.lep_pdgId()[1]==-169)*(www.MllSS()>40.)    ; }        , [&]() { return mm_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRmmTVeto"           , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRmmNj2"             , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRmmNb0"             , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRmmMjjW"            , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRmmMjjL"            , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRmmDetajjL"         , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRmmTVeto"           , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRmmNj2"             , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRmmNb0"             , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRmmMjjW"            , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRmmMjjL"            , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRmmDetajjL"         , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("OSCRmmMET"             , [&]() { return 1.                                                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRmmMllSS"           , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRmmMllSS"           , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("OSCRmmFull"            , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutOSDilep")                                                                                                              ;
     cutflow.addCutToLastActiveCut("OSCRem"                , [&]() { return (www.lep_pdgId()[0]*www.lep_pdgId()[1]==-143)*(www.MllSS()>30.)    ; }        , [&]() { return em_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemTVeto"           , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemNj2"             , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemNb0"             , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemMjjW"            , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemMjjL"            , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemDetajjL"         , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemMET"             , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemMllSS"           , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCRemMTmax"           , [&]() { return www.MTmax()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemTVeto"           , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemNj2"             , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemNb0"             , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemMjjW"            , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemMjjL"            , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemDetajjL"         , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemMET"             , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemMllSS"           , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCRemMTmax"           , cutpredicates.get("MTmax90")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("OSCRemFull"            , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutOSDilep")                                                                                                              ;
     cutflow.addCutToLastActiveCut("OSCRee"                , [&]() { return (www.lep_pdgId()[0]*www.lep_pdgId()[1]==-121)*(1)*(www.MllSS()>40.); }        , [&]() { return ee_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeZeeVt"           , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeTVeto"           , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeNj2"             , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeNb0"             , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeMjjW"            , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeMjjL"            , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeDetajjL"         , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeMET"             , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("OSCReeMllSS"           , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeZeeVt"           , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeTVeto"           , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeNj2"             , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeNb0"             , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeMjjW"            , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeMjjL"            , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeDetajjL"         , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeMET"             , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("OSCReeMllSS"           , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("OSCReeFull"            , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 
 }
@@ -56,38 +56,38 @@ void addLooseLeptonControlRegionCuts(RooUtil::Cutflow& cutflow)
 {
     // Loose lepton regions
     cutflow.getCut("CutLRDilep");
-    cutflow.addCutToLastActiveCut("LRSSmm"                , [&]() { return (www.passSSmm())*(www.MllSS()>40.)                                 ; }        , [&]() { return mm_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSmmTVeto"           , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSmmNj2"             , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSmmNb0"             , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSmmMjjW"            , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSmmMjjL"            , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSmmDetajjL"         , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmm"                , cutpredicates.get("SSmm")                                                                    , [&]() { return mm_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmmTVeto"           , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmmNj2"             , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmmNb0"             , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmmMjjW"            , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmmMjjL"            , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmmDetajjL"         , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LRSSmmMET"             , [&]() { return 1.                                                                 ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSmmMllSS"           , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSmmMllSS"           , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LRSSmmFull"            , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutLRDilep")                                                                                                              ;
     cutflow.addCutToLastActiveCut("LRSSem"                , [&]() { return (www.passSSem())*(www.MllSS()>30.)*( (fabs(www.lep_pdgId()[0])==13) * (www.lep_relIso03EAv2Lep()[0] < 0.03) + (fabs(www.lep_pdgId()[1])==13) * (www.lep_relIso03EAv2Lep()[1] < 0.03) ) ; }        , [&]() { return em_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemTVeto"           , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemNj2"             , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemNb0"             , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemMjjW"            , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemMjjL"            , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemDetajjL"         , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemMET"             , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemMllSS"           , [&]() { return www.MllSS()>30.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSemMTmax"           , [&]() { return www.MTmax()>90.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemTVeto"           , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemNj2"             , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemNb0"             , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemMjjW"            , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemMjjL"            , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemDetajjL"         , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemMET"             , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemMllSS"           , cutpredicates.get("MllSS30")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSemMTmax"           , cutpredicates.get("MTmax90")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LRSSemFull"            , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
     cutflow.getCut("CutLRDilep")                                                                                                              ;
-    cutflow.addCutToLastActiveCut("LRSSee"                , [&]() { return (www.passSSee())*(1)*(www.MllSS()>40.)                             ; }        , [&]() { return ee_sf                 ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeZeeVt"           , [&]() { return fabs(www.MllSS()-91.1876)>10.                                      ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeTVeto"           , [&]() { return www.nisoTrack_mt2_cleaned_VVV_cutbased_veto()==0                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeNj2"             , [&]() { return www.nj30()>= 2                                                     ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeNb0"             , [&]() { return www.nb()==0                                                        ; }        , [&]() { return btag_sf               ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeMjjW"            , [&]() { return fabs(www.Mjj()-80.)<15.                                            ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeMjjL"            , [&]() { return www.MjjL()<400.                                                    ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeDetajjL"         , [&]() { return www.DetajjL()<1.5                                                  ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeMET"             , [&]() { return www.met_pt()>60.                                                   ; }        , [&]() { return 1                     ; } ) ;
-    cutflow.addCutToLastActiveCut("LRSSeeMllSS"           , [&]() { return www.MllSS()>40.                                                    ; }        , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSee"                , cutpredicates.get("SSee")                                                                    , [&]() { return ee_sf                 ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeZeeVt"           , cutpredicates.get("ZeeVt")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeTVeto"           , cutpredicates.get("TVeto")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeNj2"             , cutpredicates.get("Nj2")                                                                     , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeNb0"             , cutpredicates.get("Nb0")                                                                     , [&]() { return btag_sf               ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeMjjW"            , cutpredicates.get("MjjW")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeMjjL"            , cutpredicates.get("MjjL")                                                                    , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeDetajjL"         , cutpredicates.get("DetajjL")                                                                 , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeMET"             , cutpredicates.get("MET60")                                                                   , [&]() { return 1                     ; } ) ;
+    cutflow.addCutToLastActiveCut("LRSSeeMllSS"           , cutpredicates.get("MllSS40")                                                                 , [&]() { return 1                     ; } ) ;
     cutflow.addCutToLastActiveCut("LRSSeeFull"            , [&]() { return 1                                                                  ; }        , [&]() { return 1                     ; } ) ;
 }
@@ -4,6 +4,7 @@
 #include "wwwtree.h"
 #include "globalvariables.h"
 #include "rooutil/rooutil.h"
+#include "cutpredicates.h"
 
 void addGammaControlRegionCuts(RooUtil::Cutflow& cutflow);
 void addOppositeSignControlRegionCuts(RooUtil::Cutflow& cutflow);
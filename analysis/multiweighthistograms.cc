@@ -0,0 +1,339 @@
+#include "multiweighthistograms.h"
+
+//_______________________________________________________________________________________________________
+MultiWeightHistograms::MultiWeightHistograms(FlatCutTree& cuttree_, const HistogramDefinitions& definitions) : cuttree(cuttree_), write_empty_histograms(true), epoch(0)
+{
+    for (auto& definition : definitions.definitions)
+    {
+        Variable variable;
+        variable.name = definition.name;
+        variable.nbins = definition.nbins;
+        variable.axis = definition.boundaries.empty() ? FastAxis(definition.nbins, definition.min, definition.max) : FastAxis(definition.boundaries);
+        variable.function = definition.variable;
+        variable.value = 0;
+        variable.epoch = 0;
+        variables.push_back(variable);
+    }
+    variation_names.push_back("");
+    is_booked.resize(cuttree.size(), false);
+    slot_begin.push_back(0);
+    path_passes.push_back(std::vector<char>(cuttree.size(), false));
+    path_weights.push_back(std::vector<float>(cuttree.size(), 0));
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::addWeightVariation(SystematicWeights::Variation variation)
+{
+    // The jet variations come after the weight variations
+    if (not sets.empty() or not jet_pass_funcs.empty())
+    {
+        printf("[MultiWeightHistograms::addWeightVariation] The weight variations must be added before the jet variations and the booking\n");
+        exit(1);
+    }
+    variation_names.push_back(SystematicWeights::getName(variation));
+    weight_variations.push_back(variation);
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::addJetVariation(JetVariationCuts::Variation variation, const std::vector<std::pair<TString, TString>>& varied_cuts)
+{
+    if (not sets.empty())
+    {
+        printf("[MultiWeightHistograms::addJetVariation] The variations must be added before the booking\n");
+        exit(1);
+    }
+    variation_names.push_back(JetVariationCuts::getName(variation));
+    jet_pass_funcs.push_back(std::vector<std::function<bool()>>(cuttree.size()));
+    jet_weight_funcs.push_back(std::vector<std::function<float()>>(cuttree.size()));
+    for (auto& varied_cut : varied_cuts)
+    {
+        // Cuts that are not in the tree (e.g. filtered out regions) are skipped
+        int icut = cuttree.getIndex(varied_cut.first);
+        if (icut < 0)
+            continue;
+        jet_pass_funcs.back()[icut] = jetvariationcuts.get(varied_cut.second, variation);
+        jet_weight_funcs.back()[icut] = jetvariationcuts.getWeight(varied_cut.second);
+    }
+    path_passes.push_back(std::vector<char>(cuttree.size(), false));
+    path_weights.push_back(std::vector<float>(cuttree.size(), 0));
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::bookHistogramsForCutAndBelow(TString cut)
+{
+    int icut = cuttree.getIndex(cut);
+    if (icut < 0)
+    {
+        printf("[MultiWeightHistograms::bookHistogramsForCutAndBelow] No cut %s in the cut tree\n", cut.Data());
+        exit(1);
+    }
+    for (unsigned int jcut = icut; jcut < cuttree.getSubtreeEnd(icut); ++jcut)
+        bookHistograms(jcut);
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::bookHistogramsForEndCuts()
+{
+    for (unsigned int icut = 0; icut < cuttree.size(); ++icut)
+    {
+        if (cuttree.getSubtreeEnd(icut) == icut + 1)
+            bookHistograms(icut);
+    }
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::bookHistograms(unsigned int icut)
+{
+    // A cut that is booked again (e.g. by two overlapping regions) keeps its histograms
+    if (is_booked[icut])
+        return;
+    unsigned int nvariations = variation_names.size();
+    for (unsigned int ivariable = 0; ivariable < variables.size(); ++ivariable)
+    {
+        HistogramSet set;
+        set.icut = icut;
+        set.ivariable = ivariable;
+        FillSlot slot;
+        slot.ivariable = ivariable;
+        slot.iset = sets.size();
+        slots.push_back(slot);
+        sets.push_back(set);
+    }
+    is_booked[icut] = true;
+    booked_cuts.push_back(icut);
+    slot_begin.push_back(slots.size());
+    event_passes.resize(nvariations);
+    event_weights.resize(nvariations);
+    weight_ratios.resize(weight_variations.size());
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::allocate(HistogramSet& set)
+{
+    unsigned int nvariations = variation_names.size();
+    set.sumw.assign((variables[set.ivariable].nbins + 2) * nvariations, 0);
+    set.sumw2.assign((variables[set.ivariable].nbins + 2) * nvariations, 0);
+    set.stats.assign(kNStats * nvariations, 0);
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::release(HistogramSet& set)
+{
+    std::vector<double>().swap(set.sumw);
+    std::vector<double>().swap(set.sumw2);
+    std::vector<double>().swap(set.stats);
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::evaluatePaths(unsigned int ipath)
+{
+    // Depth-first walk of the flat cut tree (subtrees of failed cuts are skipped), with the cuts replaced under a jet variation
+    std::vector<char>& passes = path_passes[ipath];
+    std::vector<float>& weights = path_weights[ipath];
+    std::vector<std::function<bool()>>* pass_funcs = ipath > 0 ? &jet_pass_funcs[ipath - 1] : 0;
+    std::vector<std::function<float()>>* weight_funcs = ipath > 0 ? &jet_weight_funcs[ipath - 1] : 0;
+    unsigned int ncuts = cuttree.size();
+    unsigned int icut = 0;
+    while (icut < ncuts)
+    {
+        int parent = cuttree.getParent(icut);
+        if (parent >= 0 and not passes[parent])
+        {
+            for (unsigned int jcut = icut; jcut < cuttree.getSubtreeEnd(icut); ++jcut)
+                passes[jcut] = false;
+            icut = cuttree.getSubtreeEnd(icut);
+            continue;
+        }
+        bool varied = pass_funcs and (*pass_funcs)[icut];
+        bool passed = varied ? (*pass_funcs)[icut]() : (cuttree.hasPass(icut) ? cuttree.pass(icut) : true);
+        float weight = 0;
+        if (passed)
+        {
+            weight = parent >= 0 ? weights[parent] : 1;
+            if (varied)
+                weight *= (*weight_funcs)[icut]();
+            else if (cuttree.hasWeight(icut))
+                weight *= cuttree.weight(icut);
+        }
+        passes[icut] = passed;
+        weights[icut] = weight;
+        ++icut;
+    }
+}
+
+//_______________________________________________________________________________________________________
+float MultiWeightHistograms::getValue(unsigned int ivariable)
+{
+    // A variable is evaluated once per event however many cuts it is filled at
+    Variable& variable = variables[ivariable];
+    if (variable.epoch != epoch)
+    {
+        variable.value = variable.function();
+        variable.epoch = epoch;
+    }
+    return variable.value;
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::fill()
+{
+    if (booked_cuts.empty())
+        return;
+    if (++epoch == 0)
+    {
+        for (auto& variable : variables)
+            variable.epoch = 0;
+        epoch = 1;
+    }
+
+    for (unsigned int ipath = 0; ipath < path_passes.size(); ++ipath)
+        evaluatePaths(ipath);
+
+    unsigned int nvariations = variation_names.size();
+    unsigned int nweightvariations = weight_variations.size();
+    bool ratios_evaluated = false;
+    for (unsigned int ibooked = 0; ibooked < booked_cuts.size(); ++ibooked)
+    {
+        unsigned int icut = booked_cuts[ibooked];
+
+        // Weights of all the variations at the cut (the weight variations follow the nominal cuts)
+        bool jet_passed = false;
+        bool nominal_passed = path_passes[0][icut];
+        float nominal_weight = path_weights[0][icut];
+        if (nominal_passed and not ratios_evaluated)
+        {
+            // The ratios of the weight variations are the same at every cut
+            for (unsigned int iweight = 0; iweight < nweightvariations; ++iweight)
+                weight_ratios[iweight] = systematicweights.weight(weight_variations[iweight]);
+            ratios_evaluated = true;
+        }
+        event_passes[0] = nominal_passed;
+        event_weights[0] = nominal_weight;
+        for (unsigned int iweight = 0; iweight < nweightvariations; ++iweight)
+        {
+            event_passes[1 + iweight] = nominal_passed;
+            event_weights[1 + iweight] = nominal_passed ? nominal_weight * weight_ratios[iweight] : 0;
+        }
+        for (unsigned int ipath = 1; ipath < path_passes.size(); ++ipath)
+        {
+            event_passes[nweightvariations + ipath] = path_passes[ipath][icut];
+            event_weights[nweightvariations + ipath] = path_weights[ipath][icut];
+            jet_passed = jet_passed or path_passes[ipath][icut];
+        }
+        if (not nominal_passed and not jet_passed)
+            continue;
+
+        for (unsigned int islot = slot_begin[ibooked]; islot < slot_begin[ibooked + 1]; ++islot)
+        {
+            const FillSlot& slot = slots[islot];
+            HistogramSet& set = sets[slot.iset];
+            Variable& variable = variables[slot.ivariable];
+            if (set.sumw.empty())
+                allocate(set);
+            double x = getValue(slot.ivariable);
+            unsigned int bin = variable.axis.findBin(x);
+            double inrange = variable.axis.inRange(bin);
+            double* sumw = &set.sumw[bin * nvariations];
+            double* sumw2 = &set.sumw2[bin * nvariations];
+            for (unsigned int ivariation = 0; ivariation < nvariations; ++ivariation)
+            {
+                if (not event_passes[ivariation])
+                    continue;
+                double w = event_weights[ivariation];
+                double win = w * inrange;
+                sumw[ivariation] += w;
+                sumw2[ivariation] += w * w;
+                double* stats = &set.stats[ivariation * kNStats];
+                stats[0] += 1;
+                stats[1] += win;
+                stats[2] += win * w;
+                stats[3] += win * x;
+                stats[4] += win * x * x;
+            }
+        }
+    }
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::saveOutput(TFile* ofile)
+{
+    // One TH1F per variation, written and deleted right away so that they are not also owned by the directory
+    unsigned int nvariations = variation_names.size();
+    for (auto& set : sets)
+    {
+        const Variable& variable = variables[set.ivariable];
+        bool allocated = not set.sumw.empty();
+        for (unsigned int ivariation = 0; ivariation < nvariations; ++ivariation)
+        {
+            bool empty = not allocated or set.stats[ivariation * kNStats] == 0;
+            if (empty and not write_empty_histograms)
+                continue;
+            TString name = cuttree.getName(set.icut) + variation_names[ivariation] + "__" + variable.name;
+            TH1F* hist = variable.axis.createHistogram<TH1F>(name);
+            if (allocated)
+                variable.axis.setContents(hist, &set.sumw[ivariation], &set.sumw2[ivariation], nvariations, &set.stats[ivariation * kNStats]);
+            ofile->WriteTObject(hist);
+            delete hist;
+        }
+    }
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::writeCheckpoint(TDirectory* dir)
+{
+    // The sums of a set are written as the bins of one TH1D (sumw, then sumw2, then stats) to be restored exactly
+    // (the sets that were never filled are not written)
+    for (unsigned int iset = 0; iset < sets.size(); ++iset)
+    {
+        HistogramSet& set = sets[iset];
+        if (set.sumw.empty())
+            continue;
+        TString title = cuttree.getName(set.icut) + "__" + variables[set.ivariable].name;
+        unsigned int n = set.sumw.size() + set.sumw2.size() + set.stats.size();
+        TH1D* hist = new TH1D(TString::Format("set%d", iset), title, n, 0, n);
+        hist->SetDirectory(0);
+        unsigned int ibin = 1;
+        for (auto& value : set.sumw) hist->SetBinContent(ibin++, value);
+        for (auto& value : set.sumw2) hist->SetBinContent(ibin++, value);
+        for (auto& value : set.stats) hist->SetBinContent(ibin++, value);
+        dir->WriteTObject(hist);
+        delete hist;
+    }
+}
+
+//_______________________________________________________________________________________________________
+bool MultiWeightHistograms::readCheckpoint(TDirectory* dir)
+{
+    for (unsigned int iset = 0; iset < sets.size(); ++iset)
+    {
+        HistogramSet& set = sets[iset];
+        TH1D* hist = (TH1D*) dir->Get(TString::Format("set%d", iset));
+        if (not hist)
+        {
+            release(set);
+            continue;
+        }
+        allocate(set);
+        TString title = cuttree.getName(set.icut) + "__" + variables[set.ivariable].name;
+        unsigned int n = set.sumw.size() + set.sumw2.size() + set.stats.size();
+        bool matches = title.EqualTo(hist->GetTitle()) and hist->GetNbinsX() == (int) n;
+        if (matches)
+        {
+            unsigned int ibin = 1;
+            for (auto& value : set.sumw) value = hist->GetBinContent(ibin++);
+            for (auto& value : set.sumw2) value = hist->GetBinContent(ibin++);
+            for (auto& value : set.stats) value = hist->GetBinContent(ibin++);
+        }
+        delete hist;
+        if (not matches)
+            return false;
+    }
+    return true;
+}
+
+//_______________________________________________________________________________________________________
+void MultiWeightHistograms::reset()
+{
+    for (auto& set : sets)
+        release(set);
+}
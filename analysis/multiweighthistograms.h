@@ -0,0 +1,118 @@
+#ifndef multiweighthistograms_h
+#define multiweighthistograms_h
+
+#include "rooutil/rooutil.h"
+#include "flatcuttree.h"
+#include "histograms.h"
+#include "systematicweights.h"
+#include "jetvariationcuts.h"
+#include "fasthistogram.h"
+#include "TFile.h"
+#include "TH1F.h"
+#include "TH1D.h"
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <cmath>
+
+//_______________________________________________________________________________________________________
+// Histograms of the booked cuts with all the systematic variations of a histogram stored together
+// Each (cut, variable) pair holds one contiguous array of (nbins + 2) x nvariations sums of weights, bin-major so that the
+// variations of a bin are next to each other, and is filled once per event with the weights of all the variations:
+// the nominal weight, the nominal weight times the ratio of each weight systematic (SystematicWeights), and the weight
+// of each jet variation of the cuts (JetVariationCuts), where the event may pass different cuts than the nominal one.
+// The arrays are only unpacked into one TH1F per variation, named like those of the RooUtil::Cutflow (cut + syst + "__" + variable),
+// when the output is saved. The arrays of a (cut, variable) pair are allocated at its first fill, so the histograms of the cuts
+// that no event of the sample passes take no memory, and are written out empty or skipped (see setWriteEmptyHistograms()).
+class MultiWeightHistograms
+{
+    public:
+        MultiWeightHistograms(FlatCutTree& cuttree, const HistogramDefinitions& definitions);
+
+        // Variations of the histograms (to be added before booking)
+        void addWeightVariation(SystematicWeights::Variation variation);
+        void addJetVariation(JetVariationCuts::Variation variation, const std::vector<std::pair<TString, TString>>& varied_cuts);
+
+        // Write the histograms that were never filled (empty) to the output, so that every booked histogram is in every output
+        // file (default), or skip them
+        void setWriteEmptyHistograms(bool write) { write_empty_histograms = write; }
+
+        // Book the histograms of the cut and of all the cuts below it, or of every cut at the end of the tree
+        void bookHistogramsForCutAndBelow(TString cut);
+        void bookHistogramsForEndCuts();
+
+        // Fill the histograms with the current event (to be called after the cuts of the event are evaluated)
+        void fill();
+
+        // Write the histograms of every variation to the output file
+        void saveOutput(TFile* ofile);
+
+        // Sums of the weights as filled so far (checkpoints; reset() releases the arrays)
+        void writeCheckpoint(TDirectory* dir);
+        bool readCheckpoint(TDirectory* dir);
+        void reset();
+
+        unsigned int getNVariations() const { return variation_names.size(); }
+
+    private:
+        struct Variable
+        {
+            TString name;
+            unsigned int nbins;
+            FastAxis axis;
+            std::function<float()> function;
+            float value;
+            unsigned int epoch;
+        };
+
+        // All the variations of one variable at one cut
+        struct HistogramSet
+        {
+            unsigned int icut;
+            unsigned int ivariable;
+            std::vector<double> sumw;      // (nbins + 2) x nvariations (empty until the first fill)
+            std::vector<double> sumw2;
+            std::vector<double> stats;     // nvariations x (entries, sumw, sumw2, sumwx, sumwx2) as kept by TH1 for the bins in range
+        };
+
+        static const unsigned int kNStats = FastHistogram::kNStats;
+
+        void bookHistograms(unsigned int icut);
+        void allocate(HistogramSet& set);
+        void release(HistogramSet& set);
+        void evaluatePaths(unsigned int ipath);
+        float getValue(unsigned int ivariable);
+
+        FlatCutTree& cuttree;
+        std::vector<Variable> variables;
+
+        // Variations: the nominal, then the weight variations, then the jet variations
+        std::vector<TString> variation_names;
+        std::vector<SystematicWeights::Variation> weight_variations;
+        std::vector<std::vector<std::function<bool()>>> jet_pass_funcs;    // cut of every node under a jet variation (empty if the nominal one)
+        std::vector<std::vector<std::function<float()>>> jet_weight_funcs;
+
+        std::vector<HistogramSet> sets;
+        // Dispatch table of the fills, built at booking: the (variable, set) pairs filled at the booked cut booked_cuts[i] are
+        // slots[slot_begin[i]] to slots[slot_begin[i + 1] - 1]
+        struct FillSlot
+        {
+            unsigned int ivariable;
+            unsigned int iset;
+        };
+        std::vector<unsigned int> booked_cuts;
+        std::vector<unsigned int> slot_begin;
+        std::vector<FillSlot> slots;
+        std::vector<char> is_booked; // of every cut
+        bool write_empty_histograms;
+
+        // Current event
+        std::vector<std::vector<char>> path_passes;      // the cut and all the cuts above it pass (nominal, then each jet variation)
+        std::vector<std::vector<float>> path_weights;    // product of the weights of the cut and all the cuts above it
+        std::vector<char> event_passes;                  // of every variation at the cut being filled
+        std::vector<double> event_weights;
+        std::vector<double> weight_ratios;               // of the weight variations
+        unsigned int epoch;
+};
+
+#endif
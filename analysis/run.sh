@@ -35,7 +35,10 @@ else
     regions=$3
 fi
 
-# The fourth argument will decide whether to run histograms (no systematics)
+# The fourth argument will decide whether to run histograms
+# (it is passed on as the options of doAnalysis, see ./doAnalysis for the options; by default the histograms of all the systematics
+#  are filled together as multi-weight histograms, which are only allocated once they are filled and so keep the memory of the
+#  36 jobs running at once down, and "multiweight=0" books the histograms in the cutflow without the systematics for regions=all)
 if [ -z $4 ]; then
     dohist=""
 else
@@ -63,6 +66,28 @@ mkdir -p ${OUTPUTDIR}
 # Clear the output .jobs.txt
 rm .jobs.txt
 
+#_____________________________________________________________________________________________
+# Writes out a single job for the ntuple given as the argument that reads the full TTree "t" once and
+# routes each event by www.bkgtype() into t_${TREEVARIATION}_*.root for every TREEVARIATION.
+# (the ":${TREEVARIATION}" suffix of the output file name tells doAnalysis to only fill events with that bkgtype)
+# Over all the events (NEVENTS=-1) the output files should be the same as running over each t_${TREEVARIATION} TTree
+# separately, which "sh validate.sh BABY t 20000 all 1" checks by comparing them to the outputs of the jobs over each TTree.
+# With NEVENTS>0 they are not: the limit then caps the events of "t" read by this one job, not the events of each
+# t_${TREEVARIATION} TTree as it did for the separate jobs.
+# The t_ss/t_ewksubt job of the background MC stays separate: it runs over the TTree "t_ss", the same-sign skim of the baby,
+# which is not one bkgtype of "t" and so cannot be routed out of this job with a ":bkgtype" output.
+demuxjob()
+{
+    DEMUXOUTPUTS=""
+    DEMUXMISSING=""
+    for TREEVARIATION in ${TREEVARIATIONS}; do
+        DEMUXOUTPUT=${OUTPUTDIR}/t_${TREEVARIATION}_$(basename $1)
+        DEMUXOUTPUTS=${DEMUXOUTPUTS:+${DEMUXOUTPUTS},}${DEMUXOUTPUT}:${TREEVARIATION}
+        DEMUXMISSING="${DEMUXMISSING:+${DEMUXMISSING} || }[ ! -f ${DEMUXOUTPUT} ]"
+    done
+    echo 'if '${DEMUXMISSING}'; then ./doAnalysis '$1' 't' '${DEMUXOUTPUTS}' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_bkgtypes_'$(basename $1)'.log 2>&1; fi' >> .jobs.txt
+}
+
 
 #_____________________________________________________________________________________________
 
@@ -114,13 +139,8 @@ for f in $(ls /nfs-7/userdata/phchang/WWW_babies/${VERSION}/skim/*.root); do
         echo 'if [ ! -f '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)' ]; then ./doAnalysis '$f' 't_${TREEVARIATION}' '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
 
         # Now write out the background part of the VH sample
-        # Loop over the tree varations. (e.g. qflip, prompt, lostlep, etc.)
-        for TREEVARIATION in ${TREEVARIATIONS}; do
-
-            # Now write out the command to run over VH background events in various TTree's like t_qflip, t_lostlep, etc.
-            echo 'if [ ! -f '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)' ]; then ./doAnalysis '$f' 't_${TREEVARIATION}' '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
-
-        done
+        # The full TTree "t" is read once and the events are routed by bkgtype into t_qflip_*.root, t_lostlep_*.root, etc. (see demuxjob())
+        demuxjob $f
     # (NOTE: not used for 2017 and onwards)
     # 3. Data: If the file name matches "data_ss" this is for the 2016 analysis primarily for the sample used for final results.
     #    So at that time, the data_ss.root was the duplicate removed data hadded ntuple.
@@ -132,12 +152,9 @@ for f in $(ls /nfs-7/userdata/phchang/WWW_babies/${VERSION}/skim/*.root); do
     #
     elif [[ $f == *"/data_ss"* ]]; then
 
-        # Write out the job command for processing data events
-        echo 'if [ ! -f '${OUTPUTDIR}'/t_ss_'$(basename $f)' ]; then ./doAnalysis '$f' 't_ss' '${OUTPUTDIR}'/t_ss_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
-
-        # Write out the job command for data-driven fake estimate
-        # The analysis source file (i.e. process.cc) recognizes the output file pattern "ddfakes" and flips the internal switch to process it as a data-driven fake estimate
-        echo 'if [ ! -f '${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' ]; then ./doAnalysis '$f' 't_ss' '${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_ddfakes_'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
+        # Write out the job command for processing data events and the data-driven fake estimate in a single pass
+        # The analysis source file (i.e. main.cc) recognizes the output file pattern "ddfakes" and flips the internal switch to fill that output as a data-driven fake estimate
+        echo 'if [ ! -f '${OUTPUTDIR}'/t_ss_'$(basename $f)' ] || [ ! -f '${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' ]; then ./doAnalysis '$f' 't_ss' '${OUTPUTDIR}'/t_ss_'$(basename $f)','${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
 
     #
     # 4. Data: If the file name starts with "data*", then process the data events.
@@ -148,12 +165,9 @@ for f in $(ls /nfs-7/userdata/phchang/WWW_babies/${VERSION}/skim/*.root); do
         # If the sample is for 2017 events or v4 and above for 2016
         if [[ $f == *"Loose2017"* ]] || [[ $f == *"WWW2017"*  ]] || [[ $f == *"WWW2016_v4"* ]] || [[ $f == *"WWW2016_v5"* ]]; then
 
-            # Write out the job command for processing data events
-            echo 'if [ ! -f '${OUTPUTDIR}'/t_ss_'$(basename $f)' ]; then ./doAnalysis '$f' 't' '${OUTPUTDIR}'/t_ss_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/'t_ss_$(basename $f)'.log 2>&1; fi' >> .jobs.txt
-
-            # Write out the job command for data-driven fake estimate
-            # The analysis source file (i.e. process.cc) recognizes the output file pattern "ddfakes" and flips the internal switch to process it as a data-driven fake estimate
-            echo 'if [ ! -f '${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' ]; then ./doAnalysis '$f' 't' '${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/'t_ddfakes_$(basename $f)'.log 2>&1; fi' >> .jobs.txt
+            # Write out the job command for processing data events and the data-driven fake estimate in a single pass
+            # The analysis source file (i.e. main.cc) recognizes the output file pattern "ddfakes" and flips the internal switch to fill that output as a data-driven fake estimate
+            echo 'if [ ! -f '${OUTPUTDIR}'/t_ss_'$(basename $f)' ] || [ ! -f '${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' ]; then ./doAnalysis '$f' 't' '${OUTPUTDIR}'/t_ss_'$(basename $f)','${OUTPUTDIR}'/t_ddfakes_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/'t_ss_$(basename $f)'.log 2>&1; fi' >> .jobs.txt
 
         # TODO: The consistent treatment of 2016 analysis with the same version of baby maker hasn't been done yet. (As of Nov. 2018)
         #       Once the VVVBabyMaker/master version produced 2016 AND 2017 with a same setup, this will be implemented and the section "3." will be deprecated.
@@ -169,25 +183,18 @@ for f in $(ls /nfs-7/userdata/phchang/WWW_babies/${VERSION}/skim/*.root); do
     else
 
         # The tzq samples are HUGE and is very TINY. We skip it. Just takes up time and does nothing.
+        # (If they are ever needed, they can be split into jobs over parts of their entries with first/last, see the README)
         if [[ $f == *"tzq"* ]]; then continue; fi
         if [[ $f == *"wz_3lnu0"* ]]; then continue; fi
         if [[ $f == *"wz_3lnu1"* ]]; then continue; fi
         if [[ $f == *"wz_3lnu2"* ]]; then continue; fi
         if [[ $f == *"wz_3lnu3"* ]]; then continue; fi
 
-        # Loop over the various TTree suffixes and write out jobs for each TTree
-        for TREEVARIATION in ${TREEVARIATIONS}; do
-
-            # Write out jobs for t_{$TREEVARIATION} for regular mc bkg processing
-            echo 'if [ ! -f '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)' ]; then ./doAnalysis '$f' 't_${TREEVARIATION}' '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_'${TREEVARIATION}'_'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
-
-        done
-
-        # Write out job commands for processing non-"non-prompt" backgrounds in application regions
-        echo 'if [ ! -f '${OUTPUTDIR}'/t_ewksubt_'$(basename $f)' ]; then ./doAnalysis '$f' 't_ss' '${OUTPUTDIR}'/t_ewksubt_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_ewksubt_'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
+        # Write out one job reading the full TTree "t" that routes the events by bkgtype into t_qflip_*.root, t_lostlep_*.root, etc. for regular mc bkg processing
+        demuxjob $f
 
-        # Write out job commands for processing as a whole
-        echo 'if [ ! -f '${OUTPUTDIR}'/t_ss_'$(basename $f)' ]; then ./doAnalysis '$f' 't_ss' '${OUTPUTDIR}'/t_ss_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_ss_'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
+        # Write out job commands for processing as a whole and for processing non-"non-prompt" backgrounds in application regions in a single pass
+        echo 'if [ ! -f '${OUTPUTDIR}'/t_ss_'$(basename $f)' ] || [ ! -f '${OUTPUTDIR}'/t_ewksubt_'$(basename $f)' ]; then ./doAnalysis '$f' 't_ss' '${OUTPUTDIR}'/t_ss_'$(basename $f)','${OUTPUTDIR}'/t_ewksubt_'$(basename $f)' '${NEVENTS}' '${regions} ${dohist}'  > '${OUTPUTDIR}'/t_ss_'$(basename $f)'.log 2>&1; fi' >> .jobs.txt
     fi
 done
 
@@ -32,7 +32,15 @@ def main():
     input_ntup_tag = "WWW2017_v5.0.2"
 
     base_dir_path = "/hadoop/cms/store/user/phchang/metis/wwwbaby/{}/".format(input_ntup_tag)
-    tar_files = ["doAnalysis", "setup.sh", "scalefactors/*.root", "scalefactors/*/*/*/*/sf.root"]
+    # Ship the scale factor maps packed by "./doAnalysis packsf scalefactors.bundle" instead of scalefactors/ (mapped once per node by the jobs)
+    use_sfbundle = True
+    if use_sfbundle:
+        if not os.path.isfile("scalefactors.bundle"):
+            print "scalefactors.bundle not found, make it first with: ./doAnalysis packsf scalefactors.bundle"
+            return
+        tar_files = ["doAnalysis", "setup.sh", "scalefactors.bundle"]
+    else:
+        tar_files = ["doAnalysis", "setup.sh", "scalefactors/*.root", "scalefactors/*/*/*/*/sf.root"]
     hadoop_dirname = "wwwanalysis"
     trees = ["t"] if "OS" in input_ntup_tag else ["t_lostlep", "t_fakes", "t_prompt", "t_qflip", "t_photon"]
 
@@ -40,6 +48,8 @@ def main():
     regions="all"
 
     dohist = ""
+    if use_sfbundle:
+        dohist = "sfbundle=scalefactors.bundle"
 
     all_samples = glob.glob("{}/*".format(base_dir_path))
 
@@ -1,6 +1,86 @@
 #include "scalefactors.h"
+#include "TFile.h"
+#include <thread>
+#include <atomic>
 
+// The table is constructed first since the scale factor tools below compile their maps into it
+ScaleFactorTable scalefactortable;
 LeptonScaleFactors leptonScaleFactors;
 FakeRates fakerates;
 TheoryWeight theoryweight;
 PileupReweight pileupreweight;
+
+//_______________________________________________________________________________________________________
+void TheoryWeight::loadFiles(TChain* chain, Long64_t first_entry, Long64_t last_entry, int nthreads)
+{
+    // Only the files with entries in [first_entry, last_entry) are read (the tree offsets are known once GetEntries() loaded the chain)
+    std::vector<TString> fnames;
+    TObjArray* chainfiles = chain->GetListOfFiles();
+    chain->GetEntries();
+    Long64_t* offsets = chain->GetTreeOffset();
+    for (int ifile = 0; ifile < chainfiles->GetEntries(); ++ifile)
+    {
+        if (offsets[ifile] < last_entry and offsets[ifile + 1] > first_entry)
+            fnames.push_back(chainfiles->At(ifile)->GetTitle());
+    }
+
+    // Each thread takes the next file not read yet (every thread opens its own files, see ROOT::EnableThreadSafety() in main())
+    std::vector<Normalization> loaded(fnames.size());
+    std::vector<char> ok(fnames.size(), 0);
+    std::atomic<unsigned int> next_file(0);
+    auto read = [&]()
+    {
+        for (unsigned int ifile = next_file++; ifile < fnames.size(); ifile = next_file++)
+            ok[ifile] = readFile(fnames[ifile], loaded[ifile]);
+    };
+    nthreads = std::max(1, std::min(nthreads, (int) fnames.size()));
+    if (nthreads > 1)
+    {
+        std::vector<std::thread> threads;
+        for (int ithread = 0; ithread < nthreads; ++ithread)
+            threads.emplace_back(read);
+        for (auto& thread : threads)
+            thread.join();
+    }
+    else
+    {
+        read();
+    }
+
+    for (unsigned int ifile = 0; ifile < fnames.size(); ++ifile)
+    {
+        if (not ok[ifile])
+        {
+            printf("[TheoryWeight::loadFiles] Could not read h_neventsinfile from %s\n", fnames[ifile].Data());
+            exit(1);
+        }
+        if (rows.find(fnames[ifile]) != rows.end())
+            continue;
+        rows[fnames[ifile]] = normalizations.size();
+        normalizations.push_back(loaded[ifile]);
+    }
+    std::cout <<  " Read the theory weight normalizations of " << fnames.size() << " files" << std::endl;
+}
+
+//_______________________________________________________________________________________________________
+bool TheoryWeight::readFile(TString fname, Normalization& normalization)
+{
+    TFile* file = TFile::Open(fname);
+    TH1* hist = file ? (TH1*) file->Get("h_neventsinfile") : 0;
+    if (hist)
+    {
+        normalization.nominal = hist->GetBinContent(1+1);
+        normalization.pdfup   = hist->GetBinContent(1+10);
+        normalization.pdfdn   = hist->GetBinContent(1+11);
+        normalization.alsup   = hist->GetBinContent(1+13);
+        normalization.alsdn   = hist->GetBinContent(1+12);
+        normalization.qsqup   = hist->GetBinContent(1+5);
+        normalization.qsqdn   = hist->GetBinContent(1+9);
+    }
+    if (file)
+    {
+        file->Close();
+        delete file;
+    }
+    return hist != 0;
+}
@@ -3,108 +3,47 @@
 
 #include "wwwtree.h"
 #include "rooutil/rooutil.h"
+#include "scalefactortable.h"
+#include "TChain.h"
+#include <map>
 
 //_______________________________________________________________________________________________________
 class LeptonScaleFactors
 {
     public:
-        RooUtil::HistMap* histmap_lead_mu_recoid_sf;
-        RooUtil::HistMap* histmap_subl_mu_recoid_sf;
-        RooUtil::HistMap* histmap_lead_el_recoid_sf;
-        RooUtil::HistMap* histmap_subl_el_recoid_sf;
-        RooUtil::HistMap* histmap_lead_el_mva_sf;
-        RooUtil::HistMap* histmap_subl_el_mva_sf;
-        RooUtil::HistMap* histmap_emu_mu_recoid_sf;
-        RooUtil::HistMap* histmap_emu_el_recoid_sf;
-        RooUtil::HistMap* histmap_emu_el_mva_sf;
-        RooUtil::HistMap* histmap_lead_mu_recoid_3l_sf;
-        RooUtil::HistMap* histmap_subl_mu_recoid_3l_sf;
-        RooUtil::HistMap* histmap_lead_el_recoid_3l_sf;
-        RooUtil::HistMap* histmap_subl_el_recoid_3l_sf;
-        RooUtil::HistMap* histmap_lead_el_mva_3l_sf;
-        RooUtil::HistMap* histmap_subl_el_mva_3l_sf;
-        RooUtil::HistMap* histmap_tert_mu_recoid_3l_sf;
-        RooUtil::HistMap* histmap_tert_el_recoid_3l_sf;
-        RooUtil::HistMap* histmap_tert_el_mva_3l_sf;
-        RooUtil::HistMap* histmap_lead_mu_isoip_sf;
-        RooUtil::HistMap* histmap_subl_mu_isoip_sf;
-        RooUtil::HistMap* histmap_lead_el_isoip_sf;
-        RooUtil::HistMap* histmap_subl_el_isoip_sf;
-        RooUtil::HistMap* histmap_emu_mu_isoip_sf;
-        RooUtil::HistMap* histmap_emu_el_isoip_sf;
-        RooUtil::HistMap* histmap_lead_mu_isoip_3l_sf;
-        RooUtil::HistMap* histmap_subl_mu_isoip_3l_sf;
-        RooUtil::HistMap* histmap_lead_el_isoip_3l_sf;
-        RooUtil::HistMap* histmap_subl_el_isoip_3l_sf;
-        RooUtil::HistMap* histmap_tert_mu_isoip_3l_sf;
-        RooUtil::HistMap* histmap_tert_el_isoip_3l_sf;
-
         LeptonScaleFactors()
         {
-            histmap_lead_mu_recoid_sf     = new RooUtil::HistMap("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta");
-            histmap_subl_mu_recoid_sf     = new RooUtil::HistMap("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta");
-            histmap_lead_el_recoid_sf     = new RooUtil::HistMap("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D");
-            histmap_subl_el_recoid_sf     = new RooUtil::HistMap("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D");
-            histmap_lead_el_mva_sf        = new RooUtil::HistMap("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp80noiso.root:EGamma_SF2D");
-            histmap_subl_el_mva_sf        = new RooUtil::HistMap("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp80noiso.root:EGamma_SF2D");
-            histmap_emu_mu_recoid_sf      = new RooUtil::HistMap("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta");
-            histmap_emu_el_recoid_sf      = new RooUtil::HistMap("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D");
-            histmap_emu_el_mva_sf         = new RooUtil::HistMap("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp80noiso.root:EGamma_SF2D");
-            histmap_lead_mu_recoid_3l_sf  = new RooUtil::HistMap("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta");
-            histmap_subl_mu_recoid_3l_sf  = new RooUtil::HistMap("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta");
-            histmap_lead_el_recoid_3l_sf  = new RooUtil::HistMap("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D");
-            histmap_subl_el_recoid_3l_sf  = new RooUtil::HistMap("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D");
-            histmap_lead_el_mva_3l_sf     = new RooUtil::HistMap("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp90noiso.root:EGamma_SF2D");
-            histmap_subl_el_mva_3l_sf     = new RooUtil::HistMap("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp90noiso.root:EGamma_SF2D");
-            histmap_tert_mu_recoid_3l_sf  = new RooUtil::HistMap("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta");
-            histmap_tert_el_recoid_3l_sf  = new RooUtil::HistMap("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D");
-            histmap_tert_el_mva_3l_sf     = new RooUtil::HistMap("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp90noiso.root:EGamma_SF2D");
-            histmap_lead_mu_isoip_sf      = new RooUtil::HistMap("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV/sf.root:h_sf_pt_vs_eta");
-            histmap_subl_mu_isoip_sf      = new RooUtil::HistMap("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV/sf.root:h_sf_pt_vs_eta");
-            histmap_lead_el_isoip_sf      = new RooUtil::HistMap("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA80POG2017_EGammaTightVVV/sf.root:h_sf_pt_vs_eta");
-            histmap_subl_el_isoip_sf      = new RooUtil::HistMap("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA80POG2017_EGammaTightVVV/sf.root:h_sf_pt_vs_eta");
-            histmap_emu_mu_isoip_sf       = new RooUtil::HistMap("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV/sf.root:h_sf_pt_vs_eta");
-            histmap_emu_el_isoip_sf       = new RooUtil::HistMap("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA80POG2017_EGammaTightVVV/sf.root:h_sf_pt_vs_eta");
-            histmap_lead_mu_isoip_3l_sf   = new RooUtil::HistMap("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV3l/sf.root:h_sf_pt_vs_eta");
-            histmap_subl_mu_isoip_3l_sf   = new RooUtil::HistMap("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV3l/sf.root:h_sf_pt_vs_eta");
-            histmap_lead_el_isoip_3l_sf   = new RooUtil::HistMap("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA90POG2017_EGammaTightVVV3l/sf.root:h_sf_pt_vs_eta");
-            histmap_subl_el_isoip_3l_sf   = new RooUtil::HistMap("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA90POG2017_EGammaTightVVV3l/sf.root:h_sf_pt_vs_eta");
-            histmap_tert_mu_isoip_3l_sf   = new RooUtil::HistMap("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV3l/sf.root:h_sf_pt_vs_eta");
-            histmap_tert_el_isoip_3l_sf   = new RooUtil::HistMap("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA90POG2017_EGammaTightVVV3l/sf.root:h_sf_pt_vs_eta");
-        }
-
-        ~LeptonScaleFactors()
-        {
-            delete histmap_lead_mu_recoid_sf;
-            delete histmap_subl_mu_recoid_sf;
-            delete histmap_lead_el_recoid_sf;
-            delete histmap_subl_el_recoid_sf;
-            delete histmap_lead_el_mva_sf;
-            delete histmap_subl_el_mva_sf;
-            delete histmap_emu_mu_recoid_sf;
-            delete histmap_emu_el_recoid_sf;
-            delete histmap_emu_el_mva_sf;
-            delete histmap_lead_mu_recoid_3l_sf;
-            delete histmap_subl_mu_recoid_3l_sf;
-            delete histmap_lead_el_recoid_3l_sf;
-            delete histmap_subl_el_recoid_3l_sf;
-            delete histmap_lead_el_mva_3l_sf;
-            delete histmap_subl_el_mva_3l_sf;
-            delete histmap_tert_mu_recoid_3l_sf;
-            delete histmap_tert_el_recoid_3l_sf;
-            delete histmap_tert_el_mva_3l_sf;
-            delete histmap_lead_mu_isoip_sf;
-            delete histmap_subl_mu_isoip_sf;
-            delete histmap_lead_el_isoip_sf;
-            delete histmap_subl_el_isoip_sf;
-            delete histmap_emu_mu_isoip_sf;
-            delete histmap_emu_el_isoip_sf;
-            delete histmap_lead_mu_isoip_3l_sf;
-            delete histmap_subl_mu_isoip_3l_sf;
-            delete histmap_lead_el_isoip_3l_sf;
-            delete histmap_subl_el_isoip_3l_sf;
-            delete histmap_tert_mu_isoip_3l_sf;
-            delete histmap_tert_el_isoip_3l_sf;
+            // Maps of the scale factors with the abs(eta) and the pt caps of each (read by scalefactortable.load(), once per distinct histogram)
+            mu_recoid[0]    = scalefactortable.add("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta", kPt120  , kAbsEta );
+            mu_recoid[1]    = scalefactortable.add("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta", kPt120  , kAbsEta );
+            el_recoid[0]    = scalefactortable.add("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D", kAbsEta , kPt500  );
+            el_recoid[1]    = scalefactortable.add("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D", kAbsEta , kPt500  );
+            el_mva[0]       = scalefactortable.add("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp80noiso.root:EGamma_SF2D", kAbsEta , kPt500  );
+            el_mva[1]       = scalefactortable.add("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp80noiso.root:EGamma_SF2D", kAbsEta , kPt500  );
+            emu_mu_recoid   = scalefactortable.add("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta", kPt120  , kAbsEta );
+            emu_el_recoid   = scalefactortable.add("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D", kAbsEta , kPt500  );
+            emu_el_mva      = scalefactortable.add("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp80noiso.root:EGamma_SF2D", kAbsEta , kPt500  );
+            mu_recoid_3l[0] = scalefactortable.add("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta", kPt120  , kAbsEta );
+            mu_recoid_3l[1] = scalefactortable.add("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta", kPt120  , kAbsEta );
+            el_recoid_3l[0] = scalefactortable.add("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D", kAbsEta , kPt500  );
+            el_recoid_3l[1] = scalefactortable.add("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D", kAbsEta , kPt500  );
+            el_mva_3l[0]    = scalefactortable.add("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp90noiso.root:EGamma_SF2D", kAbsEta , kPt500  );
+            el_mva_3l[1]    = scalefactortable.add("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp90noiso.root:EGamma_SF2D", kAbsEta , kPt500  );
+            mu_recoid_3l[2] = scalefactortable.add("scalefactors/RunBCDEF_SF_ID.root:NUM_MediumID_DEN_genTracks_pt_abseta", kPt120  , kAbsEta );
+            el_recoid_3l[2] = scalefactortable.add("scalefactors/egammaEffi.txt_EGM2D_runBCDEF_passingRECO.root:EGamma_SF2D", kAbsEta , kPt500  );
+            el_mva_3l[2]    = scalefactortable.add("scalefactors/gammaEffi.txt_EGM2D_runBCDEF_passingMVA94Xwp90noiso.root:EGamma_SF2D", kAbsEta , kPt500  );
+            mu_isoip[0]     = scalefactortable.add("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt120  );
+            mu_isoip[1]     = scalefactortable.add("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt120  );
+            el_isoip[0]     = scalefactortable.add("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA80POG2017_EGammaTightVVV/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt500  );
+            el_isoip[1]     = scalefactortable.add("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA80POG2017_EGammaTightVVV/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt500  );
+            emu_mu_isoip    = scalefactortable.add("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt200  );
+            emu_el_isoip    = scalefactortable.add("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA80POG2017_EGammaTightVVV/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt500  );
+            mu_isoip_3l[0]  = scalefactortable.add("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV3l/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt120  );
+            mu_isoip_3l[1]  = scalefactortable.add("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV3l/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt120  );
+            el_isoip_3l[0]  = scalefactortable.add("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA90POG2017_EGammaTightVVV3l/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt500  );
+            el_isoip_3l[1]  = scalefactortable.add("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA90POG2017_EGammaTightVVV3l/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt500  );
+            mu_isoip_3l[2]  = scalefactortable.add("scalefactors/isoipsf/MuonID_2017www/muon/MuMediumPOG_MuTightVVV3l/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt120  );
+            el_isoip_3l[2]  = scalefactortable.add("scalefactors/isoipsf/ElectronID_2017www/electron/EGammaMVA90POG2017_EGammaTightVVV3l/sf.root:h_sf_pt_vs_eta", kAbsEta , kPt500  );
         }
 
         //std::tuple<float, float, float, float> getScaleFactors(bool is2017, bool doFakeEstimation, bool isData, int variation=0)
@@ -116,92 +55,123 @@ class LeptonScaleFactors
             }
             else if (is2017)
             {
-                const double b500 = 499.9;
-                const double b120 = 119.9;
-                float lead_mu_recoid_sf    = variation > 0 ? histmap_lead_mu_recoid_sf    -> eval_up(min((double)www.lep_pt()[0],b120)   ,abs((double)www.lep_eta()[0])     ) : variation < 0 ? histmap_lead_mu_recoid_sf    -> eval_down(min((double)www.lep_pt()[0],b120)   ,abs((double)www.lep_eta()[0])     ) : histmap_lead_mu_recoid_sf    -> eval(min((double)www.lep_pt()[0],b120)   ,abs((double)www.lep_eta()[0])     );
-                float subl_mu_recoid_sf    = variation > 0 ? histmap_subl_mu_recoid_sf    -> eval_up(min((double)www.lep_pt()[1],b120)   ,abs((double)www.lep_eta()[1])     ) : variation < 0 ? histmap_subl_mu_recoid_sf    -> eval_down(min((double)www.lep_pt()[1],b120)   ,abs((double)www.lep_eta()[1])     ) : histmap_subl_mu_recoid_sf    -> eval(min((double)www.lep_pt()[1],b120)   ,abs((double)www.lep_eta()[1])     );
-                float lead_el_recoid_sf    = variation > 0 ? histmap_lead_el_recoid_sf    -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : variation < 0 ? histmap_lead_el_recoid_sf    -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : histmap_lead_el_recoid_sf    -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) );
-                float subl_el_recoid_sf    = variation > 0 ? histmap_subl_el_recoid_sf    -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : variation < 0 ? histmap_subl_el_recoid_sf    -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : histmap_subl_el_recoid_sf    -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) );
-                float lead_el_mva_sf       = variation > 0 ? histmap_lead_el_mva_sf       -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : variation < 0 ? histmap_lead_el_mva_sf       -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : histmap_lead_el_mva_sf       -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) );
-                float subl_el_mva_sf       = variation > 0 ? histmap_subl_el_mva_sf       -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : variation < 0 ? histmap_subl_el_mva_sf       -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : histmap_subl_el_mva_sf       -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) );
-                float emu_mu_recoid_sf     = variation > 0 ? histmap_emu_mu_recoid_sf     -> eval_up(min((double)www.mu_pt(),b120)       ,abs((double)www.mu_eta())         ) : variation < 0 ? histmap_emu_mu_recoid_sf     -> eval_down(min((double)www.mu_pt(),b120)       ,abs((double)www.mu_eta())         ) : histmap_emu_mu_recoid_sf     -> eval(min((double)www.mu_pt(),b120)       ,abs((double)www.mu_eta())         );
-                float emu_el_recoid_sf     = variation > 0 ? histmap_emu_el_recoid_sf     -> eval_up(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     ) : variation < 0 ? histmap_emu_el_recoid_sf     -> eval_down(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     ) : histmap_emu_el_recoid_sf     -> eval(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     );
-                float emu_el_mva_sf        = variation > 0 ? histmap_emu_el_mva_sf        -> eval_up(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     ) : variation < 0 ? histmap_emu_el_mva_sf        -> eval_down(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     ) : histmap_emu_el_mva_sf        -> eval(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     );
-                float lead_mu_recoid_3l_sf = variation > 0 ? histmap_lead_mu_recoid_3l_sf -> eval_up(min((double)www.lep_pt()[0],b120)   ,abs((double)www.lep_eta()[0])     ) : variation < 0 ? histmap_lead_mu_recoid_3l_sf -> eval_down(min((double)www.lep_pt()[0],b120)   ,abs((double)www.lep_eta()[0])     ) : histmap_lead_mu_recoid_3l_sf -> eval(min((double)www.lep_pt()[0],b120)   ,abs((double)www.lep_eta()[0])     );
-                float subl_mu_recoid_3l_sf = variation > 0 ? histmap_subl_mu_recoid_3l_sf -> eval_up(min((double)www.lep_pt()[1],b120)   ,abs((double)www.lep_eta()[1])     ) : variation < 0 ? histmap_subl_mu_recoid_3l_sf -> eval_down(min((double)www.lep_pt()[1],b120)   ,abs((double)www.lep_eta()[1])     ) : histmap_subl_mu_recoid_3l_sf -> eval(min((double)www.lep_pt()[1],b120)   ,abs((double)www.lep_eta()[1])     );
-                float lead_el_recoid_3l_sf = variation > 0 ? histmap_lead_el_recoid_3l_sf -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : variation < 0 ? histmap_lead_el_recoid_3l_sf -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : histmap_lead_el_recoid_3l_sf -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) );
-                float subl_el_recoid_3l_sf = variation > 0 ? histmap_subl_el_recoid_3l_sf -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : variation < 0 ? histmap_subl_el_recoid_3l_sf -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : histmap_subl_el_recoid_3l_sf -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) );
-                float lead_el_mva_3l_sf    = variation > 0 ? histmap_lead_el_mva_3l_sf    -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : variation < 0 ? histmap_lead_el_mva_3l_sf    -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : histmap_lead_el_mva_3l_sf    -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) );
-                float subl_el_mva_3l_sf    = variation > 0 ? histmap_subl_el_mva_3l_sf    -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : variation < 0 ? histmap_subl_el_mva_3l_sf    -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : histmap_subl_el_mva_3l_sf    -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) );
-                float tert_mu_recoid_3l_sf = variation > 0 ? histmap_tert_mu_recoid_3l_sf -> eval_up(min((double)www.lep_pt()[2],b120)   ,abs((double)www.lep_eta()[2])     ) : variation < 0 ? histmap_tert_mu_recoid_3l_sf -> eval_down(min((double)www.lep_pt()[2],b120)   ,abs((double)www.lep_eta()[2])     ) : histmap_tert_mu_recoid_3l_sf -> eval(min((double)www.lep_pt()[2],b120)   ,abs((double)www.lep_eta()[2])     );
-                float tert_el_recoid_3l_sf = variation > 0 ? histmap_tert_el_recoid_3l_sf -> eval_up(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) ) : variation < 0 ? histmap_tert_el_recoid_3l_sf -> eval_down(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) ) : histmap_tert_el_recoid_3l_sf -> eval(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) );
-                float tert_el_mva_3l_sf    = variation > 0 ? histmap_tert_el_mva_3l_sf    -> eval_up(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) ) : variation < 0 ? histmap_tert_el_mva_3l_sf    -> eval_down(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) ) : histmap_tert_el_mva_3l_sf    -> eval(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) );
-                float lead_mu_isoip_sf     = variation > 0 ? histmap_lead_mu_isoip_sf     -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b120) ) : variation < 0 ? histmap_lead_mu_isoip_sf     -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b120) ) : histmap_lead_mu_isoip_sf     -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b120) );
-                float subl_mu_isoip_sf     = variation > 0 ? histmap_subl_mu_isoip_sf     -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b120) ) : variation < 0 ? histmap_subl_mu_isoip_sf     -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b120) ) : histmap_subl_mu_isoip_sf     -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b120) );
-                float lead_el_isoip_sf     = variation > 0 ? histmap_lead_el_isoip_sf     -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : variation < 0 ? histmap_lead_el_isoip_sf     -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : histmap_lead_el_isoip_sf     -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) );
-                float subl_el_isoip_sf     = variation > 0 ? histmap_subl_el_isoip_sf     -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : variation < 0 ? histmap_subl_el_isoip_sf     -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : histmap_subl_el_isoip_sf     -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) );
-                float emu_mu_isoip_sf      = variation > 0 ? histmap_emu_mu_isoip_sf      -> eval_up(abs((double)www.mu_eta())           ,min((double)www.mu_pt(),199.99)   ) : variation < 0 ? histmap_emu_mu_isoip_sf      -> eval_down(abs((double)www.mu_eta())           ,min((double)www.mu_pt(),199.99)   ) : histmap_emu_mu_isoip_sf      -> eval(abs((double)www.mu_eta())           ,min((double)www.mu_pt(),199.99)   );
-                float emu_el_isoip_sf      = variation > 0 ? histmap_emu_el_isoip_sf      -> eval_up(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     ) : variation < 0 ? histmap_emu_el_isoip_sf      -> eval_down(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     ) : histmap_emu_el_isoip_sf      -> eval(abs((double)www.el_eta())           ,min((double)www.el_pt(),b500)     );
-                float lead_mu_isoip_3l_sf  = variation > 0 ? histmap_lead_mu_isoip_3l_sf  -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b120) ) : variation < 0 ? histmap_lead_mu_isoip_3l_sf  -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b120) ) : histmap_lead_mu_isoip_3l_sf  -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b120) );
-                float subl_mu_isoip_3l_sf  = variation > 0 ? histmap_subl_mu_isoip_3l_sf  -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b120) ) : variation < 0 ? histmap_subl_mu_isoip_3l_sf  -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b120) ) : histmap_subl_mu_isoip_3l_sf  -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b120) );
-                float lead_el_isoip_3l_sf  = variation > 0 ? histmap_lead_el_isoip_3l_sf  -> eval_up(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : variation < 0 ? histmap_lead_el_isoip_3l_sf  -> eval_down(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) ) : histmap_lead_el_isoip_3l_sf  -> eval(abs((double)www.lep_eta()[0])       ,min((double)www.lep_pt()[0],b500) );
-                float subl_el_isoip_3l_sf  = variation > 0 ? histmap_subl_el_isoip_3l_sf  -> eval_up(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : variation < 0 ? histmap_subl_el_isoip_3l_sf  -> eval_down(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) ) : histmap_subl_el_isoip_3l_sf  -> eval(abs((double)www.lep_eta()[1])       ,min((double)www.lep_pt()[1],b500) );
-                float tert_mu_isoip_3l_sf  = variation > 0 ? histmap_tert_mu_isoip_3l_sf  -> eval_up(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b120) ) : variation < 0 ? histmap_tert_mu_isoip_3l_sf  -> eval_down(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b120) ) : histmap_tert_mu_isoip_3l_sf  -> eval(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b120) );
-                float tert_el_isoip_3l_sf  = variation > 0 ? histmap_tert_el_isoip_3l_sf  -> eval_up(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) ) : variation < 0 ? histmap_tert_el_isoip_3l_sf  -> eval_down(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) ) : histmap_tert_el_isoip_3l_sf  -> eval(abs((double)www.lep_eta()[2])       ,min((double)www.lep_pt()[2],b500) );
-
-                // Scale factors
-                float ee_sf = lead_el_recoid_sf * lead_el_mva_sf * lead_el_isoip_sf * subl_el_recoid_sf * subl_el_mva_sf * subl_el_isoip_sf;
-                float em_sf = emu_mu_recoid_sf * emu_mu_isoip_sf * emu_el_recoid_sf * emu_el_mva_sf * emu_el_isoip_sf;
-                float mm_sf = lead_mu_recoid_sf * lead_mu_isoip_sf * subl_mu_recoid_sf * subl_mu_isoip_sf;
-                float lead_el = lead_el_recoid_3l_sf * lead_el_mva_3l_sf * lead_el_isoip_3l_sf;
-                float subl_el = subl_el_recoid_3l_sf * subl_el_mva_3l_sf * subl_el_isoip_3l_sf;
-                float tert_el = tert_el_recoid_3l_sf * tert_el_mva_3l_sf * tert_el_isoip_3l_sf;
-                float lead_mu = lead_mu_recoid_3l_sf * lead_mu_isoip_3l_sf;
-                float subl_mu = subl_mu_recoid_3l_sf * subl_mu_isoip_3l_sf;
-                float tert_mu = tert_mu_recoid_3l_sf * tert_mu_isoip_3l_sf;
-                float threelep_sf = ((abs(www.lep_pdgId()[0])==11)*(lead_el)+(abs(www.lep_pdgId()[0])!=11)*(lead_mu))
-                    *((abs(www.lep_pdgId()[1])==11)*(subl_el)+(abs(www.lep_pdgId()[1])!=11)*(subl_mu))
-                    *((abs(www.lep_pdgId()[2])==11)*(tert_el)+(abs(www.lep_pdgId()[2])!=11)*(tert_mu));
-
-                ee_sf       = doFakeEstimation ? 1 : ee_sf;
-                em_sf       = doFakeEstimation ? 1 : em_sf;
-                mm_sf       = doFakeEstimation ? 1 : mm_sf;
-                threelep_sf = doFakeEstimation ? 1 : threelep_sf;
-
-                if (www.nVlep() == 2)
+                // The down, nominal and up scale factors of the event are looked up together once per event
+                if (evaluated_epoch != epoch)
                 {
-                    if (abs(www.lep_pdgId()[0]) * abs(www.lep_pdgId()[1]) == 121)
-                    {
-                        return ee_sf;
-                    }
-                    else if (abs(www.lep_pdgId()[0]) * abs(www.lep_pdgId()[1]) == 143)
-                    {
-                        return em_sf;
-                    }
-                    else if (abs(www.lep_pdgId()[0]) * abs(www.lep_pdgId()[1]) == 169)
-                    {
-                        return mm_sf;
-                    }
-                    else
+                    evaluate();
+                    evaluated_epoch = epoch;
+                }
+                return doFakeEstimation ? 1 : event_sf[variation > 0 ? 2 : variation < 0 ? 0 : 1];
+            }
+            else
+            {
+                // Set the lepton scale factors based on
+                return www.lepsf();
+            }
+        }
+
+        // Forget the scale factors of the previous event (to be called before the event variables are computed)
+        void newEvent()
+        {
+            if (++epoch == 0)
+            {
+                evaluated_epoch = 0;
+                epoch = 1;
+            }
+        }
+
+    private:
+        unsigned int epoch = 1;
+        unsigned int evaluated_epoch = 0;
+        float event_sf[3]; // down, nominal, up
+
+        // Handles of the maps in the scale factor table (by position of the lepton)
+        unsigned int mu_recoid[2];
+        unsigned int mu_isoip[2];
+        unsigned int el_recoid[2];
+        unsigned int el_mva[2];
+        unsigned int el_isoip[2];
+        unsigned int emu_mu_recoid;
+        unsigned int emu_mu_isoip;
+        unsigned int emu_el_recoid;
+        unsigned int emu_el_mva;
+        unsigned int emu_el_isoip;
+        unsigned int mu_recoid_3l[3];
+        unsigned int mu_isoip_3l[3];
+        unsigned int el_recoid_3l[3];
+        unsigned int el_mva_3l[3];
+        unsigned int el_isoip_3l[3];
+
+        // Multiply the down, nominal and up of a scale factor map into sf
+        static void multiply(float* sf, unsigned int imap, double x, double y)
+        {
+            ScaleFactorTable::Triple triple = scalefactortable.lookup(imap, x, y);
+            sf[0] *= triple.down;
+            sf[1] *= triple.nominal;
+            sf[2] *= triple.up;
+        }
+
+        // Scale factors of the event with only the maps for the flavors and the number of leptons of the event
+        // (the products are taken in the same order as when every map was evaluated, so the values are identical)
+        void evaluate()
+        {
+            const float* lep_pt = www.lep_pt_array();
+            const float* lep_eta = www.lep_eta_array();
+            const int* lep_pdgId = www.lep_pdgId_array();
+            std::fill(event_sf, event_sf + 3, 1);
+
+            if (www.nVlep() == 2)
+            {
+                if (abs(lep_pdgId[0]) * abs(lep_pdgId[1]) == 121)
+                {
+                    for (int ilep = 0; ilep < 2; ++ilep)
                     {
-                        std::cout << "Error: should not be here " << __FUNCTION__ << std::endl;
-                        return 1;
+                        multiply(event_sf, el_recoid[ilep], lep_eta[ilep], lep_pt[ilep]);
+                        multiply(event_sf, el_mva[ilep]   , lep_eta[ilep], lep_pt[ilep]);
+                        multiply(event_sf, el_isoip[ilep] , lep_eta[ilep], lep_pt[ilep]);
                     }
                 }
-                else if (www.nVlep() == 3)
+                else if (abs(lep_pdgId[0]) * abs(lep_pdgId[1]) == 143)
                 {
-                    return threelep_sf;
+                    multiply(event_sf, emu_mu_recoid, www.mu_pt() , www.mu_eta());
+                    multiply(event_sf, emu_mu_isoip , www.mu_eta(), www.mu_pt() );
+                    multiply(event_sf, emu_el_recoid, www.el_eta(), www.el_pt() );
+                    multiply(event_sf, emu_el_mva   , www.el_eta(), www.el_pt() );
+                    multiply(event_sf, emu_el_isoip , www.el_eta(), www.el_pt() );
+                }
+                else if (abs(lep_pdgId[0]) * abs(lep_pdgId[1]) == 169)
+                {
+                    for (int ilep = 0; ilep < 2; ++ilep)
+                    {
+                        multiply(event_sf, mu_recoid[ilep], lep_pt[ilep] , lep_eta[ilep]);
+                        multiply(event_sf, mu_isoip[ilep] , lep_eta[ilep], lep_pt[ilep] );
+                    }
                 }
                 else
                 {
-                    return 1;
+                    std::cout << "Error: should not be here " << __FUNCTION__ << std::endl;
                 }
-
             }
-            else
+            else if (www.nVlep() == 3)
             {
-                // Set the lepton scale factors based on
-                return www.lepsf();
+                for (int ilep = 0; ilep < 3; ++ilep)
+                {
+                    // Scale factor of each lepton with the maps of its flavor (anything but an electron takes the muon ones)
+                    float lep_sf[3] = {1, 1, 1};
+                    if (abs(lep_pdgId[ilep]) == 11)
+                    {
+                        multiply(lep_sf, el_recoid_3l[ilep], lep_eta[ilep], lep_pt[ilep]);
+                        multiply(lep_sf, el_mva_3l[ilep]   , lep_eta[ilep], lep_pt[ilep]);
+                        multiply(lep_sf, el_isoip_3l[ilep] , lep_eta[ilep], lep_pt[ilep]);
+                    }
+                    else
+                    {
+                        multiply(lep_sf, mu_recoid_3l[ilep], lep_pt[ilep] , lep_eta[ilep]);
+                        multiply(lep_sf, mu_isoip_3l[ilep] , lep_eta[ilep], lep_pt[ilep] );
+                    }
+                    for (int ivariation = 0; ivariation < 3; ++ivariation)
+                        event_sf[ivariation] *= lep_sf[ivariation];
+                }
             }
         }
 };
@@ -210,15 +180,6 @@ class LeptonScaleFactors
 class FakeRates
 {
     public:
-        RooUtil::HistMap* histmap_fr_ss_el;
-        RooUtil::HistMap* histmap_fr_ss_mu;
-        RooUtil::HistMap* histmap_fr_3l_el;
-        RooUtil::HistMap* histmap_fr_3l_mu;
-        RooUtil::HistMap* histmap_fr_ss_el_closure;
-        RooUtil::HistMap* histmap_fr_ss_mu_closure;
-        RooUtil::HistMap* histmap_fr_3l_el_closure;
-        RooUtil::HistMap* histmap_fr_3l_mu_closure;
-
         const float muiso_ss_thresh = 0.03;
         const float eliso_ss_thresh = 0.03;
         const float muiso_3l_thresh = 0.07;
@@ -226,26 +187,15 @@ class FakeRates
 
         FakeRates()
         {
-            histmap_fr_ss_el = new RooUtil::HistMap("scalefactors/fakerate_ss.root:El_ptcorretarolledcoarse_data_fakerate");
-            histmap_fr_ss_mu = new RooUtil::HistMap("scalefactors/fakerate_ss.root:Mu_ptcorretarolledcoarse_data_fakerate");
-            histmap_fr_3l_el = new RooUtil::HistMap("scalefactors/fakerate_3l.root:El_ptcorretarolledcoarse_data_fakerate");
-            histmap_fr_3l_mu = new RooUtil::HistMap("scalefactors/fakerate_3l.root:Mu_ptcorretarolledcoarse_data_fakerate");
-            histmap_fr_ss_el_closure = new RooUtil::HistMap("scalefactors/fakerate_ss.root:El_ptcorretarolledcoarse_data_fakerateclosure");
-            histmap_fr_ss_mu_closure = new RooUtil::HistMap("scalefactors/fakerate_ss.root:Mu_ptcorretarolledcoarse_data_fakerateclosure");
-            histmap_fr_3l_el_closure = new RooUtil::HistMap("scalefactors/fakerate_3l.root:El_ptcorretarolledcoarse_data_fakerateclosure");
-            histmap_fr_3l_mu_closure = new RooUtil::HistMap("scalefactors/fakerate_3l.root:Mu_ptcorretarolledcoarse_data_fakerateclosure");
-        }
-
-        ~FakeRates()
-        {
-            delete histmap_fr_ss_el;
-            delete histmap_fr_ss_mu;
-            delete histmap_fr_3l_el;
-            delete histmap_fr_3l_mu;
-            delete histmap_fr_ss_el_closure;
-            delete histmap_fr_ss_mu_closure;
-            delete histmap_fr_3l_el_closure;
-            delete histmap_fr_3l_mu_closure;
+            // Maps of the fake rates (read by scalefactortable.load())
+            fr_ss_el         = scalefactortable.add("scalefactors/fakerate_ss.root:El_ptcorretarolledcoarse_data_fakerate", kAsIs, kAsIs);
+            fr_ss_mu         = scalefactortable.add("scalefactors/fakerate_ss.root:Mu_ptcorretarolledcoarse_data_fakerate", kAsIs, kAsIs);
+            fr_3l_el         = scalefactortable.add("scalefactors/fakerate_3l.root:El_ptcorretarolledcoarse_data_fakerate", kAsIs, kAsIs);
+            fr_3l_mu         = scalefactortable.add("scalefactors/fakerate_3l.root:Mu_ptcorretarolledcoarse_data_fakerate", kAsIs, kAsIs);
+            fr_ss_el_closure = scalefactortable.add("scalefactors/fakerate_ss.root:El_ptcorretarolledcoarse_data_fakerateclosure", kAsIs, kAsIs);
+            fr_ss_mu_closure = scalefactortable.add("scalefactors/fakerate_ss.root:Mu_ptcorretarolledcoarse_data_fakerateclosure", kAsIs, kAsIs);
+            fr_3l_el_closure = scalefactortable.add("scalefactors/fakerate_3l.root:El_ptcorretarolledcoarse_data_fakerateclosure", kAsIs, kAsIs);
+            fr_3l_mu_closure = scalefactortable.add("scalefactors/fakerate_3l.root:Mu_ptcorretarolledcoarse_data_fakerateclosure", kAsIs, kAsIs);
         }
 
         int getFakeLepIndex()
@@ -255,8 +205,8 @@ class FakeRates
                 return -1;
 
             // Retrieve the flags for the lepton ID
-            const vector<int>& istight = www.nVlep() == 2 ? www.lep_pass_VVV_cutbased_tight() : www.lep_pass_VVV_cutbased_3l_tight();
-            const vector<int>& isloose = www.nVlep() == 2 ? www.lep_pass_VVV_cutbased_fo() : www.lep_pass_VVV_cutbased_3l_fo();
+            const int* istight = www.nVlep() == 2 ? www.lep_pass_VVV_cutbased_tight_array() : www.lep_pass_VVV_cutbased_3l_tight_array();
+            const int* isloose = www.nVlep() == 2 ? www.lep_pass_VVV_cutbased_fo_array() : www.lep_pass_VVV_cutbased_3l_fo_array();
 
             // Figure out the index by whichever one is the loose but not tight
             int index = -1;
@@ -271,8 +221,12 @@ class FakeRates
 
         float getPtCorr()
         {
-            int index = getFakeLepIndex();
+            return getPtCorr(getFakeLepIndex());
+        }
 
+        // For a caller that already has the index of the fake lepton
+        float getPtCorr(int index)
+        {
             if (index < 0)
                 return 0;
 
@@ -282,139 +236,154 @@ class FakeRates
                 lepversion = 1;
 
             float ptcorr = -1;
-            if (abs(www.lep_pdgId()[index]) == 11 and lepversion == 0)
+            if (abs(www.lep_pdgId_array()[index]) == 11 and lepversion == 0)
             {
-                ptcorr = www.lep_pt()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep()[index]-eliso_ss_thresh));
+                ptcorr = www.lep_pt_array()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep_array()[index]-eliso_ss_thresh));
             }
-            else if (abs(www.lep_pdgId()[index]) == 13 and lepversion == 0)
+            else if (abs(www.lep_pdgId_array()[index]) == 13 and lepversion == 0)
             {
-                ptcorr = www.lep_pt()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep()[index]-muiso_ss_thresh));
+                ptcorr = www.lep_pt_array()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep_array()[index]-muiso_ss_thresh));
 //                std::cout <<  " ptcorr: " << ptcorr <<  " fabs(www.lep_eta()[index]): " << fabs(www.lep_eta()[index]) <<  " fr: " << fr <<  " muiso_ss_thresh: " << muiso_ss_thresh <<  std::endl;
             }
-            else if (abs(www.lep_pdgId()[index]) == 11 and lepversion == 1)
+            else if (abs(www.lep_pdgId_array()[index]) == 11 and lepversion == 1)
             {
-                ptcorr = www.lep_pt()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep()[index]-eliso_3l_thresh));
+                ptcorr = www.lep_pt_array()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep_array()[index]-eliso_3l_thresh));
             }
-            else if (abs(www.lep_pdgId()[index]) == 13 and lepversion == 1)
+            else if (abs(www.lep_pdgId_array()[index]) == 13 and lepversion == 1)
             {
-                ptcorr = www.lep_pt()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep()[index]-muiso_3l_thresh));
+                ptcorr = www.lep_pt_array()[index] * (1 + max((double) 0. , (double) www.lep_relIso03EAv2Lep_array()[index]-muiso_3l_thresh));
             }
             return ptcorr;
         }
 
+        // Fake lepton of the event with the fake factors of every variation
+        struct FakeLepton
+        {
+            int index;           // -1 if the event has no loose but not tight lepton
+            int lepid;           // abs(pdgId) (0 without a fake lepton)
+            float ptcorr;
+            float abseta;
+            float factors[2][3]; // [closure map, fake rate map][down, nominal, up] (0 without a fake rate map for the lepton)
+        };
+
+        // The fake lepton and its fake factors are only looked up once per event
+        const FakeLepton& getFakeLepton()
+        {
+            if (evaluated_epoch != epoch)
+            {
+                evaluate();
+                evaluated_epoch = epoch;
+            }
+            return fakelepton;
+        }
+
         float getFakeFactor(int err=0, int lepflav=0, bool doclosureerr=false)
         {
-            int index = getFakeLepIndex();
-            float ptcorr = getPtCorr();
-            float fr = 0;
+            const FakeLepton& fake = getFakeLepton();
+
+            // The rate is only varied for a fake lepton of the flavor of the error
+            // N.B. the closure maps are used unless doclosureerr is set
+            bool lepidmatchforerror = fake.lepid == abs(lepflav);
+            int ivariation = (err == 1 and lepidmatchforerror) ? 2 : (err ==-1 and lepidmatchforerror) ? 0 : 1;
+            return fake.factors[doclosureerr ? 1 : 0][ivariation];
+        }
+
+        // Forget the fake lepton of the previous event (to be called before the event variables are computed)
+        void newEvent()
+        {
+            if (++epoch == 0)
+            {
+                evaluated_epoch = 0;
+                epoch = 1;
+            }
+        }
+
+    private:
+        // Handles of the maps in the scale factor table
+        unsigned int fr_ss_el;
+        unsigned int fr_ss_mu;
+        unsigned int fr_3l_el;
+        unsigned int fr_3l_mu;
+        unsigned int fr_ss_el_closure;
+        unsigned int fr_ss_mu_closure;
+        unsigned int fr_3l_el_closure;
+        unsigned int fr_3l_mu_closure;
+
+        unsigned int epoch = 1;
+        unsigned int evaluated_epoch = 0;
+        FakeLepton fakelepton;
+
+        // Fake factor fr / (1 - fr) of a rate
+        static float getFakeFactorOfRate(float fr) { return fr / (1 - fr); }
+
+        void evaluate()
+        {
+            FakeLepton& fake = fakelepton;
+            fake.index = getFakeLepIndex();
+            fake.lepid = fake.index >= 0 ? abs(www.lep_pdgId_array()[fake.index]) : 0;
+            fake.ptcorr = getPtCorr(fake.index);
+            fake.abseta = fake.index >= 0 ? fabs(www.lep_eta_array()[fake.index]) : 0;
 
             // Create an int to indicate which lepton id fakerate to use
             int lepversion = 0;
             if (www.nLlep() >= 3)
                 lepversion = 1;
 
-            int lepid = abs(www.lep_pdgId()[index]);
-            bool lepidmatchforerror = abs(lepid) == abs(lepflav);
-                
-
-            if (abs(www.lep_pdgId()[index]) == 11 and lepversion == 0)
+            unsigned int imaps[2];
+            if (fake.lepid == 11 and lepversion == 0)
             {
-                if (doclosureerr)
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_el->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_el->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_ss_el->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
-                else
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_el_closure->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_el_closure->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_ss_el_closure->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
+                imaps[0] = fr_ss_el_closure;
+                imaps[1] = fr_ss_el;
             }
-            else if (abs(www.lep_pdgId()[index]) == 13 and lepversion == 0)
+            else if (fake.lepid == 13 and lepversion == 0)
             {
-                if (doclosureerr)
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_mu->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_mu->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_ss_mu->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
-                else
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_mu_closure->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_ss_mu_closure->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_ss_mu_closure->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
+                imaps[0] = fr_ss_mu_closure;
+                imaps[1] = fr_ss_mu;
             }
-            else if (abs(www.lep_pdgId()[index]) == 11 and lepversion == 1)
+            else if (fake.lepid == 11 and lepversion == 1)
             {
-                if (doclosureerr)
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_el->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_el->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_3l_el->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
-                else
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_el_closure->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_el_closure->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_3l_el_closure->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
+                imaps[0] = fr_3l_el_closure;
+                imaps[1] = fr_3l_el;
             }
-            else if (abs(www.lep_pdgId()[index]) == 13 and lepversion == 1)
+            else if (fake.lepid == 13 and lepversion == 1)
             {
-                if (doclosureerr)
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_mu->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_mu->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_3l_mu->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
-                else
-                {
-                    if (err == 1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_mu_closure->eval_up(ptcorr, fabs(www.lep_eta()[index]));
-                    else if (err ==-1 and lepidmatchforerror)
-                        fr = histmap_fr_3l_mu_closure->eval_down(ptcorr, fabs(www.lep_eta()[index]));
-                    else
-                        fr = histmap_fr_3l_mu_closure->eval(ptcorr, fabs(www.lep_eta()[index]));
-                }
+                imaps[0] = fr_3l_mu_closure;
+                imaps[1] = fr_3l_mu;
             }
             else
             {
-                return 0;
+                std::fill(&fake.factors[0][0], &fake.factors[0][0] + 6, 0);
+                return;
             }
-            return fr / (1 - fr);
-        }
 
+            for (int imap = 0; imap < 2; ++imap)
+            {
+                ScaleFactorTable::Triple triple = scalefactortable.lookup(imaps[imap], fake.ptcorr, fake.abseta);
+                fake.factors[imap][0] = getFakeFactorOfRate(triple.down);
+                fake.factors[imap][1] = getFakeFactorOfRate(triple.nominal);
+                fake.factors[imap][2] = getFakeFactorOfRate(triple.up);
+            }
+        }
 };
 
 //_______________________________________________________________________________________________________
+// Normalizations of the theory weights (sums of the weights in h_neventsinfile) of the current input file
+// The normalizations of every file of the chain are read into a table before the event loop (loadFiles()), so switching
+// to the next file is a lookup in the table instead of opening the file again.
 class TheoryWeight
 {
     public:
-        RooUtil::HistMap* histmap_neventsinfile;
+        struct Normalization
+        {
+            float nominal;
+            float pdfup;
+            float pdfdn;
+            float alsup;
+            float alsdn;
+            float qsqup;
+            float qsqdn;
+        };
+
         float nominal_;
         float pdfup_;
         float pdfdn_;
@@ -422,17 +391,34 @@ class TheoryWeight
         float alsdn_;
         float qsqup_;
         float qsqdn_;
-        TheoryWeight() : histmap_neventsinfile(0), nominal_(1), pdfup_(1), pdfdn_(1), alsup_(1), alsdn_(1), qsqup_(1), qsqdn_(1) {}
+        TheoryWeight() : nominal_(1), pdfup_(1), pdfdn_(1), alsup_(1), alsdn_(1), qsqup_(1), qsqdn_(1) {}
+
+        // Read the normalizations of the files of the chain with entries in [first_entry, last_entry), nthreads files at a time
+        void loadFiles(TChain* chain, Long64_t first_entry, Long64_t last_entry, int nthreads = 1);
+
+        // Switch to the normalizations of a file (read from the file if it was not in the chain given to loadFiles())
         void setFile(TString fname)
         {
-            histmap_neventsinfile = new RooUtil::HistMap(fname + ":h_neventsinfile");
-            nominal_ = histmap_neventsinfile->hist->GetBinContent(1+1);
-            pdfup_   = histmap_neventsinfile->hist->GetBinContent(1+10);
-            pdfdn_   = histmap_neventsinfile->hist->GetBinContent(1+11);
-            alsup_   = histmap_neventsinfile->hist->GetBinContent(1+13);
-            alsdn_   = histmap_neventsinfile->hist->GetBinContent(1+12);
-            qsqup_   = histmap_neventsinfile->hist->GetBinContent(1+5);
-            qsqdn_   = histmap_neventsinfile->hist->GetBinContent(1+9);
+            std::map<TString, unsigned int>::iterator row = rows.find(fname);
+            if (row == rows.end())
+            {
+                Normalization normalization;
+                if (not readFile(fname, normalization))
+                {
+                    printf("[TheoryWeight::setFile] Could not read h_neventsinfile from %s\n", fname.Data());
+                    exit(1);
+                }
+                row = rows.insert(std::make_pair(fname, (unsigned int) normalizations.size())).first;
+                normalizations.push_back(normalization);
+            }
+            const Normalization& normalization = normalizations[row->second];
+            nominal_ = normalization.nominal;
+            pdfup_   = normalization.pdfup;
+            pdfdn_   = normalization.pdfdn;
+            alsup_   = normalization.alsup;
+            alsdn_   = normalization.alsdn;
+            qsqup_   = normalization.qsqup;
+            qsqdn_   = normalization.qsqdn;
         }
         float& nominal() { return nominal_; }
         float& pdfup()   { return pdfup_  ; }
@@ -441,33 +427,43 @@ class TheoryWeight
         float& alsdn()   { return alsdn_  ; }
         float& qsqup()   { return qsqup_  ; }
         float& qsqdn()   { return qsqdn_  ; }
+
+    private:
+        static bool readFile(TString fname, Normalization& normalization);
+
+        std::vector<Normalization> normalizations;
+        std::map<TString, unsigned int> rows; // by file name
 };
 
 //_______________________________________________________________________________________________________
 class PileupReweight
 {
     public:
-        RooUtil::HistMap* histmap_purwegt;
-        RooUtil::HistMap* histmap_purwegt_up;
-        RooUtil::HistMap* histmap_purwegt_dn;
         PileupReweight()
         {
-            histmap_purwegt    = new RooUtil::HistMap("scalefactors/puw_2017.root:puw_central");
-            histmap_purwegt_up = new RooUtil::HistMap("scalefactors/puw_2017.root:puw_up");
-            histmap_purwegt_dn = new RooUtil::HistMap("scalefactors/puw_2017.root:puw_down");
+            // Maps of the pileup weights (read by scalefactortable.load())
+            puw_central = scalefactortable.add("scalefactors/puw_2017.root:puw_central", kAsIs, kAsIs);
+            puw_up      = scalefactortable.add("scalefactors/puw_2017.root:puw_up", kAsIs, kAsIs);
+            puw_dn      = scalefactortable.add("scalefactors/puw_2017.root:puw_down", kAsIs, kAsIs);
         }
         float purewgt()
         {
-            return histmap_purwegt->eval(www.nTrueInt());
+            return scalefactortable.lookup(puw_central, www.nTrueInt()).nominal;
         }
         float purewgt_up()
         {
-            return histmap_purwegt_up->eval(www.nTrueInt());
+            return scalefactortable.lookup(puw_up, www.nTrueInt()).nominal;
         }
         float purewgt_dn()
         {
-            return histmap_purwegt_dn->eval(www.nTrueInt());
+            return scalefactortable.lookup(puw_dn, www.nTrueInt()).nominal;
         }
+
+    private:
+        // Handles of the maps in the scale factor table
+        unsigned int puw_central;
+        unsigned int puw_up;
+        unsigned int puw_dn;
 };
 
 #ifndef __CINT__
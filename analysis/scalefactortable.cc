@@ -0,0 +1,270 @@
+#include "scalefactortable.h"
+#include "TFile.h"
+#include <map>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Format of the bundle files: the header, the histograms, the edges, the triples, then the null terminated paths
+// (the sections are all naturally aligned, so they are used in place once the file is mapped)
+static const char kBundleMagic[8] = {'W', 'W', 'W', 'S', 'F', 'T', 'B', 'L'};
+static const unsigned int kBundleVersion = 1;
+
+//_______________________________________________________________________________________________________
+unsigned int ScaleFactorTable::add(TString path, Coordinate x, Coordinate y)
+{
+    unsigned int ipath = std::find(paths.begin(), paths.end(), path) - paths.begin();
+    if (ipath == paths.size())
+        paths.push_back(path);
+
+    for (unsigned int irequest = 0; irequest < requests.size(); ++irequest)
+    {
+        const Request& request = requests[irequest];
+        if (request.ipath == ipath and
+                request.x.abs == x.abs and request.x.cap == x.cap and
+                request.y.abs == y.abs and request.y.cap == y.cap)
+            return irequest;
+    }
+
+    Request request;
+    request.ipath = ipath;
+    request.x = x;
+    request.y = y;
+    requests.push_back(request);
+    return requests.size() - 1;
+}
+
+//_______________________________________________________________________________________________________
+void ScaleFactorTable::load(TString bundle_file_name)
+{
+    if (bundle_file_name.IsNull())
+        readRootFiles();
+    else
+        readBundle(bundle_file_name);
+
+    maps.clear();
+    for (auto& request : requests)
+    {
+        const Histogram& histogram = histograms[request.ipath];
+        Map map;
+        map.x = makeAxis(histogram.x, request.x);
+        map.y = makeAxis(histogram.y, request.y);
+        map.offset = histogram.offset;
+        maps.push_back(map);
+    }
+
+    std::cout <<  " Loaded " << maps.size() << " scale factor maps of " << histograms.size() << " histograms from " << (bundle_file_name.IsNull() ? TString("the ROOT files") : bundle_file_name) << std::endl;
+}
+
+//_______________________________________________________________________________________________________
+void ScaleFactorTable::readRootFiles()
+{
+    histograms.clear();
+    edges.clear();
+    values.clear();
+
+    // Each file is opened once for all the histograms it holds
+    std::map<TString, TFile*> files;
+    for (auto& path : paths)
+    {
+        int separator = path.Last(':');
+        TString file_name = path(0, separator);
+        TString hist_name = path(separator + 1, path.Length() - separator - 1);
+        if (files.find(file_name) == files.end())
+            files[file_name] = TFile::Open(file_name);
+        TFile* file = files[file_name];
+        TH1* hist = file ? (TH1*) file->Get(hist_name) : 0;
+        if (not hist)
+        {
+            printf("[ScaleFactorTable::readRootFiles] Could not read %s\n", path.Data());
+            exit(1);
+        }
+        addHistogram(hist);
+    }
+    for (auto& file : files)
+    {
+        if (file.second)
+            file.second->Close();
+    }
+
+    edge_data = edges.data();
+    value_data = values.data();
+    nedges = edges.size();
+    nvalues = values.size();
+}
+
+//_______________________________________________________________________________________________________
+ScaleFactorTable::Binning ScaleFactorTable::makeBinning(TAxis* taxis)
+{
+    Binning binning;
+    binning.nbins = taxis->GetNbins();
+    binning.first_edge = edges.size();
+    binning.fixed = not taxis->IsVariableBinSize();
+    binning.padding = 0;
+    binning.min = taxis->GetXmin();
+    binning.max = taxis->GetXmax();
+    for (unsigned int ibin = 1; ibin <= binning.nbins + 1; ++ibin)
+        edges.push_back(taxis->GetBinLowEdge(ibin));
+    return binning;
+}
+
+//_______________________________________________________________________________________________________
+void ScaleFactorTable::addHistogram(TH1* hist)
+{
+    if (hist->GetDimension() > 2)
+    {
+        printf("[ScaleFactorTable::addHistogram] Only 1D and 2D maps can be added to the table (%s)\n", hist->GetName());
+        exit(1);
+    }
+
+    Histogram histogram;
+    histogram.x = makeBinning(hist->GetXaxis());
+    if (hist->GetDimension() == 2)
+    {
+        histogram.y = makeBinning(hist->GetYaxis());
+    }
+    else
+    {
+        histogram.y = histogram.x;
+        histogram.y.nbins = 0;
+    }
+    histogram.offset = values.size();
+    histogram.name = 0;
+
+    // Same global bin numbering as TH1::GetBin (x + (nx + 2) * y)
+    unsigned int nybins = histogram.y.nbins > 0 ? histogram.y.nbins + 2 : 1;
+    for (unsigned int ybin = 0; ybin < nybins; ++ybin)
+    {
+        for (unsigned int xbin = 0; xbin < histogram.x.nbins + 2; ++xbin)
+        {
+            double content = histogram.y.nbins > 0 ? hist->GetBinContent(xbin, ybin) : hist->GetBinContent(xbin);
+            double error = histogram.y.nbins > 0 ? hist->GetBinError(xbin, ybin) : hist->GetBinError(xbin);
+            Triple triple;
+            triple.down = content - error;
+            triple.nominal = content;
+            triple.up = content + error;
+            values.push_back(triple);
+        }
+    }
+    histograms.push_back(histogram);
+}
+
+//_______________________________________________________________________________________________________
+ScaleFactorTable::Axis ScaleFactorTable::makeAxis(const Binning& binning, Coordinate coordinate)
+{
+    Axis axis;
+    axis.nbins = binning.nbins;
+    axis.fixed = binning.fixed;
+    axis.min = binning.min;
+    axis.max = binning.max;
+    axis.first_edge = binning.first_edge;
+    axis.coordinate = coordinate;
+    return axis;
+}
+
+//_______________________________________________________________________________________________________
+void ScaleFactorTable::writeBundle(TString bundle_file_name)
+{
+    if (histograms.size() != paths.size())
+        readRootFiles();
+
+    std::string names;
+    std::vector<Histogram> bundle_histograms = histograms;
+    for (unsigned int ipath = 0; ipath < paths.size(); ++ipath)
+    {
+        bundle_histograms[ipath].name = names.size();
+        names += paths[ipath].Data();
+        names += '\0';
+    }
+
+    BundleHeader header;
+    memcpy(header.magic, kBundleMagic, sizeof(header.magic));
+    header.version = kBundleVersion;
+    header.nhistograms = bundle_histograms.size();
+    header.nedges = nedges;
+    header.nvalues = nvalues;
+    header.nnamechars = names.size();
+    header.padding = 0;
+
+    FILE* file = fopen(bundle_file_name.Data(), "wb");
+    if (not file)
+    {
+        printf("[ScaleFactorTable::writeBundle] Could not open %s\n", bundle_file_name.Data());
+        exit(1);
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok and fwrite(bundle_histograms.data(), sizeof(Histogram), bundle_histograms.size(), file) == bundle_histograms.size();
+    ok = ok and fwrite(edge_data, sizeof(double), nedges, file) == nedges;
+    ok = ok and fwrite(value_data, sizeof(Triple), nvalues, file) == nvalues;
+    ok = ok and fwrite(names.data(), 1, names.size(), file) == names.size();
+    ok = (fclose(file) == 0) and ok;
+    if (not ok)
+    {
+        printf("[ScaleFactorTable::writeBundle] Failed to write %s\n", bundle_file_name.Data());
+        exit(1);
+    }
+
+    std::cout <<  " Wrote " << paths.size() << " scale factor histograms to " << bundle_file_name << std::endl;
+}
+
+//_______________________________________________________________________________________________________
+void ScaleFactorTable::readBundle(TString bundle_file_name)
+{
+    // The file is mapped read-only and shared for the lifetime of the process (never unmapped, the table is global)
+    int fd = open(bundle_file_name.Data(), O_RDONLY);
+    struct stat file_stat;
+    if (fd < 0 or fstat(fd, &file_stat) != 0 or file_stat.st_size < (off_t) sizeof(BundleHeader))
+    {
+        printf("[ScaleFactorTable::readBundle] Could not open %s\n", bundle_file_name.Data());
+        exit(1);
+    }
+    void* mapped = mmap(0, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        printf("[ScaleFactorTable::readBundle] Could not map %s\n", bundle_file_name.Data());
+        exit(1);
+    }
+
+    const char* data = (const char*) mapped;
+    const BundleHeader* header = (const BundleHeader*) data;
+    size_t histograms_begin = sizeof(BundleHeader);
+    size_t edges_begin = histograms_begin + header->nhistograms * sizeof(Histogram);
+    size_t values_begin = edges_begin + header->nedges * sizeof(double);
+    size_t names_begin = values_begin + header->nvalues * sizeof(Triple);
+    if (memcmp(header->magic, kBundleMagic, sizeof(header->magic)) != 0 or header->version != kBundleVersion or
+            names_begin + header->nnamechars != (size_t) file_stat.st_size)
+    {
+        printf("[ScaleFactorTable::readBundle] %s is not a scale factor bundle of this version (make it again with packsf)\n", bundle_file_name.Data());
+        exit(1);
+    }
+
+    // Histograms of the bundle by path
+    const Histogram* bundle_histograms = (const Histogram*) (data + histograms_begin);
+    std::map<TString, unsigned int> bundle_index;
+    for (unsigned int ihistogram = 0; ihistogram < header->nhistograms; ++ihistogram)
+        bundle_index[data + names_begin + bundle_histograms[ihistogram].name] = ihistogram;
+
+    histograms.clear();
+    for (auto& path : paths)
+    {
+        if (bundle_index.find(path) == bundle_index.end())
+        {
+            printf("[ScaleFactorTable::readBundle] %s is not in %s (make it again with packsf)\n", path.Data(), bundle_file_name.Data());
+            exit(1);
+        }
+        histograms.push_back(bundle_histograms[bundle_index[path]]);
+    }
+
+    edges.clear();
+    values.clear();
+    edge_data = (const double*) (data + edges_begin);
+    value_data = (const Triple*) (data + values_begin);
+    nedges = header->nedges;
+    nvalues = header->nvalues;
+}
@@ -0,0 +1,167 @@
+#ifndef scalefactortable_h
+#define scalefactortable_h
+
+#include "TString.h"
+#include "TH1.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+//_______________________________________________________________________________________________________
+// Scale factor, fake rate and pileup maps compiled into one contiguous table
+// The maps are registered by path ("file.root:histogram") with the transformation of their coordinates (abs(eta), pt capped
+// below the last bin edge), and each distinct histogram is read once by load(), however many maps use it. Every histogram is
+// stored as the edges of its axes and one (down, nominal, up) triple per bin, i.e. the content minus/plus the error as given by
+// HistMap::eval_down/eval/eval_up, including the under/overflow bins. The bins are found by counting the edges below the value
+// for variable size bins (no branches, the loop over the few edges vectorizes) and with the arithmetic of TAxis::FindBin for
+// fixed size bins, so that every lookup lands in the same bin as the TH1/TH2 lookup of the HistMap.
+// The table can be written to a bundle file (see writeBundle()) that load() maps read-only into memory instead of opening the
+// ROOT files, so that the processes running on the same node share one copy of the table.
+class ScaleFactorTable
+{
+    public:
+        struct Triple
+        {
+            float down;
+            float nominal;
+            float up;
+        };
+
+        // Transformation of a coordinate before the lookup
+        struct Coordinate
+        {
+            bool abs;
+            double cap;
+        };
+
+        // Register a map (the handle is used for the lookups, the same map registered twice gets the same handle)
+        unsigned int add(TString path, Coordinate x, Coordinate y);
+
+        // Read the histograms of all the registered maps from their ROOT files, or from a bundle if a file name is given
+        // (to be called once all the maps are registered and before any lookup)
+        void load(TString bundle_file_name = "");
+
+        // Write the histograms of all the registered maps to a bundle file
+        void writeBundle(TString bundle_file_name);
+
+        inline Triple lookup(unsigned int imap, double x, double y = 0) const
+        {
+            const Map& map = maps[imap];
+            unsigned int xbin = findBin(map.x, transform(map.x, x));
+            unsigned int ybin = map.y.nbins > 0 ? findBin(map.y, transform(map.y, y)) : 0;
+            return value_data[map.offset + ybin * (map.x.nbins + 2) + xbin];
+        }
+
+        unsigned int size() const { return requests.size(); }
+
+    private:
+        // Binning of an axis of a histogram as stored in the bundle
+        struct Binning
+        {
+            unsigned int nbins;      // 0 for the y axis of a 1D histogram
+            unsigned int first_edge; // nbins + 1 edges (variable size bins)
+            unsigned int fixed;
+            unsigned int padding;
+            double min;
+            double max;
+        };
+
+        struct Histogram
+        {
+            Binning x;
+            Binning y;
+            unsigned int offset;     // first triple, (nx + 2) x (ny + 2) triples with x running fastest
+            unsigned int name;       // first character of the path in the names of the bundle
+        };
+
+        struct BundleHeader
+        {
+            char magic[8];
+            unsigned int version;
+            unsigned int nhistograms;
+            unsigned int nedges;
+            unsigned int nvalues;
+            unsigned int nnamechars;
+            unsigned int padding;
+        };
+
+        struct Request
+        {
+            unsigned int ipath;
+            Coordinate x;
+            Coordinate y;
+        };
+
+        struct Axis
+        {
+            unsigned int nbins;
+            bool fixed;
+            double min;
+            double max;
+            unsigned int first_edge;
+            Coordinate coordinate;
+        };
+
+        struct Map
+        {
+            Axis x;
+            Axis y;
+            unsigned int offset;
+        };
+
+        static inline double transform(const Axis& axis, double value)
+        {
+            double transformed = axis.coordinate.abs ? fabs(value) : value;
+            return std::min(transformed, axis.coordinate.cap);
+        }
+
+        inline unsigned int findBin(const Axis& axis, double value) const
+        {
+            if (axis.fixed)
+            {
+                // Same as TAxis::FindBin (a NaN goes to the overflow)
+                double u = std::min(std::max(-1., axis.nbins * (value - axis.min) / (axis.max - axis.min)), (double) axis.nbins);
+                unsigned int bin = 1 + (int) u;
+                bin = value < axis.min ? 0 : bin;
+                return value < axis.max ? bin : axis.nbins + 1;
+            }
+            const double* edge = &edge_data[axis.first_edge];
+            unsigned int bin = 0;
+            for (unsigned int iedge = 0; iedge <= axis.nbins; ++iedge)
+                bin += not (value < edge[iedge]);
+            return bin;
+        }
+
+        void readRootFiles();
+        void readBundle(TString bundle_file_name);
+        Binning makeBinning(TAxis* taxis);
+        void addHistogram(TH1* hist);
+        static Axis makeAxis(const Binning& binning, Coordinate coordinate);
+
+        // Registered maps (by handle) and the distinct histograms they use
+        std::vector<TString> paths;
+        std::vector<Request> requests;
+
+        // Loaded histograms (by path) with their edges and triples, either owned or mapped from a bundle
+        std::vector<Histogram> histograms;
+        std::vector<double> edges;
+        std::vector<Triple> values;
+        const double* edge_data = 0;
+        const Triple* value_data = 0;
+        unsigned int nedges = 0;
+        unsigned int nvalues = 0;
+
+        // Maps ready for the lookups (by handle)
+        std::vector<Map> maps;
+};
+
+// Coordinates of the maps
+const ScaleFactorTable::Coordinate kAsIs   = {false, INFINITY};
+const ScaleFactorTable::Coordinate kAbsEta = {true, INFINITY};
+const ScaleFactorTable::Coordinate kPt120  = {false, 119.9};
+const ScaleFactorTable::Coordinate kPt200  = {false, 199.99};
+const ScaleFactorTable::Coordinate kPt500  = {false, 499.9};
+
+extern ScaleFactorTable scalefactortable;
+
+#endif
@@ -2,3589 +2,345 @@
 
 void addSystematicCuts(RooUtil::Cutflow& cutflow)
 {
-    if (doFakeEstimation)
-    {
-        if (!is2017)
-        {
-            cutflow.addWgtSyst("FakeUp"            , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_full_up()       / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeDown"          , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_full_dn()       / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeRateUp"        , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_up()            / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeRateDown"      , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_dn()            / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeRateElUp"      , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_el_up()         / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeRateElDown"    , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_el_dn()         / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeRateMuUp"      , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_mu_up()         / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeRateMuDown"    , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_mu_dn()         / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeClosureUp"     , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_closure_up()    / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeClosureDown"   , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_closure_dn()    / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeClosureElUp"   , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_closure_el_up() / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeClosureElDown" , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_closure_el_dn() / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeClosureMuUp"   , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_closure_mu_up() / www.ffwgt(); } );
-            cutflow.addWgtSyst("FakeClosureMuDown" , [&]() { return www.ffwgt() == 0 ? 0 : www.ffwgt_closure_mu_dn() / www.ffwgt(); } );
-        }
-        else
-        {
-            cutflow.addWgtSyst("FakeUp"            , UNITY ); // TODO
-            cutflow.addWgtSyst("FakeDown"          , UNITY ); // TODO
-            cutflow.addWgtSyst("FakeRateUp"        , UNITY ); // TODO
-            cutflow.addWgtSyst("FakeRateDown"      , UNITY ); // TODO
-            cutflow.addWgtSyst("FakeRateElUp"      , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor( 1, 11) / fakerates.getFakeFactor() ;} );
-            cutflow.addWgtSyst("FakeRateElDown"    , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor(-1, 11) / fakerates.getFakeFactor() ;} );
-            cutflow.addWgtSyst("FakeRateMuUp"      , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor( 1, 13) / fakerates.getFakeFactor() ;} );
-            cutflow.addWgtSyst("FakeRateMuDown"    , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor(-1, 13) / fakerates.getFakeFactor() ;} );
-            cutflow.addWgtSyst("FakeClosureUp"     , UNITY ); // TODO
-            cutflow.addWgtSyst("FakeClosureDown"   , UNITY ); // TODO
-            cutflow.addWgtSyst("FakeClosureElUp"   , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor( 1, 11, true) / fakerates.getFakeFactor() ;} );
-            cutflow.addWgtSyst("FakeClosureElDown" , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor(-1, 11, true) / fakerates.getFakeFactor() ;} );
-            cutflow.addWgtSyst("FakeClosureMuUp"   , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor( 1, 13, true) / fakerates.getFakeFactor() ;} );
-            cutflow.addWgtSyst("FakeClosureMuDown" , [&]() { return fakerates.getFakeFactor() == 0 ? 0 : fakerates.getFakeFactor(-1, 13, true) / fakerates.getFakeFactor() ;} );
-        }
-    }
-
-    bool doJER = false; // TODO fix this to be more general
+    // Weight systematics (fake estimation and scale factor variations, as set by the mode of the output)
+    // The ratios of the varied to the nominal weights are computed together for every event (see SystematicWeights::compute())
+    for (auto& variation : SystematicWeights::getVariations())
+        cutflow.addWgtSyst(SystematicWeights::getName(variation), systematicweights.get(variation));
 
     // Systematics
     if (doSystematics)
     {
         // Declare cut varying systematics to cuts with the patterns provided in the vector
-        cutflow.addCutSyst("JESUp"  , {"jj", "MET", "Nj", "Nb", "VBF"});
-        cutflow.addCutSyst("JESDown", {"jj", "MET", "Nj", "Nb", "VBF"});
-        if (doJER)
-        {
-            cutflow.addCutSyst("JER"    , {"jj", "MET", "Nj", "Nb", "VBF"});
-            cutflow.addCutSyst("JERUp"  , {"jj", "MET", "Nj", "Nb", "VBF"});
-            cutflow.addCutSyst("JERDown", {"jj", "MET", "Nj", "Nb", "VBF"});
-        }
+        for (auto& variation : getJetVariations())
+            cutflow.addCutSyst(JetVariationCuts::getName(variation), {"jj", "MET", "Nj", "Nb", "VBF"});
 
-        if (is2017)
-        {
-            cutflow.addWgtSyst("LepSFUp"    , [&]() { return leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData) == 0 ? 0 : leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData, 1) / leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData) ; } );
-            cutflow.addWgtSyst("LepSFDown"  , [&]() { return leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData) == 0 ? 0 : leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData,-1) / leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData) ; } );
-            cutflow.addWgtSyst("TrigSFUp"   , [&]() { return 1 /*www.trigsf()          == 0                              ? 0 : www.trigsf_up()              / www.trigsf()                                                  */ ; } );
-            cutflow.addWgtSyst("TrigSFDown" , [&]() { return 1 /*www.trigsf()          == 0                              ? 0 : www.trigsf_dn()              / www.trigsf()                                                  */ ; } );
-            cutflow.addWgtSyst("BTagLFUp"   , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_light_DN() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("BTagLFDown" , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_light_UP() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("BTagHFUp"   , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_heavy_DN() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("BTagHFDown" , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_heavy_UP() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("PileupUp"   , [&]() { return pileupreweight.purewgt() == 0                           ? 0 : pileupreweight.purewgt_dn()  / pileupreweight.purewgt()                                             ; } );
-            cutflow.addWgtSyst("PileupDown" , [&]() { return pileupreweight.purewgt() == 0                           ? 0 : pileupreweight.purewgt_up()  / pileupreweight.purewgt()                                             ; } );
-            cutflow.addWgtSyst("PDFUp"      , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.pdfup() == 0 ? 0 : www.weight_pdf_up()          / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.pdfup(); } );
-            cutflow.addWgtSyst("PDFDown"    , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.pdfdn() == 0 ? 0 : www.weight_pdf_down()        / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.pdfdn(); } );
-            cutflow.addWgtSyst("QsqUp"      , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.qsqup() == 0 ? 0 : www.weight_fr_r2_f2()        / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.qsqup(); } );
-            cutflow.addWgtSyst("QsqDown"    , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.qsqdn() == 0 ? 0 : www.weight_fr_r0p5_f0p5()    / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.qsqdn(); } );
-            cutflow.addWgtSyst("AlphaSUp"   , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.alsup() == 0 ? 0 : www.weight_alphas_up()       / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.alsup(); } );
-            cutflow.addWgtSyst("AlphaSDown" , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.alsdn() == 0 ? 0 : www.weight_alphas_down()     / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.alsdn(); } );
-        }
-        else
+        // Vary the cuts that depend on the jets with the jet variation cut replacing each of them
+        for (auto& variation : getJetVariations())
         {
-            cutflow.addWgtSyst("LepSFUp"    , [&]() { return www.lepsf()           == 0                              ? 0 : www.lepsf_up()               / www.lepsf()                                                          ; } );
-            cutflow.addWgtSyst("LepSFDown"  , [&]() { return www.lepsf()           == 0                              ? 0 : www.lepsf_dn()               / www.lepsf()                                                          ; } );
-            cutflow.addWgtSyst("TrigSFUp"   , [&]() { return www.trigsf()          == 0                              ? 0 : www.trigsf_up()              / www.trigsf()                                                         ; } );
-            cutflow.addWgtSyst("TrigSFDown" , [&]() { return www.trigsf()          == 0                              ? 0 : www.trigsf_dn()              / www.trigsf()                                                         ; } );
-            cutflow.addWgtSyst("BTagLFUp"   , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_light_DN() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("BTagLFDown" , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_light_UP() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("BTagHFUp"   , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_heavy_DN() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("BTagHFDown" , [&]() { return www.weight_btagsf()   == 0                              ? 0 : www.weight_btagsf_heavy_UP() / www.weight_btagsf()                                                  ; } );
-            cutflow.addWgtSyst("PileupUp"   , [&]() { return www.purewgt()         == 0                              ? 0 : www.purewgt_dn()             / www.purewgt()                                                        ; } );
-            cutflow.addWgtSyst("PileupDown" , [&]() { return www.purewgt()         == 0                              ? 0 : www.purewgt_up()             / www.purewgt()                                                        ; } );
-            cutflow.addWgtSyst("PDFUp"      , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.pdfup() == 0 ? 0 : www.weight_pdf_up()          / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.pdfup(); } );
-            cutflow.addWgtSyst("PDFDown"    , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.pdfdn() == 0 ? 0 : www.weight_pdf_down()        / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.pdfdn(); } );
-            cutflow.addWgtSyst("QsqUp"      , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.qsqup() == 0 ? 0 : www.weight_fr_r2_f2()        / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.qsqup(); } );
-            cutflow.addWgtSyst("QsqDown"    , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.qsqdn() == 0 ? 0 : www.weight_fr_r0p5_f0p5()    / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.qsqdn(); } );
-            cutflow.addWgtSyst("AlphaSUp"   , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.alsup() == 0 ? 0 : www.weight_alphas_up()       / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.alsup(); } );
-            cutflow.addWgtSyst("AlphaSDown" , [&]() { return www.weight_fr_r1_f1() == 0 or theoryweight.alsdn() == 0 ? 0 : www.weight_alphas_down()     / www.weight_fr_r1_f1() * theoryweight.nominal() / theoryweight.alsdn(); } );
+            for (auto& jet_varied_cut : getJetVariedCuts())
+                cutflow.setCutSyst(jet_varied_cut.first, JetVariationCuts::getName(variation), jetvariationcuts.get(jet_varied_cut.second, variation), jetvariationcuts.getWeight(jet_varied_cut.second));
         }
-
     }
+}
 
-    // Systematic variations
-    if (doSystematics)
+//_______________________________________________________________________________________________________
+std::vector<JetVariationCuts::Variation> getJetVariations()
+{
+    // Jet energy scale and resolution variations of the cuts
+    std::vector<JetVariationCuts::Variation> jet_variations = {JetVariationCuts::kJESUp, JetVariationCuts::kJESDown};
+    if (doJER)
     {
-
-        systematic_cuts["fabs(www.Mjj_dn()-80.)<15."] =                                            [&]() { return fabs(www.Mjj_dn()-80.)<15.; };
-        systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."] =                                           [&]() { return fabs(www.Mjj_dn()-80.)>=15.; };
-        systematic_cuts["fabs(www.Mjj_jer()-80.)<15."] =                                           [&]() { return fabs(www.Mjj_jer()-80.)<15.; };
-        systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."] =                                          [&]() { return fabs(www.Mjj_jer()-80.)>=15.; };
-        systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."] =                                         [&]() { return fabs(www.Mjj_jerdn()-80.)<15.; };
-        systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."] =                                        [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.; };
-        systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."] =                                         [&]() { return fabs(www.Mjj_jerup()-80.)<15.; };
-        systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."] =                                        [&]() { return fabs(www.Mjj_jerup()-80.)>=15.; };
-        systematic_cuts["fabs(www.Mjj_up()-80.)<15."] =                                            [&]() { return fabs(www.Mjj_up()-80.)<15.; };
-        systematic_cuts["fabs(www.Mjj_up()-80.)>=15."] =                                           [&]() { return fabs(www.Mjj_up()-80.)>=15.; };
-        systematic_cuts["www.DPhi3lMET_dn()>2.5"] =                                                [&]() { return www.DPhi3lMET_dn()>2.5; };
-        systematic_cuts["www.DPhi3lMET_jer()>2.5"] =                                               [&]() { return www.DPhi3lMET_jer()>2.5; };
-        systematic_cuts["www.DPhi3lMET_jerdn()>2.5"] =                                             [&]() { return www.DPhi3lMET_jerdn()>2.5; };
-        systematic_cuts["www.DPhi3lMET_jerup()>2.5"] =                                             [&]() { return www.DPhi3lMET_jerup()>2.5; };
-        systematic_cuts["www.DPhi3lMET_up()>2.5"] =                                                [&]() { return www.DPhi3lMET_up()>2.5; };
-        systematic_cuts["www.DetajjL_dn()<1.5"] =                                                  [&]() { return www.DetajjL_dn()<1.5; };
-        systematic_cuts["www.DetajjL_jer()<1.5"] =                                                 [&]() { return www.DetajjL_jer()<1.5; };
-        systematic_cuts["www.DetajjL_jerdn()<1.5"] =                                               [&]() { return www.DetajjL_jerdn()<1.5; };
-        systematic_cuts["www.DetajjL_jerup()<1.5"] =                                               [&]() { return www.DetajjL_jerup()<1.5; };
-        systematic_cuts["www.DetajjL_up()<1.5"] =                                                  [&]() { return www.DetajjL_up()<1.5; };
-        systematic_cuts["www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5"] =                         [&]() { return www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5; };
-        systematic_cuts["www.MjjL_dn()<400."] =                                                    [&]() { return www.MjjL_dn()<400.; };
-        systematic_cuts["www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5"] =                       [&]() { return www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5; };
-        systematic_cuts["www.MjjL_jer()<400."] =                                                   [&]() { return www.MjjL_jer()<400.; };
-        systematic_cuts["www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5"] =                   [&]() { return www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5; };
-        systematic_cuts["www.MjjL_jerdn()<400."] =                                                 [&]() { return www.MjjL_jerdn()<400.; };
-        systematic_cuts["www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5"] =                   [&]() { return www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5; };
-        systematic_cuts["www.MjjL_jerup()<400."] =                                                 [&]() { return www.MjjL_jerup()<400.; };
-        systematic_cuts["www.MjjL_up() > 400 or www.DetajjL_up() > 1.5"] =                         [&]() { return www.MjjL_up() > 400 or www.DetajjL_up() > 1.5; };
-        systematic_cuts["www.MjjL_up()<400."] =                                                    [&]() { return www.MjjL_up()<400.; };
-        systematic_cuts["www.met_dn_pt()<60."] =                                                   [&]() { return www.met_dn_pt()<60.; };
-        systematic_cuts["www.met_dn_pt()<60. and fabs(www.MllSS()-91.1876)>10."] =                 [&]() { return www.met_dn_pt()<60. and fabs(www.MllSS()-91.1876)>10.; };
-        systematic_cuts["www.met_dn_pt()>30."] =                                                   [&]() { return www.met_dn_pt()>30.; };
-        systematic_cuts["www.met_dn_pt()>40."] =                                                   [&]() { return www.met_dn_pt()>40.; };
-        systematic_cuts["www.met_dn_pt()>55."] =                                                   [&]() { return www.met_dn_pt()>55.; };
-        systematic_cuts["www.met_dn_pt()>60."] =                                                   [&]() { return www.met_dn_pt()>60.; };
-        systematic_cuts["www.met_jer_pt()<60."] =                                                  [&]() { return www.met_jer_pt()<60.; };
-        systematic_cuts["www.met_jer_pt()<60. and fabs(www.MllSS()-91.1876)>10."] =                [&]() { return www.met_jer_pt()<60. and fabs(www.MllSS()-91.1876)>10.; };
-        systematic_cuts["www.met_jer_pt()>30."] =                                                  [&]() { return www.met_jer_pt()>30.; };
-        systematic_cuts["www.met_jer_pt()>40."] =                                                  [&]() { return www.met_jer_pt()>40.; };
-        systematic_cuts["www.met_jer_pt()>55."] =                                                  [&]() { return www.met_jer_pt()>55.; };
-        systematic_cuts["www.met_jer_pt()>60."] =                                                  [&]() { return www.met_jer_pt()>60.; };
-        systematic_cuts["www.met_jerdn_pt()<60."] =                                                [&]() { return www.met_jerdn_pt()<60.; };
-        systematic_cuts["www.met_jerdn_pt()<60. and fabs(www.MllSS()-91.1876)>10."] =              [&]() { return www.met_jerdn_pt()<60. and fabs(www.MllSS()-91.1876)>10.; };
-        systematic_cuts["www.met_jerdn_pt()>30."] =                                                [&]() { return www.met_jerdn_pt()>30.; };
-        systematic_cuts["www.met_jerdn_pt()>40."] =                                                [&]() { return www.met_jerdn_pt()>40.; };
-        systematic_cuts["www.met_jerdn_pt()>55."] =                                                [&]() { return www.met_jerdn_pt()>55.; };
-        systematic_cuts["www.met_jerdn_pt()>60."] =                                                [&]() { return www.met_jerdn_pt()>60.; };
-        systematic_cuts["www.met_jerup_pt()<60."] =                                                [&]() { return www.met_jerup_pt()<60.; };
-        systematic_cuts["www.met_jerup_pt()<60. and fabs(www.MllSS()-91.1876)>10."] =              [&]() { return www.met_jerup_pt()<60. and fabs(www.MllSS()-91.1876)>10.; };
-        systematic_cuts["www.met_jerup_pt()>30."] =                                                [&]() { return www.met_jerup_pt()>30.; };
-        systematic_cuts["www.met_jerup_pt()>40."] =                                                [&]() { return www.met_jerup_pt()>40.; };
-        systematic_cuts["www.met_jerup_pt()>55."] =                                                [&]() { return www.met_jerup_pt()>55.; };
-        systematic_cuts["www.met_jerup_pt()>60."] =                                                [&]() { return www.met_jerup_pt()>60.; };
-        systematic_cuts["www.met_up_pt()<60."] =                                                   [&]() { return www.met_up_pt()<60.; };
-        systematic_cuts["www.met_up_pt()<60. and fabs(www.MllSS()-91.1876)>10."] =                 [&]() { return www.met_up_pt()<60. and fabs(www.MllSS()-91.1876)>10.; };
-        systematic_cuts["www.met_up_pt()>30."] =                                                   [&]() { return www.met_up_pt()>30.; };
-        systematic_cuts["www.met_up_pt()>40."] =                                                   [&]() { return www.met_up_pt()>40.; };
-        systematic_cuts["www.met_up_pt()>55."] =                                                   [&]() { return www.met_up_pt()>55.; };
-        systematic_cuts["www.met_up_pt()>60."] =                                                   [&]() { return www.met_up_pt()>60.; };
-        systematic_cuts["www.nb_dn()==0"] =                                                        [&]() { return www.nb_dn()==0; };
-        systematic_cuts["www.nb_dn()==1"] =                                                        [&]() { return www.nb_dn()==1; };
-        systematic_cuts["www.nb_dn()>=1"] =                                                        [&]() { return www.nb_dn()>=1; };
-        systematic_cuts["www.nb_jer()==0"] =                                                       [&]() { return www.nb_jer()==0; };
-        systematic_cuts["www.nb_jer()==1"] =                                                       [&]() { return www.nb_jer()==1; };
-        systematic_cuts["www.nb_jer()>=1"] =                                                       [&]() { return www.nb_jer()>=1; };
-        systematic_cuts["www.nb_jerdn()==0"] =                                                     [&]() { return www.nb_jerdn()==0; };
-        systematic_cuts["www.nb_jerdn()==1"] =                                                     [&]() { return www.nb_jerdn()==1; };
-        systematic_cuts["www.nb_jerdn()>=1"] =                                                     [&]() { return www.nb_jerdn()>=1; };
-        systematic_cuts["www.nb_jerup()==0"] =                                                     [&]() { return www.nb_jerup()==0; };
-        systematic_cuts["www.nb_jerup()==1"] =                                                     [&]() { return www.nb_jerup()==1; };
-        systematic_cuts["www.nb_jerup()>=1"] =                                                     [&]() { return www.nb_jerup()>=1; };
-        systematic_cuts["www.nb_up()==0"] =                                                        [&]() { return www.nb_up()==0; };
-        systematic_cuts["www.nb_up()==1"] =                                                        [&]() { return www.nb_up()==1; };
-        systematic_cuts["www.nb_up()>=1"] =                                                        [&]() { return www.nb_up()>=1; };
-        systematic_cuts["www.nj30_dn()>= 2"] =                                                     [&]() { return www.nj30_dn()>= 2; };
-        systematic_cuts["www.nj30_dn()>= 4"] =                                                     [&]() { return www.nj30_dn()>= 4; };
-        systematic_cuts["www.nj30_jer()>= 2"] =                                                    [&]() { return www.nj30_jer()>= 2; };
-        systematic_cuts["www.nj30_jer()>= 4"] =                                                    [&]() { return www.nj30_jer()>= 4; };
-        systematic_cuts["www.nj30_jerdn()>= 2"] =                                                  [&]() { return www.nj30_jerdn()>= 2; };
-        systematic_cuts["www.nj30_jerdn()>= 4"] =                                                  [&]() { return www.nj30_jerdn()>= 4; };
-        systematic_cuts["www.nj30_jerup()>= 2"] =                                                  [&]() { return www.nj30_jerup()>= 2; };
-        systematic_cuts["www.nj30_jerup()>= 4"] =                                                  [&]() { return www.nj30_jerup()>= 4; };
-        systematic_cuts["www.nj30_up()>= 2"] =                                                     [&]() { return www.nj30_up()>= 2; };
-        systematic_cuts["www.nj30_up()>= 4"] =                                                     [&]() { return www.nj30_up()>= 4; };
-        systematic_cuts["www.nj_dn()<=1"] =                                                        [&]() { return www.nj_dn()<=1; };
-        systematic_cuts["www.nj_dn()<=2"] =                                                        [&]() { return www.nj_dn()<=2; };
-        systematic_cuts["www.nj_jer()<=1"] =                                                       [&]() { return www.nj_jer()<=1; };
-        systematic_cuts["www.nj_jer()<=2"] =                                                       [&]() { return www.nj_jer()<=2; };
-        systematic_cuts["www.nj_jerdn()<=1"] =                                                     [&]() { return www.nj_jerdn()<=1; };
-        systematic_cuts["www.nj_jerdn()<=2"] =                                                     [&]() { return www.nj_jerdn()<=2; };
-        systematic_cuts["www.nj_jerup()<=1"] =                                                     [&]() { return www.nj_jerup()<=1; };
-        systematic_cuts["www.nj_jerup()<=2"] =                                                     [&]() { return www.nj_jerup()<=2; };
-        systematic_cuts["www.nj_up()<=1"] =                                                        [&]() { return www.nj_up()<=1; };
-        systematic_cuts["www.nj_up()<=2"] =                                                        [&]() { return www.nj_up()<=2; };
-        systematic_cuts["1."] =                                                                    UNITY;
-        systematic_wgts["btag_sf"] =                                                               [&]()   { return btag_sf ; };
-
-        // Systematics that affect the raw number of events
-        cutflow.setCutSyst("SRSSmmMET"             , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-        cutflow.setCutSyst("SRSSmmMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("SRSSmmMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("SRSSmmDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("SRSSemMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("SRSSemMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("SRSSemDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("SRSSemMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("SRSSeeMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("SRSSeeMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("SRSSeeDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("SRSSeeMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("SRSSSidemmMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("SRSSSidemmMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("SRSSSidemmDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("SRSSSidemmMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("SRSSSideemMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("SRSSSideemMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("SRSSSideemDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("SRSSSideemMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("SRSSSideeeMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("SRSSSideeeMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("SRSSSideeeDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("SRSSSideeeMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("SR0SFOSDPhi3lMET"      , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("SR0SFOSMET"            , "JESUp" , systematic_cuts["www.met_up_pt()>30."]                                   , UNITY);
-        cutflow.setCutSyst("SR1SFOSDPhi3lMET"      , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("SR1SFOSMET"            , "JESUp" , systematic_cuts["www.met_up_pt()>40."]                                   , UNITY);
-        cutflow.setCutSyst("SR2SFOSDPhi3lMET"      , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("SR2SFOSMET"            , "JESUp" , systematic_cuts["www.met_up_pt()>55."]                                   , UNITY);
-        cutflow.setCutSyst("WZCRSSmmMET"           , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-        cutflow.setCutSyst("WZCRSSmmMjjL"          , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("WZCRSSmmDetajjL"       , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("WZCRSSemMjjL"          , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("WZCRSSemDetajjL"       , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("WZCRSSemMET"           , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("WZCRSSeeMjjL"          , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("WZCRSSeeDetajjL"       , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("WZCRSSeeMET"           , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"    , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("WZCR1SFOSMET"          , "JESUp" , systematic_cuts["www.met_up_pt()>40."]                                   , UNITY);
-        cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"    , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("WZCR2SFOSMET"          , "JESUp" , systematic_cuts["www.met_up_pt()>55."]                                   , UNITY);
-        cutflow.setCutSyst("ARSSmmMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("ARSSmmMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("ARSSmmDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("ARSSmmMET"             , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-        cutflow.setCutSyst("ARSSemMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("ARSSemMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("ARSSemDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("ARSSemMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("ARSSeeMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("ARSSeeMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("ARSSeeDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("ARSSeeMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("ARSSSidemmMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("ARSSSidemmMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("ARSSSidemmDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("ARSSSidemmMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("ARSSSideemMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("ARSSSideemMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("ARSSSideemDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("ARSSSideemMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("ARSSSideeeMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("ARSSSideeeMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("ARSSSideeeDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("ARSSSideeeMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("AR0SFOSDPhi3lMET"      , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("AR0SFOSMET"            , "JESUp" , systematic_cuts["www.met_up_pt()>30."]                                   , UNITY);
-        cutflow.setCutSyst("AR1SFOSDPhi3lMET"      , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("AR1SFOSMET"            , "JESUp" , systematic_cuts["www.met_up_pt()>40."]                                   , UNITY);
-        cutflow.setCutSyst("AR2SFOSDPhi3lMET"      , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("AR2SFOSMET"            , "JESUp" , systematic_cuts["www.met_up_pt()>55."]                                   , UNITY);
-        cutflow.setCutSyst("BTCRSSmmMjjW"          , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("BTCRSSmmMjjL"          , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTCRSSmmDetajjL"       , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTCRSSemMjjW"          , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("BTCRSSemMjjL"          , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTCRSSemDetajjL"       , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTCRSSeeMjjW"          , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("BTCRSSeeMjjL"          , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTCRSSeeDetajjL"       , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmMjjW"      , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmMjjL"      , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmDetajjL"   , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTCRSSSideemMjjW"      , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("BTCRSSSideemMjjL"      , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTCRSSSideemDetajjL"   , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeMjjW"      , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeMjjL"      , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeDetajjL"   , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("VBSCRSSmmVBF"          , "JESUp" , systematic_cuts["www.MjjL_up() > 400 or www.DetajjL_up() > 1.5" ]        , UNITY);
-        cutflow.setCutSyst("VBSCRSSemVBF"          , "JESUp" , systematic_cuts["www.MjjL_up() > 400 or www.DetajjL_up() > 1.5" ]        , UNITY);
-        cutflow.setCutSyst("VBSCRSSeeVBF"          , "JESUp" , systematic_cuts["www.MjjL_up() > 400 or www.DetajjL_up() > 1.5" ]        , UNITY);
-        cutflow.setCutSyst("TTWCRSSmmMjjW"         , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("TTWCRSSmmMjjL"         , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("TTWCRSSmmDetajjL"      , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("TTWCRSSemMjjW"         , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("TTWCRSSemMjjL"         , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("TTWCRSSemDetajjL"      , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("TTWCRSSeeMjjW"         , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("TTWCRSSeeMjjL"         , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("TTWCRSSeeDetajjL"      , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmMjjW"     , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmMjjL"     , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmDetajjL"  , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemMjjW"     , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemMjjL"     , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemDetajjL"  , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeMjjW"     , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeMjjL"     , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeDetajjL"  , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("LXECRSSmmMjjW"         , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("LXECRSSemMjjW"         , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("LXECRSSeeMjjW"         , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("BTCRSSmmMET"           , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-        cutflow.setCutSyst("BTCRSSemMET"           , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTCRSSeeMET"           , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmMET"       , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTCRSSSideemMET"       , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeMET"       , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"    , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("BTCR0SFOSMET"          , "JESUp" , systematic_cuts["www.met_up_pt()>30."]                                   , UNITY);
-        cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"    , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("BTCR1SFOSMET"          , "JESUp" , systematic_cuts["www.met_up_pt()>40."]                                   , UNITY);
-        cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"    , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("BTCR2SFOSMET"          , "JESUp" , systematic_cuts["www.met_up_pt()>55."]                                   , UNITY);
-        cutflow.setCutSyst("TTWCRSSmmMET"          , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-        cutflow.setCutSyst("TTWCRSSemMET"          , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("TTWCRSSeeMET"          , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmMET"      , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemMET"      , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeMET"      , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"   , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("TTZCR0SFOSMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>30."]                                   , UNITY);
-        cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"   , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("TTZCR1SFOSMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>40."]                                   , UNITY);
-        cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"   , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("TTZCR2SFOSMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>55."]                                   , UNITY);
-        cutflow.setCutSyst("LXECRSSmmMET"          , "JESUp" , systematic_cuts["www.met_up_pt()<60."]                                   , UNITY);
-        cutflow.setCutSyst("LXECRSSemMET"          , "JESUp" , systematic_cuts["www.met_up_pt()<60."]                                   , UNITY);
-        cutflow.setCutSyst("LXECRSSeeMET"          , "JESUp" , systematic_cuts["www.met_up_pt()<60. and fabs(www.MllSS()-91.1876)>10."] , UNITY);
-        cutflow.setCutSyst("BTARCRSSmmMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("BTARCRSSmmMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTARCRSSmmDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTARCRSSmmMET"         , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-        cutflow.setCutSyst("BTARCRSSemMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("BTARCRSSemMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTARCRSSemDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTARCRSSemMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTARCRSSeeMjjW"        , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-        cutflow.setCutSyst("BTARCRSSeeMjjL"        , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTARCRSSeeDetajjL"     , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTARCRSSeeMET"         , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmMjjW"    , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmMjjL"    , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmDetajjL" , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmMET"     , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemMjjW"    , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemMjjL"    , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemDetajjL" , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemMET"     , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeMjjW"    , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeMjjL"    , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeDetajjL" , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeMET"     , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-        cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"  , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("BTARCR0SFOSMET"        , "JESUp" , systematic_cuts["www.met_up_pt()>30."]                                   , UNITY);
-        cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"  , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("BTARCR1SFOSMET"        , "JESUp" , systematic_cuts["www.met_up_pt()>40."]                                   , UNITY);
-        cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"  , "JESUp" , systematic_cuts["www.DPhi3lMET_up()>2.5" ]                               , UNITY);
-        cutflow.setCutSyst("BTARCR2SFOSMET"        , "JESUp" , systematic_cuts["www.met_up_pt()>55."]                                   , UNITY);
-        cutflow.setCutSyst("LXEARCRSSmmMjjW"       , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("LXEARCRSSemMjjW"       , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("LXEARCRSSeeMjjW"       , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)>=15."]                           , UNITY);
-        cutflow.setCutSyst("LXEARCRSSmmMET"        , "JESUp" , systematic_cuts["www.met_up_pt()<60."]                                   , UNITY);
-        cutflow.setCutSyst("LXEARCRSSemMET"        , "JESUp" , systematic_cuts["www.met_up_pt()<60."]                                   , UNITY);
-        cutflow.setCutSyst("LXEARCRSSeeMET"        , "JESUp" , systematic_cuts["www.met_up_pt()<60. and fabs(www.MllSS()-91.1876)>10."] , UNITY);
-//        cutflow.setCutSyst("OSCRmmMET"             , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-//        cutflow.setCutSyst("OSCRmmMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-//        cutflow.setCutSyst("OSCRmmMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-//        cutflow.setCutSyst("OSCRmmDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-//        cutflow.setCutSyst("OSCRemMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-//        cutflow.setCutSyst("OSCRemMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-//        cutflow.setCutSyst("OSCRemDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-//        cutflow.setCutSyst("OSCRemMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-//        cutflow.setCutSyst("OSCReeMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-//        cutflow.setCutSyst("OSCReeMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-//        cutflow.setCutSyst("OSCReeDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-//        cutflow.setCutSyst("OSCReeMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-//        cutflow.setCutSyst("LRSSmmMET"             , "JESUp" , systematic_cuts["1."]                                                    , UNITY);
-//        cutflow.setCutSyst("LRSSmmMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-//        cutflow.setCutSyst("LRSSmmMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-//        cutflow.setCutSyst("LRSSmmDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-//        cutflow.setCutSyst("LRSSemMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-//        cutflow.setCutSyst("LRSSemMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-//        cutflow.setCutSyst("LRSSemDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-//        cutflow.setCutSyst("LRSSemMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-//        cutflow.setCutSyst("LRSSeeMjjW"            , "JESUp" , systematic_cuts["fabs(www.Mjj_up()-80.)<15."]                            , UNITY);
-//        cutflow.setCutSyst("LRSSeeMjjL"            , "JESUp" , systematic_cuts["www.MjjL_up()<400."]                                    , UNITY);
-//        cutflow.setCutSyst("LRSSeeDetajjL"         , "JESUp" , systematic_cuts["www.DetajjL_up()<1.5" ]                                 , UNITY);
-//        cutflow.setCutSyst("LRSSeeMET"             , "JESUp" , systematic_cuts["www.met_up_pt()>60."]                                   , UNITY);
-
-        cutflow.setCutSyst("SRSSmmMET"                      , "JESDown" , systematic_cuts["1."], UNITY);
-        cutflow.setCutSyst("SRSSmmMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("SRSSmmMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("SRSSmmDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("SRSSemMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("SRSSemMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("SRSSemDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("SRSSemMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("SRSSeeMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("SRSSeeMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("SRSSeeDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("SRSSeeMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("SRSSSidemmMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("SRSSSideemMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("SRSSSideemMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("SRSSSideemDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("SRSSSideemMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("SRSSSideeeMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("SR0SFOSMET"                     , "JESDown" , systematic_cuts["www.met_dn_pt()>30."], UNITY);
-        cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("SR1SFOSMET"                     , "JESDown" , systematic_cuts["www.met_dn_pt()>40."], UNITY);
-        cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("SR2SFOSMET"                     , "JESDown" , systematic_cuts["www.met_dn_pt()>55."], UNITY);
-        cutflow.setCutSyst("WZCRSSmmMET"                    , "JESDown" , systematic_cuts["1."], UNITY);
-        cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("WZCRSSemMjjL"                   , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("WZCRSSemDetajjL"                , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("WZCRSSemMET"                    , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("WZCRSSeeMET"                    , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("WZCR1SFOSMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()>40."], UNITY);
-        cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("WZCR2SFOSMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()>55."], UNITY);
-        cutflow.setCutSyst("ARSSmmMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("ARSSmmMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("ARSSmmDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("ARSSmmMET"                      , "JESDown" , systematic_cuts["1."], UNITY);
-        cutflow.setCutSyst("ARSSemMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("ARSSemMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("ARSSemDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("ARSSemMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("ARSSeeMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("ARSSeeMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("ARSSeeDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("ARSSeeMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("ARSSSidemmMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("ARSSSideemMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("ARSSSideemMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("ARSSSideemDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("ARSSSideemMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("ARSSSideeeMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JESDown" , systematic_cuts["www.DPhi3lMET_up()>2.5"], UNITY);
-        cutflow.setCutSyst("AR0SFOSMET"                     , "JESDown" , systematic_cuts["www.met_up_pt()>30."], UNITY);
-        cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JESDown" , systematic_cuts["www.DPhi3lMET_up()>2.5"], UNITY);
-        cutflow.setCutSyst("AR1SFOSMET"                     , "JESDown" , systematic_cuts["www.met_up_pt()>40."], UNITY);
-        cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JESDown" , systematic_cuts["www.DPhi3lMET_up()>2.5"], UNITY);
-        cutflow.setCutSyst("AR2SFOSMET"                     , "JESDown" , systematic_cuts["www.met_up_pt()>55."], UNITY);
-        cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTCRSSemMjjW"                   , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("BTCRSSemMjjL"                   , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTCRSSemDetajjL"                , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JESDown" , systematic_cuts["www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5"], UNITY);
-        cutflow.setCutSyst("VBSCRSSemVBF"                   , "JESDown" , systematic_cuts["www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5"], UNITY);
-        cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JESDown" , systematic_cuts["www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5"], UNITY);
-        cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("LXECRSSemMjjW"                  , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("BTCRSSmmMET"                    , "JESDown" , systematic_cuts["1."], UNITY);
-        cutflow.setCutSyst("BTCRSSemMET"                    , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTCRSSeeMET"                    , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmMET"                , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTCRSSSideemMET"                , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeMET"                , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("BTCR0SFOSMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()>30."], UNITY);
-        cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("BTCR1SFOSMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()>40."], UNITY);
-        cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("BTCR2SFOSMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()>55."], UNITY);
-        cutflow.setCutSyst("TTWCRSSmmMET"                   , "JESDown" , systematic_cuts["1."], UNITY);
-        cutflow.setCutSyst("TTWCRSSemMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("TTWCRSSeeMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemMET"               , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>30."], UNITY);
-        cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>40."], UNITY);
-        cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>55."], UNITY);
-        cutflow.setCutSyst("LXECRSSmmMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()<60."], UNITY);
-        cutflow.setCutSyst("LXECRSSemMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()<60."], UNITY);
-        cutflow.setCutSyst("LXECRSSeeMET"                   , "JESDown" , systematic_cuts["www.met_dn_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-        cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTARCRSSmmMET"                  , "JESDown" , systematic_cuts["1."], UNITY);
-        cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTARCRSSemMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-        cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTARCRSSeeMET"                  , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemMET"              , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-        cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JESDown" , systematic_cuts["www.met_dn_pt()>30."], UNITY);
-        cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JESDown" , systematic_cuts["www.met_dn_pt()>40."], UNITY);
-        cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JESDown" , systematic_cuts["www.DPhi3lMET_dn()>2.5"], UNITY);
-        cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JESDown" , systematic_cuts["www.met_dn_pt()>55."], UNITY);
-        cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)>=15."], UNITY);
-        cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JESDown" , systematic_cuts["www.met_dn_pt()<60."], UNITY);
-        cutflow.setCutSyst("LXEARCRSSemMET"                 , "JESDown" , systematic_cuts["www.met_dn_pt()<60."], UNITY);
-        cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JESDown" , systematic_cuts["www.met_dn_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-//        cutflow.setCutSyst("OSCRmmMET"                      , "JESDown" , systematic_cuts["1."], UNITY);
-//        cutflow.setCutSyst("OSCRmmMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-//        cutflow.setCutSyst("OSCRmmMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-//        cutflow.setCutSyst("OSCRmmDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-//        cutflow.setCutSyst("OSCRemMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-//        cutflow.setCutSyst("OSCRemMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-//        cutflow.setCutSyst("OSCRemDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-//        cutflow.setCutSyst("OSCRemMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-//        cutflow.setCutSyst("OSCReeMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-//        cutflow.setCutSyst("OSCReeMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-//        cutflow.setCutSyst("OSCReeDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-//        cutflow.setCutSyst("OSCReeMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-//        cutflow.setCutSyst("LRSSmmMET"                      , "JESDown" , systematic_cuts["1."], UNITY);
-//        cutflow.setCutSyst("LRSSmmMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-//        cutflow.setCutSyst("LRSSmmMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-//        cutflow.setCutSyst("LRSSmmDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-//        cutflow.setCutSyst("LRSSemMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-//        cutflow.setCutSyst("LRSSemMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-//        cutflow.setCutSyst("LRSSemDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-//        cutflow.setCutSyst("LRSSemMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-//        cutflow.setCutSyst("LRSSeeMjjW"                     , "JESDown" , systematic_cuts["fabs(www.Mjj_dn()-80.)<15."], UNITY);
-//        cutflow.setCutSyst("LRSSeeMjjL"                     , "JESDown" , systematic_cuts["www.MjjL_dn()<400."], UNITY);
-//        cutflow.setCutSyst("LRSSeeDetajjL"                  , "JESDown" , systematic_cuts["www.DetajjL_dn()<1.5"], UNITY);
-//        cutflow.setCutSyst("LRSSeeMET"                      , "JESDown" , systematic_cuts["www.met_dn_pt()>60."], UNITY);
-
-        if (doJER)
-        {
-            // Systematics that affect the raw number of events
-            cutflow.setCutSyst("SRSSmmMET"                      , "JER"     , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("SRSSmmMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSmmMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("SRSSmmDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSemMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSemMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("SRSSemDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSemMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSeeMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSeeMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("SRSSeeDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSeeMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSideemMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSideemMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSideemDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSideemMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("SR0SFOSMET"                     , "JER"     , systematic_cuts["www.met_jer_pt()>30."], UNITY);
-            cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("SR1SFOSMET"                     , "JER"     , systematic_cuts["www.met_jer_pt()>40."], UNITY);
-            cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("SR2SFOSMET"                     , "JER"     , systematic_cuts["www.met_jer_pt()>55."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmMET"                    , "JER"     , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSemMjjL"                   , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSemDetajjL"                , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSemMET"                    , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSeeMET"                    , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()>40."], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()>55."], UNITY);
-            cutflow.setCutSyst("ARSSmmMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSmmMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("ARSSmmDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSmmMET"                      , "JER"     , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("ARSSemMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSemMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("ARSSemDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSemMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSeeMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSeeMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("ARSSeeDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSeeMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSideemMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSideemMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSideemDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSideemMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("AR0SFOSMET"                     , "JER"     , systematic_cuts["www.met_jer_pt()>30."], UNITY);
-            cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("AR1SFOSMET"                     , "JER"     , systematic_cuts["www.met_jer_pt()>40."], UNITY);
-            cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("AR2SFOSMET"                     , "JER"     , systematic_cuts["www.met_jer_pt()>55."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSemMjjW"                   , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSemMjjL"                   , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSemDetajjL"                , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JER"     , systematic_cuts["www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSemVBF"                   , "JER"     , systematic_cuts["www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JER"     , systematic_cuts["www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXECRSSemMjjW"                  , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMET"                    , "JER"     , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("BTCRSSemMET"                    , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMET"                    , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMET"                , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMET"                , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMET"                , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()>30."], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()>40."], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()>55."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMET"                   , "JER"     , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMET"               , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>30."], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>40."], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>55."], UNITY);
-            cutflow.setCutSyst("LXECRSSmmMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXECRSSemMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXECRSSeeMET"                   , "JER"     , systematic_cuts["www.met_jer_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMET"                  , "JER"     , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMET"                  , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMET"              , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JER"     , systematic_cuts["www.met_jer_pt()>30."], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JER"     , systematic_cuts["www.met_jer_pt()>40."], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JER"     , systematic_cuts["www.DPhi3lMET_jer()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JER"     , systematic_cuts["www.met_jer_pt()>55."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JER"     , systematic_cuts["www.met_jer_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemMET"                 , "JER"     , systematic_cuts["www.met_jer_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JER"     , systematic_cuts["www.met_jer_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMET"                      , "JER"     , systematic_cuts["1."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            // cutflow.setCutSyst("OSCRmmDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCRemMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCRemMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            // cutflow.setCutSyst("OSCRemDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCRemMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            // cutflow.setCutSyst("OSCReeMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCReeMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            // cutflow.setCutSyst("OSCReeDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCReeMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMET"                      , "JER"     , systematic_cuts["1."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSmmDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSemMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSemMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSemDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSemMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-            // cutflow.setCutSyst("LRSSeeMjjW"                     , "JER"     , systematic_cuts["fabs(www.Mjj_jer()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSeeMjjL"                     , "JER"     , systematic_cuts["www.MjjL_jer()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSeeDetajjL"                  , "JER"     , systematic_cuts["www.DetajjL_jer()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSeeMET"                      , "JER"     , systematic_cuts["www.met_jer_pt()>60."], UNITY);
-
-            // Systematics that affect the raw number of events
-            cutflow.setCutSyst("SRSSmmMET"                      , "JERUp"   , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("SRSSmmMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSmmMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("SRSSmmDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSemMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSemMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("SRSSemDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSemMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSeeMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSeeMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("SRSSeeDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSeeMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSideemMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSideemMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSideemDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSideemMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("SR0SFOSMET"                     , "JERUp"   , systematic_cuts["www.met_jerup_pt()>30."], UNITY);
-            cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("SR1SFOSMET"                     , "JERUp"   , systematic_cuts["www.met_jerup_pt()>40."], UNITY);
-            cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("SR2SFOSMET"                     , "JERUp"   , systematic_cuts["www.met_jerup_pt()>55."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmMET"                    , "JERUp"   , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSemMjjL"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSemDetajjL"                , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSemMET"                    , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSeeMET"                    , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()>40."], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()>55."], UNITY);
-            cutflow.setCutSyst("ARSSmmMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSmmMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("ARSSmmDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSmmMET"                      , "JERUp"   , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("ARSSemMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSemMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("ARSSemDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSemMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSeeMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSeeMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("ARSSeeDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSeeMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSideemMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSideemMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSideemDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSideemMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("AR0SFOSMET"                     , "JERUp"   , systematic_cuts["www.met_jerup_pt()>30."], UNITY);
-            cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("AR1SFOSMET"                     , "JERUp"   , systematic_cuts["www.met_jerup_pt()>40."], UNITY);
-            cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("AR2SFOSMET"                     , "JERUp"   , systematic_cuts["www.met_jerup_pt()>55."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSemMjjW"                   , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSemMjjL"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSemDetajjL"                , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSemVBF"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JERUp"   , systematic_cuts["www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXECRSSemMjjW"                  , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMET"                    , "JERUp"   , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("BTCRSSemMET"                    , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMET"                    , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMET"                , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMET"                , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMET"                , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()>30."], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()>40."], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()>55."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMET"                   , "JERUp"   , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMET"               , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>30."], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>40."], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>55."], UNITY);
-            cutflow.setCutSyst("LXECRSSmmMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXECRSSemMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXECRSSeeMET"                   , "JERUp"   , systematic_cuts["www.met_jerup_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMET"                  , "JERUp"   , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMET"                  , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMET"              , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JERUp"   , systematic_cuts["www.met_jerup_pt()>30."], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JERUp"   , systematic_cuts["www.met_jerup_pt()>40."], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JERUp"   , systematic_cuts["www.DPhi3lMET_jerup()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JERUp"   , systematic_cuts["www.met_jerup_pt()>55."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JERUp"   , systematic_cuts["www.met_jerup_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemMET"                 , "JERUp"   , systematic_cuts["www.met_jerup_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JERUp"   , systematic_cuts["www.met_jerup_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMET"                      , "JERUp"   , systematic_cuts["1."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            // cutflow.setCutSyst("OSCRmmDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCRemMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCRemMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            // cutflow.setCutSyst("OSCRemDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCRemMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            // cutflow.setCutSyst("OSCReeMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCReeMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            // cutflow.setCutSyst("OSCReeDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCReeMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMET"                      , "JERUp"   , systematic_cuts["1."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSmmDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSemMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSemMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSemDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSemMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-            // cutflow.setCutSyst("LRSSeeMjjW"                     , "JERUp"   , systematic_cuts["fabs(www.Mjj_jerup()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSeeMjjL"                     , "JERUp"   , systematic_cuts["www.MjjL_jerup()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSeeDetajjL"                  , "JERUp"   , systematic_cuts["www.DetajjL_jerup()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSeeMET"                      , "JERUp"   , systematic_cuts["www.met_jerup_pt()>60."], UNITY);
-
-            // Systematics that affect the raw number of events
-            cutflow.setCutSyst("SRSSmmMET"                      , "JERDown" , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("SRSSmmMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSmmMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("SRSSmmDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSemMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSemMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("SRSSemDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSemMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSeeMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("SRSSeeMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("SRSSeeDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSeeMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSidemmMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSideemMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSideemMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSideemDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSideemMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("SRSSSideeeMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("SR0SFOSMET"                     , "JERDown" , systematic_cuts["www.met_jerdn_pt()>30."], UNITY);
-            cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("SR1SFOSMET"                     , "JERDown" , systematic_cuts["www.met_jerdn_pt()>40."], UNITY);
-            cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("SR2SFOSMET"                     , "JERDown" , systematic_cuts["www.met_jerdn_pt()>55."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmMET"                    , "JERDown" , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSemMjjL"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSemDetajjL"                , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSemMET"                    , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("WZCRSSeeMET"                    , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()>40."], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()>55."], UNITY);
-            cutflow.setCutSyst("ARSSmmMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSmmMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("ARSSmmDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSmmMET"                      , "JERDown" , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("ARSSemMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSemMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("ARSSemDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSemMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSeeMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("ARSSeeMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("ARSSeeDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSeeMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSidemmMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSideemMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSideemMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSideemDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSideemMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("ARSSSideeeMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("AR0SFOSMET"                     , "JERDown" , systematic_cuts["www.met_jerdn_pt()>30."], UNITY);
-            cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("AR1SFOSMET"                     , "JERDown" , systematic_cuts["www.met_jerdn_pt()>40."], UNITY);
-            cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("AR2SFOSMET"                     , "JERDown" , systematic_cuts["www.met_jerdn_pt()>55."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSemMjjW"                   , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSemMjjL"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSemDetajjL"                , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSemVBF"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5"], UNITY);
-            cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JERDown" , systematic_cuts["www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXECRSSemMjjW"                  , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTCRSSmmMET"                    , "JERDown" , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("BTCRSSemMET"                    , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSeeMET"                    , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmMET"                , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemMET"                , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeMET"                , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()>30."], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()>40."], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()>55."], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmMET"                   , "JERDown" , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("TTWCRSSemMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemMET"               , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>30."], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>40."], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>55."], UNITY);
-            cutflow.setCutSyst("LXECRSSmmMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXECRSSemMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXECRSSeeMET"                   , "JERDown" , systematic_cuts["www.met_jerdn_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmMET"                  , "JERDown" , systematic_cuts["1."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSemMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeMET"                  , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemMET"              , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JERDown" , systematic_cuts["www.met_jerdn_pt()>30."], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JERDown" , systematic_cuts["www.met_jerdn_pt()>40."], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JERDown" , systematic_cuts["www.DPhi3lMET_jerdn()>2.5"], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JERDown" , systematic_cuts["www.met_jerdn_pt()>55."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)>=15."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JERDown" , systematic_cuts["www.met_jerdn_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemMET"                 , "JERDown" , systematic_cuts["www.met_jerdn_pt()<60."], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JERDown" , systematic_cuts["www.met_jerdn_pt()<60. and fabs(www.MllSS()-91.1876)>10."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMET"                      , "JERDown" , systematic_cuts["1."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCRmmMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            // cutflow.setCutSyst("OSCRmmDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCRemMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCRemMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            // cutflow.setCutSyst("OSCRemDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCRemMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            // cutflow.setCutSyst("OSCReeMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("OSCReeMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            // cutflow.setCutSyst("OSCReeDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            // cutflow.setCutSyst("OSCReeMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMET"                      , "JERDown" , systematic_cuts["1."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSmmMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSmmDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSemMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSemMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSemDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSemMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-            // cutflow.setCutSyst("LRSSeeMjjW"                     , "JERDown" , systematic_cuts["fabs(www.Mjj_jerdn()-80.)<15."], UNITY);
-            // cutflow.setCutSyst("LRSSeeMjjL"                     , "JERDown" , systematic_cuts["www.MjjL_jerdn()<400."], UNITY);
-            // cutflow.setCutSyst("LRSSeeDetajjL"                  , "JERDown" , systematic_cuts["www.DetajjL_jerdn()<1.5"], UNITY);
-            // cutflow.setCutSyst("LRSSeeMET"                      , "JERDown" , systematic_cuts["www.met_jerdn_pt()>60."], UNITY);
-        }
-
-        cutflow.setCutSyst("SRSSmmNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSemNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSeeNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSSidemmNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSSideemNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSSideeeNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("SR0SFOSNj1"                     , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("SR1SFOSNj1"                     , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("SR2SFOSNj1"                     , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("WZCRSSmmNj2"                    , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("WZCRSSemNj2"                    , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("WZCRSSeeNj2"                    , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("ARSSmmNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSemNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSeeNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSSidemmNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSSideemNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSSideeeNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("AR0SFOSNj1"                     , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("AR1SFOSNj1"                     , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("AR2SFOSNj1"                     , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("BTCRSSmmNj2"                    , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSemNj2"                    , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSeeNj2"                    , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSSideemNj2"                , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("VBSCRSSemNj2"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("TTWCRSSemNj4"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JESUp"   , systematic_cuts["www.nj30_up()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JESUp"   , systematic_cuts["www.nj30_up()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JESUp"   , systematic_cuts["www.nj30_up()>= 4"], UNITY);
-        cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JESUp"   , systematic_cuts["www.nj_up()<=2"], UNITY);
-        cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JESUp"   , systematic_cuts["www.nj_up()<=2"], UNITY);
-        cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JESUp"   , systematic_cuts["www.nj_up()<=2"], UNITY);
-        cutflow.setCutSyst("LXECRSSmmNj2"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("LXECRSSemNj2"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("LXECRSSeeNj2"                   , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("PhotonCRNj1"                    , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSemNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JESUp"   , systematic_cuts["www.nj_up()<=1"], UNITY);
-        cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-        cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-//        cutflow.setCutSyst("OSCRmmNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-//        cutflow.setCutSyst("OSCRemNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-//        cutflow.setCutSyst("OSCReeNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-//        cutflow.setCutSyst("LRSSmmNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-//        cutflow.setCutSyst("LRSSemNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-//        cutflow.setCutSyst("LRSSeeNj2"                      , "JESUp"   , systematic_cuts["www.nj30_up()>= 2"], UNITY);
-
-        cutflow.setCutSyst("SRSSmmNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSemNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSeeNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSSidemmNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSSideemNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("SRSSSideeeNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("SR0SFOSNj1"                     , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("SR1SFOSNj1"                     , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("SR2SFOSNj1"                     , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("WZCRSSmmNj2"                    , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("WZCRSSemNj2"                    , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("WZCRSSeeNj2"                    , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("ARSSmmNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSemNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSeeNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSSidemmNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSSideemNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("ARSSSideeeNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("AR0SFOSNj1"                     , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("AR1SFOSNj1"                     , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("AR2SFOSNj1"                     , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("BTCRSSmmNj2"                    , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSemNj2"                    , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSeeNj2"                    , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSSideemNj2"                , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("VBSCRSSemNj2"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("TTWCRSSemNj4"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JESDown" , systematic_cuts["www.nj30_dn()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JESDown" , systematic_cuts["www.nj30_dn()>= 4"], UNITY);
-        cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JESDown" , systematic_cuts["www.nj30_dn()>= 4"], UNITY);
-        cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JESDown" , systematic_cuts["www.nj_dn()<=2"], UNITY);
-        cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JESDown" , systematic_cuts["www.nj_dn()<=2"], UNITY);
-        cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JESDown" , systematic_cuts["www.nj_dn()<=2"], UNITY);
-        cutflow.setCutSyst("LXECRSSmmNj2"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("LXECRSSemNj2"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("LXECRSSeeNj2"                   , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("PhotonCRNj1"                    , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSemNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JESDown" , systematic_cuts["www.nj_dn()<=1"], UNITY);
-        cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-        cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-//        cutflow.setCutSyst("OSCRmmNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-//        cutflow.setCutSyst("OSCRemNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-//        cutflow.setCutSyst("OSCReeNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-//        cutflow.setCutSyst("LRSSmmNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-//        cutflow.setCutSyst("LRSSemNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-//        cutflow.setCutSyst("LRSSeeNj2"                      , "JESDown" , systematic_cuts["www.nj30_dn()>= 2"], UNITY);
-
-        if (doJER)
-        {
-            cutflow.setCutSyst("SRSSmmNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSemNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSeeNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSidemmNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSideemNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSideeeNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("SR0SFOSNj1"                     , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("SR1SFOSNj1"                     , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("SR2SFOSNj1"                     , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("WZCRSSmmNj2"                    , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCRSSemNj2"                    , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCRSSeeNj2"                    , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("ARSSmmNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSemNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSeeNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSidemmNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSideemNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSideeeNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("AR0SFOSNj1"                     , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("AR1SFOSNj1"                     , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("AR2SFOSNj1"                     , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("BTCRSSmmNj2"                    , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSemNj2"                    , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSeeNj2"                    , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemNj2"                , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("VBSCRSSemNj2"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("TTWCRSSemNj4"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JER"     , systematic_cuts["www.nj30_jer()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JER"     , systematic_cuts["www.nj30_jer()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JER"     , systematic_cuts["www.nj30_jer()>= 4"], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JER"     , systematic_cuts["www.nj_jer()<=2"], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JER"     , systematic_cuts["www.nj_jer()<=2"], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JER"     , systematic_cuts["www.nj_jer()<=2"], UNITY);
-            cutflow.setCutSyst("LXECRSSmmNj2"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("LXECRSSemNj2"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("LXECRSSeeNj2"                   , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("PhotonCRNj1"                    , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSemNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JER"     , systematic_cuts["www.nj_jer()<=1"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCRmmNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCRemNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCReeNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSmmNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSemNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSeeNj2"                      , "JER"     , systematic_cuts["www.nj30_jer()>= 2"], UNITY);
-
-            cutflow.setCutSyst("SRSSmmNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSemNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSeeNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSidemmNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSideemNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSideeeNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("SR0SFOSNj1"                     , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("SR1SFOSNj1"                     , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("SR2SFOSNj1"                     , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("WZCRSSmmNj2"                    , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCRSSemNj2"                    , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCRSSeeNj2"                    , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("ARSSmmNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSemNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSeeNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSidemmNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSideemNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSideeeNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("AR0SFOSNj1"                     , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("AR1SFOSNj1"                     , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("AR2SFOSNj1"                     , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("BTCRSSmmNj2"                    , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSemNj2"                    , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSeeNj2"                    , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemNj2"                , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("VBSCRSSemNj2"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("TTWCRSSemNj4"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 4"], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JERUp"   , systematic_cuts["www.nj_jerup()<=2"], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JERUp"   , systematic_cuts["www.nj_jerup()<=2"], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JERUp"   , systematic_cuts["www.nj_jerup()<=2"], UNITY);
-            cutflow.setCutSyst("LXECRSSmmNj2"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("LXECRSSemNj2"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("LXECRSSeeNj2"                   , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("PhotonCRNj1"                    , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSemNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JERUp"   , systematic_cuts["www.nj_jerup()<=1"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCRmmNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCRemNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCReeNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSmmNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSemNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSeeNj2"                      , "JERUp"   , systematic_cuts["www.nj30_jerup()>= 2"], UNITY);
-
-            cutflow.setCutSyst("SRSSmmNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSemNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSeeNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSidemmNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSideemNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("SRSSSideeeNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("SR0SFOSNj1"                     , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("SR1SFOSNj1"                     , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("SR2SFOSNj1"                     , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("WZCRSSmmNj2"                    , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCRSSemNj2"                    , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCRSSeeNj2"                    , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("ARSSmmNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSemNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSeeNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSidemmNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSideemNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("ARSSSideeeNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("AR0SFOSNj1"                     , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("AR1SFOSNj1"                     , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("AR2SFOSNj1"                     , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("BTCRSSmmNj2"                    , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSemNj2"                    , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSeeNj2"                    , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideemNj2"                , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("VBSCRSSemNj2"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("TTWCRSSemNj4"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 4"], UNITY);
-            cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 4"], UNITY);
-            cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JERDown" , systematic_cuts["www.nj_jerdn()<=2"], UNITY);
-            cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JERDown" , systematic_cuts["www.nj_jerdn()<=2"], UNITY);
-            cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JERDown" , systematic_cuts["www.nj_jerdn()<=2"], UNITY);
-            cutflow.setCutSyst("LXECRSSmmNj2"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("LXECRSSemNj2"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("LXECRSSeeNj2"                   , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("PhotonCRNj1"                    , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSemNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JERDown" , systematic_cuts["www.nj_jerdn()<=1"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCRmmNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCRemNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            //        cutflow.setCutSyst("OSCReeNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSmmNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSemNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-            //        cutflow.setCutSyst("LRSSeeNj2"                      , "JERDown" , systematic_cuts["www.nj30_jerdn()>= 2"], UNITY);
-        }
-
-        cutflow.setCutSyst("SRSSmmNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSemNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSeeNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSSidemmNb0"                  , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSSideemNb0"                  , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSSideeeNb0"                  , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SR0SFOSNb0"                     , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SR1SFOSNb0"                     , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SR2SFOSNb0"                     , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCRSSmmNb0"                    , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCRSSemNb0"                    , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCRSSeeNb0"                    , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSmmNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSemNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSeeNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSSidemmNb0"                  , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSSideemNb0"                  , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSSideeeNb0"                  , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("AR0SFOSNb0"                     , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("AR1SFOSNb0"                     , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("AR2SFOSNb0"                     , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("VBSCRSSemNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JESUp"   , systematic_cuts["www.nb_up()==1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JESUp"   , systematic_cuts["www.nb_up()==1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JESUp"   , systematic_cuts["www.nb_up()==1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXECRSSmmNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXECRSSemNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXECRSSeeNb0"                   , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("PhotonCRNb0"                    , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JESUp"   , systematic_cuts["www.nb_up()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("OSCRmmNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("OSCRemNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("OSCReeNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("LRSSmmNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("LRSSemNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("LRSSeeNb0"                      , "JESUp"   , systematic_cuts["www.nb_up()==0"], systematic_wgts["btag_sf"] ) ;
-
-        cutflow.setCutSyst("SRSSmmNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSemNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSeeNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSSidemmNb0"                  , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSSideemNb0"                  , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SRSSSideeeNb0"                  , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SR0SFOSNb0"                     , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SR1SFOSNb0"                     , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("SR2SFOSNb0"                     , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCRSSmmNb0"                    , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCRSSemNb0"                    , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCRSSeeNb0"                    , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSmmNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSemNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSeeNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSSidemmNb0"                  , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSSideemNb0"                  , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("ARSSSideeeNb0"                  , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("AR0SFOSNb0"                     , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("AR1SFOSNb0"                     , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("AR2SFOSNb0"                     , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("VBSCRSSemNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JESDown" , systematic_cuts["www.nb_dn()==1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JESDown" , systematic_cuts["www.nb_dn()==1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JESDown" , systematic_cuts["www.nb_dn()==1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXECRSSmmNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXECRSSemNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXECRSSeeNb0"                   , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("PhotonCRNb0"                    , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JESDown" , systematic_cuts["www.nb_dn()>=1"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-        cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("OSCRmmNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("OSCRemNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("OSCReeNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("LRSSmmNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("LRSSemNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-//        cutflow.setCutSyst("LRSSeeNb0"                      , "JESDown" , systematic_cuts["www.nb_dn()==0"], systematic_wgts["btag_sf"] ) ;
-
-        if (doJER)
-        {
-
-            cutflow.setCutSyst("SRSSmmNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSemNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSeeNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSidemmNb0"                  , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSideemNb0"                  , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSideeeNb0"                  , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR0SFOSNb0"                     , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR1SFOSNb0"                     , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR2SFOSNb0"                     , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSmmNb0"                    , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSemNb0"                    , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSeeNb0"                    , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSmmNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSemNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSeeNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSidemmNb0"                  , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSideemNb0"                  , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSideeeNb0"                  , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR0SFOSNb0"                     , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR1SFOSNb0"                     , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR2SFOSNb0"                     , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSemNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JER"     , systematic_cuts["www.nb_jer()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JER"     , systematic_cuts["www.nb_jer()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JER"     , systematic_cuts["www.nb_jer()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSmmNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSemNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSeeNb0"                   , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("PhotonCRNb0"                    , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JER"     , systematic_cuts["www.nb_jer()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCRmmNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCRemNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCReeNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSmmNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSemNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSeeNb0"                      , "JER"     , systematic_cuts["www.nb_jer()==0"], systematic_wgts["btag_sf"] ) ;
-
-            cutflow.setCutSyst("SRSSmmNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSemNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSeeNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSidemmNb0"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSideemNb0"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSideeeNb0"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR0SFOSNb0"                     , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR1SFOSNb0"                     , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR2SFOSNb0"                     , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSmmNb0"                    , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSemNb0"                    , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSeeNb0"                    , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSmmNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSemNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSeeNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSidemmNb0"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSideemNb0"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSideeeNb0"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR0SFOSNb0"                     , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR1SFOSNb0"                     , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR2SFOSNb0"                     , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSemNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JERUp"   , systematic_cuts["www.nb_jerup()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSmmNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSemNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSeeNb0"                   , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("PhotonCRNb0"                    , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JERUp"   , systematic_cuts["www.nb_jerup()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCRmmNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCRemNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCReeNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSmmNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSemNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSeeNb0"                      , "JERUp"   , systematic_cuts["www.nb_jerup()==0"], systematic_wgts["btag_sf"] ) ;
-
-            cutflow.setCutSyst("SRSSmmNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSemNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSeeNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSidemmNb0"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSideemNb0"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SRSSSideeeNb0"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR0SFOSNb0"                     , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR1SFOSNb0"                     , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("SR2SFOSNb0"                     , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSmmNb0"                    , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSemNb0"                    , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCRSSeeNb0"                    , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSmmNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSemNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSeeNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSidemmNb0"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSideemNb0"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("ARSSSideeeNb0"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR0SFOSNb0"                     , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR1SFOSNb0"                     , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("AR2SFOSNb0"                     , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSemNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JERDown" , systematic_cuts["www.nb_jerdn()==1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSmmNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSemNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXECRSSeeNb0"                   , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("PhotonCRNb0"                    , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JERDown" , systematic_cuts["www.nb_jerdn()>=1"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCRmmNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCRemNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("OSCReeNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSmmNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSemNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-            //        cutflow.setCutSyst("LRSSeeNb0"                      , "JERDown" , systematic_cuts["www.nb_jerdn()==0"], systematic_wgts["btag_sf"] ) ;
-        }
-
-//        // Systematics that affect the raw number of events
-//        cutflow.setCutSyst("SRSSmmMET"                      , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSMET"                     , "JESUp"   , [&]() { return www.met_up_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSMET"                     , "JESUp"   , [&]() { return www.met_up_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSMET"                     , "JESUp"   , [&]() { return www.met_up_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMET"                    , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMjjL"                   , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemDetajjL"                , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMET"                    , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMET"                    , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSMET"                   , "JESUp"   , [&]() { return www.met_up_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSMET"                   , "JESUp"   , [&]() { return www.met_up_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMET"                      , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSMET"                     , "JESUp"   , [&]() { return www.met_up_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSMET"                     , "JESUp"   , [&]() { return www.met_up_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSMET"                     , "JESUp"   , [&]() { return www.met_up_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjW"                   , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjL"                   , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemDetajjL"                , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JESUp"   , [&]() { return www.MjjL_up() > 400 or www.DetajjL_up() > 1.5            ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemVBF"                   , "JESUp"   , [&]() { return www.MjjL_up() > 400 or www.DetajjL_up() > 1.5            ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JESUp"   , [&]() { return www.MjjL_up() > 400 or www.DetajjL_up() > 1.5            ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMjjW"                  , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMET"                    , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMET"                    , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMET"                    , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMET"                , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMET"                , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMET"                , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSMET"                   , "JESUp"   , [&]() { return www.met_up_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSMET"                   , "JESUp"   , [&]() { return www.met_up_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSMET"                   , "JESUp"   , [&]() { return www.met_up_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMET"                   , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMET"                   , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMET"                   , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMET"               , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMET"                   , "JESUp"   , [&]() { return www.met_up_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMET"                   , "JESUp"   , [&]() { return www.met_up_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMET"                   , "JESUp"   , [&]() { return www.met_up_pt()<60. and fabs(www.MllSS()-91.1876)>10.    ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMET"                  , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMET"                  , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMET"              , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JESUp"   , [&]() { return www.met_up_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JESUp"   , [&]() { return www.met_up_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JESUp"   , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JESUp"   , [&]() { return www.met_up_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JESUp"   , [&]() { return www.met_up_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMET"                 , "JESUp"   , [&]() { return www.met_up_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JESUp"   , [&]() { return www.met_up_pt()<60. and fabs(www.MllSS()-91.1876)>10.    ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMET"                      , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMET"                      , "JESUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjW"                     , "JESUp"   , [&]() { return fabs(www.Mjj_up()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjL"                     , "JESUp"   , [&]() { return www.MjjL_up()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeDetajjL"                  , "JESUp"   , [&]() { return www.DetajjL_up()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMET"                      , "JESUp"   , [&]() { return www.met_up_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmMET"                      , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSMET"                     , "JESDown" , [&]() { return www.met_dn_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSMET"                     , "JESDown" , [&]() { return www.met_dn_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSMET"                     , "JESDown" , [&]() { return www.met_dn_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMET"                    , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMjjL"                   , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemDetajjL"                , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMET"                    , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMET"                    , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSMET"                   , "JESDown" , [&]() { return www.met_dn_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSMET"                   , "JESDown" , [&]() { return www.met_dn_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMET"                      , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JESDown" , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSMET"                     , "JESDown" , [&]() { return www.met_up_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JESDown" , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSMET"                     , "JESDown" , [&]() { return www.met_up_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JESDown" , [&]() { return www.DPhi3lMET_up()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSMET"                     , "JESDown" , [&]() { return www.met_up_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjW"                   , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjL"                   , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemDetajjL"                , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JESDown" , [&]() { return www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5            ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemVBF"                   , "JESDown" , [&]() { return www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5            ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JESDown" , [&]() { return www.MjjL_dn() > 400 or www.DetajjL_dn() > 1.5            ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMjjW"                  , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMET"                    , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMET"                    , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMET"                    , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMET"                , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMET"                , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMET"                , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSMET"                   , "JESDown" , [&]() { return www.met_dn_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSMET"                   , "JESDown" , [&]() { return www.met_dn_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSMET"                   , "JESDown" , [&]() { return www.met_dn_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMET"                   , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMET"                   , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMET"                   , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMET"               , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMET"                   , "JESDown" , [&]() { return www.met_dn_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMET"                   , "JESDown" , [&]() { return www.met_dn_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMET"                   , "JESDown" , [&]() { return www.met_dn_pt()<60. and fabs(www.MllSS()-91.1876)>10.    ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMET"                  , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMET"                  , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMET"              , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JESDown" , [&]() { return www.met_dn_pt()>30.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JESDown" , [&]() { return www.met_dn_pt()>40.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JESDown" , [&]() { return www.DPhi3lMET_dn()>2.5                                   ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JESDown" , [&]() { return www.met_dn_pt()>55.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)>=15.                              ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JESDown" , [&]() { return www.met_dn_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMET"                 , "JESDown" , [&]() { return www.met_dn_pt()<60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JESDown" , [&]() { return www.met_dn_pt()<60. and fabs(www.MllSS()-91.1876)>10.    ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMET"                      , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMET"                      , "JESDown" , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjW"                     , "JESDown" , [&]() { return fabs(www.Mjj_dn()-80.)<15.                               ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjL"                     , "JESDown" , [&]() { return www.MjjL_dn()<400.                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeDetajjL"                  , "JESDown" , [&]() { return www.DetajjL_dn()<1.5                                     ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMET"                      , "JESDown" , [&]() { return www.met_dn_pt()>60.                                      ; } , [&]()   { return 1       ; } ) ;
-//
-//        // Systematics that affect the raw number of events
-//        cutflow.setCutSyst("SRSSmmMET"                      , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSmmDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSemDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSemMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSeeDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSMET"                     , "JER"     , [&]() { return www.met_jer_pt()>30.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSMET"                     , "JER"     , [&]() { return www.met_jer_pt()>40.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSMET"                     , "JER"     , [&]() { return www.met_jer_pt()>55.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMET"                    , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMjjL"                   , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemDetajjL"                , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMET"                    , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMET"                    , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSMET"                   , "JER"     , [&]() { return www.met_jer_pt()>40.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSMET"                   , "JER"     , [&]() { return www.met_jer_pt()>55.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSmmDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMET"                      , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSemDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSemMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSeeDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSMET"                     , "JER"     , [&]() { return www.met_jer_pt()>30.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSMET"                     , "JER"     , [&]() { return www.met_jer_pt()>40.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSMET"                     , "JER"     , [&]() { return www.met_jer_pt()>55.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjW"                   , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjL"                   , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemDetajjL"                , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JER"     , [&]() { return www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5          ; } , [&]()     { return 1         ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemVBF"                   , "JER"     , [&]() { return www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5          ; } , [&]()     { return 1         ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JER"     , [&]() { return www.MjjL_jer() > 400 or www.DetajjL_jer() > 1.5          ; } , [&]()     { return 1         ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMjjW"                  , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMET"                    , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMET"                    , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMET"                    , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMET"                , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMET"                , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMET"                , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSMET"                   , "JER"     , [&]() { return www.met_jer_pt()>30.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSMET"                   , "JER"     , [&]() { return www.met_jer_pt()>40.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSMET"                   , "JER"     , [&]() { return www.met_jer_pt()>55.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMET"                   , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMET"                   , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMET"                   , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMET"               , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JER"     , [&]() { return www.met_jer_pt()>30.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JER"     , [&]() { return www.met_jer_pt()>40.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JER"     , [&]() { return www.met_jer_pt()>55.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMET"                   , "JER"     , [&]() { return www.met_jer_pt()<60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMET"                   , "JER"     , [&]() { return www.met_jer_pt()<60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMET"                   , "JER"     , [&]() { return www.met_jer_pt()<60. and fabs(www.MllSS()-91.1876)>10.   ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMET"                  , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMET"                  , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMET"              , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JER"     , [&]() { return www.met_jer_pt()>30.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JER"     , [&]() { return www.met_jer_pt()>40.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JER"     , [&]() { return www.DPhi3lMET_jer()>2.5                                  ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JER"     , [&]() { return www.met_jer_pt()>55.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)>=15.                             ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JER"     , [&]() { return www.met_jer_pt()<60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMET"                 , "JER"     , [&]() { return www.met_jer_pt()<60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JER"     , [&]() { return www.met_jer_pt()<60. and fabs(www.MllSS()-91.1876)>10.   ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMET"                      , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRmmDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRemDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRemMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCReeDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCReeMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMET"                      , "JER"     , [&]() { return 1.                                                       ; } , [&]()     { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSmmDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSemDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSemMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjW"                     , "JER"     , [&]() { return fabs(www.Mjj_jer()-80.)<15.                              ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjL"                     , "JER"     , [&]() { return www.MjjL_jer()<400.                                      ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSeeDetajjL"                  , "JER"     , [&]() { return www.DetajjL_jer()<1.5                                    ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMET"                      , "JER"     , [&]() { return www.met_jer_pt()>60.                                     ; } , [&]()     { return 1        ; } ) ;
-//
-//        // Systematics that affect the raw number of events
-//        cutflow.setCutSyst("SRSSmmMET"                      , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSmmDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSMET"                     , "JERUp"   , [&]() { return www.met_jerup_pt()>30.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSMET"                     , "JERUp"   , [&]() { return www.met_jerup_pt()>40.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSMET"                     , "JERUp"   , [&]() { return www.met_jerup_pt()>55.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMET"                    , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMjjL"                   , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemDetajjL"                , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMET"                    , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMET"                    , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()>40.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()>55.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMET"                      , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSMET"                     , "JERUp"   , [&]() { return www.met_jerup_pt()>30.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSMET"                     , "JERUp"   , [&]() { return www.met_jerup_pt()>40.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSMET"                     , "JERUp"   , [&]() { return www.met_jerup_pt()>55.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjW"                   , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjL"                   , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemDetajjL"                , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JERUp"   , [&]() { return www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5      ; } , [&]()   { return 1             ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemVBF"                   , "JERUp"   , [&]() { return www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5      ; } , [&]()   { return 1             ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JERUp"   , [&]() { return www.MjjL_jerup() > 400 or www.DetajjL_jerup() > 1.5      ; } , [&]()   { return 1             ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMjjW"                  , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMET"                    , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMET"                    , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMET"                    , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMET"                , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMET"                , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMET"                , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()>30.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()>40.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()>55.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMET"                   , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMET"               , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>30.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>40.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>55.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()<60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()<60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMET"                   , "JERUp"   , [&]() { return www.met_jerup_pt()<60. and fabs(www.MllSS()-91.1876)>10. ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMET"                  , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMET"                  , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMET"              , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JERUp"   , [&]() { return www.met_jerup_pt()>30.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JERUp"   , [&]() { return www.met_jerup_pt()>40.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JERUp"   , [&]() { return www.DPhi3lMET_jerup()>2.5                                ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JERUp"   , [&]() { return www.met_jerup_pt()>55.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)>=15.                           ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JERUp"   , [&]() { return www.met_jerup_pt()<60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMET"                 , "JERUp"   , [&]() { return www.met_jerup_pt()<60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JERUp"   , [&]() { return www.met_jerup_pt()<60. and fabs(www.MllSS()-91.1876)>10. ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMET"                      , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMET"                      , "JERUp"   , [&]() { return 1.                                                       ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjW"                     , "JERUp"   , [&]() { return fabs(www.Mjj_jerup()-80.)<15.                            ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjL"                     , "JERUp"   , [&]() { return www.MjjL_jerup()<400.                                    ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeDetajjL"                  , "JERUp"   , [&]() { return www.DetajjL_jerup()<1.5                                  ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMET"                      , "JERUp"   , [&]() { return www.met_jerup_pt()>60.                                   ; } , [&]()   { return 1          ; } ) ;
-//
-//        // Systematics that affect the raw number of events
-//        cutflow.setCutSyst("SRSSmmMET"                      , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSmmMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSmmDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSDPhi3lMET"               , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSMET"                     , "JERDown" , [&]() { return www.met_jerdn_pt()>30.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSDPhi3lMET"               , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSMET"                     , "JERDown" , [&]() { return www.met_jerdn_pt()>40.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSDPhi3lMET"               , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSMET"                     , "JERDown" , [&]() { return www.met_jerdn_pt()>55.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMET"                    , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmMjjL"                   , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmDetajjL"                , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMjjL"                   , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemDetajjL"                , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemMET"                    , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMjjL"                   , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeDetajjL"                , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeMET"                    , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSDPhi3lMET"             , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()>40.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSDPhi3lMET"             , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()>55.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmMET"                      , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSDPhi3lMET"               , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSMET"                     , "JERDown" , [&]() { return www.met_jerdn_pt()>30.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSDPhi3lMET"               , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSMET"                     , "JERDown" , [&]() { return www.met_jerdn_pt()>40.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSDPhi3lMET"               , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSMET"                     , "JERDown" , [&]() { return www.met_jerdn_pt()>55.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjW"                   , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMjjL"                   , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmDetajjL"                , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjW"                   , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMjjL"                   , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemDetajjL"                , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjW"                   , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMjjL"                   , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeDetajjL"                , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjW"               , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMjjL"               , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmDetajjL"            , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjW"               , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMjjL"               , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemDetajjL"            , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjW"               , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMjjL"               , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeDetajjL"            , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmVBF"                   , "JERDown" , [&]() { return www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5      ; } , [&]() { return 1             ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemVBF"                   , "JERDown" , [&]() { return www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5      ; } , [&]() { return 1             ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeVBF"                   , "JERDown" , [&]() { return www.MjjL_jerdn() > 400 or www.DetajjL_jerdn() > 1.5      ; } , [&]() { return 1             ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjW"                  , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMjjL"                  , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmDetajjL"               , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjW"                  , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMjjL"                  , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemDetajjL"               , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjW"                  , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMjjL"                  , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeDetajjL"               , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjW"              , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMjjL"              , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmDetajjL"           , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjW"              , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMjjL"              , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemDetajjL"           , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjW"              , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMjjL"              , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeDetajjL"           , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMjjW"                  , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMjjW"                  , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMjjW"                  , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmMET"                    , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemMET"                    , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeMET"                    , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmMET"                , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemMET"                , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeMET"                , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSDPhi3lMET"             , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()>30.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSDPhi3lMET"             , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()>40.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSDPhi3lMET"             , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()>55.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmMET"                   , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmMET"               , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemMET"               , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeMET"               , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSDPhi3lMET"            , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>30.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSDPhi3lMET"            , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>40.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSDPhi3lMET"            , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>55.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()<60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()<60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeMET"                   , "JERDown" , [&]() { return www.met_jerdn_pt()<60. and fabs(www.MllSS()-91.1876)>10. ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmMET"                  , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjW"                 , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMjjL"                 , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeDetajjL"              , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeMET"                  , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjW"             , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMjjL"             , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmDetajjL"          , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmMET"              , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjW"             , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMjjL"             , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemDetajjL"          , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemMET"              , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjW"             , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMjjL"             , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeDetajjL"          , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeMET"              , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSDPhi3lMET"           , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSMET"                 , "JERDown" , [&]() { return www.met_jerdn_pt()>30.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSDPhi3lMET"           , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSMET"                 , "JERDown" , [&]() { return www.met_jerdn_pt()>40.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSDPhi3lMET"           , "JERDown" , [&]() { return www.DPhi3lMET_jerdn()>2.5                                ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSMET"                 , "JERDown" , [&]() { return www.met_jerdn_pt()>55.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMjjW"                , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMjjW"                , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMjjW"                , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)>=15.                           ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmMET"                 , "JERDown" , [&]() { return www.met_jerdn_pt()<60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemMET"                 , "JERDown" , [&]() { return www.met_jerdn_pt()<60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeMET"                 , "JERDown" , [&]() { return www.met_jerdn_pt()<60. and fabs(www.MllSS()-91.1876)>10. ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMET"                      , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMET"                      , "JERDown" , [&]() { return 1.                                                       ; } , [&]() { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjW"                     , "JERDown" , [&]() { return fabs(www.Mjj_jerdn()-80.)<15.                            ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMjjL"                     , "JERDown" , [&]() { return www.MjjL_jerdn()<400.                                    ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeDetajjL"                  , "JERDown" , [&]() { return www.DetajjL_jerdn()<1.5                                  ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeMET"                      , "JERDown" , [&]() { return www.met_jerdn_pt()>60.                                   ; } , [&]() { return 1          ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNj1"                     , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNj1"                     , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNj1"                     , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNj2"                    , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNj2"                    , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNj2"                    , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNj1"                     , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNj1"                     , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNj1"                     , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNj2"                    , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNj2"                    , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNj2"                    , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNj2"                , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNj2"                   , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNj4"                   , "JESUp"   , [&]() { return www.nj30_up()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JESUp"   , [&]() { return www.nj30_up()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JESUp"   , [&]() { return www.nj30_up()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JESUp"   , [&]() { return www.nj30_up()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JESUp"   , [&]() { return www.nj30_up()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JESUp"   , [&]() { return www.nj_up()<=2                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JESUp"   , [&]() { return www.nj_up()<=2                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JESUp"   , [&]() { return www.nj_up()<=2                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNj2"                   , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNj2"                   , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNj2"                   , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNj1"                    , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JESUp"   , [&]() { return www.nj_up()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNj2"                      , "JESUp"   , [&]() { return www.nj30_up()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSemNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNj1"                     , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNj1"                     , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNj1"                     , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNj2"                    , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNj2"                    , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNj2"                    , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSemNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNj1"                     , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNj1"                     , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNj1"                     , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNj2"                    , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNj2"                    , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNj2"                    , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNj2"                , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNj2"                   , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNj4"                   , "JESDown" , [&]() { return www.nj30_dn()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JESDown" , [&]() { return www.nj30_dn()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JESDown" , [&]() { return www.nj30_dn()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JESDown" , [&]() { return www.nj30_dn()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JESDown" , [&]() { return www.nj30_dn()>= 4                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JESDown" , [&]() { return www.nj_dn()<=2                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JESDown" , [&]() { return www.nj_dn()<=2                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JESDown" , [&]() { return www.nj_dn()<=2                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNj2"                   , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNj2"                   , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNj2"                   , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNj1"                    , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JESDown" , [&]() { return www.nj_dn()<=1                                           ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCRemNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("OSCReeNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSemNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNj2"                      , "JESDown" , [&]() { return www.nj30_dn()>= 2                                        ; } , [&]()   { return 1       ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSemNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNj1"                     , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNj1"                     , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNj1"                     , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNj2"                    , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNj2"                    , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNj2"                    , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSemNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNj1"                     , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNj1"                     , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNj1"                     , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNj2"                    , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNj2"                    , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNj2"                    , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNj2"                , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNj2"                   , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNj4"                   , "JER"     , [&]() { return www.nj30_jer()>= 4                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JER"     , [&]() { return www.nj30_jer()>= 4                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JER"     , [&]() { return www.nj30_jer()>= 4                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JER"     , [&]() { return www.nj30_jer()>= 4                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JER"     , [&]() { return www.nj30_jer()>= 4                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JER"     , [&]() { return www.nj_jer()<=2                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JER"     , [&]() { return www.nj_jer()<=2                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JER"     , [&]() { return www.nj_jer()<=2                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNj2"                   , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNj2"                   , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNj2"                   , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNj1"                    , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JER"     , [&]() { return www.nj_jer()<=1                                          ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCRemNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("OSCReeNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSemNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNj2"                      , "JER"     , [&]() { return www.nj30_jer()>= 2                                       ; } , [&]()     { return 1        ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNj1"                     , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNj1"                     , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNj1"                     , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNj2"                    , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNj2"                    , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNj2"                    , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNj1"                     , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNj1"                     , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNj1"                     , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNj2"                    , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNj2"                    , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNj2"                    , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNj2"                , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNj2"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNj4"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 4                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 4                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JERUp"   , [&]() { return www.nj30_jerup()>= 4                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JERUp"   , [&]() { return www.nj30_jerup()>= 4                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JERUp"   , [&]() { return www.nj30_jerup()>= 4                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JERUp"   , [&]() { return www.nj_jerup()<=2                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JERUp"   , [&]() { return www.nj_jerup()<=2                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JERUp"   , [&]() { return www.nj_jerup()<=2                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNj2"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNj2"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNj2"                   , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNj1"                    , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JERUp"   , [&]() { return www.nj_jerup()<=1                                        ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNj2"                      , "JERUp"   , [&]() { return www.nj30_jerup()>= 2                                     ; } , [&]()   { return 1          ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSemNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNj1"                     , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNj1"                     , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNj1"                     , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNj2"                    , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNj2"                    , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNj2"                    , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNj1"                   , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNj1"                   , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSemNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNj1"                     , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNj1"                     , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNj1"                     , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNj2"                    , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNj2"                    , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNj2"                    , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNj2"                , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNj2"                , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNj2"                , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNj1"                   , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNj1"                   , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNj1"                   , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNj2"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNj2"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNj2"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNj4"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNj4"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 4                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNj4"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 4                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNj4"               , "JERDown" , [&]() { return www.nj30_jerdn()>= 4                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNj4"               , "JERDown" , [&]() { return www.nj30_jerdn()>= 4                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNj4"               , "JERDown" , [&]() { return www.nj30_jerdn()>= 4                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNj2"                  , "JERDown" , [&]() { return www.nj_jerdn()<=2                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNj2"                  , "JERDown" , [&]() { return www.nj_jerdn()<=2                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNj2"                  , "JERDown" , [&]() { return www.nj_jerdn()<=2                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNj2"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNj2"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNj2"                   , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNj1"                    , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNj2"                  , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNj2"              , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNj2"              , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNj2"              , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNj1"                 , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNj1"                 , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNj1"                 , "JERDown" , [&]() { return www.nj_jerdn()<=1                                        ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNj2"                 , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNj2"                 , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNj2"                 , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCRemNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("OSCReeNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSemNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNj2"                      , "JERDown" , [&]() { return www.nj30_jerdn()>= 2                                     ; } , [&]() { return 1          ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSemNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNb0"                  , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNb0"                  , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNb0"                  , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNb0"                     , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNb0"                     , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNb0"                     , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNb0"                    , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNb0"                    , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNb0"                    , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSemNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNb0"                  , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNb0"                  , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNb0"                  , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNb0"                     , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNb0"                     , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNb0"                     , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JESUp"   , [&]() { return www.nb_up()==1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JESUp"   , [&]() { return www.nb_up()==1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JESUp"   , [&]() { return www.nb_up()==1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNb0"                   , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNb0"                    , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JESUp"   , [&]() { return www.nb_up()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("OSCRemNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("OSCReeNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LRSSemNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNb0"                      , "JESUp"   , [&]() { return www.nb_up()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSemNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNb0"                  , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNb0"                  , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNb0"                  , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNb0"                     , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNb0"                     , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNb0"                     , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNb0"                    , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNb0"                    , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNb0"                    , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSemNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNb0"                  , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNb0"                  , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNb0"                  , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNb0"                     , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNb0"                     , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNb0"                     , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JESDown" , [&]() { return www.nb_dn()==1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JESDown" , [&]() { return www.nb_dn()==1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JESDown" , [&]() { return www.nb_dn()==1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNb0"                   , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNb0"                    , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JESDown" , [&]() { return www.nb_dn()>=1                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("OSCRemNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("OSCReeNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LRSSemNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNb0"                      , "JESDown" , [&]() { return www.nb_dn()==0                                           ; } , [&]()   { return btag_sf ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SRSSemNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNb0"                  , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNb0"                  , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNb0"                  , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNb0"                     , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNb0"                     , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNb0"                     , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNb0"                    , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNb0"                    , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNb0"                    , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("ARSSemNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNb0"                  , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNb0"                  , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNb0"                  , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNb0"                     , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNb0"                     , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNb0"                     , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JER"     , [&]() { return www.nb_jer()==1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JER"     , [&]() { return www.nb_jer()==1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JER"     , [&]() { return www.nb_jer()==1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNb0"                   , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNb0"                    , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JER"     , [&]() { return www.nb_jer()>=1                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("OSCRemNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("OSCReeNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LRSSemNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNb0"                      , "JER"     , [&]() { return www.nb_jer()==0                                          ; } , [&]()     { return btag_sf  ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSemNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNb0"                  , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNb0"                  , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNb0"                  , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNb0"                     , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNb0"                     , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNb0"                     , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNb0"                    , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNb0"                    , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNb0"                    , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSemNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNb0"                  , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNb0"                  , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNb0"                  , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNb0"                     , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNb0"                     , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNb0"                     , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JERUp"   , [&]() { return www.nb_jerup()==1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JERUp"   , [&]() { return www.nb_jerup()==1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JERUp"   , [&]() { return www.nb_jerup()==1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNb0"                   , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNb0"                    , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JERUp"   , [&]() { return www.nb_jerup()>=1                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("OSCRemNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("OSCReeNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LRSSemNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNb0"                      , "JERUp"   , [&]() { return www.nb_jerup()==0                                        ; } , [&]()   { return btag_sf    ; } ) ;
-//
-//        cutflow.setCutSyst("SRSSmmNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSemNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSeeNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSSidemmNb0"                  , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSSideemNb0"                  , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SRSSSideeeNb0"                  , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SR0SFOSNb0"                     , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SR1SFOSNb0"                     , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("SR2SFOSNb0"                     , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCRSSmmNb0"                    , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCRSSemNb0"                    , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCRSSeeNb0"                    , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCR1SFOSNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("WZCR2SFOSNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSmmNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSemNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSeeNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSSidemmNb0"                  , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSSideemNb0"                  , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("ARSSSideeeNb0"                  , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("AR0SFOSNb0"                     , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("AR1SFOSNb0"                     , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("AR2SFOSNb0"                     , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSmmNbgeq1"                 , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSemNbgeq1"                 , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSeeNbgeq1"                 , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSidemmNbgeq1"             , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideemNbgeq1"             , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCRSSSideeeNbgeq1"             , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCR0SFOSNbgeq1"                , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCR1SFOSNbgeq1"                , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTCR2SFOSNbgeq1"                , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSmmNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSemNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("VBSCRSSeeNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSmmNbgeq1"                , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSemNbgeq1"                , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSeeNbgeq1"                , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSidemmNbgeq1"            , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideemNbgeq1"            , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTWCRSSSideeeNbgeq1"            , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTZCR0SFOSNb1"                  , "JERDown" , [&]() { return www.nb_jerdn()==1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTZCR1SFOSNb1"                  , "JERDown" , [&]() { return www.nb_jerdn()==1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("TTZCR2SFOSNb1"                  , "JERDown" , [&]() { return www.nb_jerdn()==1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXECRSSmmNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXECRSSemNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXECRSSeeNb0"                   , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("PhotonCRNb0"                    , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSmmNbgeq1"               , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSemNbgeq1"               , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSeeNbgeq1"               , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSidemmNbgeq1"           , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideemNbgeq1"           , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCRSSSideeeNbgeq1"           , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCR0SFOSNbgeq1"              , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCR1SFOSNbgeq1"              , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("BTARCR2SFOSNbgeq1"              , "JERDown" , [&]() { return www.nb_jerdn()>=1                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSmmNb0"                 , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSemNb0"                 , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LXEARCRSSeeNb0"                 , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("OSCRmmNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("OSCRemNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("OSCReeNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LRSSmmNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LRSSemNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-//        cutflow.setCutSyst("LRSSeeNb0"                      , "JERDown" , [&]() { return www.nb_jerdn()==0                                        ; } , [&]() { return btag_sf    ; } ) ;
-
+        jet_variations.push_back(JetVariationCuts::kJER);
+        jet_variations.push_back(JetVariationCuts::kJERUp);
+        jet_variations.push_back(JetVariationCuts::kJERDown);
     }
+    return jet_variations;
+}
+
+//_______________________________________________________________________________________________________
+std::vector<std::pair<TString, TString>> getJetVariedCuts()
+{
+    // Cuts that are varied by the jet energy scale and resolution, each with the jet variation cut replacing it under the variations
+    // (the jet variation cuts are written once against the variables of a variation, see addJetVariationCuts())
+    std::vector<std::pair<TString, TString>> jet_varied_cuts = {
+        {"SRSSmmMET"                 , "Pass"          },
+        {"SRSSmmMjjW"                , "MjjW"          },
+        {"SRSSmmMjjL"                , "MjjL"          },
+        {"SRSSmmDetajjL"             , "DetajjL"       },
+        {"SRSSemMjjW"                , "MjjW"          },
+        {"SRSSemMjjL"                , "MjjL"          },
+        {"SRSSemDetajjL"             , "DetajjL"       },
+        {"SRSSemMET"                 , "MET60"         },
+        {"SRSSeeMjjW"                , "MjjW"          },
+        {"SRSSeeMjjL"                , "MjjL"          },
+        {"SRSSeeDetajjL"             , "DetajjL"       },
+        {"SRSSeeMET"                 , "MET60"         },
+        {"SRSSSidemmMjjW"            , "MjjSide"       },
+        {"SRSSSidemmMjjL"            , "MjjL"          },
+        {"SRSSSidemmDetajjL"         , "DetajjL"       },
+        {"SRSSSidemmMET"             , "MET60"         },
+        {"SRSSSideemMjjW"            , "MjjSide"       },
+        {"SRSSSideemMjjL"            , "MjjL"          },
+        {"SRSSSideemDetajjL"         , "DetajjL"       },
+        {"SRSSSideemMET"             , "MET60"         },
+        {"SRSSSideeeMjjW"            , "MjjSide"       },
+        {"SRSSSideeeMjjL"            , "MjjL"          },
+        {"SRSSSideeeDetajjL"         , "DetajjL"       },
+        {"SRSSSideeeMET"             , "MET60"         },
+        {"SR0SFOSDPhi3lMET"          , "DPhi3lMET"     },
+        {"SR0SFOSMET"                , "MET30"         },
+        {"SR1SFOSDPhi3lMET"          , "DPhi3lMET"     },
+        {"SR1SFOSMET"                , "MET40"         },
+        {"SR2SFOSDPhi3lMET"          , "DPhi3lMET"     },
+        {"SR2SFOSMET"                , "MET55"         },
+        {"WZCRSSmmMET"               , "Pass"          },
+        {"WZCRSSmmMjjL"              , "MjjL"          },
+        {"WZCRSSmmDetajjL"           , "DetajjL"       },
+        {"WZCRSSemMjjL"              , "MjjL"          },
+        {"WZCRSSemDetajjL"           , "DetajjL"       },
+        {"WZCRSSemMET"               , "MET60"         },
+        {"WZCRSSeeMjjL"              , "MjjL"          },
+        {"WZCRSSeeDetajjL"           , "DetajjL"       },
+        {"WZCRSSeeMET"               , "MET60"         },
+        {"WZCR1SFOSDPhi3lMET"        , "DPhi3lMET"     },
+        {"WZCR1SFOSMET"              , "MET40"         },
+        {"WZCR2SFOSDPhi3lMET"        , "DPhi3lMET"     },
+        {"WZCR2SFOSMET"              , "MET55"         },
+        {"ARSSmmMjjW"                , "MjjW"          },
+        {"ARSSmmMjjL"                , "MjjL"          },
+        {"ARSSmmDetajjL"             , "DetajjL"       },
+        {"ARSSmmMET"                 , "Pass"          },
+        {"ARSSemMjjW"                , "MjjW"          },
+        {"ARSSemMjjL"                , "MjjL"          },
+        {"ARSSemDetajjL"             , "DetajjL"       },
+        {"ARSSemMET"                 , "MET60"         },
+        {"ARSSeeMjjW"                , "MjjW"          },
+        {"ARSSeeMjjL"                , "MjjL"          },
+        {"ARSSeeDetajjL"             , "DetajjL"       },
+        {"ARSSeeMET"                 , "MET60"         },
+        {"ARSSSidemmMjjW"            , "MjjSide"       },
+        {"ARSSSidemmMjjL"            , "MjjL"          },
+        {"ARSSSidemmDetajjL"         , "DetajjL"       },
+        {"ARSSSidemmMET"             , "MET60"         },
+        {"ARSSSideemMjjW"            , "MjjSide"       },
+        {"ARSSSideemMjjL"            , "MjjL"          },
+        {"ARSSSideemDetajjL"         , "DetajjL"       },
+        {"ARSSSideemMET"             , "MET60"         },
+        {"ARSSSideeeMjjW"            , "MjjSide"       },
+        {"ARSSSideeeMjjL"            , "MjjL"          },
+        {"ARSSSideeeDetajjL"         , "DetajjL"       },
+        {"ARSSSideeeMET"             , "MET60"         },
+        {"AR0SFOSDPhi3lMET"          , "DPhi3lMET"     },
+        {"AR0SFOSMET"                , "MET30"         },
+        {"AR1SFOSDPhi3lMET"          , "DPhi3lMET"     },
+        {"AR1SFOSMET"                , "MET40"         },
+        {"AR2SFOSDPhi3lMET"          , "DPhi3lMET"     },
+        {"AR2SFOSMET"                , "MET55"         },
+        {"BTCRSSmmMjjW"              , "MjjW"          },
+        {"BTCRSSmmMjjL"              , "MjjL"          },
+        {"BTCRSSmmDetajjL"           , "DetajjL"       },
+        {"BTCRSSemMjjW"              , "MjjW"          },
+        {"BTCRSSemMjjL"              , "MjjL"          },
+        {"BTCRSSemDetajjL"           , "DetajjL"       },
+        {"BTCRSSeeMjjW"              , "MjjW"          },
+        {"BTCRSSeeMjjL"              , "MjjL"          },
+        {"BTCRSSeeDetajjL"           , "DetajjL"       },
+        {"BTCRSSSidemmMjjW"          , "MjjSide"       },
+        {"BTCRSSSidemmMjjL"          , "MjjL"          },
+        {"BTCRSSSidemmDetajjL"       , "DetajjL"       },
+        {"BTCRSSSideemMjjW"          , "MjjSide"       },
+        {"BTCRSSSideemMjjL"          , "MjjL"          },
+        {"BTCRSSSideemDetajjL"       , "DetajjL"       },
+        {"BTCRSSSideeeMjjW"          , "MjjSide"       },
+        {"BTCRSSSideeeMjjL"          , "MjjL"          },
+        {"BTCRSSSideeeDetajjL"       , "DetajjL"       },
+        {"VBSCRSSmmVBF"              , "VBF"           },
+        {"VBSCRSSemVBF"              , "VBF"           },
+        {"VBSCRSSeeVBF"              , "VBF"           },
+        {"TTWCRSSmmMjjW"             , "MjjW"          },
+        {"TTWCRSSmmMjjL"             , "MjjL"          },
+        {"TTWCRSSmmDetajjL"          , "DetajjL"       },
+        {"TTWCRSSemMjjW"             , "MjjW"          },
+        {"TTWCRSSemMjjL"             , "MjjL"          },
+        {"TTWCRSSemDetajjL"          , "DetajjL"       },
+        {"TTWCRSSeeMjjW"             , "MjjW"          },
+        {"TTWCRSSeeMjjL"             , "MjjL"          },
+        {"TTWCRSSeeDetajjL"          , "DetajjL"       },
+        {"TTWCRSSSidemmMjjW"         , "MjjSide"       },
+        {"TTWCRSSSidemmMjjL"         , "MjjL"          },
+        {"TTWCRSSSidemmDetajjL"      , "DetajjL"       },
+        {"TTWCRSSSideemMjjW"         , "MjjSide"       },
+        {"TTWCRSSSideemMjjL"         , "MjjL"          },
+        {"TTWCRSSSideemDetajjL"      , "DetajjL"       },
+        {"TTWCRSSSideeeMjjW"         , "MjjSide"       },
+        {"TTWCRSSSideeeMjjL"         , "MjjL"          },
+        {"TTWCRSSSideeeDetajjL"      , "DetajjL"       },
+        {"LXECRSSmmMjjW"             , "MjjSide"       },
+        {"LXECRSSemMjjW"             , "MjjSide"       },
+        {"LXECRSSeeMjjW"             , "MjjSide"       },
+        {"BTCRSSmmMET"               , "Pass"          },
+        {"BTCRSSemMET"               , "MET60"         },
+        {"BTCRSSeeMET"               , "MET60"         },
+        {"BTCRSSSidemmMET"           , "MET60"         },
+        {"BTCRSSSideemMET"           , "MET60"         },
+        {"BTCRSSSideeeMET"           , "MET60"         },
+        {"BTCR0SFOSDPhi3lMET"        , "DPhi3lMET"     },
+        {"BTCR0SFOSMET"              , "MET30"         },
+        {"BTCR1SFOSDPhi3lMET"        , "DPhi3lMET"     },
+        {"BTCR1SFOSMET"              , "MET40"         },
+        {"BTCR2SFOSDPhi3lMET"        , "DPhi3lMET"     },
+        {"BTCR2SFOSMET"              , "MET55"         },
+        {"TTWCRSSmmMET"              , "Pass"          },
+        {"TTWCRSSemMET"              , "MET60"         },
+        {"TTWCRSSeeMET"              , "MET60"         },
+        {"TTWCRSSSidemmMET"          , "MET60"         },
+        {"TTWCRSSSideemMET"          , "MET60"         },
+        {"TTWCRSSSideeeMET"          , "MET60"         },
+        {"TTZCR0SFOSDPhi3lMET"       , "DPhi3lMET"     },
+        {"TTZCR0SFOSMET"             , "MET30"         },
+        {"TTZCR1SFOSDPhi3lMET"       , "DPhi3lMET"     },
+        {"TTZCR1SFOSMET"             , "MET40"         },
+        {"TTZCR2SFOSDPhi3lMET"       , "DPhi3lMET"     },
+        {"TTZCR2SFOSMET"             , "MET55"         },
+        {"LXECRSSmmMET"              , "METlt60"       },
+        {"LXECRSSemMET"              , "METlt60"       },
+        {"LXECRSSeeMET"              , "METlt60ZeeVt"  },
+        {"BTARCRSSmmMjjW"            , "MjjW"          },
+        {"BTARCRSSmmMjjL"            , "MjjL"          },
+        {"BTARCRSSmmDetajjL"         , "DetajjL"       },
+        {"BTARCRSSmmMET"             , "Pass"          },
+        {"BTARCRSSemMjjW"            , "MjjW"          },
+        {"BTARCRSSemMjjL"            , "MjjL"          },
+        {"BTARCRSSemDetajjL"         , "DetajjL"       },
+        {"BTARCRSSemMET"             , "MET60"         },
+        {"BTARCRSSeeMjjW"            , "MjjW"          },
+        {"BTARCRSSeeMjjL"            , "MjjL"          },
+        {"BTARCRSSeeDetajjL"         , "DetajjL"       },
+        {"BTARCRSSeeMET"             , "MET60"         },
+        {"BTARCRSSSidemmMjjW"        , "MjjSide"       },
+        {"BTARCRSSSidemmMjjL"        , "MjjL"          },
+        {"BTARCRSSSidemmDetajjL"     , "DetajjL"       },
+        {"BTARCRSSSidemmMET"         , "MET60"         },
+        {"BTARCRSSSideemMjjW"        , "MjjSide"       },
+        {"BTARCRSSSideemMjjL"        , "MjjL"          },
+        {"BTARCRSSSideemDetajjL"     , "DetajjL"       },
+        {"BTARCRSSSideemMET"         , "MET60"         },
+        {"BTARCRSSSideeeMjjW"        , "MjjSide"       },
+        {"BTARCRSSSideeeMjjL"        , "MjjL"          },
+        {"BTARCRSSSideeeDetajjL"     , "DetajjL"       },
+        {"BTARCRSSSideeeMET"         , "MET60"         },
+        {"BTARCR0SFOSDPhi3lMET"      , "DPhi3lMET"     },
+        {"BTARCR0SFOSMET"            , "MET30"         },
+        {"BTARCR1SFOSDPhi3lMET"      , "DPhi3lMET"     },
+        {"BTARCR1SFOSMET"            , "MET40"         },
+        {"BTARCR2SFOSDPhi3lMET"      , "DPhi3lMET"     },
+        {"BTARCR2SFOSMET"            , "MET55"         },
+        {"LXEARCRSSmmMjjW"           , "MjjSide"       },
+        {"LXEARCRSSemMjjW"           , "MjjSide"       },
+        {"LXEARCRSSeeMjjW"           , "MjjSide"       },
+        {"LXEARCRSSmmMET"            , "METlt60"       },
+        {"LXEARCRSSemMET"            , "METlt60"       },
+        {"LXEARCRSSeeMET"            , "METlt60ZeeVt"  },
+        {"SRSSmmNj2"                 , "Nj2"           },
+        {"SRSSemNj2"                 , "Nj2"           },
+        {"SRSSeeNj2"                 , "Nj2"           },
+        {"SRSSSidemmNj2"             , "Nj2"           },
+        {"SRSSSideemNj2"             , "Nj2"           },
+        {"SRSSSideeeNj2"             , "Nj2"           },
+        {"SR0SFOSNj1"                , "Nj1"           },
+        {"SR1SFOSNj1"                , "Nj1"           },
+        {"SR2SFOSNj1"                , "Nj1"           },
+        {"WZCRSSmmNj2"               , "Nj2"           },
+        {"WZCRSSemNj2"               , "Nj2"           },
+        {"WZCRSSeeNj2"               , "Nj2"           },
+        {"WZCR1SFOSNj1"              , "Nj1"           },
+        {"WZCR2SFOSNj1"              , "Nj1"           },
+        {"ARSSmmNj2"                 , "Nj2"           },
+        {"ARSSemNj2"                 , "Nj2"           },
+        {"ARSSeeNj2"                 , "Nj2"           },
+        {"ARSSSidemmNj2"             , "Nj2"           },
+        {"ARSSSideemNj2"             , "Nj2"           },
+        {"ARSSSideeeNj2"             , "Nj2"           },
+        {"AR0SFOSNj1"                , "Nj1"           },
+        {"AR1SFOSNj1"                , "Nj1"           },
+        {"AR2SFOSNj1"                , "Nj1"           },
+        {"BTCRSSmmNj2"               , "Nj2"           },
+        {"BTCRSSemNj2"               , "Nj2"           },
+        {"BTCRSSeeNj2"               , "Nj2"           },
+        {"BTCRSSSidemmNj2"           , "Nj2"           },
+        {"BTCRSSSideemNj2"           , "Nj2"           },
+        {"BTCRSSSideeeNj2"           , "Nj2"           },
+        {"BTCR0SFOSNj1"              , "Nj1"           },
+        {"BTCR1SFOSNj1"              , "Nj1"           },
+        {"BTCR2SFOSNj1"              , "Nj1"           },
+        {"VBSCRSSmmNj2"              , "Nj2"           },
+        {"VBSCRSSemNj2"              , "Nj2"           },
+        {"VBSCRSSeeNj2"              , "Nj2"           },
+        {"TTWCRSSmmNj4"              , "Nj2"           },
+        {"TTWCRSSemNj4"              , "Nj4"           },
+        {"TTWCRSSeeNj4"              , "Nj4"           },
+        {"TTWCRSSSidemmNj4"          , "Nj4"           },
+        {"TTWCRSSSideemNj4"          , "Nj4"           },
+        {"TTWCRSSSideeeNj4"          , "Nj4"           },
+        {"TTZCR0SFOSNj2"             , "NjLeq2"        },
+        {"TTZCR1SFOSNj2"             , "NjLeq2"        },
+        {"TTZCR2SFOSNj2"             , "NjLeq2"        },
+        {"LXECRSSmmNj2"              , "Nj2"           },
+        {"LXECRSSemNj2"              , "Nj2"           },
+        {"LXECRSSeeNj2"              , "Nj2"           },
+        {"PhotonCRNj1"               , "Nj1"           },
+        {"BTARCRSSmmNj2"             , "Nj2"           },
+        {"BTARCRSSemNj2"             , "Nj2"           },
+        {"BTARCRSSeeNj2"             , "Nj2"           },
+        {"BTARCRSSSidemmNj2"         , "Nj2"           },
+        {"BTARCRSSSideemNj2"         , "Nj2"           },
+        {"BTARCRSSSideeeNj2"         , "Nj2"           },
+        {"BTARCR0SFOSNj1"            , "Nj1"           },
+        {"BTARCR1SFOSNj1"            , "Nj1"           },
+        {"BTARCR2SFOSNj1"            , "Nj1"           },
+        {"LXEARCRSSmmNj2"            , "Nj2"           },
+        {"LXEARCRSSemNj2"            , "Nj2"           },
+        {"LXEARCRSSeeNj2"            , "Nj2"           },
+        {"SRSSmmNb0"                 , "Nb0"           },
+        {"SRSSemNb0"                 , "Nb0"           },
+        {"SRSSeeNb0"                 , "Nb0"           },
+        {"SRSSSidemmNb0"             , "Nb0"           },
+        {"SRSSSideemNb0"             , "Nb0"           },
+        {"SRSSSideeeNb0"             , "Nb0"           },
+        {"SR0SFOSNb0"                , "Nb0"           },
+        {"SR1SFOSNb0"                , "Nb0"           },
+        {"SR2SFOSNb0"                , "Nb0"           },
+        {"WZCRSSmmNb0"               , "Nb0"           },
+        {"WZCRSSemNb0"               , "Nb0"           },
+        {"WZCRSSeeNb0"               , "Nb0"           },
+        {"WZCR1SFOSNb0"              , "Nb0"           },
+        {"WZCR2SFOSNb0"              , "Nb0"           },
+        {"ARSSmmNb0"                 , "Nb0"           },
+        {"ARSSemNb0"                 , "Nb0"           },
+        {"ARSSeeNb0"                 , "Nb0"           },
+        {"ARSSSidemmNb0"             , "Nb0"           },
+        {"ARSSSideemNb0"             , "Nb0"           },
+        {"ARSSSideeeNb0"             , "Nb0"           },
+        {"AR0SFOSNb0"                , "Nb0"           },
+        {"AR1SFOSNb0"                , "Nb0"           },
+        {"AR2SFOSNb0"                , "Nb0"           },
+        {"BTCRSSmmNbgeq1"            , "Nb1"           },
+        {"BTCRSSemNbgeq1"            , "Nb1"           },
+        {"BTCRSSeeNbgeq1"            , "Nb1"           },
+        {"BTCRSSSidemmNbgeq1"        , "Nb1"           },
+        {"BTCRSSSideemNbgeq1"        , "Nb1"           },
+        {"BTCRSSSideeeNbgeq1"        , "Nb1"           },
+        {"BTCR0SFOSNbgeq1"           , "Nb1"           },
+        {"BTCR1SFOSNbgeq1"           , "Nb1"           },
+        {"BTCR2SFOSNbgeq1"           , "Nb1"           },
+        {"VBSCRSSmmNb0"              , "Nb0"           },
+        {"VBSCRSSemNb0"              , "Nb0"           },
+        {"VBSCRSSeeNb0"              , "Nb0"           },
+        {"TTWCRSSmmNbgeq1"           , "Nb1"           },
+        {"TTWCRSSemNbgeq1"           , "Nb1"           },
+        {"TTWCRSSeeNbgeq1"           , "Nb1"           },
+        {"TTWCRSSSidemmNbgeq1"       , "Nb1"           },
+        {"TTWCRSSSideemNbgeq1"       , "Nb1"           },
+        {"TTWCRSSSideeeNbgeq1"       , "Nb1"           },
+        {"TTZCR0SFOSNb1"             , "NbEq1"         },
+        {"TTZCR1SFOSNb1"             , "NbEq1"         },
+        {"TTZCR2SFOSNb1"             , "NbEq1"         },
+        {"LXECRSSmmNb0"              , "Nb0"           },
+        {"LXECRSSemNb0"              , "Nb0"           },
+        {"LXECRSSeeNb0"              , "Nb0"           },
+        {"PhotonCRNb0"               , "Nb0"           },
+        {"BTARCRSSmmNbgeq1"          , "Nb1"           },
+        {"BTARCRSSemNbgeq1"          , "Nb1"           },
+        {"BTARCRSSeeNbgeq1"          , "Nb1"           },
+        {"BTARCRSSSidemmNbgeq1"      , "Nb1"           },
+        {"BTARCRSSSideemNbgeq1"      , "Nb1"           },
+        {"BTARCRSSSideeeNbgeq1"      , "Nb1"           },
+        {"BTARCR0SFOSNbgeq1"         , "Nb1"           },
+        {"BTARCR1SFOSNbgeq1"         , "Nb1"           },
+        {"BTARCR2SFOSNbgeq1"         , "Nb1"           },
+        {"LXEARCRSSmmNb0"            , "Nb0"           },
+        {"LXEARCRSSemNb0"            , "Nb0"           },
+        {"LXEARCRSSeeNb0"            , "Nb0"           }
+    };
+    return jet_varied_cuts;
 }
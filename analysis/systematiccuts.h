@@ -5,7 +5,11 @@
 #include "globalvariables.h"
 #include "rooutil/rooutil.h"
 #include "scalefactors.h"
+#include "systematicweights.h"
+#include "jetvariationcuts.h"
 
 void addSystematicCuts(RooUtil::Cutflow& cutflow);
+std::vector<JetVariationCuts::Variation> getJetVariations();
+std::vector<std::pair<TString, TString>> getJetVariedCuts();
 
 #endif
@@ -0,0 +1,136 @@
+#include "systematicweights.h"
+
+SystematicWeights systematicweights;
+
+//_______________________________________________________________________________________________________
+SystematicWeights::SystematicWeights() : weights(kNVariations, 1), epoch(1), computed_epoch(0)
+{
+}
+
+//_______________________________________________________________________________________________________
+std::vector<SystematicWeights::Variation> SystematicWeights::getVariations()
+{
+    std::vector<Variation> variations;
+    if (doFakeEstimation)
+    {
+        for (int variation = kFakeUp; variation <= kFakeClosureMuDown; ++variation)
+            variations.push_back((Variation) variation);
+    }
+    if (doSystematics)
+    {
+        for (int variation = kLepSFUp; variation <= kAlphaSDown; ++variation)
+            variations.push_back((Variation) variation);
+    }
+    return variations;
+}
+
+//_______________________________________________________________________________________________________
+TString SystematicWeights::getName(Variation variation)
+{
+    static const char* names[kNVariations] = {
+        "FakeUp", "FakeDown",
+        "FakeRateUp", "FakeRateDown", "FakeRateElUp", "FakeRateElDown", "FakeRateMuUp", "FakeRateMuDown",
+        "FakeClosureUp", "FakeClosureDown", "FakeClosureElUp", "FakeClosureElDown", "FakeClosureMuUp", "FakeClosureMuDown",
+        "LepSFUp", "LepSFDown",
+        "TrigSFUp", "TrigSFDown",
+        "BTagLFUp", "BTagLFDown", "BTagHFUp", "BTagHFDown",
+        "PileupUp", "PileupDown",
+        "PDFUp", "PDFDown", "QsqUp", "QsqDown", "AlphaSUp", "AlphaSDown"
+    };
+    return variation < kNVariations ? names[variation] : "";
+}
+
+//_______________________________________________________________________________________________________
+std::function<float()> SystematicWeights::get(Variation variation)
+{
+    unsigned int ivariation = variation;
+    return [this, ivariation]() { return weight(ivariation); };
+}
+
+//_______________________________________________________________________________________________________
+void SystematicWeights::compute()
+{
+    // Same expressions as the variations registered in addSystematicCuts() (so the weights are identical), each input evaluated once
+    computed_epoch = epoch;
+
+    if (doFakeEstimation)
+    {
+        if (!is2017)
+        {
+            float ffwgt = www.ffwgt();
+            weights[kFakeUp]            = ffwgt == 0 ? 0 : www.ffwgt_full_up()       / ffwgt;
+            weights[kFakeDown]          = ffwgt == 0 ? 0 : www.ffwgt_full_dn()       / ffwgt;
+            weights[kFakeRateUp]        = ffwgt == 0 ? 0 : www.ffwgt_up()            / ffwgt;
+            weights[kFakeRateDown]      = ffwgt == 0 ? 0 : www.ffwgt_dn()            / ffwgt;
+            weights[kFakeRateElUp]      = ffwgt == 0 ? 0 : www.ffwgt_el_up()         / ffwgt;
+            weights[kFakeRateElDown]    = ffwgt == 0 ? 0 : www.ffwgt_el_dn()         / ffwgt;
+            weights[kFakeRateMuUp]      = ffwgt == 0 ? 0 : www.ffwgt_mu_up()         / ffwgt;
+            weights[kFakeRateMuDown]    = ffwgt == 0 ? 0 : www.ffwgt_mu_dn()         / ffwgt;
+            weights[kFakeClosureUp]     = ffwgt == 0 ? 0 : www.ffwgt_closure_up()    / ffwgt;
+            weights[kFakeClosureDown]   = ffwgt == 0 ? 0 : www.ffwgt_closure_dn()    / ffwgt;
+            weights[kFakeClosureElUp]   = ffwgt == 0 ? 0 : www.ffwgt_closure_el_up() / ffwgt;
+            weights[kFakeClosureElDown] = ffwgt == 0 ? 0 : www.ffwgt_closure_el_dn() / ffwgt;
+            weights[kFakeClosureMuUp]   = ffwgt == 0 ? 0 : www.ffwgt_closure_mu_up() / ffwgt;
+            weights[kFakeClosureMuDown] = ffwgt == 0 ? 0 : www.ffwgt_closure_mu_dn() / ffwgt;
+        }
+        else
+        {
+            weights[kFakeUp]            = 1; // TODO
+            weights[kFakeDown]          = 1; // TODO
+            weights[kFakeRateUp]        = 1; // TODO
+            weights[kFakeRateDown]      = 1; // TODO
+            weights[kFakeClosureUp]     = 1; // TODO
+            weights[kFakeClosureDown]   = 1; // TODO
+            float ff = fakerates.getFakeFactor();
+            weights[kFakeRateElUp]      = ff == 0 ? 0 : fakerates.getFakeFactor( 1, 11)       / ff;
+            weights[kFakeRateElDown]    = ff == 0 ? 0 : fakerates.getFakeFactor(-1, 11)       / ff;
+            weights[kFakeRateMuUp]      = ff == 0 ? 0 : fakerates.getFakeFactor( 1, 13)       / ff;
+            weights[kFakeRateMuDown]    = ff == 0 ? 0 : fakerates.getFakeFactor(-1, 13)       / ff;
+            weights[kFakeClosureElUp]   = ff == 0 ? 0 : fakerates.getFakeFactor( 1, 11, true) / ff;
+            weights[kFakeClosureElDown] = ff == 0 ? 0 : fakerates.getFakeFactor(-1, 11, true) / ff;
+            weights[kFakeClosureMuUp]   = ff == 0 ? 0 : fakerates.getFakeFactor( 1, 13, true) / ff;
+            weights[kFakeClosureMuDown] = ff == 0 ? 0 : fakerates.getFakeFactor(-1, 13, true) / ff;
+        }
+    }
+
+    if (not doSystematics)
+        return;
+
+    if (is2017)
+    {
+        float lepsf = leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData);
+        weights[kLepSFUp]    = lepsf == 0 ? 0 : leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData, 1) / lepsf;
+        weights[kLepSFDown]  = lepsf == 0 ? 0 : leptonScaleFactors.getScaleFactors(is2017, doFakeEstimation, isData,-1) / lepsf;
+        weights[kTrigSFUp]   = 1;
+        weights[kTrigSFDown] = 1;
+        float purewgt = pileupreweight.purewgt();
+        weights[kPileupUp]   = purewgt == 0 ? 0 : pileupreweight.purewgt_dn() / purewgt;
+        weights[kPileupDown] = purewgt == 0 ? 0 : pileupreweight.purewgt_up() / purewgt;
+    }
+    else
+    {
+        float lepsf = www.lepsf();
+        weights[kLepSFUp]    = lepsf == 0 ? 0 : www.lepsf_up() / lepsf;
+        weights[kLepSFDown]  = lepsf == 0 ? 0 : www.lepsf_dn() / lepsf;
+        float trigsf = www.trigsf();
+        weights[kTrigSFUp]   = trigsf == 0 ? 0 : www.trigsf_up() / trigsf;
+        weights[kTrigSFDown] = trigsf == 0 ? 0 : www.trigsf_dn() / trigsf;
+        float purewgt = www.purewgt();
+        weights[kPileupUp]   = purewgt == 0 ? 0 : www.purewgt_dn() / purewgt;
+        weights[kPileupDown] = purewgt == 0 ? 0 : www.purewgt_up() / purewgt;
+    }
+
+    float btagsf = www.weight_btagsf();
+    weights[kBTagLFUp]   = btagsf == 0 ? 0 : www.weight_btagsf_light_DN() / btagsf;
+    weights[kBTagLFDown] = btagsf == 0 ? 0 : www.weight_btagsf_light_UP() / btagsf;
+    weights[kBTagHFUp]   = btagsf == 0 ? 0 : www.weight_btagsf_heavy_DN() / btagsf;
+    weights[kBTagHFDown] = btagsf == 0 ? 0 : www.weight_btagsf_heavy_UP() / btagsf;
+
+    float fr = www.weight_fr_r1_f1();
+    weights[kPDFUp]      = fr == 0 or theoryweight.pdfup() == 0 ? 0 : www.weight_pdf_up()       / fr * theoryweight.nominal() / theoryweight.pdfup();
+    weights[kPDFDown]    = fr == 0 or theoryweight.pdfdn() == 0 ? 0 : www.weight_pdf_down()     / fr * theoryweight.nominal() / theoryweight.pdfdn();
+    weights[kQsqUp]      = fr == 0 or theoryweight.qsqup() == 0 ? 0 : www.weight_fr_r2_f2()     / fr * theoryweight.nominal() / theoryweight.qsqup();
+    weights[kQsqDown]    = fr == 0 or theoryweight.qsqdn() == 0 ? 0 : www.weight_fr_r0p5_f0p5() / fr * theoryweight.nominal() / theoryweight.qsqdn();
+    weights[kAlphaSUp]   = fr == 0 or theoryweight.alsup() == 0 ? 0 : www.weight_alphas_up()    / fr * theoryweight.nominal() / theoryweight.alsup();
+    weights[kAlphaSDown] = fr == 0 or theoryweight.alsdn() == 0 ? 0 : www.weight_alphas_down()  / fr * theoryweight.nominal() / theoryweight.alsdn();
+}
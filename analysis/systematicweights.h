@@ -0,0 +1,71 @@
+#ifndef systematicweights_h
+#define systematicweights_h
+
+#include "wwwtree.h"
+#include "globalvariables.h"
+#include "scalefactors.h"
+#include "rooutil/rooutil.h"
+#include <vector>
+#include <functional>
+
+//_______________________________________________________________________________________________________
+// Weights of all the weight systematic variations (relative to the nominal weight) computed together in one pass
+// The first access of an event computes every variation into a contiguous array, sharing the intermediate values
+// (nominal lepton scale factor, fake factor, pileup and b-tagging weights, ...) that each variation used to recompute.
+// The functions handed out by get() read from the array and are passed to cutflow.addWgtSyst().
+class SystematicWeights
+{
+    public:
+        enum Variation
+        {
+            kFakeUp, kFakeDown,
+            kFakeRateUp, kFakeRateDown, kFakeRateElUp, kFakeRateElDown, kFakeRateMuUp, kFakeRateMuDown,
+            kFakeClosureUp, kFakeClosureDown, kFakeClosureElUp, kFakeClosureElDown, kFakeClosureMuUp, kFakeClosureMuDown,
+            kLepSFUp, kLepSFDown,
+            kTrigSFUp, kTrigSFDown,
+            kBTagLFUp, kBTagLFDown, kBTagHFUp, kBTagHFDown,
+            kPileupUp, kPileupDown,
+            kPDFUp, kPDFDown, kQsqUp, kQsqDown, kAlphaSUp, kAlphaSDown,
+            kNVariations
+        };
+
+        SystematicWeights();
+
+        // Variations registered for the current mode (fake and/or weight systematics) in the order they are booked in the cutflow
+        static std::vector<Variation> getVariations();
+
+        // Name of the variation in the cutflow (e.g. "LepSFUp")
+        static TString getName(Variation variation);
+
+        // Function returning the weight of a variation for the current event (to be passed to cutflow.addWgtSyst)
+        std::function<float()> get(Variation variation);
+
+        // Forget the weights of the previous event (to be called before every cutflow.fill())
+        void newEvent() { ++epoch; }
+
+        inline float weight(unsigned int ivariation)
+        {
+            if (computed_epoch != epoch)
+                compute();
+            return weights[ivariation];
+        }
+
+        // All the weights of the current event (only the variations of the current mode are set)
+        const std::vector<float>& getWeights()
+        {
+            if (computed_epoch != epoch)
+                compute();
+            return weights;
+        }
+
+    private:
+        void compute();
+
+        std::vector<float> weights;
+        unsigned int epoch;
+        unsigned int computed_epoch;
+};
+
+extern SystematicWeights systematicweights;
+
+#endif
@@ -0,0 +1,80 @@
+#!/bin/bash
+
+# Measures the per-event cost of the histogram fills for the SRSS* and WZCR* booking sets, before and after a change of the
+# multi-weight fill (e.g. the dense dispatch table):
+#
+#   sh timefill.sh /path/to/baby.root BEFORE_REVISION
+#
+# BEFORE_REVISION is any git revision (branch, tag or commit), e.g. the parent of the commit that introduced the dispatch table.
+# For each booking set the working tree doAnalysis runs with timefill=1, once with the histograms booked in the cutflow
+# (multiweight=0) and once with the multi-weight histograms (multiweight=1), and prints the fill time per event of each.
+# The given revision has no timefill option, so it is built in a temporary git worktree (with the rooutil of this checkout)
+# and compared with multiweight=1 by the wall time per event of the whole job, next to the same for the working tree.
+# All the jobs run in one process from this directory (same scalefactors/), the first one also warms up the page cache.
+
+#_____________________________________________________________________________________________
+# Help message
+help()
+{
+    echo "Error - Usage:"
+    echo "$0 INPUT_BABY [BEFORE_REVISION] [TREENAME=t] [NEVENTS=20000]"
+    exit 1
+}
+
+if [ -z $1 ]; then help; fi
+
+INPUT=$1
+BEFORE=$2
+TREENAME=${3:-t}
+NEVENTS=${4:-20000}
+WORKDIR=timefill_$(basename ${INPUT} .root)
+mkdir -p ${WORKDIR}
+
+# The booking sets (end cuts without the "Full" suffix)
+SRSS="SRSSee,SRSSem,SRSSmm,SRSSSideee,SRSSSideem,SRSSSidemm"
+WZCR="WZCRSSee,WZCRSSem,WZCRSSmm,WZCR1SFOS,WZCR2SFOS"
+
+#_____________________________________________________________________________________________
+# Run the given doAnalysis on the booking set with the given options and print the wall time per event
+# (and the fill timing lines when timefill=1 is among the options)
+run()
+{
+    EXE=$1
+    NAME=$2
+    REGIONS=$3
+    OPTIONS=$4
+    START=$(date +%s.%N)
+    ${EXE} ${INPUT} ${TREENAME} ${WORKDIR}/${NAME}.root ${NEVENTS} ${REGIONS} "${OPTIONS}" > ${WORKDIR}/${NAME}.log 2>&1
+    if [ $? -ne 0 ]; then
+        echo "doAnalysis failed for ${NAME} (see ${WORKDIR}/${NAME}.log)"
+        return 1
+    fi
+    END=$(date +%s.%N)
+    echo "${NAME} \"${OPTIONS}\": $(echo "1e6 * (${END} - ${START}) / ${NEVENTS}" | bc -l | xargs printf "%.2f") microseconds per event for the whole job"
+    grep " cutflow.fill(): " ${WORKDIR}/${NAME}.log
+}
+
+#_____________________________________________________________________________________________
+# Build doAnalysis at the given revision
+if [ -n "${BEFORE}" ]; then
+    HERE=$(pwd)
+    git -C .. worktree add --detach ${HERE}/${WORKDIR}/before ${BEFORE} > /dev/null || exit 1
+    rmdir ${WORKDIR}/before/analysis/rooutil 2> /dev/null
+    ln -sfn ${HERE}/rooutil ${WORKDIR}/before/analysis/rooutil
+    if ! make -C ${WORKDIR}/before/analysis -j > ${WORKDIR}/before.log 2>&1; then
+        echo "Could not build doAnalysis at ${BEFORE} (see ${WORKDIR}/before.log)"
+        BEFORE=""
+    fi
+fi
+
+for SET in SRSS WZCR; do
+    echo "${SET}*:"
+    run ./doAnalysis ${SET}_cutflow ${!SET} "timefill=1,multiweight=0"
+    run ./doAnalysis ${SET}_multiweight ${!SET} "timefill=1,multiweight=1"
+    if [ -n "${BEFORE}" ]; then
+        run ${WORKDIR}/before/analysis/doAnalysis ${SET}_multiweight_before ${!SET} "multiweight=1"
+        run ./doAnalysis ${SET}_multiweight_after ${!SET} "multiweight=1"
+    fi
+done
+
+if [ -d ${WORKDIR}/before ]; then git -C .. worktree remove --force ${HERE}/${WORKDIR}/before; fi
@@ -0,0 +1,168 @@
+#!/bin/bash
+
+# Checks that the optional code paths of doAnalysis give the same outputs as the reference path on one baby
+# Each check runs doAnalysis with the reference options and with the options under test on the same input and compares
+# every histogram and cutflow of the two outputs with compareoutputs.py. Exits with 1 if any check fails.
+
+#_____________________________________________________________________________________________
+# Help message
+help()
+{
+    echo "Error - Usage:"
+    echo "$0 INPUT_BABY [TREENAME=t] [NEVENTS=20000] [REGIONS=all] [DEMUX=0]"
+    exit 1
+}
+
+if [ -z $1 ]; then help; fi
+
+INPUT=$1
+TREENAME=${2:-t}
+NEVENTS=${3:-20000}
+REGIONS=${4:-all}
+DEMUX=${5:-0}
+WORKDIR=validate_$(basename ${INPUT} .root)
+mkdir -p ${WORKDIR}
+
+NFAILED=0
+
+#_____________________________________________________________________________________________
+# Run doAnalysis on the input with the given options into the given output name (on the given regions, ${REGIONS} by default)
+run()
+{
+    ./doAnalysis ${INPUT} ${TREENAME} ${WORKDIR}/$1 ${NEVENTS} ${3:-${REGIONS}} "$2" > ${WORKDIR}/$1.log 2>&1
+    if [ $? -ne 0 ]; then
+        echo "doAnalysis failed with options \"$2\" (see ${WORKDIR}/$1.log)"
+        NFAILED=$((NFAILED + 1))
+        return 1
+    fi
+}
+
+# Compare the outputs ${NAME}_reference.root and ${NAME}.root with a description of what differs between them, exactly unless
+# a relative tolerance is given (the entry range and checkpoint bookkeeping trees are not histograms and are not compared)
+compare()
+{
+    if python compareoutputs.py ${WORKDIR}/$1_reference.root ${WORKDIR}/$1.root ${3:-0} > ${WORKDIR}/$1.diff; then
+        echo "PASSED $1: $2"
+    else
+        echo "FAILED $1: $2 (see ${WORKDIR}/$1.diff)"
+        NFAILED=$((NFAILED + 1))
+    fi
+}
+
+# Compare the outputs of the reference options and of the options under test [on the given regions] [up to a relative tolerance]
+check()
+{
+    NAME=$1
+    REFERENCE_OPTIONS=$2
+    OPTIONS=$3
+    run ${NAME}_reference.root "${REFERENCE_OPTIONS}" "$4" || return
+    run ${NAME}.root "${OPTIONS}" "$4" || return
+    compare ${NAME} "\"${OPTIONS}\" against \"${REFERENCE_OPTIONS}\"" "$5"
+}
+
+# Compare the output of a job stopped right after its first checkpoint and then resumed from it (see stopatcheckpoint) to the
+# output of the same job run without interruption
+checkresume()
+{
+    CHECKPOINTEVENTS=$(( NEVENTS > 0 ? (NEVENTS + 2) / 3 : 5000 ))
+    OPTIONS="eventlists=0,checkpointevents=${CHECKPOINTEVENTS}"
+    rm -f ${WORKDIR}/resume_checkpoint.root
+    run resume_reference.root "eventlists=0" || return
+    ./doAnalysis ${INPUT} ${TREENAME} ${WORKDIR}/resume.root ${NEVENTS} ${REGIONS} "${OPTIONS},stopatcheckpoint=1" > ${WORKDIR}/resume_stopped.log 2>&1
+    if [ $? -ne 3 ]; then
+        echo "FAILED resume: doAnalysis did not stop after a checkpoint every ${CHECKPOINTEVENTS} events (see ${WORKDIR}/resume_stopped.log)"
+        NFAILED=$((NFAILED + 1))
+        return 1
+    fi
+    run resume.root "${OPTIONS}" || return
+    compare resume "resumed from the first checkpoint of \"${OPTIONS}\" against an uninterrupted job"
+}
+
+# Compare the outputs filled together in one pass over the events (as the t_ss + t_ddfakes and t_ss + t_ewksubt jobs of run.sh)
+# to the same outputs each filled by a job of its own (the mode of an output is set by "ddfakes"/"ewksubt" in its name)
+checksinglepass()
+{
+    MODES="ss ddfakes ewksubt"
+    SINGLEPASSOUTPUTS=""
+    for MODE in ${MODES}; do
+        SINGLEPASSOUTPUTS=${SINGLEPASSOUTPUTS:+${SINGLEPASSOUTPUTS},}${WORKDIR}/singlepass_${MODE}.root
+    done
+    if ! ./doAnalysis ${INPUT} ${TREENAME} ${SINGLEPASSOUTPUTS} ${NEVENTS} ${REGIONS} "" > ${WORKDIR}/singlepass.log 2>&1; then
+        echo "doAnalysis failed for the outputs filled in one pass (see ${WORKDIR}/singlepass.log)"
+        NFAILED=$((NFAILED + 1))
+        return 1
+    fi
+    for MODE in ${MODES}; do
+        run singlepass_${MODE}_reference.root "" || continue
+        compare singlepass_${MODE} "${MODE} output filled together with the others against a job of its own"
+    done
+}
+
+# Compare the outputs of the single job routing the events of the full TTree "t" by bkgtype (demuxjob() of run.sh) to the
+# jobs over each t_${BKGTYPE} TTree. Needs an MC baby with those trees, and every event is processed since the trees do not
+# share their entry numbers.
+checkdemux()
+{
+    BKGTYPES="qflip photon fakes prompt lostlep"
+    DEMUXOUTPUTS=""
+    for BKGTYPE in ${BKGTYPES}; do
+        DEMUXOUTPUTS=${DEMUXOUTPUTS:+${DEMUXOUTPUTS},}${WORKDIR}/demux_t_${BKGTYPE}.root:${BKGTYPE}
+    done
+    if ! ./doAnalysis ${INPUT} t ${DEMUXOUTPUTS} -1 ${REGIONS} > ${WORKDIR}/demux.log 2>&1; then
+        echo "doAnalysis failed for the job routing by bkgtype (see ${WORKDIR}/demux.log)"
+        NFAILED=$((NFAILED + 1))
+        return 1
+    fi
+    for BKGTYPE in ${BKGTYPES}; do
+        if ! ./doAnalysis ${INPUT} t_${BKGTYPE} ${WORKDIR}/demux_t_${BKGTYPE}_reference.root -1 ${REGIONS} > ${WORKDIR}/demux_t_${BKGTYPE}_reference.log 2>&1; then
+            echo "doAnalysis failed over t_${BKGTYPE} (see ${WORKDIR}/demux_t_${BKGTYPE}_reference.log)"
+            NFAILED=$((NFAILED + 1))
+            continue
+        fi
+        compare demux_t_${BKGTYPE} "events of t routed to ${BKGTYPE} against the TTree t_${BKGTYPE}"
+    done
+}
+
+#_____________________________________________________________________________________________
+# The checks
+
+# Histograms of all the systematic variations filled together (multi-weight arrays with the weight ratios, the jet varied cut
+# paths and the TH1 statistics put at the end) against the histograms booked in the RooUtil cutflow. The regions are given
+# explicitly since with regions=all the cutflow skips its systematic histograms, and the systematics are only booked for MC
+# babies. The TH1F of the multi-weight histograms are rounded once from double sums, so they agree up to float rounding.
+check multiweight "multiweight=0" "multiweight=1" "SRSSee,SRSSem,SRSSmm,SR0SFOS,SR1SFOS,SR2SFOS,WZCR1SFOS" 1e-5
+
+# Outputs of the different modes filled in one pass
+checksinglepass
+
+# Job resumed after an interruption from its checkpoint
+checkresume
+
+# Blocks read ahead by the reader thread (the block columns handed over and the compressed baskets prefetched), against the
+# same blocks read in the event loop
+check prefetch "blocksize=1000" "blocksize=1000,prefetch=2"
+
+# Event loop split over worker processes whose output shards are merged (adding up the TH1F of the shards rounds differently
+# from filling one TH1F, so they agree up to float rounding)
+check workers "workers=1" "workers=4" "" 1e-5
+
+# Single branch cut predicates evaluated into bitmasks over blocks of columns, against the same blocks evaluated per event
+# (with checkblockcuts=1 doAnalysis also compares every bit to the evaluation per event and fails if any differs)
+check blockcuts "blockcuts=0,blocksize=1000" "blockcuts=1,checkblockcuts=1,blocksize=1000"
+
+# Same without the per-event check, whose evaluation per event goes through the accessors: with the branch tracing the bitmasks
+# are then read from branches that no accessor touches (they have to stay switched on after the tracing)
+check blockcutstraced "blockcuts=0,blocksize=1000,tracebranches=1000" "blockcuts=1,blocksize=1000,tracebranches=1000"
+
+# Per-lepton vector branches read from their baskets into the fixed capacity inline arrays, against the vectors
+check inlineleptons "inlineleptons=0" "inlineleptons=1"
+
+# Outputs per bkgtype out of one pass over "t" (only on request, with an MC baby)
+if [ ${DEMUX} -ne 0 ]; then checkdemux; fi
+
+#_____________________________________________________________________________________________
+if [ ${NFAILED} -ne 0 ]; then
+    echo "${NFAILED} checks failed"
+    exit 1
+fi
+echo "All checks passed"
@@ -0,0 +1,277 @@
+#include "wwwcolumns.h"
+
+//_______________________________________________________________________________________________________
+WWWColumns::WWWColumns() : select_all(true), tree(0), first_entry(0), last_entry(0)
+{
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::selectAll()
+{
+    select_all = true;
+    selection.clear();
+    if (tree)
+        setTree(tree);
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::select(const std::set<TString>& names)
+{
+    select_all = false;
+    selection = names;
+    if (tree)
+        setTree(tree);
+}
+
+//_______________________________________________________________________________________________________
+bool WWWColumns::isFlatScalar(TBranch* branch, bool& isfloat)
+{
+    // Only plain leaflist branches with a single Float_t or Int_t leaf qualify (vectors and LorentzVectors are TBranchElements)
+    if (not TString(branch->ClassName()).EqualTo("TBranch"))
+        return false;
+    if (branch->GetListOfLeaves()->GetEntries() != 1)
+        return false;
+    TLeaf* leaf = (TLeaf*) branch->GetListOfLeaves()->At(0);
+    if (leaf->GetLeafCount() or leaf->GetLenStatic() != 1)
+        return false;
+    TString type = leaf->GetTypeName();
+    if (not type.EqualTo("Float_t") and not type.EqualTo("Int_t"))
+        return false;
+    isfloat = type.EqualTo("Float_t");
+    return true;
+}
+
+//_______________________________________________________________________________________________________
+// A vector<T> branch streams every entry as a byte count, the class version, the size and the values, at the offset of the
+// entry in its basket. The byte count has to match the size, so anything laid out otherwise is left to the vector accessors.
+template <class T>
+static Int_t readVector(TBranch* branch, Long64_t entry, T* array, Int_t capacity)
+{
+    Long64_t* basket_entries = branch->GetBasketEntry();
+    Int_t ibasket = TMath::BinarySearch((Long64_t) branch->GetWriteBasket() + 1, basket_entries, entry);
+    TBasket* basket = ibasket >= 0 ? branch->GetBasket(ibasket) : 0;
+    if (not basket or not basket->GetEntryOffset())
+        return -1;
+    basket->GetEntryPointer(entry - basket_entries[ibasket]);
+    TBuffer* buffer = basket->GetBufferRef();
+    UInt_t start = 0;
+    UInt_t bytecount = 0;
+    buffer->ReadVersion(&start, &bytecount);
+    Int_t n = 0;
+    buffer->ReadInt(n);
+    if (n < 0 or n > capacity or bytecount != sizeof(Version_t) + sizeof(Int_t) + n * sizeof(T))
+        return -1;
+    buffer->ReadFastArray(array, n);
+    return n;
+}
+
+//_______________________________________________________________________________________________________
+Int_t WWWColumns::readVectorEntry(TBranch* branch, Long64_t entry, float* array, Int_t capacity)
+{
+    return readVector(branch, entry, array, capacity);
+}
+
+//_______________________________________________________________________________________________________
+Int_t WWWColumns::readVectorEntry(TBranch* branch, Long64_t entry, int* array, Int_t capacity)
+{
+    return readVector(branch, entry, array, capacity);
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::release()
+{
+    // The unique ID of a branch is used by wwwtree to find its column, so reset them for the branches let go
+    for (auto& column : columns)
+    {
+        column.branch->SetUniqueID(0);
+        if (column.ownsaddress)
+            column.branch->SetAddress(0);
+    }
+    columns.clear();
+    tree = 0;
+    first_entry = 0;
+    last_entry = 0;
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::setTree(TTree* tree_)
+{
+    release();
+    tree = tree_;
+    TObjArray* branches = tree->GetListOfBranches();
+    for (int ibranch = 0; ibranch < branches->GetEntries(); ++ibranch)
+    {
+        TBranch* branch = (TBranch*) branches->At(ibranch);
+        bool isfloat = false;
+        if (not isFlatScalar(branch, isfloat))
+            continue;
+        if (not select_all and selection.find(branch->GetName()) == selection.end())
+            continue;
+        Column column;
+        column.name = branch->GetName();
+        column.isfloat = isfloat;
+        column.branch = branch;
+        column.ownsaddress = false;
+        column.value = 0;
+        columns.push_back(column);
+        branch->SetUniqueID(columns.size());
+    }
+
+    // The addresses into the columns are only taken once the vector is not going to be reallocated anymore
+    for (auto& column : columns)
+    {
+        if (column.branch->GetAddress())
+            continue;
+        column.ownsaddress = true;
+        column.branch->SetAddress(&column.value);
+    }
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::read(Long64_t first, Long64_t last)
+{
+    first_entry = first;
+    last_entry = last;
+    for (auto& column : columns)
+        readColumn(column, first, last);
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::readColumn(Column& column, Long64_t first, Long64_t last)
+{
+    // The values are unpacked basket by basket straight from the basket buffers into the array. A basket shared by two blocks
+    // stays loaded in the branch (ROOT drops baskets only once the memory limit of the tree is reached), so it is read only once.
+    Long64_t n = last - first;
+    if (column.isfloat)
+        column.f.resize(n);
+    else
+        column.i.resize(n);
+    TBranch* branch = column.branch;
+    Long64_t* basket_entries = branch->GetBasketEntry();
+    Int_t nbaskets = branch->GetWriteBasket() + 1;
+    Long64_t entry = first;
+    while (entry < last)
+    {
+        Int_t ibasket = TMath::BinarySearch((Long64_t) nbaskets, basket_entries, entry);
+        TBasket* basket = ibasket >= 0 ? branch->GetBasket(ibasket) : 0;
+        if (not basket)
+            break;
+        Long64_t basket_last = ibasket + 1 < nbaskets ? basket_entries[ibasket + 1] : branch->GetEntries();
+        Int_t ifirst = entry - basket_entries[ibasket];
+        Int_t nread = std::min(basket_last, last) - entry;
+        if (nread <= 0)
+            break;
+
+        // The values of the entries are contiguous (4 bytes each) unless the basket says otherwise, then read them one by one
+        Int_t* offsets = basket->GetEntryOffset();
+        if (offsets and offsets[ifirst + nread - 1] - offsets[ifirst] != 4 * (nread - 1))
+            break;
+
+        basket->GetEntryPointer(ifirst);
+        TBuffer* buffer = basket->GetBufferRef();
+        if (column.isfloat)
+            buffer->ReadFastArray(column.f.data() + (entry - first), nread);
+        else
+            buffer->ReadFastArray(column.i.data() + (entry - first), nread);
+        entry += nread;
+    }
+    if (entry < last)
+        readEntries(column, entry - first, first, last);
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::readEntries(Column& column, Long64_t offset, Long64_t first, Long64_t last)
+{
+    // Fallback entry by entry through the address of the branch, for the baskets that cannot be unpacked in one go
+    TBranch* branch = column.branch;
+    const char* address = branch->GetAddress();
+    for (Long64_t ientry = offset; ientry < last - first; ++ientry)
+    {
+        branch->GetEntry(first + ientry, 1);
+        if (column.isfloat)
+            column.f[ientry] = *((const float*) address);
+        else
+            column.i[ientry] = *((const int*) address);
+    }
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::exportBlock(Block& block)
+{
+    // The arrays of the block (e.g. of a block that was imported before) are swapped in so their memory is reused
+    block.first = first_entry;
+    block.last = last_entry;
+    block.columns.resize(columns.size());
+    for (unsigned int icol = 0; icol < columns.size(); ++icol)
+    {
+        Column& column = block.columns[icol];
+        column.name = columns[icol].name;
+        column.isfloat = columns[icol].isfloat;
+        column.branch = 0;
+        column.ownsaddress = false;
+        column.f.swap(columns[icol].f);
+        column.i.swap(columns[icol].i);
+    }
+    first_entry = 0;
+    last_entry = 0;
+}
+
+//_______________________________________________________________________________________________________
+void WWWColumns::importBlock(Block& block)
+{
+    // The block was read from another instance of the same tree, so its columns normally come in the same order
+    first_entry = block.first;
+    last_entry = block.last;
+    for (unsigned int icol = 0; icol < columns.size(); ++icol)
+    {
+        Column& column = columns[icol];
+        Column* blockcolumn = 0;
+        if (icol < block.columns.size() and block.columns[icol].name == column.name)
+            blockcolumn = &block.columns[icol];
+        for (unsigned int jcol = 0; jcol < block.columns.size() and not blockcolumn; ++jcol)
+            if (block.columns[jcol].name == column.name)
+                blockcolumn = &block.columns[jcol];
+        if (blockcolumn and blockcolumn->isfloat == column.isfloat)
+        {
+            column.f.swap(blockcolumn->f);
+            column.i.swap(blockcolumn->i);
+        }
+        else
+        {
+            readColumn(column, first_entry, last_entry);
+        }
+    }
+}
+
+//_______________________________________________________________________________________________________
+int WWWColumns::getColumnIndex(TString name) const
+{
+    for (unsigned int icol = 0; icol < columns.size(); ++icol)
+        if (columns[icol].name == name)
+            return icol;
+    return -1;
+}
+
+//_______________________________________________________________________________________________________
+const float* WWWColumns::getFloat(TString name) const
+{
+    int icol = getColumnIndex(name);
+    if (icol < 0 or not columns[icol].isfloat)
+    {
+        printf("[WWWColumns::getFloat] No float column %s\n", name.Data());
+        exit(1);
+    }
+    return getFloat(icol);
+}
+
+//_______________________________________________________________________________________________________
+const int* WWWColumns::getInt(TString name) const
+{
+    int icol = getColumnIndex(name);
+    if (icol < 0 or columns[icol].isfloat)
+    {
+        printf("[WWWColumns::getInt] No int column %s\n", name.Data());
+        exit(1);
+    }
+    return getInt(icol);
+}
@@ -0,0 +1,105 @@
+#ifndef wwwcolumns_h
+#define wwwcolumns_h
+
+#include "TTree.h"
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "TBasket.h"
+#include "TBuffer.h"
+#include "TMath.h"
+#include "TString.h"
+#include <vector>
+#include <set>
+#include <algorithm>
+
+//_______________________________________________________________________________________________________
+// Contiguous arrays of selected flat float/int branches of wwwtree for a range of entries
+// The arrays are filled one branch at a time over the whole range, copying the values of each basket straight out of its
+// buffer instead of going through TBranch::GetEntry for every event. Once attached to wwwtree (wwwtree::AttachColumns) the
+// scalar accessors of the selected branches are served from the arrays, every other branch is still read per event on access.
+class WWWColumns
+{
+    public:
+        struct Column
+        {
+            TString name;
+            bool isfloat;
+            TBranch* branch;
+            bool ownsaddress;  // the branch streams into value (tree without wwwtree::Init, e.g. the one of a prefetch thread)
+            Long64_t value;
+            std::vector<float> f;
+            std::vector<int> i;
+        };
+
+        // Arrays of a range of entries detached from the tree they were read from (to be handed over between threads)
+        struct Block
+        {
+            Long64_t entry;    // global entry of the chain corresponding to first
+            Long64_t first;
+            Long64_t last;
+            std::vector<Column> columns;
+        };
+
+        WWWColumns();
+
+        // Select the branches to be read (by default all flat float/int branches)
+        void selectAll();
+        void select(const std::set<TString>& names);
+
+        // Find the selected flat float/int branches in the tree (to be called for every new tree)
+        void setTree(TTree* tree);
+
+        // Forget the branches of the current tree (to be called before the tree is deleted)
+        void release();
+
+        // Read entries [first, last) of every selected column
+        void read(Long64_t first, Long64_t last);
+
+        // Swap the arrays with the ones of a block (export leaves the columns empty, import reads the columns missing in the block)
+        void exportBlock(Block& block);
+        void importBlock(Block& block);
+
+        // Access to the arrays (index 0 corresponds to entry first())
+        int getColumnIndex(TString name) const;
+        const float* getFloat(int icol) const { return columns[icol].f.data(); }
+        const int* getInt(int icol) const { return columns[icol].i.data(); }
+        const float* getFloat(TString name) const;
+        const int* getInt(TString name) const;
+        const std::vector<Column>& getColumns() const { return columns; }
+        Long64_t first() const { return first_entry; }
+        Long64_t last() const { return last_entry; }
+        Long64_t size() const { return last_entry - first_entry; }
+
+        // Copy the value of column icol at a given entry into address (false if the entry is not in the block)
+        inline bool copy(int icol, Long64_t entry, char* address) const
+        {
+            if (entry < first_entry or entry >= last_entry)
+                return false;
+            const Column& column = columns[icol];
+            if (column.isfloat)
+                *((float*) address) = column.f[entry - first_entry];
+            else
+                *((int*) address) = column.i[entry - first_entry];
+            return true;
+        }
+
+        static bool isFlatScalar(TBranch* branch, bool& isfloat);
+
+        // Read an entry of a vector<float>/vector<int> branch straight from its basket into array (at most capacity values)
+        // Returns the size of the vector, or -1 if it is larger than capacity or the entry is not laid out as a streamed vector
+        static Int_t readVectorEntry(TBranch* branch, Long64_t entry, float* array, Int_t capacity);
+        static Int_t readVectorEntry(TBranch* branch, Long64_t entry, int* array, Int_t capacity);
+
+    private:
+        static void readColumn(Column& column, Long64_t first, Long64_t last);
+        static void readEntries(Column& column, Long64_t offset, Long64_t first, Long64_t last);
+
+        std::vector<Column> columns;
+        bool select_all;
+        std::set<TString> selection;
+        TTree* tree;
+        Long64_t first_entry;
+        Long64_t last_entry;
+};
+
+#endif
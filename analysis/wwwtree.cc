@@ -1,7 +1,9 @@
 #include "wwwtree.h"
+#include "wwwcolumns.h"
 wwwtree www;
 
 void wwwtree::Init(TTree *tree) {
+  tree_ = tree;
   lep_p4_branch = tree->GetBranch("lep_p4");
   if (lep_p4_branch) lep_p4_branch->SetAddress(&lep_p4_);
   jets_p4_branch = tree->GetBranch("jets_p4");
@@ -1025,520 +1027,576 @@ void wwwtree::Init(TTree *tree) {
   if (MT_higgs_branch) MT_higgs_branch->SetAddress(&MT_higgs_);
 
   tree->SetMakeClass(0);
+  ResetLoadEpochs();
+  if (branch_selection_active_) ApplyBranchSelection();
 }
 
 void wwwtree::GetEntry(unsigned int idx) {
-  // this only marks branches as not loaded, saving a lot of time
+  // this only bumps the load epoch, every branch loaded for a previous epoch is reloaded on access
   index = idx;
-  run_isLoaded = false;
-  lumi_isLoaded = false;
-  evt_isLoaded = false;
-  isData_isLoaded = false;
-  evt_scale1fb_isLoaded = false;
-  xsec_br_isLoaded = false;
-  evt_passgoodrunlist_isLoaded = false;
-  CMS4path_isLoaded = false;
-  CMS4index_isLoaded = false;
-  weight_fr_r1_f1_isLoaded = false;
-  weight_fr_r1_f2_isLoaded = false;
-  weight_fr_r1_f0p5_isLoaded = false;
-  weight_fr_r2_f1_isLoaded = false;
-  weight_fr_r2_f2_isLoaded = false;
-  weight_fr_r2_f0p5_isLoaded = false;
-  weight_fr_r0p5_f1_isLoaded = false;
-  weight_fr_r0p5_f2_isLoaded = false;
-  weight_fr_r0p5_f0p5_isLoaded = false;
-  weight_pdf_up_isLoaded = false;
-  weight_pdf_down_isLoaded = false;
-  weight_alphas_down_isLoaded = false;
-  weight_alphas_up_isLoaded = false;
-  weight_isr_isLoaded = false;
-  weight_isr_up_isLoaded = false;
-  weight_isr_down_isLoaded = false;
-  HLT_DoubleMu_isLoaded = false;
-  HLT_DoubleEl_isLoaded = false;
-  HLT_DoubleEl_DZ_isLoaded = false;
-  HLT_DoubleEl_DZ_2_isLoaded = false;
-  HLT_MuEG_isLoaded = false;
-  HLT_SingleEl8_isLoaded = false;
-  HLT_SingleEl17_isLoaded = false;
-  HLT_SingleIsoEl8_isLoaded = false;
-  HLT_SingleIsoEl17_isLoaded = false;
-  HLT_SingleIsoEl23_isLoaded = false;
-  HLT_SingleIsoMu8_isLoaded = false;
-  HLT_SingleIsoMu17_isLoaded = false;
-  HLT_PFMET140_PFMHT140_IDTight_isLoaded = false;
-  mc_HLT_DoubleMu_isLoaded = false;
-  mc_HLT_DoubleEl_isLoaded = false;
-  mc_HLT_DoubleEl_DZ_isLoaded = false;
-  mc_HLT_DoubleEl_DZ_2_isLoaded = false;
-  mc_HLT_MuEG_isLoaded = false;
-  mc_HLT_SingleEl8_isLoaded = false;
-  mc_HLT_SingleEl17_isLoaded = false;
-  mc_HLT_SingleIsoEl8_isLoaded = false;
-  mc_HLT_SingleIsoEl17_isLoaded = false;
-  mc_HLT_SingleIsoEl23_isLoaded = false;
-  mc_HLT_SingleIsoMu8_isLoaded = false;
-  mc_HLT_SingleIsoMu17_isLoaded = false;
-  mc_HLT_PFMET140_PFMHT140_IDTight_isLoaded = false;
-  pass_duplicate_ee_em_mm_isLoaded = false;
-  pass_duplicate_mm_em_ee_isLoaded = false;
-  is2016_isLoaded = false;
-  is2017_isLoaded = false;
-  HLT_MuEG_2016_isLoaded = false;
-  mc_HLT_MuEG_2016_isLoaded = false;
-  pass_duplicate_ee_em2016_mm_isLoaded = false;
-  pass_duplicate_mm_em2016_ee_isLoaded = false;
-  passTrigger_isLoaded = false;
-  lep_p4_isLoaded = false;
-  lep_pt_isLoaded = false;
-  lep_eta_isLoaded = false;
-  lep_phi_isLoaded = false;
-  lep_coneCorrPt_isLoaded = false;
-  lep_ip3d_isLoaded = false;
-  lep_ip3derr_isLoaded = false;
-  lep_isTriggerSafe_v1_isLoaded = false;
-  lep_lostHits_isLoaded = false;
-  lep_convVeto_isLoaded = false;
-  lep_motherIdSS_isLoaded = false;
-  lep_pass_VVV_cutbased_3l_fo_isLoaded = false;
-  lep_pass_VVV_cutbased_3l_tight_isLoaded = false;
-  lep_pass_VVV_cutbased_fo_isLoaded = false;
-  lep_pass_VVV_cutbased_tight_isLoaded = false;
-  lep_pass_VVV_cutbased_veto_isLoaded = false;
-  lep_pass_VVV_cutbased_fo_noiso_isLoaded = false;
-  lep_pass_VVV_cutbased_tight_noiso_isLoaded = false;
-  lep_pass_VVV_cutbased_veto_noiso_isLoaded = false;
-  lep_pass_POG_veto_isLoaded = false;
-  lep_pass_POG_loose_isLoaded = false;
-  lep_pass_POG_medium_isLoaded = false;
-  lep_pass_POG_tight_isLoaded = false;
-  lep_pdgId_isLoaded = false;
-  lep_dxy_isLoaded = false;
-  lep_dz_isLoaded = false;
-  lep_pterr_isLoaded = false;
-  lep_relIso04DB_isLoaded = false;
-  lep_relIso03EA_isLoaded = false;
-  lep_relIso03EALep_isLoaded = false;
-  lep_relIso03EAv2_isLoaded = false;
-  lep_relIso04EAv2_isLoaded = false;
-  lep_relIso03EAv2Lep_isLoaded = false;
-  lep_tightCharge_isLoaded = false;
-  lep_trk_pt_isLoaded = false;
-  lep_charge_isLoaded = false;
-  lep_etaSC_isLoaded = false;
-  lep_MVA_isLoaded = false;
-  lep_isMediumPOG_isLoaded = false;
-  lep_isTightPOG_isLoaded = false;
-  lep_isFromW_isLoaded = false;
-  lep_isFromZ_isLoaded = false;
-  lep_isFromB_isLoaded = false;
-  lep_isFromC_isLoaded = false;
-  lep_isFromL_isLoaded = false;
-  lep_isFromLF_isLoaded = false;
-  lep_genPart_index_isLoaded = false;
-  lep_r9_isLoaded = false;
-  lep_nlayers_isLoaded = false;
-  el_pt_isLoaded = false;
-  el_eta_isLoaded = false;
-  el_phi_isLoaded = false;
-  el_relIso03EA_isLoaded = false;
-  el_relIso03EALep_isLoaded = false;
-  el_ip3d_isLoaded = false;
-  mu_pt_isLoaded = false;
-  mu_eta_isLoaded = false;
-  mu_phi_isLoaded = false;
-  mu_relIso04DB_isLoaded = false;
-  mu_relIso03EA_isLoaded = false;
-  mu_relIso03EALep_isLoaded = false;
-  mu_ip3d_isLoaded = false;
-  lbnt_pt_isLoaded = false;
-  lbnt_coneCorrPt_isLoaded = false;
-  lbnt_abseta_isLoaded = false;
-  lbnt_pdgId_isLoaded = false;
-  lbnt_el_pt_isLoaded = false;
-  lbnt_el_coneCorrPt_isLoaded = false;
-  lbnt_el_abseta_isLoaded = false;
-  lbnt_mu_pt_isLoaded = false;
-  lbnt_mu_coneCorrPt_isLoaded = false;
-  lbnt_mu_abseta_isLoaded = false;
-  jets_p4_isLoaded = false;
-  jets_up_p4_isLoaded = false;
-  jets_dn_p4_isLoaded = false;
-  jets_csv_isLoaded = false;
-  jets_up_csv_isLoaded = false;
-  jets_dn_csv_isLoaded = false;
-  jets_jer_csv_isLoaded = false;
-  jets_jerup_csv_isLoaded = false;
-  jets_jerdn_csv_isLoaded = false;
-  jets_jer_p4_isLoaded = false;
-  jets_jerup_p4_isLoaded = false;
-  jets_jerdn_p4_isLoaded = false;
-  jets30_p4_isLoaded = false;
-  jets30_up_p4_isLoaded = false;
-  jets30_dn_p4_isLoaded = false;
-  jets30_jer_p4_isLoaded = false;
-  jets30_jerup_p4_isLoaded = false;
-  jets30_jerdn_p4_isLoaded = false;
-  ak8jets_p4_isLoaded = false;
-  ak8jets_softdropMass_isLoaded = false;
-  ak8jets_prunedMass_isLoaded = false;
-  ak8jets_trimmedMass_isLoaded = false;
-  ak8jets_mass_isLoaded = false;
-  ak8jets_nJettinessTau1_isLoaded = false;
-  ak8jets_nJettinessTau2_isLoaded = false;
-  ak8jets_softdropPuppiSubjet1_isLoaded = false;
-  ak8jets_softdropPuppiSubjet2_isLoaded = false;
-  ak8jets_puppi_softdropMass_isLoaded = false;
-  ak8jets_puppi_nJettinessTau1_isLoaded = false;
-  ak8jets_puppi_nJettinessTau2_isLoaded = false;
-  ak8jets_puppi_eta_isLoaded = false;
-  ak8jets_puppi_phi_isLoaded = false;
-  ak8jets_puppi_pt_isLoaded = false;
-  ak8jets_puppi_mass_isLoaded = false;
-  met_pt_isLoaded = false;
-  met_phi_isLoaded = false;
-  met_up_pt_isLoaded = false;
-  met_up_phi_isLoaded = false;
-  met_dn_pt_isLoaded = false;
-  met_dn_phi_isLoaded = false;
-  met_gen_pt_isLoaded = false;
-  met_gen_phi_isLoaded = false;
-  met_jer_pt_isLoaded = false;
-  met_jerup_pt_isLoaded = false;
-  met_jerdn_pt_isLoaded = false;
-  met_jer_phi_isLoaded = false;
-  met_jerup_phi_isLoaded = false;
-  met_jerdn_phi_isLoaded = false;
-  firstgoodvertex_isLoaded = false;
-  nTrueInt_isLoaded = false;
-  nVert_isLoaded = false;
-  nisoTrack_mt2_cleaned_VVV_cutbased_veto_isLoaded = false;
-  weight_btagsf_isLoaded = false;
-  weight_btagsf_heavy_DN_isLoaded = false;
-  weight_btagsf_heavy_UP_isLoaded = false;
-  weight_btagsf_light_DN_isLoaded = false;
-  weight_btagsf_light_UP_isLoaded = false;
-  gen_ht_isLoaded = false;
-  genPart_p4_isLoaded = false;
-  genPart_motherId_isLoaded = false;
-  genPart_pdgId_isLoaded = false;
-  genPart_charge_isLoaded = false;
-  genPart_status_isLoaded = false;
-  ngenLep_isLoaded = false;
-  ngenLepFromTau_isLoaded = false;
-  Flag_AllEventFilters_isLoaded = false;
-  Flag_EcalDeadCellTriggerPrimitiveFilter_isLoaded = false;
-  Flag_HBHEIsoNoiseFilter_isLoaded = false;
-  Flag_HBHENoiseFilter_isLoaded = false;
-  Flag_badChargedCandidateFilter_isLoaded = false;
-  Flag_badMuonFilter_isLoaded = false;
-  Flag_badMuonFilterv2_isLoaded = false;
-  Flag_badChargedCandidateFilterv2_isLoaded = false;
-  Flag_eeBadScFilter_isLoaded = false;
-  Flag_ecalBadCalibFilter_isLoaded = false;
-  Flag_globalTightHalo2016_isLoaded = false;
-  Flag_goodVertices_isLoaded = false;
-  Flag_ecalLaserCorrFilter_isLoaded = false;
-  Flag_hcalLaserEventFilter_isLoaded = false;
-  Flag_trackingFailureFilter_isLoaded = false;
-  Flag_CSCTightHaloFilter_isLoaded = false;
-  Flag_CSCTightHalo2015Filter_isLoaded = false;
-  Flag_badMuons_isLoaded = false;
-  Flag_duplicateMuons_isLoaded = false;
-  Flag_noBadMuons_isLoaded = false;
-  fastsimfilt_isLoaded = false;
-  nVlep_isLoaded = false;
-  nTlep_isLoaded = false;
-  nTlepSS_isLoaded = false;
-  nLlep_isLoaded = false;
-  nLlep3L_isLoaded = false;
-  nTlep3L_isLoaded = false;
-  nSFOS_isLoaded = false;
-  nSFOSinZ_isLoaded = false;
-  nj_isLoaded = false;
-  nj_up_isLoaded = false;
-  nj_dn_isLoaded = false;
-  nj_jer_isLoaded = false;
-  nj_jerup_isLoaded = false;
-  nj_jerdn_isLoaded = false;
-  nj30_isLoaded = false;
-  nj30_up_isLoaded = false;
-  nj30_dn_isLoaded = false;
-  nj30_jer_isLoaded = false;
-  nj30_jerup_isLoaded = false;
-  nj30_jerdn_isLoaded = false;
-  nb_isLoaded = false;
-  nb_up_isLoaded = false;
-  nb_dn_isLoaded = false;
-  nb_jer_isLoaded = false;
-  nb_jerup_isLoaded = false;
-  nb_jerdn_isLoaded = false;
-  Ml0j0_isLoaded = false;
-  Ml0j0_up_isLoaded = false;
-  Ml0j0_dn_isLoaded = false;
-  Ml0j0_jer_isLoaded = false;
-  Ml0j0_jerup_isLoaded = false;
-  Ml0j0_jerdn_isLoaded = false;
-  Ml0j1_isLoaded = false;
-  Ml0j1_up_isLoaded = false;
-  Ml0j1_dn_isLoaded = false;
-  Ml0j1_jer_isLoaded = false;
-  Ml0j1_jerup_isLoaded = false;
-  Ml0j1_jerdn_isLoaded = false;
-  Ml1j0_isLoaded = false;
-  Ml1j0_up_isLoaded = false;
-  Ml1j0_dn_isLoaded = false;
-  Ml1j0_jer_isLoaded = false;
-  Ml1j0_jerup_isLoaded = false;
-  Ml1j0_jerdn_isLoaded = false;
-  Ml1j1_isLoaded = false;
-  Ml1j1_up_isLoaded = false;
-  Ml1j1_dn_isLoaded = false;
-  Ml1j1_jer_isLoaded = false;
-  Ml1j1_jerup_isLoaded = false;
-  Ml1j1_jerdn_isLoaded = false;
-  MinMlj_isLoaded = false;
-  MinMlj_up_isLoaded = false;
-  MinMlj_dn_isLoaded = false;
-  MinMlj_jer_isLoaded = false;
-  MinMlj_jerup_isLoaded = false;
-  MinMlj_jerdn_isLoaded = false;
-  SumMinMlj01_isLoaded = false;
-  SumMinMlj01_up_isLoaded = false;
-  SumMinMlj01_dn_isLoaded = false;
-  SumMinMlj01_jer_isLoaded = false;
-  SumMinMlj01_jerup_isLoaded = false;
-  SumMinMlj01_jerdn_isLoaded = false;
-  MaxMlj_isLoaded = false;
-  MaxMlj_up_isLoaded = false;
-  MaxMlj_dn_isLoaded = false;
-  MaxMlj_jer_isLoaded = false;
-  MaxMlj_jerup_isLoaded = false;
-  MaxMlj_jerdn_isLoaded = false;
-  SumMlj_isLoaded = false;
-  SumMlj_up_isLoaded = false;
-  SumMlj_dn_isLoaded = false;
-  SumMlj_jer_isLoaded = false;
-  SumMlj_jerup_isLoaded = false;
-  SumMlj_jerdn_isLoaded = false;
-  Ml0jj_isLoaded = false;
-  Ml0jj_up_isLoaded = false;
-  Ml0jj_dn_isLoaded = false;
-  Ml0jj_jer_isLoaded = false;
-  Ml0jj_jerup_isLoaded = false;
-  Ml0jj_jerdn_isLoaded = false;
-  Ml1jj_isLoaded = false;
-  Ml1jj_up_isLoaded = false;
-  Ml1jj_dn_isLoaded = false;
-  Ml1jj_jer_isLoaded = false;
-  Ml1jj_jerup_isLoaded = false;
-  Ml1jj_jerdn_isLoaded = false;
-  MinMljj_isLoaded = false;
-  MinMljj_up_isLoaded = false;
-  MinMljj_dn_isLoaded = false;
-  MinMljj_jer_isLoaded = false;
-  MinMljj_jerup_isLoaded = false;
-  MinMljj_jerdn_isLoaded = false;
-  MaxMljj_isLoaded = false;
-  MaxMljj_up_isLoaded = false;
-  MaxMljj_dn_isLoaded = false;
-  MaxMljj_jer_isLoaded = false;
-  MaxMljj_jerup_isLoaded = false;
-  MaxMljj_jerdn_isLoaded = false;
-  SumMljj_isLoaded = false;
-  SumMljj_up_isLoaded = false;
-  SumMljj_dn_isLoaded = false;
-  SumMljj_jer_isLoaded = false;
-  SumMljj_jerup_isLoaded = false;
-  SumMljj_jerdn_isLoaded = false;
-  Mjj_isLoaded = false;
-  Mjj_up_isLoaded = false;
-  Mjj_dn_isLoaded = false;
-  Mjj_jer_isLoaded = false;
-  Mjj_jerup_isLoaded = false;
-  Mjj_jerdn_isLoaded = false;
-  DRjj_isLoaded = false;
-  DRjj_up_isLoaded = false;
-  DRjj_dn_isLoaded = false;
-  DRjj_jer_isLoaded = false;
-  DRjj_jerup_isLoaded = false;
-  DRjj_jerdn_isLoaded = false;
-  jet0_wtag_p4_isLoaded = false;
-  jet0_wtag_p4_up_isLoaded = false;
-  jet0_wtag_p4_dn_isLoaded = false;
-  jet0_wtag_p4_jer_isLoaded = false;
-  jet0_wtag_p4_jerup_isLoaded = false;
-  jet0_wtag_p4_jerdn_isLoaded = false;
-  jet1_wtag_p4_isLoaded = false;
-  jet1_wtag_p4_up_isLoaded = false;
-  jet1_wtag_p4_dn_isLoaded = false;
-  jet1_wtag_p4_jer_isLoaded = false;
-  jet1_wtag_p4_jerup_isLoaded = false;
-  jet1_wtag_p4_jerdn_isLoaded = false;
-  MjjDR1_isLoaded = false;
-  MjjDR1_up_isLoaded = false;
-  MjjDR1_dn_isLoaded = false;
-  MjjDR1_jer_isLoaded = false;
-  MjjDR1_jerup_isLoaded = false;
-  MjjDR1_jerdn_isLoaded = false;
-  DRjjDR1_isLoaded = false;
-  DRjjDR1_up_isLoaded = false;
-  DRjjDR1_dn_isLoaded = false;
-  DRjjDR1_jer_isLoaded = false;
-  DRjjDR1_jerup_isLoaded = false;
-  DRjjDR1_jerdn_isLoaded = false;
-  jet0_wtag_p4_DR1_isLoaded = false;
-  jet0_wtag_p4_DR1_up_isLoaded = false;
-  jet0_wtag_p4_DR1_dn_isLoaded = false;
-  jet0_wtag_p4_DR1_jer_isLoaded = false;
-  jet0_wtag_p4_DR1_jerup_isLoaded = false;
-  jet0_wtag_p4_DR1_jerdn_isLoaded = false;
-  jet1_wtag_p4_DR1_isLoaded = false;
-  jet1_wtag_p4_DR1_up_isLoaded = false;
-  jet1_wtag_p4_DR1_dn_isLoaded = false;
-  jet1_wtag_p4_DR1_jer_isLoaded = false;
-  jet1_wtag_p4_DR1_jerup_isLoaded = false;
-  jet1_wtag_p4_DR1_jerdn_isLoaded = false;
-  MjjVBF_isLoaded = false;
-  MjjVBF_up_isLoaded = false;
-  MjjVBF_dn_isLoaded = false;
-  MjjVBF_jer_isLoaded = false;
-  MjjVBF_jerup_isLoaded = false;
-  MjjVBF_jerdn_isLoaded = false;
-  DetajjVBF_isLoaded = false;
-  DetajjVBF_up_isLoaded = false;
-  DetajjVBF_dn_isLoaded = false;
-  DetajjVBF_jer_isLoaded = false;
-  DetajjVBF_jerup_isLoaded = false;
-  DetajjVBF_jerdn_isLoaded = false;
-  MjjL_isLoaded = false;
-  MjjL_up_isLoaded = false;
-  MjjL_dn_isLoaded = false;
-  MjjL_jer_isLoaded = false;
-  MjjL_jerup_isLoaded = false;
-  MjjL_jerdn_isLoaded = false;
-  DetajjL_isLoaded = false;
-  DetajjL_up_isLoaded = false;
-  DetajjL_dn_isLoaded = false;
-  DetajjL_jer_isLoaded = false;
-  DetajjL_jerup_isLoaded = false;
-  DetajjL_jerdn_isLoaded = false;
-  MllSS_isLoaded = false;
-  MeeSS_isLoaded = false;
-  Mll3L_isLoaded = false;
-  Mee3L_isLoaded = false;
-  Mll3L1_isLoaded = false;
-  M3l_isLoaded = false;
-  Pt3l_isLoaded = false;
-  M01_isLoaded = false;
-  M02_isLoaded = false;
-  M12_isLoaded = false;
-  isSFOS01_isLoaded = false;
-  isSFOS02_isLoaded = false;
-  isSFOS12_isLoaded = false;
-  DPhi3lMET_isLoaded = false;
-  DPhi3lMET_up_isLoaded = false;
-  DPhi3lMET_dn_isLoaded = false;
-  DPhi3lMET_jer_isLoaded = false;
-  DPhi3lMET_jerup_isLoaded = false;
-  DPhi3lMET_jerdn_isLoaded = false;
-  DPhi3lMET_gen_isLoaded = false;
-  MTmax_isLoaded = false;
-  MTmax_up_isLoaded = false;
-  MTmax_dn_isLoaded = false;
-  MTmax_jer_isLoaded = false;
-  MTmax_jerup_isLoaded = false;
-  MTmax_jerdn_isLoaded = false;
-  MTmax_gen_isLoaded = false;
-  MTmin_isLoaded = false;
-  MTmin_up_isLoaded = false;
-  MTmin_dn_isLoaded = false;
-  MTmin_jer_isLoaded = false;
-  MTmin_jerup_isLoaded = false;
-  MTmin_jerdn_isLoaded = false;
-  MTmin_gen_isLoaded = false;
-  MT3rd_isLoaded = false;
-  MT3rd_up_isLoaded = false;
-  MT3rd_dn_isLoaded = false;
-  MT3rd_jer_isLoaded = false;
-  MT3rd_jerup_isLoaded = false;
-  MT3rd_jerdn_isLoaded = false;
-  MT3rd_gen_isLoaded = false;
-  MTmax3L_isLoaded = false;
-  MTmax3L_up_isLoaded = false;
-  MTmax3L_dn_isLoaded = false;
-  MTmax3L_jer_isLoaded = false;
-  MTmax3L_jerup_isLoaded = false;
-  MTmax3L_jerdn_isLoaded = false;
-  MTmax3L_gen_isLoaded = false;
-  passSSee_isLoaded = false;
-  passSSem_isLoaded = false;
-  passSSmm_isLoaded = false;
-  lep_idx0_SS_isLoaded = false;
-  lep_idx1_SS_isLoaded = false;
-  bkgtype_isLoaded = false;
-  vetophoton_isLoaded = false;
-  purewgt_isLoaded = false;
-  purewgt_up_isLoaded = false;
-  purewgt_dn_isLoaded = false;
-  ffwgt_isLoaded = false;
-  ffwgt_up_isLoaded = false;
-  ffwgt_dn_isLoaded = false;
-  ffwgt_el_up_isLoaded = false;
-  ffwgt_el_dn_isLoaded = false;
-  ffwgt_mu_up_isLoaded = false;
-  ffwgt_mu_dn_isLoaded = false;
-  ffwgt_closure_up_isLoaded = false;
-  ffwgt_closure_dn_isLoaded = false;
-  ffwgt_closure_el_up_isLoaded = false;
-  ffwgt_closure_el_dn_isLoaded = false;
-  ffwgt_closure_mu_up_isLoaded = false;
-  ffwgt_closure_mu_dn_isLoaded = false;
-  ffwgt_full_up_isLoaded = false;
-  ffwgt_full_dn_isLoaded = false;
-  ffwgtqcd_isLoaded = false;
-  ffwgtqcd_up_isLoaded = false;
-  ffwgtqcd_dn_isLoaded = false;
-  lepsf_isLoaded = false;
-  lepsf_up_isLoaded = false;
-  lepsf_dn_isLoaded = false;
-  trigeff_isLoaded = false;
-  trigeff_up_isLoaded = false;
-  trigeff_dn_isLoaded = false;
-  trigsf_isLoaded = false;
-  trigsf_up_isLoaded = false;
-  trigsf_dn_isLoaded = false;
-  musmear_sf_isLoaded = false;
-  iswhwww_isLoaded = false;
-  www_channel_isLoaded = false;
-  has_tau_isLoaded = false;
-  w_p4_isLoaded = false;
-  w_islep_isLoaded = false;
-  w_isstar_isLoaded = false;
-  w_isH_isLoaded = false;
-  l_p4_isLoaded = false;
-  l_w_pt_isLoaded = false;
-  l_w_eta_isLoaded = false;
-  l_w_phi_isLoaded = false;
-  l_w_mass_isLoaded = false;
-  l_w_id_isLoaded = false;
-  l_isstar_isLoaded = false;
-  l_isH_isLoaded = false;
-  l_istau_isLoaded = false;
-  q_p4_isLoaded = false;
-  q_w_pt_isLoaded = false;
-  q_w_eta_isLoaded = false;
-  q_w_phi_isLoaded = false;
-  q_w_mass_isLoaded = false;
-  q_w_id_isLoaded = false;
-  q_isstar_isLoaded = false;
-  q_isH_isLoaded = false;
-  dRllSS_isLoaded = false;
-  dRqqSS_isLoaded = false;
-  DPhill_higgs_isLoaded = false;
-  Mll_higgs_isLoaded = false;
-  MT_higgs_isLoaded = false;
+  if (++epoch == 0) ResetLoadEpochs();
+}
+
+void wwwtree::ResetLoadEpochs() {
+  // mark every branch as not loaded (at initialization and when the epoch counter wraps around)
+  epoch = 1;
+  lep_pt_inlineEpoch = 0;
+  lep_eta_inlineEpoch = 0;
+  lep_phi_inlineEpoch = 0;
+  lep_coneCorrPt_inlineEpoch = 0;
+  lep_ip3d_inlineEpoch = 0;
+  lep_ip3derr_inlineEpoch = 0;
+  lep_isTriggerSafe_v1_inlineEpoch = 0;
+  lep_lostHits_inlineEpoch = 0;
+  lep_convVeto_inlineEpoch = 0;
+  lep_motherIdSS_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_3l_fo_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_3l_tight_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_fo_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_tight_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_veto_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_fo_noiso_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_tight_noiso_inlineEpoch = 0;
+  lep_pass_VVV_cutbased_veto_noiso_inlineEpoch = 0;
+  lep_pass_POG_veto_inlineEpoch = 0;
+  lep_pass_POG_loose_inlineEpoch = 0;
+  lep_pass_POG_medium_inlineEpoch = 0;
+  lep_pass_POG_tight_inlineEpoch = 0;
+  lep_pdgId_inlineEpoch = 0;
+  lep_dxy_inlineEpoch = 0;
+  lep_dz_inlineEpoch = 0;
+  lep_pterr_inlineEpoch = 0;
+  lep_relIso04DB_inlineEpoch = 0;
+  lep_relIso03EA_inlineEpoch = 0;
+  lep_relIso03EALep_inlineEpoch = 0;
+  lep_relIso03EAv2_inlineEpoch = 0;
+  lep_relIso04EAv2_inlineEpoch = 0;
+  lep_relIso03EAv2Lep_inlineEpoch = 0;
+  lep_tightCharge_inlineEpoch = 0;
+  lep_trk_pt_inlineEpoch = 0;
+  lep_charge_inlineEpoch = 0;
+  lep_etaSC_inlineEpoch = 0;
+  lep_MVA_inlineEpoch = 0;
+  lep_isMediumPOG_inlineEpoch = 0;
+  lep_isTightPOG_inlineEpoch = 0;
+  lep_isFromW_inlineEpoch = 0;
+  lep_isFromZ_inlineEpoch = 0;
+  lep_isFromB_inlineEpoch = 0;
+  lep_isFromC_inlineEpoch = 0;
+  lep_isFromL_inlineEpoch = 0;
+  lep_isFromLF_inlineEpoch = 0;
+  lep_genPart_index_inlineEpoch = 0;
+  lep_r9_inlineEpoch = 0;
+  lep_nlayers_inlineEpoch = 0;
+  run_loadedEpoch = 0;
+  lumi_loadedEpoch = 0;
+  evt_loadedEpoch = 0;
+  isData_loadedEpoch = 0;
+  evt_scale1fb_loadedEpoch = 0;
+  xsec_br_loadedEpoch = 0;
+  evt_passgoodrunlist_loadedEpoch = 0;
+  CMS4path_loadedEpoch = 0;
+  CMS4index_loadedEpoch = 0;
+  weight_fr_r1_f1_loadedEpoch = 0;
+  weight_fr_r1_f2_loadedEpoch = 0;
+  weight_fr_r1_f0p5_loadedEpoch = 0;
+  weight_fr_r2_f1_loadedEpoch = 0;
+  weight_fr_r2_f2_loadedEpoch = 0;
+  weight_fr_r2_f0p5_loadedEpoch = 0;
+  weight_fr_r0p5_f1_loadedEpoch = 0;
+  weight_fr_r0p5_f2_loadedEpoch = 0;
+  weight_fr_r0p5_f0p5_loadedEpoch = 0;
+  weight_pdf_up_loadedEpoch = 0;
+  weight_pdf_down_loadedEpoch = 0;
+  weight_alphas_down_loadedEpoch = 0;
+  weight_alphas_up_loadedEpoch = 0;
+  weight_isr_loadedEpoch = 0;
+  weight_isr_up_loadedEpoch = 0;
+  weight_isr_down_loadedEpoch = 0;
+  HLT_DoubleMu_loadedEpoch = 0;
+  HLT_DoubleEl_loadedEpoch = 0;
+  HLT_DoubleEl_DZ_loadedEpoch = 0;
+  HLT_DoubleEl_DZ_2_loadedEpoch = 0;
+  HLT_MuEG_loadedEpoch = 0;
+  HLT_SingleEl8_loadedEpoch = 0;
+  HLT_SingleEl17_loadedEpoch = 0;
+  HLT_SingleIsoEl8_loadedEpoch = 0;
+  HLT_SingleIsoEl17_loadedEpoch = 0;
+  HLT_SingleIsoEl23_loadedEpoch = 0;
+  HLT_SingleIsoMu8_loadedEpoch = 0;
+  HLT_SingleIsoMu17_loadedEpoch = 0;
+  HLT_PFMET140_PFMHT140_IDTight_loadedEpoch = 0;
+  mc_HLT_DoubleMu_loadedEpoch = 0;
+  mc_HLT_DoubleEl_loadedEpoch = 0;
+  mc_HLT_DoubleEl_DZ_loadedEpoch = 0;
+  mc_HLT_DoubleEl_DZ_2_loadedEpoch = 0;
+  mc_HLT_MuEG_loadedEpoch = 0;
+  mc_HLT_SingleEl8_loadedEpoch = 0;
+  mc_HLT_SingleEl17_loadedEpoch = 0;
+  mc_HLT_SingleIsoEl8_loadedEpoch = 0;
+  mc_HLT_SingleIsoEl17_loadedEpoch = 0;
+  mc_HLT_SingleIsoEl23_loadedEpoch = 0;
+  mc_HLT_SingleIsoMu8_loadedEpoch = 0;
+  mc_HLT_SingleIsoMu17_loadedEpoch = 0;
+  mc_HLT_PFMET140_PFMHT140_IDTight_loadedEpoch = 0;
+  pass_duplicate_ee_em_mm_loadedEpoch = 0;
+  pass_duplicate_mm_em_ee_loadedEpoch = 0;
+  is2016_loadedEpoch = 0;
+  is2017_loadedEpoch = 0;
+  HLT_MuEG_2016_loadedEpoch = 0;
+  mc_HLT_MuEG_2016_loadedEpoch = 0;
+  pass_duplicate_ee_em2016_mm_loadedEpoch = 0;
+  pass_duplicate_mm_em2016_ee_loadedEpoch = 0;
+  passTrigger_loadedEpoch = 0;
+  lep_p4_loadedEpoch = 0;
+  lep_pt_loadedEpoch = 0;
+  lep_eta_loadedEpoch = 0;
+  lep_phi_loadedEpoch = 0;
+  lep_coneCorrPt_loadedEpoch = 0;
+  lep_ip3d_loadedEpoch = 0;
+  lep_ip3derr_loadedEpoch = 0;
+  lep_isTriggerSafe_v1_loadedEpoch = 0;
+  lep_lostHits_loadedEpoch = 0;
+  lep_convVeto_loadedEpoch = 0;
+  lep_motherIdSS_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_3l_fo_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_3l_tight_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_fo_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_tight_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_veto_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_fo_noiso_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_tight_noiso_loadedEpoch = 0;
+  lep_pass_VVV_cutbased_veto_noiso_loadedEpoch = 0;
+  lep_pass_POG_veto_loadedEpoch = 0;
+  lep_pass_POG_loose_loadedEpoch = 0;
+  lep_pass_POG_medium_loadedEpoch = 0;
+  lep_pass_POG_tight_loadedEpoch = 0;
+  lep_pdgId_loadedEpoch = 0;
+  lep_dxy_loadedEpoch = 0;
+  lep_dz_loadedEpoch = 0;
+  lep_pterr_loadedEpoch = 0;
+  lep_relIso04DB_loadedEpoch = 0;
+  lep_relIso03EA_loadedEpoch = 0;
+  lep_relIso03EALep_loadedEpoch = 0;
+  lep_relIso03EAv2_loadedEpoch = 0;
+  lep_relIso04EAv2_loadedEpoch = 0;
+  lep_relIso03EAv2Lep_loadedEpoch = 0;
+  lep_tightCharge_loadedEpoch = 0;
+  lep_trk_pt_loadedEpoch = 0;
+  lep_charge_loadedEpoch = 0;
+  lep_etaSC_loadedEpoch = 0;
+  lep_MVA_loadedEpoch = 0;
+  lep_isMediumPOG_loadedEpoch = 0;
+  lep_isTightPOG_loadedEpoch = 0;
+  lep_isFromW_loadedEpoch = 0;
+  lep_isFromZ_loadedEpoch = 0;
+  lep_isFromB_loadedEpoch = 0;
+  lep_isFromC_loadedEpoch = 0;
+  lep_isFromL_loadedEpoch = 0;
+  lep_isFromLF_loadedEpoch = 0;
+  lep_genPart_index_loadedEpoch = 0;
+  lep_r9_loadedEpoch = 0;
+  lep_nlayers_loadedEpoch = 0;
+  el_pt_loadedEpoch = 0;
+  el_eta_loadedEpoch = 0;
+  el_phi_loadedEpoch = 0;
+  el_relIso03EA_loadedEpoch = 0;
+  el_relIso03EALep_loadedEpoch = 0;
+  el_ip3d_loadedEpoch = 0;
+  mu_pt_loadedEpoch = 0;
+  mu_eta_loadedEpoch = 0;
+  mu_phi_loadedEpoch = 0;
+  mu_relIso04DB_loadedEpoch = 0;
+  mu_relIso03EA_loadedEpoch = 0;
+  mu_relIso03EALep_loadedEpoch = 0;
+  mu_ip3d_loadedEpoch = 0;
+  lbnt_pt_loadedEpoch = 0;
+  lbnt_coneCorrPt_loadedEpoch = 0;
+  lbnt_abseta_loadedEpoch = 0;
+  lbnt_pdgId_loadedEpoch = 0;
+  lbnt_el_pt_loadedEpoch = 0;
+  lbnt_el_coneCorrPt_loadedEpoch = 0;
+  lbnt_el_abseta_loadedEpoch = 0;
+  lbnt_mu_pt_loadedEpoch = 0;
+  lbnt_mu_coneCorrPt_loadedEpoch = 0;
+  lbnt_mu_abseta_loadedEpoch = 0;
+  jets_p4_loadedEpoch = 0;
+  jets_up_p4_loadedEpoch = 0;
+  jets_dn_p4_loadedEpoch = 0;
+  jets_csv_loadedEpoch = 0;
+  jets_up_csv_loadedEpoch = 0;
+  jets_dn_csv_loadedEpoch = 0;
+  jets_jer_csv_loadedEpoch = 0;
+  jets_jerup_csv_loadedEpoch = 0;
+  jets_jerdn_csv_loadedEpoch = 0;
+  jets_jer_p4_loadedEpoch = 0;
+  jets_jerup_p4_loadedEpoch = 0;
+  jets_jerdn_p4_loadedEpoch = 0;
+  jets30_p4_loadedEpoch = 0;
+  jets30_up_p4_loadedEpoch = 0;
+  jets30_dn_p4_loadedEpoch = 0;
+  jets30_jer_p4_loadedEpoch = 0;
+  jets30_jerup_p4_loadedEpoch = 0;
+  jets30_jerdn_p4_loadedEpoch = 0;
+  ak8jets_p4_loadedEpoch = 0;
+  ak8jets_softdropMass_loadedEpoch = 0;
+  ak8jets_prunedMass_loadedEpoch = 0;
+  ak8jets_trimmedMass_loadedEpoch = 0;
+  ak8jets_mass_loadedEpoch = 0;
+  ak8jets_nJettinessTau1_loadedEpoch = 0;
+  ak8jets_nJettinessTau2_loadedEpoch = 0;
+  ak8jets_softdropPuppiSubjet1_loadedEpoch = 0;
+  ak8jets_softdropPuppiSubjet2_loadedEpoch = 0;
+  ak8jets_puppi_softdropMass_loadedEpoch = 0;
+  ak8jets_puppi_nJettinessTau1_loadedEpoch = 0;
+  ak8jets_puppi_nJettinessTau2_loadedEpoch = 0;
+  ak8jets_puppi_eta_loadedEpoch = 0;
+  ak8jets_puppi_phi_loadedEpoch = 0;
+  ak8jets_puppi_pt_loadedEpoch = 0;
+  ak8jets_puppi_mass_loadedEpoch = 0;
+  met_pt_loadedEpoch = 0;
+  met_phi_loadedEpoch = 0;
+  met_up_pt_loadedEpoch = 0;
+  met_up_phi_loadedEpoch = 0;
+  met_dn_pt_loadedEpoch = 0;
+  met_dn_phi_loadedEpoch = 0;
+  met_gen_pt_loadedEpoch = 0;
+  met_gen_phi_loadedEpoch = 0;
+  met_jer_pt_loadedEpoch = 0;
+  met_jerup_pt_loadedEpoch = 0;
+  met_jerdn_pt_loadedEpoch = 0;
+  met_jer_phi_loadedEpoch = 0;
+  met_jerup_phi_loadedEpoch = 0;
+  met_jerdn_phi_loadedEpoch = 0;
+  firstgoodvertex_loadedEpoch = 0;
+  nTrueInt_loadedEpoch = 0;
+  nVert_loadedEpoch = 0;
+  nisoTrack_mt2_cleaned_VVV_cutbased_veto_loadedEpoch = 0;
+  weight_btagsf_loadedEpoch = 0;
+  weight_btagsf_heavy_DN_loadedEpoch = 0;
+  weight_btagsf_heavy_UP_loadedEpoch = 0;
+  weight_btagsf_light_DN_loadedEpoch = 0;
+  weight_btagsf_light_UP_loadedEpoch = 0;
+  gen_ht_loadedEpoch = 0;
+  genPart_p4_loadedEpoch = 0;
+  genPart_motherId_loadedEpoch = 0;
+  genPart_pdgId_loadedEpoch = 0;
+  genPart_charge_loadedEpoch = 0;
+  genPart_status_loadedEpoch = 0;
+  ngenLep_loadedEpoch = 0;
+  ngenLepFromTau_loadedEpoch = 0;
+  Flag_AllEventFilters_loadedEpoch = 0;
+  Flag_EcalDeadCellTriggerPrimitiveFilter_loadedEpoch = 0;
+  Flag_HBHEIsoNoiseFilter_loadedEpoch = 0;
+  Flag_HBHENoiseFilter_loadedEpoch = 0;
+  Flag_badChargedCandidateFilter_loadedEpoch = 0;
+  Flag_badMuonFilter_loadedEpoch = 0;
+  Flag_badMuonFilterv2_loadedEpoch = 0;
+  Flag_badChargedCandidateFilterv2_loadedEpoch = 0;
+  Flag_eeBadScFilter_loadedEpoch = 0;
+  Flag_ecalBadCalibFilter_loadedEpoch = 0;
+  Flag_globalTightHalo2016_loadedEpoch = 0;
+  Flag_goodVertices_loadedEpoch = 0;
+  Flag_ecalLaserCorrFilter_loadedEpoch = 0;
+  Flag_hcalLaserEventFilter_loadedEpoch = 0;
+  Flag_trackingFailureFilter_loadedEpoch = 0;
+  Flag_CSCTightHaloFilter_loadedEpoch = 0;
+  Flag_CSCTightHalo2015Filter_loadedEpoch = 0;
+  Flag_badMuons_loadedEpoch = 0;
+  Flag_duplicateMuons_loadedEpoch = 0;
+  Flag_noBadMuons_loadedEpoch = 0;
+  fastsimfilt_loadedEpoch = 0;
+  nVlep_loadedEpoch = 0;
+  nTlep_loadedEpoch = 0;
+  nTlepSS_loadedEpoch = 0;
+  nLlep_loadedEpoch = 0;
+  nLlep3L_loadedEpoch = 0;
+  nTlep3L_loadedEpoch = 0;
+  nSFOS_loadedEpoch = 0;
+  nSFOSinZ_loadedEpoch = 0;
+  nj_loadedEpoch = 0;
+  nj_up_loadedEpoch = 0;
+  nj_dn_loadedEpoch = 0;
+  nj_jer_loadedEpoch = 0;
+  nj_jerup_loadedEpoch = 0;
+  nj_jerdn_loadedEpoch = 0;
+  nj30_loadedEpoch = 0;
+  nj30_up_loadedEpoch = 0;
+  nj30_dn_loadedEpoch = 0;
+  nj30_jer_loadedEpoch = 0;
+  nj30_jerup_loadedEpoch = 0;
+  nj30_jerdn_loadedEpoch = 0;
+  nb_loadedEpoch = 0;
+  nb_up_loadedEpoch = 0;
+  nb_dn_loadedEpoch = 0;
+  nb_jer_loadedEpoch = 0;
+  nb_jerup_loadedEpoch = 0;
+  nb_jerdn_loadedEpoch = 0;
+  Ml0j0_loadedEpoch = 0;
+  Ml0j0_up_loadedEpoch = 0;
+  Ml0j0_dn_loadedEpoch = 0;
+  Ml0j0_jer_loadedEpoch = 0;
+  Ml0j0_jerup_loadedEpoch = 0;
+  Ml0j0_jerdn_loadedEpoch = 0;
+  Ml0j1_loadedEpoch = 0;
+  Ml0j1_up_loadedEpoch = 0;
+  Ml0j1_dn_loadedEpoch = 0;
+  Ml0j1_jer_loadedEpoch = 0;
+  Ml0j1_jerup_loadedEpoch = 0;
+  Ml0j1_jerdn_loadedEpoch = 0;
+  Ml1j0_loadedEpoch = 0;
+  Ml1j0_up_loadedEpoch = 0;
+  Ml1j0_dn_loadedEpoch = 0;
+  Ml1j0_jer_loadedEpoch = 0;
+  Ml1j0_jerup_loadedEpoch = 0;
+  Ml1j0_jerdn_loadedEpoch = 0;
+  Ml1j1_loadedEpoch = 0;
+  Ml1j1_up_loadedEpoch = 0;
+  Ml1j1_dn_loadedEpoch = 0;
+  Ml1j1_jer_loadedEpoch = 0;
+  Ml1j1_jerup_loadedEpoch = 0;
+  Ml1j1_jerdn_loadedEpoch = 0;
+  MinMlj_loadedEpoch = 0;
+  MinMlj_up_loadedEpoch = 0;
+  MinMlj_dn_loadedEpoch = 0;
+  MinMlj_jer_loadedEpoch = 0;
+  MinMlj_jerup_loadedEpoch = 0;
+  MinMlj_jerdn_loadedEpoch = 0;
+  SumMinMlj01_loadedEpoch = 0;
+  SumMinMlj01_up_loadedEpoch = 0;
+  SumMinMlj01_dn_loadedEpoch = 0;
+  SumMinMlj01_jer_loadedEpoch = 0;
+  SumMinMlj01_jerup_loadedEpoch = 0;
+  SumMinMlj01_jerdn_loadedEpoch = 0;
+  MaxMlj_loadedEpoch = 0;
+  MaxMlj_up_loadedEpoch = 0;
+  MaxMlj_dn_loadedEpoch = 0;
+  MaxMlj_jer_loadedEpoch = 0;
+  MaxMlj_jerup_loadedEpoch = 0;
+  MaxMlj_jerdn_loadedEpoch = 0;
+  SumMlj_loadedEpoch = 0;
+  SumMlj_up_loadedEpoch = 0;
+  SumMlj_dn_loadedEpoch = 0;
+  SumMlj_jer_loadedEpoch = 0;
+  SumMlj_jerup_loadedEpoch = 0;
+  SumMlj_jerdn_loadedEpoch = 0;
+  Ml0jj_loadedEpoch = 0;
+  Ml0jj_up_loadedEpoch = 0;
+  Ml0jj_dn_loadedEpoch = 0;
+  Ml0jj_jer_loadedEpoch = 0;
+  Ml0jj_jerup_loadedEpoch = 0;
+  Ml0jj_jerdn_loadedEpoch = 0;
+  Ml1jj_loadedEpoch = 0;
+  Ml1jj_up_loadedEpoch = 0;
+  Ml1jj_dn_loadedEpoch = 0;
+  Ml1jj_jer_loadedEpoch = 0;
+  Ml1jj_jerup_loadedEpoch = 0;
+  Ml1jj_jerdn_loadedEpoch = 0;
+  MinMljj_loadedEpoch = 0;
+  MinMljj_up_loadedEpoch = 0;
+  MinMljj_dn_loadedEpoch = 0;
+  MinMljj_jer_loadedEpoch = 0;
+  MinMljj_jerup_loadedEpoch = 0;
+  MinMljj_jerdn_loadedEpoch = 0;
+  MaxMljj_loadedEpoch = 0;
+  MaxMljj_up_loadedEpoch = 0;
+  MaxMljj_dn_loadedEpoch = 0;
+  MaxMljj_jer_loadedEpoch = 0;
+  MaxMljj_jerup_loadedEpoch = 0;
+  MaxMljj_jerdn_loadedEpoch = 0;
+  SumMljj_loadedEpoch = 0;
+  SumMljj_up_loadedEpoch = 0;
+  SumMljj_dn_loadedEpoch = 0;
+  SumMljj_jer_loadedEpoch = 0;
+  SumMljj_jerup_loadedEpoch = 0;
+  SumMljj_jerdn_loadedEpoch = 0;
+  Mjj_loadedEpoch = 0;
+  Mjj_up_loadedEpoch = 0;
+  Mjj_dn_loadedEpoch = 0;
+  Mjj_jer_loadedEpoch = 0;
+  Mjj_jerup_loadedEpoch = 0;
+  Mjj_jerdn_loadedEpoch = 0;
+  DRjj_loadedEpoch = 0;
+  DRjj_up_loadedEpoch = 0;
+  DRjj_dn_loadedEpoch = 0;
+  DRjj_jer_loadedEpoch = 0;
+  DRjj_jerup_loadedEpoch = 0;
+  DRjj_jerdn_loadedEpoch = 0;
+  jet0_wtag_p4_loadedEpoch = 0;
+  jet0_wtag_p4_up_loadedEpoch = 0;
+  jet0_wtag_p4_dn_loadedEpoch = 0;
+  jet0_wtag_p4_jer_loadedEpoch = 0;
+  jet0_wtag_p4_jerup_loadedEpoch = 0;
+  jet0_wtag_p4_jerdn_loadedEpoch = 0;
+  jet1_wtag_p4_loadedEpoch = 0;
+  jet1_wtag_p4_up_loadedEpoch = 0;
+  jet1_wtag_p4_dn_loadedEpoch = 0;
+  jet1_wtag_p4_jer_loadedEpoch = 0;
+  jet1_wtag_p4_jerup_loadedEpoch = 0;
+  jet1_wtag_p4_jerdn_loadedEpoch = 0;
+  MjjDR1_loadedEpoch = 0;
+  MjjDR1_up_loadedEpoch = 0;
+  MjjDR1_dn_loadedEpoch = 0;
+  MjjDR1_jer_loadedEpoch = 0;
+  MjjDR1_jerup_loadedEpoch = 0;
+  MjjDR1_jerdn_loadedEpoch = 0;
+  DRjjDR1_loadedEpoch = 0;
+  DRjjDR1_up_loadedEpoch = 0;
+  DRjjDR1_dn_loadedEpoch = 0;
+  DRjjDR1_jer_loadedEpoch = 0;
+  DRjjDR1_jerup_loadedEpoch = 0;
+  DRjjDR1_jerdn_loadedEpoch = 0;
+  jet0_wtag_p4_DR1_loadedEpoch = 0;
+  jet0_wtag_p4_DR1_up_loadedEpoch = 0;
+  jet0_wtag_p4_DR1_dn_loadedEpoch = 0;
+  jet0_wtag_p4_DR1_jer_loadedEpoch = 0;
+  jet0_wtag_p4_DR1_jerup_loadedEpoch = 0;
+  jet0_wtag_p4_DR1_jerdn_loadedEpoch = 0;
+  jet1_wtag_p4_DR1_loadedEpoch = 0;
+  jet1_wtag_p4_DR1_up_loadedEpoch = 0;
+  jet1_wtag_p4_DR1_dn_loadedEpoch = 0;
+  jet1_wtag_p4_DR1_jer_loadedEpoch = 0;
+  jet1_wtag_p4_DR1_jerup_loadedEpoch = 0;
+  jet1_wtag_p4_DR1_jerdn_loadedEpoch = 0;
+  MjjVBF_loadedEpoch = 0;
+  MjjVBF_up_loadedEpoch = 0;
+  MjjVBF_dn_loadedEpoch = 0;
+  MjjVBF_jer_loadedEpoch = 0;
+  MjjVBF_jerup_loadedEpoch = 0;
+  MjjVBF_jerdn_loadedEpoch = 0;
+  DetajjVBF_loadedEpoch = 0;
+  DetajjVBF_up_loadedEpoch = 0;
+  DetajjVBF_dn_loadedEpoch = 0;
+  DetajjVBF_jer_loadedEpoch = 0;
+  DetajjVBF_jerup_loadedEpoch = 0;
+  DetajjVBF_jerdn_loadedEpoch = 0;
+  MjjL_loadedEpoch = 0;
+  MjjL_up_loadedEpoch = 0;
+  MjjL_dn_loadedEpoch = 0;
+  MjjL_jer_loadedEpoch = 0;
+  MjjL_jerup_loadedEpoch = 0;
+  MjjL_jerdn_loadedEpoch = 0;
+  DetajjL_loadedEpoch = 0;
+  DetajjL_up_loadedEpoch = 0;
+  DetajjL_dn_loadedEpoch = 0;
+  DetajjL_jer_loadedEpoch = 0;
+  DetajjL_jerup_loadedEpoch = 0;
+  DetajjL_jerdn_loadedEpoch = 0;
+  MllSS_loadedEpoch = 0;
+  MeeSS_loadedEpoch = 0;
+  Mll3L_loadedEpoch = 0;
+  Mee3L_loadedEpoch = 0;
+  Mll3L1_loadedEpoch = 0;
+  M3l_loadedEpoch = 0;
+  Pt3l_loadedEpoch = 0;
+  M01_loadedEpoch = 0;
+  M02_loadedEpoch = 0;
+  M12_loadedEpoch = 0;
+  isSFOS01_loadedEpoch = 0;
+  isSFOS02_loadedEpoch = 0;
+  isSFOS12_loadedEpoch = 0;
+  DPhi3lMET_loadedEpoch = 0;
+  DPhi3lMET_up_loadedEpoch = 0;
+  DPhi3lMET_dn_loadedEpoch = 0;
+  DPhi3lMET_jer_loadedEpoch = 0;
+  DPhi3lMET_jerup_loadedEpoch = 0;
+  DPhi3lMET_jerdn_loadedEpoch = 0;
+  DPhi3lMET_gen_loadedEpoch = 0;
+  MTmax_loadedEpoch = 0;
+  MTmax_up_loadedEpoch = 0;
+  MTmax_dn_loadedEpoch = 0;
+  MTmax_jer_loadedEpoch = 0;
+  MTmax_jerup_loadedEpoch = 0;
+  MTmax_jerdn_loadedEpoch = 0;
+  MTmax_gen_loadedEpoch = 0;
+  MTmin_loadedEpoch = 0;
+  MTmin_up_loadedEpoch = 0;
+  MTmin_dn_loadedEpoch = 0;
+  MTmin_jer_loadedEpoch = 0;
+  MTmin_jerup_loadedEpoch = 0;
+  MTmin_jerdn_loadedEpoch = 0;
+  MTmin_gen_loadedEpoch = 0;
+  MT3rd_loadedEpoch = 0;
+  MT3rd_up_loadedEpoch = 0;
+  MT3rd_dn_loadedEpoch = 0;
+  MT3rd_jer_loadedEpoch = 0;
+  MT3rd_jerup_loadedEpoch = 0;
+  MT3rd_jerdn_loadedEpoch = 0;
+  MT3rd_gen_loadedEpoch = 0;
+  MTmax3L_loadedEpoch = 0;
+  MTmax3L_up_loadedEpoch = 0;
+  MTmax3L_dn_loadedEpoch = 0;
+  MTmax3L_jer_loadedEpoch = 0;
+  MTmax3L_jerup_loadedEpoch = 0;
+  MTmax3L_jerdn_loadedEpoch = 0;
+  MTmax3L_gen_loadedEpoch = 0;
+  passSSee_loadedEpoch = 0;
+  passSSem_loadedEpoch = 0;
+  passSSmm_loadedEpoch = 0;
+  lep_idx0_SS_loadedEpoch = 0;
+  lep_idx1_SS_loadedEpoch = 0;
+  bkgtype_loadedEpoch = 0;
+  vetophoton_loadedEpoch = 0;
+  purewgt_loadedEpoch = 0;
+  purewgt_up_loadedEpoch = 0;
+  purewgt_dn_loadedEpoch = 0;
+  ffwgt_loadedEpoch = 0;
+  ffwgt_up_loadedEpoch = 0;
+  ffwgt_dn_loadedEpoch = 0;
+  ffwgt_el_up_loadedEpoch = 0;
+  ffwgt_el_dn_loadedEpoch = 0;
+  ffwgt_mu_up_loadedEpoch = 0;
+  ffwgt_mu_dn_loadedEpoch = 0;
+  ffwgt_closure_up_loadedEpoch = 0;
+  ffwgt_closure_dn_loadedEpoch = 0;
+  ffwgt_closure_el_up_loadedEpoch = 0;
+  ffwgt_closure_el_dn_loadedEpoch = 0;
+  ffwgt_closure_mu_up_loadedEpoch = 0;
+  ffwgt_closure_mu_dn_loadedEpoch = 0;
+  ffwgt_full_up_loadedEpoch = 0;
+  ffwgt_full_dn_loadedEpoch = 0;
+  ffwgtqcd_loadedEpoch = 0;
+  ffwgtqcd_up_loadedEpoch = 0;
+  ffwgtqcd_dn_loadedEpoch = 0;
+  lepsf_loadedEpoch = 0;
+  lepsf_up_loadedEpoch = 0;
+  lepsf_dn_loadedEpoch = 0;
+  trigeff_loadedEpoch = 0;
+  trigeff_up_loadedEpoch = 0;
+  trigeff_dn_loadedEpoch = 0;
+  trigsf_loadedEpoch = 0;
+  trigsf_up_loadedEpoch = 0;
+  trigsf_dn_loadedEpoch = 0;
+  musmear_sf_loadedEpoch = 0;
+  iswhwww_loadedEpoch = 0;
+  www_channel_loadedEpoch = 0;
+  has_tau_loadedEpoch = 0;
+  w_p4_loadedEpoch = 0;
+  w_islep_loadedEpoch = 0;
+  w_isstar_loadedEpoch = 0;
+  w_isH_loadedEpoch = 0;
+  l_p4_loadedEpoch = 0;
+  l_w_pt_loadedEpoch = 0;
+  l_w_eta_loadedEpoch = 0;
+  l_w_phi_loadedEpoch = 0;
+  l_w_mass_loadedEpoch = 0;
+  l_w_id_loadedEpoch = 0;
+  l_isstar_loadedEpoch = 0;
+  l_isH_loadedEpoch = 0;
+  l_istau_loadedEpoch = 0;
+  q_p4_loadedEpoch = 0;
+  q_w_pt_loadedEpoch = 0;
+  q_w_eta_loadedEpoch = 0;
+  q_w_phi_loadedEpoch = 0;
+  q_w_mass_loadedEpoch = 0;
+  q_w_id_loadedEpoch = 0;
+  q_isstar_loadedEpoch = 0;
+  q_isH_loadedEpoch = 0;
+  dRllSS_loadedEpoch = 0;
+  dRqqSS_loadedEpoch = 0;
+  DPhill_higgs_loadedEpoch = 0;
+  Mll_higgs_loadedEpoch = 0;
+  MT_higgs_loadedEpoch = 0;
 }
 
 void wwwtree::LoadAllBranches() {
@@ -2055,6618 +2113,6618 @@ void wwwtree::LoadAllBranches() {
 }
 
 const int &wwwtree::run() {
-  if (not run_isLoaded) {
+  if (run_loadedEpoch != epoch) {
     if (run_branch != 0) {
-      run_branch->GetEntry(index);
+      LoadBranch(run_branch);
     } else {
       printf("branch run_branch does not exist!\n");
       exit(1);
     }
-    run_isLoaded = true;
+    run_loadedEpoch = epoch;
   }
   return run_;
 }
 
 const int &wwwtree::lumi() {
-  if (not lumi_isLoaded) {
+  if (lumi_loadedEpoch != epoch) {
     if (lumi_branch != 0) {
-      lumi_branch->GetEntry(index);
+      LoadBranch(lumi_branch);
     } else {
       printf("branch lumi_branch does not exist!\n");
       exit(1);
     }
-    lumi_isLoaded = true;
+    lumi_loadedEpoch = epoch;
   }
   return lumi_;
 }
 
 const unsigned long long &wwwtree::evt() {
-  if (not evt_isLoaded) {
+  if (evt_loadedEpoch != epoch) {
     if (evt_branch != 0) {
-      evt_branch->GetEntry(index);
+      LoadBranch(evt_branch);
     } else {
       printf("branch evt_branch does not exist!\n");
       exit(1);
     }
-    evt_isLoaded = true;
+    evt_loadedEpoch = epoch;
   }
   return evt_;
 }
 
 const int &wwwtree::isData() {
-  if (not isData_isLoaded) {
+  if (isData_loadedEpoch != epoch) {
     if (isData_branch != 0) {
-      isData_branch->GetEntry(index);
+      LoadBranch(isData_branch);
     } else {
       printf("branch isData_branch does not exist!\n");
       exit(1);
     }
-    isData_isLoaded = true;
+    isData_loadedEpoch = epoch;
   }
   return isData_;
 }
 
 const float &wwwtree::evt_scale1fb() {
-  if (not evt_scale1fb_isLoaded) {
+  if (evt_scale1fb_loadedEpoch != epoch) {
     if (evt_scale1fb_branch != 0) {
-      evt_scale1fb_branch->GetEntry(index);
+      LoadBranch(evt_scale1fb_branch);
     } else {
       printf("branch evt_scale1fb_branch does not exist!\n");
       exit(1);
     }
-    evt_scale1fb_isLoaded = true;
+    evt_scale1fb_loadedEpoch = epoch;
   }
   return evt_scale1fb_;
 }
 
 const float &wwwtree::xsec_br() {
-  if (not xsec_br_isLoaded) {
+  if (xsec_br_loadedEpoch != epoch) {
     if (xsec_br_branch != 0) {
-      xsec_br_branch->GetEntry(index);
+      LoadBranch(xsec_br_branch);
     } else {
       printf("branch xsec_br_branch does not exist!\n");
       exit(1);
     }
-    xsec_br_isLoaded = true;
+    xsec_br_loadedEpoch = epoch;
   }
   return xsec_br_;
 }
 
 const int &wwwtree::evt_passgoodrunlist() {
-  if (not evt_passgoodrunlist_isLoaded) {
+  if (evt_passgoodrunlist_loadedEpoch != epoch) {
     if (evt_passgoodrunlist_branch != 0) {
-      evt_passgoodrunlist_branch->GetEntry(index);
+      LoadBranch(evt_passgoodrunlist_branch);
     } else {
       printf("branch evt_passgoodrunlist_branch does not exist!\n");
       exit(1);
     }
-    evt_passgoodrunlist_isLoaded = true;
+    evt_passgoodrunlist_loadedEpoch = epoch;
   }
   return evt_passgoodrunlist_;
 }
 
 const TString &wwwtree::CMS4path() {
-  if (not CMS4path_isLoaded) {
+  if (CMS4path_loadedEpoch != epoch) {
     if (CMS4path_branch != 0) {
-      CMS4path_branch->GetEntry(index);
+      LoadBranch(CMS4path_branch);
     } else {
       printf("branch CMS4path_branch does not exist!\n");
       exit(1);
     }
-    CMS4path_isLoaded = true;
+    CMS4path_loadedEpoch = epoch;
   }
   return *CMS4path_;
 }
 
 const int &wwwtree::CMS4index() {
-  if (not CMS4index_isLoaded) {
+  if (CMS4index_loadedEpoch != epoch) {
     if (CMS4index_branch != 0) {
-      CMS4index_branch->GetEntry(index);
+      LoadBranch(CMS4index_branch);
     } else {
       printf("branch CMS4index_branch does not exist!\n");
       exit(1);
     }
-    CMS4index_isLoaded = true;
+    CMS4index_loadedEpoch = epoch;
   }
   return CMS4index_;
 }
 
 const float &wwwtree::weight_fr_r1_f1() {
-  if (not weight_fr_r1_f1_isLoaded) {
+  if (weight_fr_r1_f1_loadedEpoch != epoch) {
     if (weight_fr_r1_f1_branch != 0) {
-      weight_fr_r1_f1_branch->GetEntry(index);
+      LoadBranch(weight_fr_r1_f1_branch);
     } else {
       printf("branch weight_fr_r1_f1_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r1_f1_isLoaded = true;
+    weight_fr_r1_f1_loadedEpoch = epoch;
   }
   return weight_fr_r1_f1_;
 }
 
 const float &wwwtree::weight_fr_r1_f2() {
-  if (not weight_fr_r1_f2_isLoaded) {
+  if (weight_fr_r1_f2_loadedEpoch != epoch) {
     if (weight_fr_r1_f2_branch != 0) {
-      weight_fr_r1_f2_branch->GetEntry(index);
+      LoadBranch(weight_fr_r1_f2_branch);
     } else {
       printf("branch weight_fr_r1_f2_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r1_f2_isLoaded = true;
+    weight_fr_r1_f2_loadedEpoch = epoch;
   }
   return weight_fr_r1_f2_;
 }
 
 const float &wwwtree::weight_fr_r1_f0p5() {
-  if (not weight_fr_r1_f0p5_isLoaded) {
+  if (weight_fr_r1_f0p5_loadedEpoch != epoch) {
     if (weight_fr_r1_f0p5_branch != 0) {
-      weight_fr_r1_f0p5_branch->GetEntry(index);
+      LoadBranch(weight_fr_r1_f0p5_branch);
     } else {
       printf("branch weight_fr_r1_f0p5_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r1_f0p5_isLoaded = true;
+    weight_fr_r1_f0p5_loadedEpoch = epoch;
   }
   return weight_fr_r1_f0p5_;
 }
 
 const float &wwwtree::weight_fr_r2_f1() {
-  if (not weight_fr_r2_f1_isLoaded) {
+  if (weight_fr_r2_f1_loadedEpoch != epoch) {
     if (weight_fr_r2_f1_branch != 0) {
-      weight_fr_r2_f1_branch->GetEntry(index);
+      LoadBranch(weight_fr_r2_f1_branch);
     } else {
       printf("branch weight_fr_r2_f1_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r2_f1_isLoaded = true;
+    weight_fr_r2_f1_loadedEpoch = epoch;
   }
   return weight_fr_r2_f1_;
 }
 
 const float &wwwtree::weight_fr_r2_f2() {
-  if (not weight_fr_r2_f2_isLoaded) {
+  if (weight_fr_r2_f2_loadedEpoch != epoch) {
     if (weight_fr_r2_f2_branch != 0) {
-      weight_fr_r2_f2_branch->GetEntry(index);
+      LoadBranch(weight_fr_r2_f2_branch);
     } else {
       printf("branch weight_fr_r2_f2_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r2_f2_isLoaded = true;
+    weight_fr_r2_f2_loadedEpoch = epoch;
   }
   return weight_fr_r2_f2_;
 }
 
 const float &wwwtree::weight_fr_r2_f0p5() {
-  if (not weight_fr_r2_f0p5_isLoaded) {
+  if (weight_fr_r2_f0p5_loadedEpoch != epoch) {
     if (weight_fr_r2_f0p5_branch != 0) {
-      weight_fr_r2_f0p5_branch->GetEntry(index);
+      LoadBranch(weight_fr_r2_f0p5_branch);
     } else {
       printf("branch weight_fr_r2_f0p5_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r2_f0p5_isLoaded = true;
+    weight_fr_r2_f0p5_loadedEpoch = epoch;
   }
   return weight_fr_r2_f0p5_;
 }
 
 const float &wwwtree::weight_fr_r0p5_f1() {
-  if (not weight_fr_r0p5_f1_isLoaded) {
+  if (weight_fr_r0p5_f1_loadedEpoch != epoch) {
     if (weight_fr_r0p5_f1_branch != 0) {
-      weight_fr_r0p5_f1_branch->GetEntry(index);
+      LoadBranch(weight_fr_r0p5_f1_branch);
     } else {
       printf("branch weight_fr_r0p5_f1_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r0p5_f1_isLoaded = true;
+    weight_fr_r0p5_f1_loadedEpoch = epoch;
   }
   return weight_fr_r0p5_f1_;
 }
 
 const float &wwwtree::weight_fr_r0p5_f2() {
-  if (not weight_fr_r0p5_f2_isLoaded) {
+  if (weight_fr_r0p5_f2_loadedEpoch != epoch) {
     if (weight_fr_r0p5_f2_branch != 0) {
-      weight_fr_r0p5_f2_branch->GetEntry(index);
+      LoadBranch(weight_fr_r0p5_f2_branch);
     } else {
       printf("branch weight_fr_r0p5_f2_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r0p5_f2_isLoaded = true;
+    weight_fr_r0p5_f2_loadedEpoch = epoch;
   }
   return weight_fr_r0p5_f2_;
 }
 
 const float &wwwtree::weight_fr_r0p5_f0p5() {
-  if (not weight_fr_r0p5_f0p5_isLoaded) {
+  if (weight_fr_r0p5_f0p5_loadedEpoch != epoch) {
     if (weight_fr_r0p5_f0p5_branch != 0) {
-      weight_fr_r0p5_f0p5_branch->GetEntry(index);
+      LoadBranch(weight_fr_r0p5_f0p5_branch);
     } else {
       printf("branch weight_fr_r0p5_f0p5_branch does not exist!\n");
       exit(1);
     }
-    weight_fr_r0p5_f0p5_isLoaded = true;
+    weight_fr_r0p5_f0p5_loadedEpoch = epoch;
   }
   return weight_fr_r0p5_f0p5_;
 }
 
 const float &wwwtree::weight_pdf_up() {
-  if (not weight_pdf_up_isLoaded) {
+  if (weight_pdf_up_loadedEpoch != epoch) {
     if (weight_pdf_up_branch != 0) {
-      weight_pdf_up_branch->GetEntry(index);
+      LoadBranch(weight_pdf_up_branch);
     } else {
       printf("branch weight_pdf_up_branch does not exist!\n");
       exit(1);
     }
-    weight_pdf_up_isLoaded = true;
+    weight_pdf_up_loadedEpoch = epoch;
   }
   return weight_pdf_up_;
 }
 
 const float &wwwtree::weight_pdf_down() {
-  if (not weight_pdf_down_isLoaded) {
+  if (weight_pdf_down_loadedEpoch != epoch) {
     if (weight_pdf_down_branch != 0) {
-      weight_pdf_down_branch->GetEntry(index);
+      LoadBranch(weight_pdf_down_branch);
     } else {
       printf("branch weight_pdf_down_branch does not exist!\n");
       exit(1);
     }
-    weight_pdf_down_isLoaded = true;
+    weight_pdf_down_loadedEpoch = epoch;
   }
   return weight_pdf_down_;
 }
 
 const float &wwwtree::weight_alphas_down() {
-  if (not weight_alphas_down_isLoaded) {
+  if (weight_alphas_down_loadedEpoch != epoch) {
     if (weight_alphas_down_branch != 0) {
-      weight_alphas_down_branch->GetEntry(index);
+      LoadBranch(weight_alphas_down_branch);
     } else {
       printf("branch weight_alphas_down_branch does not exist!\n");
       exit(1);
     }
-    weight_alphas_down_isLoaded = true;
+    weight_alphas_down_loadedEpoch = epoch;
   }
   return weight_alphas_down_;
 }
 
 const float &wwwtree::weight_alphas_up() {
-  if (not weight_alphas_up_isLoaded) {
+  if (weight_alphas_up_loadedEpoch != epoch) {
     if (weight_alphas_up_branch != 0) {
-      weight_alphas_up_branch->GetEntry(index);
+      LoadBranch(weight_alphas_up_branch);
     } else {
       printf("branch weight_alphas_up_branch does not exist!\n");
       exit(1);
     }
-    weight_alphas_up_isLoaded = true;
+    weight_alphas_up_loadedEpoch = epoch;
   }
   return weight_alphas_up_;
 }
 
 const float &wwwtree::weight_isr() {
-  if (not weight_isr_isLoaded) {
+  if (weight_isr_loadedEpoch != epoch) {
     if (weight_isr_branch != 0) {
-      weight_isr_branch->GetEntry(index);
+      LoadBranch(weight_isr_branch);
     } else {
       printf("branch weight_isr_branch does not exist!\n");
       exit(1);
     }
-    weight_isr_isLoaded = true;
+    weight_isr_loadedEpoch = epoch;
   }
   return weight_isr_;
 }
 
 const float &wwwtree::weight_isr_up() {
-  if (not weight_isr_up_isLoaded) {
+  if (weight_isr_up_loadedEpoch != epoch) {
     if (weight_isr_up_branch != 0) {
-      weight_isr_up_branch->GetEntry(index);
+      LoadBranch(weight_isr_up_branch);
     } else {
       printf("branch weight_isr_up_branch does not exist!\n");
       exit(1);
     }
-    weight_isr_up_isLoaded = true;
+    weight_isr_up_loadedEpoch = epoch;
   }
   return weight_isr_up_;
 }
 
 const float &wwwtree::weight_isr_down() {
-  if (not weight_isr_down_isLoaded) {
+  if (weight_isr_down_loadedEpoch != epoch) {
     if (weight_isr_down_branch != 0) {
-      weight_isr_down_branch->GetEntry(index);
+      LoadBranch(weight_isr_down_branch);
     } else {
       printf("branch weight_isr_down_branch does not exist!\n");
       exit(1);
     }
-    weight_isr_down_isLoaded = true;
+    weight_isr_down_loadedEpoch = epoch;
   }
   return weight_isr_down_;
 }
 
 const int &wwwtree::HLT_DoubleMu() {
-  if (not HLT_DoubleMu_isLoaded) {
+  if (HLT_DoubleMu_loadedEpoch != epoch) {
     if (HLT_DoubleMu_branch != 0) {
-      HLT_DoubleMu_branch->GetEntry(index);
+      LoadBranch(HLT_DoubleMu_branch);
     } else {
       printf("branch HLT_DoubleMu_branch does not exist!\n");
       exit(1);
     }
-    HLT_DoubleMu_isLoaded = true;
+    HLT_DoubleMu_loadedEpoch = epoch;
   }
   return HLT_DoubleMu_;
 }
 
 const int &wwwtree::HLT_DoubleEl() {
-  if (not HLT_DoubleEl_isLoaded) {
+  if (HLT_DoubleEl_loadedEpoch != epoch) {
     if (HLT_DoubleEl_branch != 0) {
-      HLT_DoubleEl_branch->GetEntry(index);
+      LoadBranch(HLT_DoubleEl_branch);
     } else {
       printf("branch HLT_DoubleEl_branch does not exist!\n");
       exit(1);
     }
-    HLT_DoubleEl_isLoaded = true;
+    HLT_DoubleEl_loadedEpoch = epoch;
   }
   return HLT_DoubleEl_;
 }
 
 const int &wwwtree::HLT_DoubleEl_DZ() {
-  if (not HLT_DoubleEl_DZ_isLoaded) {
+  if (HLT_DoubleEl_DZ_loadedEpoch != epoch) {
     if (HLT_DoubleEl_DZ_branch != 0) {
-      HLT_DoubleEl_DZ_branch->GetEntry(index);
+      LoadBranch(HLT_DoubleEl_DZ_branch);
     } else {
       printf("branch HLT_DoubleEl_DZ_branch does not exist!\n");
       exit(1);
     }
-    HLT_DoubleEl_DZ_isLoaded = true;
+    HLT_DoubleEl_DZ_loadedEpoch = epoch;
   }
   return HLT_DoubleEl_DZ_;
 }
 
 const int &wwwtree::HLT_DoubleEl_DZ_2() {
-  if (not HLT_DoubleEl_DZ_2_isLoaded) {
+  if (HLT_DoubleEl_DZ_2_loadedEpoch != epoch) {
     if (HLT_DoubleEl_DZ_2_branch != 0) {
-      HLT_DoubleEl_DZ_2_branch->GetEntry(index);
+      LoadBranch(HLT_DoubleEl_DZ_2_branch);
     } else {
       printf("branch HLT_DoubleEl_DZ_2_branch does not exist!\n");
       exit(1);
     }
-    HLT_DoubleEl_DZ_2_isLoaded = true;
+    HLT_DoubleEl_DZ_2_loadedEpoch = epoch;
   }
   return HLT_DoubleEl_DZ_2_;
 }
 
 const int &wwwtree::HLT_MuEG() {
-  if (not HLT_MuEG_isLoaded) {
+  if (HLT_MuEG_loadedEpoch != epoch) {
     if (HLT_MuEG_branch != 0) {
-      HLT_MuEG_branch->GetEntry(index);
+      LoadBranch(HLT_MuEG_branch);
     } else {
       printf("branch HLT_MuEG_branch does not exist!\n");
       exit(1);
     }
-    HLT_MuEG_isLoaded = true;
+    HLT_MuEG_loadedEpoch = epoch;
   }
   return HLT_MuEG_;
 }
 
 const int &wwwtree::HLT_SingleEl8() {
-  if (not HLT_SingleEl8_isLoaded) {
+  if (HLT_SingleEl8_loadedEpoch != epoch) {
     if (HLT_SingleEl8_branch != 0) {
-      HLT_SingleEl8_branch->GetEntry(index);
+      LoadBranch(HLT_SingleEl8_branch);
     } else {
       printf("branch HLT_SingleEl8_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleEl8_isLoaded = true;
+    HLT_SingleEl8_loadedEpoch = epoch;
   }
   return HLT_SingleEl8_;
 }
 
 const int &wwwtree::HLT_SingleEl17() {
-  if (not HLT_SingleEl17_isLoaded) {
+  if (HLT_SingleEl17_loadedEpoch != epoch) {
     if (HLT_SingleEl17_branch != 0) {
-      HLT_SingleEl17_branch->GetEntry(index);
+      LoadBranch(HLT_SingleEl17_branch);
     } else {
       printf("branch HLT_SingleEl17_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleEl17_isLoaded = true;
+    HLT_SingleEl17_loadedEpoch = epoch;
   }
   return HLT_SingleEl17_;
 }
 
 const int &wwwtree::HLT_SingleIsoEl8() {
-  if (not HLT_SingleIsoEl8_isLoaded) {
+  if (HLT_SingleIsoEl8_loadedEpoch != epoch) {
     if (HLT_SingleIsoEl8_branch != 0) {
-      HLT_SingleIsoEl8_branch->GetEntry(index);
+      LoadBranch(HLT_SingleIsoEl8_branch);
     } else {
       printf("branch HLT_SingleIsoEl8_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleIsoEl8_isLoaded = true;
+    HLT_SingleIsoEl8_loadedEpoch = epoch;
   }
   return HLT_SingleIsoEl8_;
 }
 
 const int &wwwtree::HLT_SingleIsoEl17() {
-  if (not HLT_SingleIsoEl17_isLoaded) {
+  if (HLT_SingleIsoEl17_loadedEpoch != epoch) {
     if (HLT_SingleIsoEl17_branch != 0) {
-      HLT_SingleIsoEl17_branch->GetEntry(index);
+      LoadBranch(HLT_SingleIsoEl17_branch);
     } else {
       printf("branch HLT_SingleIsoEl17_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleIsoEl17_isLoaded = true;
+    HLT_SingleIsoEl17_loadedEpoch = epoch;
   }
   return HLT_SingleIsoEl17_;
 }
 
 const int &wwwtree::HLT_SingleIsoEl23() {
-  if (not HLT_SingleIsoEl23_isLoaded) {
+  if (HLT_SingleIsoEl23_loadedEpoch != epoch) {
     if (HLT_SingleIsoEl23_branch != 0) {
-      HLT_SingleIsoEl23_branch->GetEntry(index);
+      LoadBranch(HLT_SingleIsoEl23_branch);
     } else {
       printf("branch HLT_SingleIsoEl23_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleIsoEl23_isLoaded = true;
+    HLT_SingleIsoEl23_loadedEpoch = epoch;
   }
   return HLT_SingleIsoEl23_;
 }
 
 const int &wwwtree::HLT_SingleIsoMu8() {
-  if (not HLT_SingleIsoMu8_isLoaded) {
+  if (HLT_SingleIsoMu8_loadedEpoch != epoch) {
     if (HLT_SingleIsoMu8_branch != 0) {
-      HLT_SingleIsoMu8_branch->GetEntry(index);
+      LoadBranch(HLT_SingleIsoMu8_branch);
     } else {
       printf("branch HLT_SingleIsoMu8_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleIsoMu8_isLoaded = true;
+    HLT_SingleIsoMu8_loadedEpoch = epoch;
   }
   return HLT_SingleIsoMu8_;
 }
 
 const int &wwwtree::HLT_SingleIsoMu17() {
-  if (not HLT_SingleIsoMu17_isLoaded) {
+  if (HLT_SingleIsoMu17_loadedEpoch != epoch) {
     if (HLT_SingleIsoMu17_branch != 0) {
-      HLT_SingleIsoMu17_branch->GetEntry(index);
+      LoadBranch(HLT_SingleIsoMu17_branch);
     } else {
       printf("branch HLT_SingleIsoMu17_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleIsoMu17_isLoaded = true;
+    HLT_SingleIsoMu17_loadedEpoch = epoch;
   }
   return HLT_SingleIsoMu17_;
 }
 
 const int &wwwtree::HLT_PFMET140_PFMHT140_IDTight() {
-  if (not HLT_PFMET140_PFMHT140_IDTight_isLoaded) {
+  if (HLT_PFMET140_PFMHT140_IDTight_loadedEpoch != epoch) {
     if (HLT_PFMET140_PFMHT140_IDTight_branch != 0) {
-      HLT_PFMET140_PFMHT140_IDTight_branch->GetEntry(index);
+      LoadBranch(HLT_PFMET140_PFMHT140_IDTight_branch);
     } else {
       printf("branch HLT_PFMET140_PFMHT140_IDTight_branch does not exist!\n");
       exit(1);
     }
-    HLT_PFMET140_PFMHT140_IDTight_isLoaded = true;
+    HLT_PFMET140_PFMHT140_IDTight_loadedEpoch = epoch;
   }
   return HLT_PFMET140_PFMHT140_IDTight_;
 }
 
 const int &wwwtree::mc_HLT_DoubleMu() {
-  if (not mc_HLT_DoubleMu_isLoaded) {
+  if (mc_HLT_DoubleMu_loadedEpoch != epoch) {
     if (mc_HLT_DoubleMu_branch != 0) {
-      mc_HLT_DoubleMu_branch->GetEntry(index);
+      LoadBranch(mc_HLT_DoubleMu_branch);
     } else {
       printf("branch mc_HLT_DoubleMu_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_DoubleMu_isLoaded = true;
+    mc_HLT_DoubleMu_loadedEpoch = epoch;
   }
   return mc_HLT_DoubleMu_;
 }
 
 const int &wwwtree::mc_HLT_DoubleEl() {
-  if (not mc_HLT_DoubleEl_isLoaded) {
+  if (mc_HLT_DoubleEl_loadedEpoch != epoch) {
     if (mc_HLT_DoubleEl_branch != 0) {
-      mc_HLT_DoubleEl_branch->GetEntry(index);
+      LoadBranch(mc_HLT_DoubleEl_branch);
     } else {
       printf("branch mc_HLT_DoubleEl_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_DoubleEl_isLoaded = true;
+    mc_HLT_DoubleEl_loadedEpoch = epoch;
   }
   return mc_HLT_DoubleEl_;
 }
 
 const int &wwwtree::mc_HLT_DoubleEl_DZ() {
-  if (not mc_HLT_DoubleEl_DZ_isLoaded) {
+  if (mc_HLT_DoubleEl_DZ_loadedEpoch != epoch) {
     if (mc_HLT_DoubleEl_DZ_branch != 0) {
-      mc_HLT_DoubleEl_DZ_branch->GetEntry(index);
+      LoadBranch(mc_HLT_DoubleEl_DZ_branch);
     } else {
       printf("branch mc_HLT_DoubleEl_DZ_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_DoubleEl_DZ_isLoaded = true;
+    mc_HLT_DoubleEl_DZ_loadedEpoch = epoch;
   }
   return mc_HLT_DoubleEl_DZ_;
 }
 
 const int &wwwtree::mc_HLT_DoubleEl_DZ_2() {
-  if (not mc_HLT_DoubleEl_DZ_2_isLoaded) {
+  if (mc_HLT_DoubleEl_DZ_2_loadedEpoch != epoch) {
     if (mc_HLT_DoubleEl_DZ_2_branch != 0) {
-      mc_HLT_DoubleEl_DZ_2_branch->GetEntry(index);
+      LoadBranch(mc_HLT_DoubleEl_DZ_2_branch);
     } else {
       printf("branch mc_HLT_DoubleEl_DZ_2_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_DoubleEl_DZ_2_isLoaded = true;
+    mc_HLT_DoubleEl_DZ_2_loadedEpoch = epoch;
   }
   return mc_HLT_DoubleEl_DZ_2_;
 }
 
 const int &wwwtree::mc_HLT_MuEG() {
-  if (not mc_HLT_MuEG_isLoaded) {
+  if (mc_HLT_MuEG_loadedEpoch != epoch) {
     if (mc_HLT_MuEG_branch != 0) {
-      mc_HLT_MuEG_branch->GetEntry(index);
+      LoadBranch(mc_HLT_MuEG_branch);
     } else {
       printf("branch mc_HLT_MuEG_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_MuEG_isLoaded = true;
+    mc_HLT_MuEG_loadedEpoch = epoch;
   }
   return mc_HLT_MuEG_;
 }
 
 const int &wwwtree::mc_HLT_SingleEl8() {
-  if (not mc_HLT_SingleEl8_isLoaded) {
+  if (mc_HLT_SingleEl8_loadedEpoch != epoch) {
     if (mc_HLT_SingleEl8_branch != 0) {
-      mc_HLT_SingleEl8_branch->GetEntry(index);
+      LoadBranch(mc_HLT_SingleEl8_branch);
     } else {
       printf("branch mc_HLT_SingleEl8_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_SingleEl8_isLoaded = true;
+    mc_HLT_SingleEl8_loadedEpoch = epoch;
   }
   return mc_HLT_SingleEl8_;
 }
 
 const int &wwwtree::mc_HLT_SingleEl17() {
-  if (not mc_HLT_SingleEl17_isLoaded) {
+  if (mc_HLT_SingleEl17_loadedEpoch != epoch) {
     if (mc_HLT_SingleEl17_branch != 0) {
-      mc_HLT_SingleEl17_branch->GetEntry(index);
+      LoadBranch(mc_HLT_SingleEl17_branch);
     } else {
       printf("branch mc_HLT_SingleEl17_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_SingleEl17_isLoaded = true;
+    mc_HLT_SingleEl17_loadedEpoch = epoch;
   }
   return mc_HLT_SingleEl17_;
 }
 
 const int &wwwtree::mc_HLT_SingleIsoEl8() {
-  if (not mc_HLT_SingleIsoEl8_isLoaded) {
+  if (mc_HLT_SingleIsoEl8_loadedEpoch != epoch) {
     if (mc_HLT_SingleIsoEl8_branch != 0) {
-      mc_HLT_SingleIsoEl8_branch->GetEntry(index);
+      LoadBranch(mc_HLT_SingleIsoEl8_branch);
     } else {
       printf("branch mc_HLT_SingleIsoEl8_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_SingleIsoEl8_isLoaded = true;
+    mc_HLT_SingleIsoEl8_loadedEpoch = epoch;
   }
   return mc_HLT_SingleIsoEl8_;
 }
 
 const int &wwwtree::mc_HLT_SingleIsoEl17() {
-  if (not mc_HLT_SingleIsoEl17_isLoaded) {
+  if (mc_HLT_SingleIsoEl17_loadedEpoch != epoch) {
     if (mc_HLT_SingleIsoEl17_branch != 0) {
-      mc_HLT_SingleIsoEl17_branch->GetEntry(index);
+      LoadBranch(mc_HLT_SingleIsoEl17_branch);
     } else {
       printf("branch mc_HLT_SingleIsoEl17_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_SingleIsoEl17_isLoaded = true;
+    mc_HLT_SingleIsoEl17_loadedEpoch = epoch;
   }
   return mc_HLT_SingleIsoEl17_;
 }
 
 const int &wwwtree::mc_HLT_SingleIsoEl23() {
-  if (not mc_HLT_SingleIsoEl23_isLoaded) {
+  if (mc_HLT_SingleIsoEl23_loadedEpoch != epoch) {
     if (mc_HLT_SingleIsoEl23_branch != 0) {
-      mc_HLT_SingleIsoEl23_branch->GetEntry(index);
+      LoadBranch(mc_HLT_SingleIsoEl23_branch);
     } else {
       printf("branch mc_HLT_SingleIsoEl23_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_SingleIsoEl23_isLoaded = true;
+    mc_HLT_SingleIsoEl23_loadedEpoch = epoch;
   }
   return mc_HLT_SingleIsoEl23_;
 }
 
 const int &wwwtree::mc_HLT_SingleIsoMu8() {
-  if (not mc_HLT_SingleIsoMu8_isLoaded) {
+  if (mc_HLT_SingleIsoMu8_loadedEpoch != epoch) {
     if (mc_HLT_SingleIsoMu8_branch != 0) {
-      mc_HLT_SingleIsoMu8_branch->GetEntry(index);
+      LoadBranch(mc_HLT_SingleIsoMu8_branch);
     } else {
       printf("branch mc_HLT_SingleIsoMu8_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_SingleIsoMu8_isLoaded = true;
+    mc_HLT_SingleIsoMu8_loadedEpoch = epoch;
   }
   return mc_HLT_SingleIsoMu8_;
 }
 
 const int &wwwtree::mc_HLT_SingleIsoMu17() {
-  if (not mc_HLT_SingleIsoMu17_isLoaded) {
+  if (mc_HLT_SingleIsoMu17_loadedEpoch != epoch) {
     if (mc_HLT_SingleIsoMu17_branch != 0) {
-      mc_HLT_SingleIsoMu17_branch->GetEntry(index);
+      LoadBranch(mc_HLT_SingleIsoMu17_branch);
     } else {
       printf("branch mc_HLT_SingleIsoMu17_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_SingleIsoMu17_isLoaded = true;
+    mc_HLT_SingleIsoMu17_loadedEpoch = epoch;
   }
   return mc_HLT_SingleIsoMu17_;
 }
 
 const int &wwwtree::mc_HLT_PFMET140_PFMHT140_IDTight() {
-  if (not mc_HLT_PFMET140_PFMHT140_IDTight_isLoaded) {
+  if (mc_HLT_PFMET140_PFMHT140_IDTight_loadedEpoch != epoch) {
     if (mc_HLT_PFMET140_PFMHT140_IDTight_branch != 0) {
-      mc_HLT_PFMET140_PFMHT140_IDTight_branch->GetEntry(index);
+      LoadBranch(mc_HLT_PFMET140_PFMHT140_IDTight_branch);
     } else {
       printf("branch mc_HLT_PFMET140_PFMHT140_IDTight_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_PFMET140_PFMHT140_IDTight_isLoaded = true;
+    mc_HLT_PFMET140_PFMHT140_IDTight_loadedEpoch = epoch;
   }
   return mc_HLT_PFMET140_PFMHT140_IDTight_;
 }
 
 const int &wwwtree::pass_duplicate_ee_em_mm() {
-  if (not pass_duplicate_ee_em_mm_isLoaded) {
+  if (pass_duplicate_ee_em_mm_loadedEpoch != epoch) {
     if (pass_duplicate_ee_em_mm_branch != 0) {
-      pass_duplicate_ee_em_mm_branch->GetEntry(index);
+      LoadBranch(pass_duplicate_ee_em_mm_branch);
     } else {
       printf("branch pass_duplicate_ee_em_mm_branch does not exist!\n");
       exit(1);
     }
-    pass_duplicate_ee_em_mm_isLoaded = true;
+    pass_duplicate_ee_em_mm_loadedEpoch = epoch;
   }
   return pass_duplicate_ee_em_mm_;
 }
 
 const int &wwwtree::pass_duplicate_mm_em_ee() {
-  if (not pass_duplicate_mm_em_ee_isLoaded) {
+  if (pass_duplicate_mm_em_ee_loadedEpoch != epoch) {
     if (pass_duplicate_mm_em_ee_branch != 0) {
-      pass_duplicate_mm_em_ee_branch->GetEntry(index);
+      LoadBranch(pass_duplicate_mm_em_ee_branch);
     } else {
       printf("branch pass_duplicate_mm_em_ee_branch does not exist!\n");
       exit(1);
     }
-    pass_duplicate_mm_em_ee_isLoaded = true;
+    pass_duplicate_mm_em_ee_loadedEpoch = epoch;
   }
   return pass_duplicate_mm_em_ee_;
 }
 
 const int &wwwtree::is2016() {
-  if (not is2016_isLoaded) {
+  if (is2016_loadedEpoch != epoch) {
     if (is2016_branch != 0) {
-      is2016_branch->GetEntry(index);
+      LoadBranch(is2016_branch);
     } else {
       printf("branch is2016_branch does not exist!\n");
       exit(1);
     }
-    is2016_isLoaded = true;
+    is2016_loadedEpoch = epoch;
   }
   return is2016_;
 }
 
 const int &wwwtree::is2017() {
-  if (not is2017_isLoaded) {
+  if (is2017_loadedEpoch != epoch) {
     if (is2017_branch != 0) {
-      is2017_branch->GetEntry(index);
+      LoadBranch(is2017_branch);
     } else {
       printf("branch is2017_branch does not exist!\n");
       exit(1);
     }
-    is2017_isLoaded = true;
+    is2017_loadedEpoch = epoch;
   }
   return is2017_;
 }
 
 const int &wwwtree::HLT_MuEG_2016() {
-  if (not HLT_MuEG_2016_isLoaded) {
+  if (HLT_MuEG_2016_loadedEpoch != epoch) {
     if (HLT_MuEG_2016_branch != 0) {
-      HLT_MuEG_2016_branch->GetEntry(index);
+      LoadBranch(HLT_MuEG_2016_branch);
     } else {
       printf("branch HLT_MuEG_2016_branch does not exist!\n");
       exit(1);
     }
-    HLT_MuEG_2016_isLoaded = true;
+    HLT_MuEG_2016_loadedEpoch = epoch;
   }
   return HLT_MuEG_2016_;
 }
 
 const int &wwwtree::mc_HLT_MuEG_2016() {
-  if (not mc_HLT_MuEG_2016_isLoaded) {
+  if (mc_HLT_MuEG_2016_loadedEpoch != epoch) {
     if (mc_HLT_MuEG_2016_branch != 0) {
-      mc_HLT_MuEG_2016_branch->GetEntry(index);
+      LoadBranch(mc_HLT_MuEG_2016_branch);
     } else {
       printf("branch mc_HLT_MuEG_2016_branch does not exist!\n");
       exit(1);
     }
-    mc_HLT_MuEG_2016_isLoaded = true;
+    mc_HLT_MuEG_2016_loadedEpoch = epoch;
   }
   return mc_HLT_MuEG_2016_;
 }
 
 const int &wwwtree::pass_duplicate_ee_em2016_mm() {
-  if (not pass_duplicate_ee_em2016_mm_isLoaded) {
+  if (pass_duplicate_ee_em2016_mm_loadedEpoch != epoch) {
     if (pass_duplicate_ee_em2016_mm_branch != 0) {
-      pass_duplicate_ee_em2016_mm_branch->GetEntry(index);
+      LoadBranch(pass_duplicate_ee_em2016_mm_branch);
     } else {
       printf("branch pass_duplicate_ee_em2016_mm_branch does not exist!\n");
       exit(1);
     }
-    pass_duplicate_ee_em2016_mm_isLoaded = true;
+    pass_duplicate_ee_em2016_mm_loadedEpoch = epoch;
   }
   return pass_duplicate_ee_em2016_mm_;
 }
 
 const int &wwwtree::pass_duplicate_mm_em2016_ee() {
-  if (not pass_duplicate_mm_em2016_ee_isLoaded) {
+  if (pass_duplicate_mm_em2016_ee_loadedEpoch != epoch) {
     if (pass_duplicate_mm_em2016_ee_branch != 0) {
-      pass_duplicate_mm_em2016_ee_branch->GetEntry(index);
+      LoadBranch(pass_duplicate_mm_em2016_ee_branch);
     } else {
       printf("branch pass_duplicate_mm_em2016_ee_branch does not exist!\n");
       exit(1);
     }
-    pass_duplicate_mm_em2016_ee_isLoaded = true;
+    pass_duplicate_mm_em2016_ee_loadedEpoch = epoch;
   }
   return pass_duplicate_mm_em2016_ee_;
 }
 
 const int &wwwtree::passTrigger() {
-  if (not passTrigger_isLoaded) {
+  if (passTrigger_loadedEpoch != epoch) {
     if (passTrigger_branch != 0) {
-      passTrigger_branch->GetEntry(index);
+      LoadBranch(passTrigger_branch);
     } else {
       printf("branch passTrigger_branch does not exist!\n");
       exit(1);
     }
-    passTrigger_isLoaded = true;
+    passTrigger_loadedEpoch = epoch;
   }
   return passTrigger_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::lep_p4() {
-  if (not lep_p4_isLoaded) {
+  if (lep_p4_loadedEpoch != epoch) {
     if (lep_p4_branch != 0) {
-      lep_p4_branch->GetEntry(index);
+      LoadBranch(lep_p4_branch);
     } else {
       printf("branch lep_p4_branch does not exist!\n");
       exit(1);
     }
-    lep_p4_isLoaded = true;
+    lep_p4_loadedEpoch = epoch;
   }
   return *lep_p4_;
 }
 
 const vector<float> &wwwtree::lep_pt() {
-  if (not lep_pt_isLoaded) {
+  if (lep_pt_loadedEpoch != epoch) {
     if (lep_pt_branch != 0) {
-      lep_pt_branch->GetEntry(index);
+      LoadBranch(lep_pt_branch);
     } else {
       printf("branch lep_pt_branch does not exist!\n");
       exit(1);
     }
-    lep_pt_isLoaded = true;
+    lep_pt_loadedEpoch = epoch;
   }
   return *lep_pt_;
 }
 
 const vector<float> &wwwtree::lep_eta() {
-  if (not lep_eta_isLoaded) {
+  if (lep_eta_loadedEpoch != epoch) {
     if (lep_eta_branch != 0) {
-      lep_eta_branch->GetEntry(index);
+      LoadBranch(lep_eta_branch);
     } else {
       printf("branch lep_eta_branch does not exist!\n");
       exit(1);
     }
-    lep_eta_isLoaded = true;
+    lep_eta_loadedEpoch = epoch;
   }
   return *lep_eta_;
 }
 
 const vector<float> &wwwtree::lep_phi() {
-  if (not lep_phi_isLoaded) {
+  if (lep_phi_loadedEpoch != epoch) {
     if (lep_phi_branch != 0) {
-      lep_phi_branch->GetEntry(index);
+      LoadBranch(lep_phi_branch);
     } else {
       printf("branch lep_phi_branch does not exist!\n");
       exit(1);
     }
-    lep_phi_isLoaded = true;
+    lep_phi_loadedEpoch = epoch;
   }
   return *lep_phi_;
 }
 
 const vector<float> &wwwtree::lep_coneCorrPt() {
-  if (not lep_coneCorrPt_isLoaded) {
+  if (lep_coneCorrPt_loadedEpoch != epoch) {
     if (lep_coneCorrPt_branch != 0) {
-      lep_coneCorrPt_branch->GetEntry(index);
+      LoadBranch(lep_coneCorrPt_branch);
     } else {
       printf("branch lep_coneCorrPt_branch does not exist!\n");
       exit(1);
     }
-    lep_coneCorrPt_isLoaded = true;
+    lep_coneCorrPt_loadedEpoch = epoch;
   }
   return *lep_coneCorrPt_;
 }
 
 const vector<float> &wwwtree::lep_ip3d() {
-  if (not lep_ip3d_isLoaded) {
+  if (lep_ip3d_loadedEpoch != epoch) {
     if (lep_ip3d_branch != 0) {
-      lep_ip3d_branch->GetEntry(index);
+      LoadBranch(lep_ip3d_branch);
     } else {
       printf("branch lep_ip3d_branch does not exist!\n");
       exit(1);
     }
-    lep_ip3d_isLoaded = true;
+    lep_ip3d_loadedEpoch = epoch;
   }
   return *lep_ip3d_;
 }
 
 const vector<float> &wwwtree::lep_ip3derr() {
-  if (not lep_ip3derr_isLoaded) {
+  if (lep_ip3derr_loadedEpoch != epoch) {
     if (lep_ip3derr_branch != 0) {
-      lep_ip3derr_branch->GetEntry(index);
+      LoadBranch(lep_ip3derr_branch);
     } else {
       printf("branch lep_ip3derr_branch does not exist!\n");
       exit(1);
     }
-    lep_ip3derr_isLoaded = true;
+    lep_ip3derr_loadedEpoch = epoch;
   }
   return *lep_ip3derr_;
 }
 
 const vector<int> &wwwtree::lep_isTriggerSafe_v1() {
-  if (not lep_isTriggerSafe_v1_isLoaded) {
+  if (lep_isTriggerSafe_v1_loadedEpoch != epoch) {
     if (lep_isTriggerSafe_v1_branch != 0) {
-      lep_isTriggerSafe_v1_branch->GetEntry(index);
+      LoadBranch(lep_isTriggerSafe_v1_branch);
     } else {
       printf("branch lep_isTriggerSafe_v1_branch does not exist!\n");
       exit(1);
     }
-    lep_isTriggerSafe_v1_isLoaded = true;
+    lep_isTriggerSafe_v1_loadedEpoch = epoch;
   }
   return *lep_isTriggerSafe_v1_;
 }
 
 const vector<int> &wwwtree::lep_lostHits() {
-  if (not lep_lostHits_isLoaded) {
+  if (lep_lostHits_loadedEpoch != epoch) {
     if (lep_lostHits_branch != 0) {
-      lep_lostHits_branch->GetEntry(index);
+      LoadBranch(lep_lostHits_branch);
     } else {
       printf("branch lep_lostHits_branch does not exist!\n");
       exit(1);
     }
-    lep_lostHits_isLoaded = true;
+    lep_lostHits_loadedEpoch = epoch;
   }
   return *lep_lostHits_;
 }
 
 const vector<int> &wwwtree::lep_convVeto() {
-  if (not lep_convVeto_isLoaded) {
+  if (lep_convVeto_loadedEpoch != epoch) {
     if (lep_convVeto_branch != 0) {
-      lep_convVeto_branch->GetEntry(index);
+      LoadBranch(lep_convVeto_branch);
     } else {
       printf("branch lep_convVeto_branch does not exist!\n");
       exit(1);
     }
-    lep_convVeto_isLoaded = true;
+    lep_convVeto_loadedEpoch = epoch;
   }
   return *lep_convVeto_;
 }
 
 const vector<int> &wwwtree::lep_motherIdSS() {
-  if (not lep_motherIdSS_isLoaded) {
+  if (lep_motherIdSS_loadedEpoch != epoch) {
     if (lep_motherIdSS_branch != 0) {
-      lep_motherIdSS_branch->GetEntry(index);
+      LoadBranch(lep_motherIdSS_branch);
     } else {
       printf("branch lep_motherIdSS_branch does not exist!\n");
       exit(1);
     }
-    lep_motherIdSS_isLoaded = true;
+    lep_motherIdSS_loadedEpoch = epoch;
   }
   return *lep_motherIdSS_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_3l_fo() {
-  if (not lep_pass_VVV_cutbased_3l_fo_isLoaded) {
+  if (lep_pass_VVV_cutbased_3l_fo_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_3l_fo_branch != 0) {
-      lep_pass_VVV_cutbased_3l_fo_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_3l_fo_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_3l_fo_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_3l_fo_isLoaded = true;
+    lep_pass_VVV_cutbased_3l_fo_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_3l_fo_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_3l_tight() {
-  if (not lep_pass_VVV_cutbased_3l_tight_isLoaded) {
+  if (lep_pass_VVV_cutbased_3l_tight_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_3l_tight_branch != 0) {
-      lep_pass_VVV_cutbased_3l_tight_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_3l_tight_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_3l_tight_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_3l_tight_isLoaded = true;
+    lep_pass_VVV_cutbased_3l_tight_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_3l_tight_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_fo() {
-  if (not lep_pass_VVV_cutbased_fo_isLoaded) {
+  if (lep_pass_VVV_cutbased_fo_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_fo_branch != 0) {
-      lep_pass_VVV_cutbased_fo_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_fo_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_fo_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_fo_isLoaded = true;
+    lep_pass_VVV_cutbased_fo_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_fo_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_tight() {
-  if (not lep_pass_VVV_cutbased_tight_isLoaded) {
+  if (lep_pass_VVV_cutbased_tight_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_tight_branch != 0) {
-      lep_pass_VVV_cutbased_tight_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_tight_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_tight_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_tight_isLoaded = true;
+    lep_pass_VVV_cutbased_tight_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_tight_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_veto() {
-  if (not lep_pass_VVV_cutbased_veto_isLoaded) {
+  if (lep_pass_VVV_cutbased_veto_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_veto_branch != 0) {
-      lep_pass_VVV_cutbased_veto_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_veto_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_veto_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_veto_isLoaded = true;
+    lep_pass_VVV_cutbased_veto_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_veto_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_fo_noiso() {
-  if (not lep_pass_VVV_cutbased_fo_noiso_isLoaded) {
+  if (lep_pass_VVV_cutbased_fo_noiso_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_fo_noiso_branch != 0) {
-      lep_pass_VVV_cutbased_fo_noiso_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_fo_noiso_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_fo_noiso_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_fo_noiso_isLoaded = true;
+    lep_pass_VVV_cutbased_fo_noiso_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_fo_noiso_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_tight_noiso() {
-  if (not lep_pass_VVV_cutbased_tight_noiso_isLoaded) {
+  if (lep_pass_VVV_cutbased_tight_noiso_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_tight_noiso_branch != 0) {
-      lep_pass_VVV_cutbased_tight_noiso_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_tight_noiso_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_tight_noiso_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_tight_noiso_isLoaded = true;
+    lep_pass_VVV_cutbased_tight_noiso_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_tight_noiso_;
 }
 
 const vector<int> &wwwtree::lep_pass_VVV_cutbased_veto_noiso() {
-  if (not lep_pass_VVV_cutbased_veto_noiso_isLoaded) {
+  if (lep_pass_VVV_cutbased_veto_noiso_loadedEpoch != epoch) {
     if (lep_pass_VVV_cutbased_veto_noiso_branch != 0) {
-      lep_pass_VVV_cutbased_veto_noiso_branch->GetEntry(index);
+      LoadBranch(lep_pass_VVV_cutbased_veto_noiso_branch);
     } else {
       printf("branch lep_pass_VVV_cutbased_veto_noiso_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_VVV_cutbased_veto_noiso_isLoaded = true;
+    lep_pass_VVV_cutbased_veto_noiso_loadedEpoch = epoch;
   }
   return *lep_pass_VVV_cutbased_veto_noiso_;
 }
 
 const vector<int> &wwwtree::lep_pass_POG_veto() {
-  if (not lep_pass_POG_veto_isLoaded) {
+  if (lep_pass_POG_veto_loadedEpoch != epoch) {
     if (lep_pass_POG_veto_branch != 0) {
-      lep_pass_POG_veto_branch->GetEntry(index);
+      LoadBranch(lep_pass_POG_veto_branch);
     } else {
       printf("branch lep_pass_POG_veto_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_POG_veto_isLoaded = true;
+    lep_pass_POG_veto_loadedEpoch = epoch;
   }
   return *lep_pass_POG_veto_;
 }
 
 const vector<int> &wwwtree::lep_pass_POG_loose() {
-  if (not lep_pass_POG_loose_isLoaded) {
+  if (lep_pass_POG_loose_loadedEpoch != epoch) {
     if (lep_pass_POG_loose_branch != 0) {
-      lep_pass_POG_loose_branch->GetEntry(index);
+      LoadBranch(lep_pass_POG_loose_branch);
     } else {
       printf("branch lep_pass_POG_loose_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_POG_loose_isLoaded = true;
+    lep_pass_POG_loose_loadedEpoch = epoch;
   }
   return *lep_pass_POG_loose_;
 }
 
 const vector<int> &wwwtree::lep_pass_POG_medium() {
-  if (not lep_pass_POG_medium_isLoaded) {
+  if (lep_pass_POG_medium_loadedEpoch != epoch) {
     if (lep_pass_POG_medium_branch != 0) {
-      lep_pass_POG_medium_branch->GetEntry(index);
+      LoadBranch(lep_pass_POG_medium_branch);
     } else {
       printf("branch lep_pass_POG_medium_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_POG_medium_isLoaded = true;
+    lep_pass_POG_medium_loadedEpoch = epoch;
   }
   return *lep_pass_POG_medium_;
 }
 
 const vector<int> &wwwtree::lep_pass_POG_tight() {
-  if (not lep_pass_POG_tight_isLoaded) {
+  if (lep_pass_POG_tight_loadedEpoch != epoch) {
     if (lep_pass_POG_tight_branch != 0) {
-      lep_pass_POG_tight_branch->GetEntry(index);
+      LoadBranch(lep_pass_POG_tight_branch);
     } else {
       printf("branch lep_pass_POG_tight_branch does not exist!\n");
       exit(1);
     }
-    lep_pass_POG_tight_isLoaded = true;
+    lep_pass_POG_tight_loadedEpoch = epoch;
   }
   return *lep_pass_POG_tight_;
 }
 
 const vector<int> &wwwtree::lep_pdgId() {
-  if (not lep_pdgId_isLoaded) {
+  if (lep_pdgId_loadedEpoch != epoch) {
     if (lep_pdgId_branch != 0) {
-      lep_pdgId_branch->GetEntry(index);
+      LoadBranch(lep_pdgId_branch);
     } else {
       printf("branch lep_pdgId_branch does not exist!\n");
       exit(1);
     }
-    lep_pdgId_isLoaded = true;
+    lep_pdgId_loadedEpoch = epoch;
   }
   return *lep_pdgId_;
 }
 
 const vector<float> &wwwtree::lep_dxy() {
-  if (not lep_dxy_isLoaded) {
+  if (lep_dxy_loadedEpoch != epoch) {
     if (lep_dxy_branch != 0) {
-      lep_dxy_branch->GetEntry(index);
+      LoadBranch(lep_dxy_branch);
     } else {
       printf("branch lep_dxy_branch does not exist!\n");
       exit(1);
     }
-    lep_dxy_isLoaded = true;
+    lep_dxy_loadedEpoch = epoch;
   }
   return *lep_dxy_;
 }
 
 const vector<float> &wwwtree::lep_dz() {
-  if (not lep_dz_isLoaded) {
+  if (lep_dz_loadedEpoch != epoch) {
     if (lep_dz_branch != 0) {
-      lep_dz_branch->GetEntry(index);
+      LoadBranch(lep_dz_branch);
     } else {
       printf("branch lep_dz_branch does not exist!\n");
       exit(1);
     }
-    lep_dz_isLoaded = true;
+    lep_dz_loadedEpoch = epoch;
   }
   return *lep_dz_;
 }
 
 const vector<float> &wwwtree::lep_pterr() {
-  if (not lep_pterr_isLoaded) {
+  if (lep_pterr_loadedEpoch != epoch) {
     if (lep_pterr_branch != 0) {
-      lep_pterr_branch->GetEntry(index);
+      LoadBranch(lep_pterr_branch);
     } else {
       printf("branch lep_pterr_branch does not exist!\n");
       exit(1);
     }
-    lep_pterr_isLoaded = true;
+    lep_pterr_loadedEpoch = epoch;
   }
   return *lep_pterr_;
 }
 
 const vector<float> &wwwtree::lep_relIso04DB() {
-  if (not lep_relIso04DB_isLoaded) {
+  if (lep_relIso04DB_loadedEpoch != epoch) {
     if (lep_relIso04DB_branch != 0) {
-      lep_relIso04DB_branch->GetEntry(index);
+      LoadBranch(lep_relIso04DB_branch);
     } else {
       printf("branch lep_relIso04DB_branch does not exist!\n");
       exit(1);
     }
-    lep_relIso04DB_isLoaded = true;
+    lep_relIso04DB_loadedEpoch = epoch;
   }
   return *lep_relIso04DB_;
 }
 
 const vector<float> &wwwtree::lep_relIso03EA() {
-  if (not lep_relIso03EA_isLoaded) {
+  if (lep_relIso03EA_loadedEpoch != epoch) {
     if (lep_relIso03EA_branch != 0) {
-      lep_relIso03EA_branch->GetEntry(index);
+      LoadBranch(lep_relIso03EA_branch);
     } else {
       printf("branch lep_relIso03EA_branch does not exist!\n");
       exit(1);
     }
-    lep_relIso03EA_isLoaded = true;
+    lep_relIso03EA_loadedEpoch = epoch;
   }
   return *lep_relIso03EA_;
 }
 
 const vector<float> &wwwtree::lep_relIso03EALep() {
-  if (not lep_relIso03EALep_isLoaded) {
+  if (lep_relIso03EALep_loadedEpoch != epoch) {
     if (lep_relIso03EALep_branch != 0) {
-      lep_relIso03EALep_branch->GetEntry(index);
+      LoadBranch(lep_relIso03EALep_branch);
     } else {
       printf("branch lep_relIso03EALep_branch does not exist!\n");
       exit(1);
     }
-    lep_relIso03EALep_isLoaded = true;
+    lep_relIso03EALep_loadedEpoch = epoch;
   }
   return *lep_relIso03EALep_;
 }
 
 const vector<float> &wwwtree::lep_relIso03EAv2() {
-  if (not lep_relIso03EAv2_isLoaded) {
+  if (lep_relIso03EAv2_loadedEpoch != epoch) {
     if (lep_relIso03EAv2_branch != 0) {
-      lep_relIso03EAv2_branch->GetEntry(index);
+      LoadBranch(lep_relIso03EAv2_branch);
     } else {
       printf("branch lep_relIso03EAv2_branch does not exist!\n");
       exit(1);
     }
-    lep_relIso03EAv2_isLoaded = true;
+    lep_relIso03EAv2_loadedEpoch = epoch;
   }
   return *lep_relIso03EAv2_;
 }
 
 const vector<float> &wwwtree::lep_relIso04EAv2() {
-  if (not lep_relIso04EAv2_isLoaded) {
+  if (lep_relIso04EAv2_loadedEpoch != epoch) {
     if (lep_relIso04EAv2_branch != 0) {
-      lep_relIso04EAv2_branch->GetEntry(index);
+      LoadBranch(lep_relIso04EAv2_branch);
     } else {
       printf("branch lep_relIso04EAv2_branch does not exist!\n");
       exit(1);
     }
-    lep_relIso04EAv2_isLoaded = true;
+    lep_relIso04EAv2_loadedEpoch = epoch;
   }
   return *lep_relIso04EAv2_;
 }
 
 const vector<float> &wwwtree::lep_relIso03EAv2Lep() {
-  if (not lep_relIso03EAv2Lep_isLoaded) {
+  if (lep_relIso03EAv2Lep_loadedEpoch != epoch) {
     if (lep_relIso03EAv2Lep_branch != 0) {
-      lep_relIso03EAv2Lep_branch->GetEntry(index);
+      LoadBranch(lep_relIso03EAv2Lep_branch);
     } else {
       printf("branch lep_relIso03EAv2Lep_branch does not exist!\n");
       exit(1);
     }
-    lep_relIso03EAv2Lep_isLoaded = true;
+    lep_relIso03EAv2Lep_loadedEpoch = epoch;
   }
   return *lep_relIso03EAv2Lep_;
 }
 
 const vector<int> &wwwtree::lep_tightCharge() {
-  if (not lep_tightCharge_isLoaded) {
+  if (lep_tightCharge_loadedEpoch != epoch) {
     if (lep_tightCharge_branch != 0) {
-      lep_tightCharge_branch->GetEntry(index);
+      LoadBranch(lep_tightCharge_branch);
     } else {
       printf("branch lep_tightCharge_branch does not exist!\n");
       exit(1);
     }
-    lep_tightCharge_isLoaded = true;
+    lep_tightCharge_loadedEpoch = epoch;
   }
   return *lep_tightCharge_;
 }
 
 const vector<float> &wwwtree::lep_trk_pt() {
-  if (not lep_trk_pt_isLoaded) {
+  if (lep_trk_pt_loadedEpoch != epoch) {
     if (lep_trk_pt_branch != 0) {
-      lep_trk_pt_branch->GetEntry(index);
+      LoadBranch(lep_trk_pt_branch);
     } else {
       printf("branch lep_trk_pt_branch does not exist!\n");
       exit(1);
     }
-    lep_trk_pt_isLoaded = true;
+    lep_trk_pt_loadedEpoch = epoch;
   }
   return *lep_trk_pt_;
 }
 
 const vector<int> &wwwtree::lep_charge() {
-  if (not lep_charge_isLoaded) {
+  if (lep_charge_loadedEpoch != epoch) {
     if (lep_charge_branch != 0) {
-      lep_charge_branch->GetEntry(index);
+      LoadBranch(lep_charge_branch);
     } else {
       printf("branch lep_charge_branch does not exist!\n");
       exit(1);
     }
-    lep_charge_isLoaded = true;
+    lep_charge_loadedEpoch = epoch;
   }
   return *lep_charge_;
 }
 
 const vector<float> &wwwtree::lep_etaSC() {
-  if (not lep_etaSC_isLoaded) {
+  if (lep_etaSC_loadedEpoch != epoch) {
     if (lep_etaSC_branch != 0) {
-      lep_etaSC_branch->GetEntry(index);
+      LoadBranch(lep_etaSC_branch);
     } else {
       printf("branch lep_etaSC_branch does not exist!\n");
       exit(1);
     }
-    lep_etaSC_isLoaded = true;
+    lep_etaSC_loadedEpoch = epoch;
   }
   return *lep_etaSC_;
 }
 
 const vector<float> &wwwtree::lep_MVA() {
-  if (not lep_MVA_isLoaded) {
+  if (lep_MVA_loadedEpoch != epoch) {
     if (lep_MVA_branch != 0) {
-      lep_MVA_branch->GetEntry(index);
+      LoadBranch(lep_MVA_branch);
     } else {
       printf("branch lep_MVA_branch does not exist!\n");
       exit(1);
     }
-    lep_MVA_isLoaded = true;
+    lep_MVA_loadedEpoch = epoch;
   }
   return *lep_MVA_;
 }
 
 const vector<int> &wwwtree::lep_isMediumPOG() {
-  if (not lep_isMediumPOG_isLoaded) {
+  if (lep_isMediumPOG_loadedEpoch != epoch) {
     if (lep_isMediumPOG_branch != 0) {
-      lep_isMediumPOG_branch->GetEntry(index);
+      LoadBranch(lep_isMediumPOG_branch);
     } else {
       printf("branch lep_isMediumPOG_branch does not exist!\n");
       exit(1);
     }
-    lep_isMediumPOG_isLoaded = true;
+    lep_isMediumPOG_loadedEpoch = epoch;
   }
   return *lep_isMediumPOG_;
 }
 
 const vector<int> &wwwtree::lep_isTightPOG() {
-  if (not lep_isTightPOG_isLoaded) {
+  if (lep_isTightPOG_loadedEpoch != epoch) {
     if (lep_isTightPOG_branch != 0) {
-      lep_isTightPOG_branch->GetEntry(index);
+      LoadBranch(lep_isTightPOG_branch);
     } else {
       printf("branch lep_isTightPOG_branch does not exist!\n");
       exit(1);
     }
-    lep_isTightPOG_isLoaded = true;
+    lep_isTightPOG_loadedEpoch = epoch;
   }
   return *lep_isTightPOG_;
 }
 
 const vector<int> &wwwtree::lep_isFromW() {
-  if (not lep_isFromW_isLoaded) {
+  if (lep_isFromW_loadedEpoch != epoch) {
     if (lep_isFromW_branch != 0) {
-      lep_isFromW_branch->GetEntry(index);
+      LoadBranch(lep_isFromW_branch);
     } else {
       printf("branch lep_isFromW_branch does not exist!\n");
       exit(1);
     }
-    lep_isFromW_isLoaded = true;
+    lep_isFromW_loadedEpoch = epoch;
   }
   return *lep_isFromW_;
 }
 
 const vector<int> &wwwtree::lep_isFromZ() {
-  if (not lep_isFromZ_isLoaded) {
+  if (lep_isFromZ_loadedEpoch != epoch) {
     if (lep_isFromZ_branch != 0) {
-      lep_isFromZ_branch->GetEntry(index);
+      LoadBranch(lep_isFromZ_branch);
     } else {
       printf("branch lep_isFromZ_branch does not exist!\n");
       exit(1);
     }
-    lep_isFromZ_isLoaded = true;
+    lep_isFromZ_loadedEpoch = epoch;
   }
   return *lep_isFromZ_;
 }
 
 const vector<int> &wwwtree::lep_isFromB() {
-  if (not lep_isFromB_isLoaded) {
+  if (lep_isFromB_loadedEpoch != epoch) {
     if (lep_isFromB_branch != 0) {
-      lep_isFromB_branch->GetEntry(index);
+      LoadBranch(lep_isFromB_branch);
     } else {
       printf("branch lep_isFromB_branch does not exist!\n");
       exit(1);
     }
-    lep_isFromB_isLoaded = true;
+    lep_isFromB_loadedEpoch = epoch;
   }
   return *lep_isFromB_;
 }
 
 const vector<int> &wwwtree::lep_isFromC() {
-  if (not lep_isFromC_isLoaded) {
+  if (lep_isFromC_loadedEpoch != epoch) {
     if (lep_isFromC_branch != 0) {
-      lep_isFromC_branch->GetEntry(index);
+      LoadBranch(lep_isFromC_branch);
     } else {
       printf("branch lep_isFromC_branch does not exist!\n");
       exit(1);
     }
-    lep_isFromC_isLoaded = true;
+    lep_isFromC_loadedEpoch = epoch;
   }
   return *lep_isFromC_;
 }
 
 const vector<int> &wwwtree::lep_isFromL() {
-  if (not lep_isFromL_isLoaded) {
+  if (lep_isFromL_loadedEpoch != epoch) {
     if (lep_isFromL_branch != 0) {
-      lep_isFromL_branch->GetEntry(index);
+      LoadBranch(lep_isFromL_branch);
     } else {
       printf("branch lep_isFromL_branch does not exist!\n");
       exit(1);
     }
-    lep_isFromL_isLoaded = true;
+    lep_isFromL_loadedEpoch = epoch;
   }
   return *lep_isFromL_;
 }
 
 const vector<int> &wwwtree::lep_isFromLF() {
-  if (not lep_isFromLF_isLoaded) {
+  if (lep_isFromLF_loadedEpoch != epoch) {
     if (lep_isFromLF_branch != 0) {
-      lep_isFromLF_branch->GetEntry(index);
+      LoadBranch(lep_isFromLF_branch);
     } else {
       printf("branch lep_isFromLF_branch does not exist!\n");
       exit(1);
     }
-    lep_isFromLF_isLoaded = true;
+    lep_isFromLF_loadedEpoch = epoch;
   }
   return *lep_isFromLF_;
 }
 
 const vector<int> &wwwtree::lep_genPart_index() {
-  if (not lep_genPart_index_isLoaded) {
+  if (lep_genPart_index_loadedEpoch != epoch) {
     if (lep_genPart_index_branch != 0) {
-      lep_genPart_index_branch->GetEntry(index);
+      LoadBranch(lep_genPart_index_branch);
     } else {
       printf("branch lep_genPart_index_branch does not exist!\n");
       exit(1);
     }
-    lep_genPart_index_isLoaded = true;
+    lep_genPart_index_loadedEpoch = epoch;
   }
   return *lep_genPart_index_;
 }
 
 const vector<float> &wwwtree::lep_r9() {
-  if (not lep_r9_isLoaded) {
+  if (lep_r9_loadedEpoch != epoch) {
     if (lep_r9_branch != 0) {
-      lep_r9_branch->GetEntry(index);
+      LoadBranch(lep_r9_branch);
     } else {
       printf("branch lep_r9_branch does not exist!\n");
       exit(1);
     }
-    lep_r9_isLoaded = true;
+    lep_r9_loadedEpoch = epoch;
   }
   return *lep_r9_;
 }
 
 const vector<int> &wwwtree::lep_nlayers() {
-  if (not lep_nlayers_isLoaded) {
+  if (lep_nlayers_loadedEpoch != epoch) {
     if (lep_nlayers_branch != 0) {
-      lep_nlayers_branch->GetEntry(index);
+      LoadBranch(lep_nlayers_branch);
     } else {
       printf("branch lep_nlayers_branch does not exist!\n");
       exit(1);
     }
-    lep_nlayers_isLoaded = true;
+    lep_nlayers_loadedEpoch = epoch;
   }
   return *lep_nlayers_;
 }
 
 const float &wwwtree::el_pt() {
-  if (not el_pt_isLoaded) {
+  if (el_pt_loadedEpoch != epoch) {
     if (el_pt_branch != 0) {
-      el_pt_branch->GetEntry(index);
+      LoadBranch(el_pt_branch);
     } else {
       printf("branch el_pt_branch does not exist!\n");
       exit(1);
     }
-    el_pt_isLoaded = true;
+    el_pt_loadedEpoch = epoch;
   }
   return el_pt_;
 }
 
 const float &wwwtree::el_eta() {
-  if (not el_eta_isLoaded) {
+  if (el_eta_loadedEpoch != epoch) {
     if (el_eta_branch != 0) {
-      el_eta_branch->GetEntry(index);
+      LoadBranch(el_eta_branch);
     } else {
       printf("branch el_eta_branch does not exist!\n");
       exit(1);
     }
-    el_eta_isLoaded = true;
+    el_eta_loadedEpoch = epoch;
   }
   return el_eta_;
 }
 
 const float &wwwtree::el_phi() {
-  if (not el_phi_isLoaded) {
+  if (el_phi_loadedEpoch != epoch) {
     if (el_phi_branch != 0) {
-      el_phi_branch->GetEntry(index);
+      LoadBranch(el_phi_branch);
     } else {
       printf("branch el_phi_branch does not exist!\n");
       exit(1);
     }
-    el_phi_isLoaded = true;
+    el_phi_loadedEpoch = epoch;
   }
   return el_phi_;
 }
 
 const float &wwwtree::el_relIso03EA() {
-  if (not el_relIso03EA_isLoaded) {
+  if (el_relIso03EA_loadedEpoch != epoch) {
     if (el_relIso03EA_branch != 0) {
-      el_relIso03EA_branch->GetEntry(index);
+      LoadBranch(el_relIso03EA_branch);
     } else {
       printf("branch el_relIso03EA_branch does not exist!\n");
       exit(1);
     }
-    el_relIso03EA_isLoaded = true;
+    el_relIso03EA_loadedEpoch = epoch;
   }
   return el_relIso03EA_;
 }
 
 const float &wwwtree::el_relIso03EALep() {
-  if (not el_relIso03EALep_isLoaded) {
+  if (el_relIso03EALep_loadedEpoch != epoch) {
     if (el_relIso03EALep_branch != 0) {
-      el_relIso03EALep_branch->GetEntry(index);
+      LoadBranch(el_relIso03EALep_branch);
     } else {
       printf("branch el_relIso03EALep_branch does not exist!\n");
       exit(1);
     }
-    el_relIso03EALep_isLoaded = true;
+    el_relIso03EALep_loadedEpoch = epoch;
   }
   return el_relIso03EALep_;
 }
 
 const float &wwwtree::el_ip3d() {
-  if (not el_ip3d_isLoaded) {
+  if (el_ip3d_loadedEpoch != epoch) {
     if (el_ip3d_branch != 0) {
-      el_ip3d_branch->GetEntry(index);
+      LoadBranch(el_ip3d_branch);
     } else {
       printf("branch el_ip3d_branch does not exist!\n");
       exit(1);
     }
-    el_ip3d_isLoaded = true;
+    el_ip3d_loadedEpoch = epoch;
   }
   return el_ip3d_;
 }
 
 const float &wwwtree::mu_pt() {
-  if (not mu_pt_isLoaded) {
+  if (mu_pt_loadedEpoch != epoch) {
     if (mu_pt_branch != 0) {
-      mu_pt_branch->GetEntry(index);
+      LoadBranch(mu_pt_branch);
     } else {
       printf("branch mu_pt_branch does not exist!\n");
       exit(1);
     }
-    mu_pt_isLoaded = true;
+    mu_pt_loadedEpoch = epoch;
   }
   return mu_pt_;
 }
 
 const float &wwwtree::mu_eta() {
-  if (not mu_eta_isLoaded) {
+  if (mu_eta_loadedEpoch != epoch) {
     if (mu_eta_branch != 0) {
-      mu_eta_branch->GetEntry(index);
+      LoadBranch(mu_eta_branch);
     } else {
       printf("branch mu_eta_branch does not exist!\n");
       exit(1);
     }
-    mu_eta_isLoaded = true;
+    mu_eta_loadedEpoch = epoch;
   }
   return mu_eta_;
 }
 
 const float &wwwtree::mu_phi() {
-  if (not mu_phi_isLoaded) {
+  if (mu_phi_loadedEpoch != epoch) {
     if (mu_phi_branch != 0) {
-      mu_phi_branch->GetEntry(index);
+      LoadBranch(mu_phi_branch);
     } else {
       printf("branch mu_phi_branch does not exist!\n");
       exit(1);
     }
-    mu_phi_isLoaded = true;
+    mu_phi_loadedEpoch = epoch;
   }
   return mu_phi_;
 }
 
 const float &wwwtree::mu_relIso04DB() {
-  if (not mu_relIso04DB_isLoaded) {
+  if (mu_relIso04DB_loadedEpoch != epoch) {
     if (mu_relIso04DB_branch != 0) {
-      mu_relIso04DB_branch->GetEntry(index);
+      LoadBranch(mu_relIso04DB_branch);
     } else {
       printf("branch mu_relIso04DB_branch does not exist!\n");
       exit(1);
     }
-    mu_relIso04DB_isLoaded = true;
+    mu_relIso04DB_loadedEpoch = epoch;
   }
   return mu_relIso04DB_;
 }
 
 const float &wwwtree::mu_relIso03EA() {
-  if (not mu_relIso03EA_isLoaded) {
+  if (mu_relIso03EA_loadedEpoch != epoch) {
     if (mu_relIso03EA_branch != 0) {
-      mu_relIso03EA_branch->GetEntry(index);
+      LoadBranch(mu_relIso03EA_branch);
     } else {
       printf("branch mu_relIso03EA_branch does not exist!\n");
       exit(1);
     }
-    mu_relIso03EA_isLoaded = true;
+    mu_relIso03EA_loadedEpoch = epoch;
   }
   return mu_relIso03EA_;
 }
 
 const float &wwwtree::mu_relIso03EALep() {
-  if (not mu_relIso03EALep_isLoaded) {
+  if (mu_relIso03EALep_loadedEpoch != epoch) {
     if (mu_relIso03EALep_branch != 0) {
-      mu_relIso03EALep_branch->GetEntry(index);
+      LoadBranch(mu_relIso03EALep_branch);
     } else {
       printf("branch mu_relIso03EALep_branch does not exist!\n");
       exit(1);
     }
-    mu_relIso03EALep_isLoaded = true;
+    mu_relIso03EALep_loadedEpoch = epoch;
   }
   return mu_relIso03EALep_;
 }
 
 const float &wwwtree::mu_ip3d() {
-  if (not mu_ip3d_isLoaded) {
+  if (mu_ip3d_loadedEpoch != epoch) {
     if (mu_ip3d_branch != 0) {
-      mu_ip3d_branch->GetEntry(index);
+      LoadBranch(mu_ip3d_branch);
     } else {
       printf("branch mu_ip3d_branch does not exist!\n");
       exit(1);
     }
-    mu_ip3d_isLoaded = true;
+    mu_ip3d_loadedEpoch = epoch;
   }
   return mu_ip3d_;
 }
 
 const float &wwwtree::lbnt_pt() {
-  if (not lbnt_pt_isLoaded) {
+  if (lbnt_pt_loadedEpoch != epoch) {
     if (lbnt_pt_branch != 0) {
-      lbnt_pt_branch->GetEntry(index);
+      LoadBranch(lbnt_pt_branch);
     } else {
       printf("branch lbnt_pt_branch does not exist!\n");
       exit(1);
     }
-    lbnt_pt_isLoaded = true;
+    lbnt_pt_loadedEpoch = epoch;
   }
   return lbnt_pt_;
 }
 
 const float &wwwtree::lbnt_coneCorrPt() {
-  if (not lbnt_coneCorrPt_isLoaded) {
+  if (lbnt_coneCorrPt_loadedEpoch != epoch) {
     if (lbnt_coneCorrPt_branch != 0) {
-      lbnt_coneCorrPt_branch->GetEntry(index);
+      LoadBranch(lbnt_coneCorrPt_branch);
     } else {
       printf("branch lbnt_coneCorrPt_branch does not exist!\n");
       exit(1);
     }
-    lbnt_coneCorrPt_isLoaded = true;
+    lbnt_coneCorrPt_loadedEpoch = epoch;
   }
   return lbnt_coneCorrPt_;
 }
 
 const float &wwwtree::lbnt_abseta() {
-  if (not lbnt_abseta_isLoaded) {
+  if (lbnt_abseta_loadedEpoch != epoch) {
     if (lbnt_abseta_branch != 0) {
-      lbnt_abseta_branch->GetEntry(index);
+      LoadBranch(lbnt_abseta_branch);
     } else {
       printf("branch lbnt_abseta_branch does not exist!\n");
       exit(1);
     }
-    lbnt_abseta_isLoaded = true;
+    lbnt_abseta_loadedEpoch = epoch;
   }
   return lbnt_abseta_;
 }
 
 const float &wwwtree::lbnt_pdgId() {
-  if (not lbnt_pdgId_isLoaded) {
+  if (lbnt_pdgId_loadedEpoch != epoch) {
     if (lbnt_pdgId_branch != 0) {
-      lbnt_pdgId_branch->GetEntry(index);
+      LoadBranch(lbnt_pdgId_branch);
     } else {
       printf("branch lbnt_pdgId_branch does not exist!\n");
       exit(1);
     }
-    lbnt_pdgId_isLoaded = true;
+    lbnt_pdgId_loadedEpoch = epoch;
   }
   return lbnt_pdgId_;
 }
 
 const float &wwwtree::lbnt_el_pt() {
-  if (not lbnt_el_pt_isLoaded) {
+  if (lbnt_el_pt_loadedEpoch != epoch) {
     if (lbnt_el_pt_branch != 0) {
-      lbnt_el_pt_branch->GetEntry(index);
+      LoadBranch(lbnt_el_pt_branch);
     } else {
       printf("branch lbnt_el_pt_branch does not exist!\n");
       exit(1);
     }
-    lbnt_el_pt_isLoaded = true;
+    lbnt_el_pt_loadedEpoch = epoch;
   }
   return lbnt_el_pt_;
 }
 
 const float &wwwtree::lbnt_el_coneCorrPt() {
-  if (not lbnt_el_coneCorrPt_isLoaded) {
+  if (lbnt_el_coneCorrPt_loadedEpoch != epoch) {
     if (lbnt_el_coneCorrPt_branch != 0) {
-      lbnt_el_coneCorrPt_branch->GetEntry(index);
+      LoadBranch(lbnt_el_coneCorrPt_branch);
     } else {
       printf("branch lbnt_el_coneCorrPt_branch does not exist!\n");
       exit(1);
     }
-    lbnt_el_coneCorrPt_isLoaded = true;
+    lbnt_el_coneCorrPt_loadedEpoch = epoch;
   }
   return lbnt_el_coneCorrPt_;
 }
 
 const float &wwwtree::lbnt_el_abseta() {
-  if (not lbnt_el_abseta_isLoaded) {
+  if (lbnt_el_abseta_loadedEpoch != epoch) {
     if (lbnt_el_abseta_branch != 0) {
-      lbnt_el_abseta_branch->GetEntry(index);
+      LoadBranch(lbnt_el_abseta_branch);
     } else {
       printf("branch lbnt_el_abseta_branch does not exist!\n");
       exit(1);
     }
-    lbnt_el_abseta_isLoaded = true;
+    lbnt_el_abseta_loadedEpoch = epoch;
   }
   return lbnt_el_abseta_;
 }
 
 const float &wwwtree::lbnt_mu_pt() {
-  if (not lbnt_mu_pt_isLoaded) {
+  if (lbnt_mu_pt_loadedEpoch != epoch) {
     if (lbnt_mu_pt_branch != 0) {
-      lbnt_mu_pt_branch->GetEntry(index);
+      LoadBranch(lbnt_mu_pt_branch);
     } else {
       printf("branch lbnt_mu_pt_branch does not exist!\n");
       exit(1);
     }
-    lbnt_mu_pt_isLoaded = true;
+    lbnt_mu_pt_loadedEpoch = epoch;
   }
   return lbnt_mu_pt_;
 }
 
 const float &wwwtree::lbnt_mu_coneCorrPt() {
-  if (not lbnt_mu_coneCorrPt_isLoaded) {
+  if (lbnt_mu_coneCorrPt_loadedEpoch != epoch) {
     if (lbnt_mu_coneCorrPt_branch != 0) {
-      lbnt_mu_coneCorrPt_branch->GetEntry(index);
+      LoadBranch(lbnt_mu_coneCorrPt_branch);
     } else {
       printf("branch lbnt_mu_coneCorrPt_branch does not exist!\n");
       exit(1);
     }
-    lbnt_mu_coneCorrPt_isLoaded = true;
+    lbnt_mu_coneCorrPt_loadedEpoch = epoch;
   }
   return lbnt_mu_coneCorrPt_;
 }
 
 const float &wwwtree::lbnt_mu_abseta() {
-  if (not lbnt_mu_abseta_isLoaded) {
+  if (lbnt_mu_abseta_loadedEpoch != epoch) {
     if (lbnt_mu_abseta_branch != 0) {
-      lbnt_mu_abseta_branch->GetEntry(index);
+      LoadBranch(lbnt_mu_abseta_branch);
     } else {
       printf("branch lbnt_mu_abseta_branch does not exist!\n");
       exit(1);
     }
-    lbnt_mu_abseta_isLoaded = true;
+    lbnt_mu_abseta_loadedEpoch = epoch;
   }
   return lbnt_mu_abseta_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets_p4() {
-  if (not jets_p4_isLoaded) {
+  if (jets_p4_loadedEpoch != epoch) {
     if (jets_p4_branch != 0) {
-      jets_p4_branch->GetEntry(index);
+      LoadBranch(jets_p4_branch);
     } else {
       printf("branch jets_p4_branch does not exist!\n");
       exit(1);
     }
-    jets_p4_isLoaded = true;
+    jets_p4_loadedEpoch = epoch;
   }
   return *jets_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets_up_p4() {
-  if (not jets_up_p4_isLoaded) {
+  if (jets_up_p4_loadedEpoch != epoch) {
     if (jets_up_p4_branch != 0) {
-      jets_up_p4_branch->GetEntry(index);
+      LoadBranch(jets_up_p4_branch);
     } else {
       printf("branch jets_up_p4_branch does not exist!\n");
       exit(1);
     }
-    jets_up_p4_isLoaded = true;
+    jets_up_p4_loadedEpoch = epoch;
   }
   return *jets_up_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets_dn_p4() {
-  if (not jets_dn_p4_isLoaded) {
+  if (jets_dn_p4_loadedEpoch != epoch) {
     if (jets_dn_p4_branch != 0) {
-      jets_dn_p4_branch->GetEntry(index);
+      LoadBranch(jets_dn_p4_branch);
     } else {
       printf("branch jets_dn_p4_branch does not exist!\n");
       exit(1);
     }
-    jets_dn_p4_isLoaded = true;
+    jets_dn_p4_loadedEpoch = epoch;
   }
   return *jets_dn_p4_;
 }
 
 const vector<float> &wwwtree::jets_csv() {
-  if (not jets_csv_isLoaded) {
+  if (jets_csv_loadedEpoch != epoch) {
     if (jets_csv_branch != 0) {
-      jets_csv_branch->GetEntry(index);
+      LoadBranch(jets_csv_branch);
     } else {
       printf("branch jets_csv_branch does not exist!\n");
       exit(1);
     }
-    jets_csv_isLoaded = true;
+    jets_csv_loadedEpoch = epoch;
   }
   return *jets_csv_;
 }
 
 const vector<float> &wwwtree::jets_up_csv() {
-  if (not jets_up_csv_isLoaded) {
+  if (jets_up_csv_loadedEpoch != epoch) {
     if (jets_up_csv_branch != 0) {
-      jets_up_csv_branch->GetEntry(index);
+      LoadBranch(jets_up_csv_branch);
     } else {
       printf("branch jets_up_csv_branch does not exist!\n");
       exit(1);
     }
-    jets_up_csv_isLoaded = true;
+    jets_up_csv_loadedEpoch = epoch;
   }
   return *jets_up_csv_;
 }
 
 const vector<float> &wwwtree::jets_dn_csv() {
-  if (not jets_dn_csv_isLoaded) {
+  if (jets_dn_csv_loadedEpoch != epoch) {
     if (jets_dn_csv_branch != 0) {
-      jets_dn_csv_branch->GetEntry(index);
+      LoadBranch(jets_dn_csv_branch);
     } else {
       printf("branch jets_dn_csv_branch does not exist!\n");
       exit(1);
     }
-    jets_dn_csv_isLoaded = true;
+    jets_dn_csv_loadedEpoch = epoch;
   }
   return *jets_dn_csv_;
 }
 
 const vector<float> &wwwtree::jets_jer_csv() {
-  if (not jets_jer_csv_isLoaded) {
+  if (jets_jer_csv_loadedEpoch != epoch) {
     if (jets_jer_csv_branch != 0) {
-      jets_jer_csv_branch->GetEntry(index);
+      LoadBranch(jets_jer_csv_branch);
     } else {
       printf("branch jets_jer_csv_branch does not exist!\n");
       exit(1);
     }
-    jets_jer_csv_isLoaded = true;
+    jets_jer_csv_loadedEpoch = epoch;
   }
   return *jets_jer_csv_;
 }
 
 const vector<float> &wwwtree::jets_jerup_csv() {
-  if (not jets_jerup_csv_isLoaded) {
+  if (jets_jerup_csv_loadedEpoch != epoch) {
     if (jets_jerup_csv_branch != 0) {
-      jets_jerup_csv_branch->GetEntry(index);
+      LoadBranch(jets_jerup_csv_branch);
     } else {
       printf("branch jets_jerup_csv_branch does not exist!\n");
       exit(1);
     }
-    jets_jerup_csv_isLoaded = true;
+    jets_jerup_csv_loadedEpoch = epoch;
   }
   return *jets_jerup_csv_;
 }
 
 const vector<float> &wwwtree::jets_jerdn_csv() {
-  if (not jets_jerdn_csv_isLoaded) {
+  if (jets_jerdn_csv_loadedEpoch != epoch) {
     if (jets_jerdn_csv_branch != 0) {
-      jets_jerdn_csv_branch->GetEntry(index);
+      LoadBranch(jets_jerdn_csv_branch);
     } else {
       printf("branch jets_jerdn_csv_branch does not exist!\n");
       exit(1);
     }
-    jets_jerdn_csv_isLoaded = true;
+    jets_jerdn_csv_loadedEpoch = epoch;
   }
   return *jets_jerdn_csv_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets_jer_p4() {
-  if (not jets_jer_p4_isLoaded) {
+  if (jets_jer_p4_loadedEpoch != epoch) {
     if (jets_jer_p4_branch != 0) {
-      jets_jer_p4_branch->GetEntry(index);
+      LoadBranch(jets_jer_p4_branch);
     } else {
       printf("branch jets_jer_p4_branch does not exist!\n");
       exit(1);
     }
-    jets_jer_p4_isLoaded = true;
+    jets_jer_p4_loadedEpoch = epoch;
   }
   return *jets_jer_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets_jerup_p4() {
-  if (not jets_jerup_p4_isLoaded) {
+  if (jets_jerup_p4_loadedEpoch != epoch) {
     if (jets_jerup_p4_branch != 0) {
-      jets_jerup_p4_branch->GetEntry(index);
+      LoadBranch(jets_jerup_p4_branch);
     } else {
       printf("branch jets_jerup_p4_branch does not exist!\n");
       exit(1);
     }
-    jets_jerup_p4_isLoaded = true;
+    jets_jerup_p4_loadedEpoch = epoch;
   }
   return *jets_jerup_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets_jerdn_p4() {
-  if (not jets_jerdn_p4_isLoaded) {
+  if (jets_jerdn_p4_loadedEpoch != epoch) {
     if (jets_jerdn_p4_branch != 0) {
-      jets_jerdn_p4_branch->GetEntry(index);
+      LoadBranch(jets_jerdn_p4_branch);
     } else {
       printf("branch jets_jerdn_p4_branch does not exist!\n");
       exit(1);
     }
-    jets_jerdn_p4_isLoaded = true;
+    jets_jerdn_p4_loadedEpoch = epoch;
   }
   return *jets_jerdn_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets30_p4() {
-  if (not jets30_p4_isLoaded) {
+  if (jets30_p4_loadedEpoch != epoch) {
     if (jets30_p4_branch != 0) {
-      jets30_p4_branch->GetEntry(index);
+      LoadBranch(jets30_p4_branch);
     } else {
       printf("branch jets30_p4_branch does not exist!\n");
       exit(1);
     }
-    jets30_p4_isLoaded = true;
+    jets30_p4_loadedEpoch = epoch;
   }
   return *jets30_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets30_up_p4() {
-  if (not jets30_up_p4_isLoaded) {
+  if (jets30_up_p4_loadedEpoch != epoch) {
     if (jets30_up_p4_branch != 0) {
-      jets30_up_p4_branch->GetEntry(index);
+      LoadBranch(jets30_up_p4_branch);
     } else {
       printf("branch jets30_up_p4_branch does not exist!\n");
       exit(1);
     }
-    jets30_up_p4_isLoaded = true;
+    jets30_up_p4_loadedEpoch = epoch;
   }
   return *jets30_up_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets30_dn_p4() {
-  if (not jets30_dn_p4_isLoaded) {
+  if (jets30_dn_p4_loadedEpoch != epoch) {
     if (jets30_dn_p4_branch != 0) {
-      jets30_dn_p4_branch->GetEntry(index);
+      LoadBranch(jets30_dn_p4_branch);
     } else {
       printf("branch jets30_dn_p4_branch does not exist!\n");
       exit(1);
     }
-    jets30_dn_p4_isLoaded = true;
+    jets30_dn_p4_loadedEpoch = epoch;
   }
   return *jets30_dn_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets30_jer_p4() {
-  if (not jets30_jer_p4_isLoaded) {
+  if (jets30_jer_p4_loadedEpoch != epoch) {
     if (jets30_jer_p4_branch != 0) {
-      jets30_jer_p4_branch->GetEntry(index);
+      LoadBranch(jets30_jer_p4_branch);
     } else {
       printf("branch jets30_jer_p4_branch does not exist!\n");
       exit(1);
     }
-    jets30_jer_p4_isLoaded = true;
+    jets30_jer_p4_loadedEpoch = epoch;
   }
   return *jets30_jer_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets30_jerup_p4() {
-  if (not jets30_jerup_p4_isLoaded) {
+  if (jets30_jerup_p4_loadedEpoch != epoch) {
     if (jets30_jerup_p4_branch != 0) {
-      jets30_jerup_p4_branch->GetEntry(index);
+      LoadBranch(jets30_jerup_p4_branch);
     } else {
       printf("branch jets30_jerup_p4_branch does not exist!\n");
       exit(1);
     }
-    jets30_jerup_p4_isLoaded = true;
+    jets30_jerup_p4_loadedEpoch = epoch;
   }
   return *jets30_jerup_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::jets30_jerdn_p4() {
-  if (not jets30_jerdn_p4_isLoaded) {
+  if (jets30_jerdn_p4_loadedEpoch != epoch) {
     if (jets30_jerdn_p4_branch != 0) {
-      jets30_jerdn_p4_branch->GetEntry(index);
+      LoadBranch(jets30_jerdn_p4_branch);
     } else {
       printf("branch jets30_jerdn_p4_branch does not exist!\n");
       exit(1);
     }
-    jets30_jerdn_p4_isLoaded = true;
+    jets30_jerdn_p4_loadedEpoch = epoch;
   }
   return *jets30_jerdn_p4_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::ak8jets_p4() {
-  if (not ak8jets_p4_isLoaded) {
+  if (ak8jets_p4_loadedEpoch != epoch) {
     if (ak8jets_p4_branch != 0) {
-      ak8jets_p4_branch->GetEntry(index);
+      LoadBranch(ak8jets_p4_branch);
     } else {
       printf("branch ak8jets_p4_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_p4_isLoaded = true;
+    ak8jets_p4_loadedEpoch = epoch;
   }
   return *ak8jets_p4_;
 }
 
 const vector<float> &wwwtree::ak8jets_softdropMass() {
-  if (not ak8jets_softdropMass_isLoaded) {
+  if (ak8jets_softdropMass_loadedEpoch != epoch) {
     if (ak8jets_softdropMass_branch != 0) {
-      ak8jets_softdropMass_branch->GetEntry(index);
+      LoadBranch(ak8jets_softdropMass_branch);
     } else {
       printf("branch ak8jets_softdropMass_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_softdropMass_isLoaded = true;
+    ak8jets_softdropMass_loadedEpoch = epoch;
   }
   return *ak8jets_softdropMass_;
 }
 
 const vector<float> &wwwtree::ak8jets_prunedMass() {
-  if (not ak8jets_prunedMass_isLoaded) {
+  if (ak8jets_prunedMass_loadedEpoch != epoch) {
     if (ak8jets_prunedMass_branch != 0) {
-      ak8jets_prunedMass_branch->GetEntry(index);
+      LoadBranch(ak8jets_prunedMass_branch);
     } else {
       printf("branch ak8jets_prunedMass_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_prunedMass_isLoaded = true;
+    ak8jets_prunedMass_loadedEpoch = epoch;
   }
   return *ak8jets_prunedMass_;
 }
 
 const vector<float> &wwwtree::ak8jets_trimmedMass() {
-  if (not ak8jets_trimmedMass_isLoaded) {
+  if (ak8jets_trimmedMass_loadedEpoch != epoch) {
     if (ak8jets_trimmedMass_branch != 0) {
-      ak8jets_trimmedMass_branch->GetEntry(index);
+      LoadBranch(ak8jets_trimmedMass_branch);
     } else {
       printf("branch ak8jets_trimmedMass_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_trimmedMass_isLoaded = true;
+    ak8jets_trimmedMass_loadedEpoch = epoch;
   }
   return *ak8jets_trimmedMass_;
 }
 
 const vector<float> &wwwtree::ak8jets_mass() {
-  if (not ak8jets_mass_isLoaded) {
+  if (ak8jets_mass_loadedEpoch != epoch) {
     if (ak8jets_mass_branch != 0) {
-      ak8jets_mass_branch->GetEntry(index);
+      LoadBranch(ak8jets_mass_branch);
     } else {
       printf("branch ak8jets_mass_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_mass_isLoaded = true;
+    ak8jets_mass_loadedEpoch = epoch;
   }
   return *ak8jets_mass_;
 }
 
 const vector<float> &wwwtree::ak8jets_nJettinessTau1() {
-  if (not ak8jets_nJettinessTau1_isLoaded) {
+  if (ak8jets_nJettinessTau1_loadedEpoch != epoch) {
     if (ak8jets_nJettinessTau1_branch != 0) {
-      ak8jets_nJettinessTau1_branch->GetEntry(index);
+      LoadBranch(ak8jets_nJettinessTau1_branch);
     } else {
       printf("branch ak8jets_nJettinessTau1_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_nJettinessTau1_isLoaded = true;
+    ak8jets_nJettinessTau1_loadedEpoch = epoch;
   }
   return *ak8jets_nJettinessTau1_;
 }
 
 const vector<float> &wwwtree::ak8jets_nJettinessTau2() {
-  if (not ak8jets_nJettinessTau2_isLoaded) {
+  if (ak8jets_nJettinessTau2_loadedEpoch != epoch) {
     if (ak8jets_nJettinessTau2_branch != 0) {
-      ak8jets_nJettinessTau2_branch->GetEntry(index);
+      LoadBranch(ak8jets_nJettinessTau2_branch);
     } else {
       printf("branch ak8jets_nJettinessTau2_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_nJettinessTau2_isLoaded = true;
+    ak8jets_nJettinessTau2_loadedEpoch = epoch;
   }
   return *ak8jets_nJettinessTau2_;
 }
 
 const vector<float> &wwwtree::ak8jets_softdropPuppiSubjet1() {
-  if (not ak8jets_softdropPuppiSubjet1_isLoaded) {
+  if (ak8jets_softdropPuppiSubjet1_loadedEpoch != epoch) {
     if (ak8jets_softdropPuppiSubjet1_branch != 0) {
-      ak8jets_softdropPuppiSubjet1_branch->GetEntry(index);
+      LoadBranch(ak8jets_softdropPuppiSubjet1_branch);
     } else {
       printf("branch ak8jets_softdropPuppiSubjet1_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_softdropPuppiSubjet1_isLoaded = true;
+    ak8jets_softdropPuppiSubjet1_loadedEpoch = epoch;
   }
   return *ak8jets_softdropPuppiSubjet1_;
 }
 
 const vector<float> &wwwtree::ak8jets_softdropPuppiSubjet2() {
-  if (not ak8jets_softdropPuppiSubjet2_isLoaded) {
+  if (ak8jets_softdropPuppiSubjet2_loadedEpoch != epoch) {
     if (ak8jets_softdropPuppiSubjet2_branch != 0) {
-      ak8jets_softdropPuppiSubjet2_branch->GetEntry(index);
+      LoadBranch(ak8jets_softdropPuppiSubjet2_branch);
     } else {
       printf("branch ak8jets_softdropPuppiSubjet2_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_softdropPuppiSubjet2_isLoaded = true;
+    ak8jets_softdropPuppiSubjet2_loadedEpoch = epoch;
   }
   return *ak8jets_softdropPuppiSubjet2_;
 }
 
 const vector<float> &wwwtree::ak8jets_puppi_softdropMass() {
-  if (not ak8jets_puppi_softdropMass_isLoaded) {
+  if (ak8jets_puppi_softdropMass_loadedEpoch != epoch) {
     if (ak8jets_puppi_softdropMass_branch != 0) {
-      ak8jets_puppi_softdropMass_branch->GetEntry(index);
+      LoadBranch(ak8jets_puppi_softdropMass_branch);
     } else {
       printf("branch ak8jets_puppi_softdropMass_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_puppi_softdropMass_isLoaded = true;
+    ak8jets_puppi_softdropMass_loadedEpoch = epoch;
   }
   return *ak8jets_puppi_softdropMass_;
 }
 
 const vector<float> &wwwtree::ak8jets_puppi_nJettinessTau1() {
-  if (not ak8jets_puppi_nJettinessTau1_isLoaded) {
+  if (ak8jets_puppi_nJettinessTau1_loadedEpoch != epoch) {
     if (ak8jets_puppi_nJettinessTau1_branch != 0) {
-      ak8jets_puppi_nJettinessTau1_branch->GetEntry(index);
+      LoadBranch(ak8jets_puppi_nJettinessTau1_branch);
     } else {
       printf("branch ak8jets_puppi_nJettinessTau1_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_puppi_nJettinessTau1_isLoaded = true;
+    ak8jets_puppi_nJettinessTau1_loadedEpoch = epoch;
   }
   return *ak8jets_puppi_nJettinessTau1_;
 }
 
 const vector<float> &wwwtree::ak8jets_puppi_nJettinessTau2() {
-  if (not ak8jets_puppi_nJettinessTau2_isLoaded) {
+  if (ak8jets_puppi_nJettinessTau2_loadedEpoch != epoch) {
     if (ak8jets_puppi_nJettinessTau2_branch != 0) {
-      ak8jets_puppi_nJettinessTau2_branch->GetEntry(index);
+      LoadBranch(ak8jets_puppi_nJettinessTau2_branch);
     } else {
       printf("branch ak8jets_puppi_nJettinessTau2_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_puppi_nJettinessTau2_isLoaded = true;
+    ak8jets_puppi_nJettinessTau2_loadedEpoch = epoch;
   }
   return *ak8jets_puppi_nJettinessTau2_;
 }
 
 const vector<float> &wwwtree::ak8jets_puppi_eta() {
-  if (not ak8jets_puppi_eta_isLoaded) {
+  if (ak8jets_puppi_eta_loadedEpoch != epoch) {
     if (ak8jets_puppi_eta_branch != 0) {
-      ak8jets_puppi_eta_branch->GetEntry(index);
+      LoadBranch(ak8jets_puppi_eta_branch);
     } else {
       printf("branch ak8jets_puppi_eta_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_puppi_eta_isLoaded = true;
+    ak8jets_puppi_eta_loadedEpoch = epoch;
   }
   return *ak8jets_puppi_eta_;
 }
 
 const vector<float> &wwwtree::ak8jets_puppi_phi() {
-  if (not ak8jets_puppi_phi_isLoaded) {
+  if (ak8jets_puppi_phi_loadedEpoch != epoch) {
     if (ak8jets_puppi_phi_branch != 0) {
-      ak8jets_puppi_phi_branch->GetEntry(index);
+      LoadBranch(ak8jets_puppi_phi_branch);
     } else {
       printf("branch ak8jets_puppi_phi_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_puppi_phi_isLoaded = true;
+    ak8jets_puppi_phi_loadedEpoch = epoch;
   }
   return *ak8jets_puppi_phi_;
 }
 
 const vector<float> &wwwtree::ak8jets_puppi_pt() {
-  if (not ak8jets_puppi_pt_isLoaded) {
+  if (ak8jets_puppi_pt_loadedEpoch != epoch) {
     if (ak8jets_puppi_pt_branch != 0) {
-      ak8jets_puppi_pt_branch->GetEntry(index);
+      LoadBranch(ak8jets_puppi_pt_branch);
     } else {
       printf("branch ak8jets_puppi_pt_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_puppi_pt_isLoaded = true;
+    ak8jets_puppi_pt_loadedEpoch = epoch;
   }
   return *ak8jets_puppi_pt_;
 }
 
 const vector<float> &wwwtree::ak8jets_puppi_mass() {
-  if (not ak8jets_puppi_mass_isLoaded) {
+  if (ak8jets_puppi_mass_loadedEpoch != epoch) {
     if (ak8jets_puppi_mass_branch != 0) {
-      ak8jets_puppi_mass_branch->GetEntry(index);
+      LoadBranch(ak8jets_puppi_mass_branch);
     } else {
       printf("branch ak8jets_puppi_mass_branch does not exist!\n");
       exit(1);
     }
-    ak8jets_puppi_mass_isLoaded = true;
+    ak8jets_puppi_mass_loadedEpoch = epoch;
   }
   return *ak8jets_puppi_mass_;
 }
 
 const float &wwwtree::met_pt() {
-  if (not met_pt_isLoaded) {
+  if (met_pt_loadedEpoch != epoch) {
     if (met_pt_branch != 0) {
-      met_pt_branch->GetEntry(index);
+      LoadBranch(met_pt_branch);
     } else {
       printf("branch met_pt_branch does not exist!\n");
       exit(1);
     }
-    met_pt_isLoaded = true;
+    met_pt_loadedEpoch = epoch;
   }
   return met_pt_;
 }
 
 const float &wwwtree::met_phi() {
-  if (not met_phi_isLoaded) {
+  if (met_phi_loadedEpoch != epoch) {
     if (met_phi_branch != 0) {
-      met_phi_branch->GetEntry(index);
+      LoadBranch(met_phi_branch);
     } else {
       printf("branch met_phi_branch does not exist!\n");
       exit(1);
     }
-    met_phi_isLoaded = true;
+    met_phi_loadedEpoch = epoch;
   }
   return met_phi_;
 }
 
 const float &wwwtree::met_up_pt() {
-  if (not met_up_pt_isLoaded) {
+  if (met_up_pt_loadedEpoch != epoch) {
     if (met_up_pt_branch != 0) {
-      met_up_pt_branch->GetEntry(index);
+      LoadBranch(met_up_pt_branch);
     } else {
       printf("branch met_up_pt_branch does not exist!\n");
       exit(1);
     }
-    met_up_pt_isLoaded = true;
+    met_up_pt_loadedEpoch = epoch;
   }
   return met_up_pt_;
 }
 
 const float &wwwtree::met_up_phi() {
-  if (not met_up_phi_isLoaded) {
+  if (met_up_phi_loadedEpoch != epoch) {
     if (met_up_phi_branch != 0) {
-      met_up_phi_branch->GetEntry(index);
+      LoadBranch(met_up_phi_branch);
     } else {
       printf("branch met_up_phi_branch does not exist!\n");
       exit(1);
     }
-    met_up_phi_isLoaded = true;
+    met_up_phi_loadedEpoch = epoch;
   }
   return met_up_phi_;
 }
 
 const float &wwwtree::met_dn_pt() {
-  if (not met_dn_pt_isLoaded) {
+  if (met_dn_pt_loadedEpoch != epoch) {
     if (met_dn_pt_branch != 0) {
-      met_dn_pt_branch->GetEntry(index);
+      LoadBranch(met_dn_pt_branch);
     } else {
       printf("branch met_dn_pt_branch does not exist!\n");
       exit(1);
     }
-    met_dn_pt_isLoaded = true;
+    met_dn_pt_loadedEpoch = epoch;
   }
   return met_dn_pt_;
 }
 
 const float &wwwtree::met_dn_phi() {
-  if (not met_dn_phi_isLoaded) {
+  if (met_dn_phi_loadedEpoch != epoch) {
     if (met_dn_phi_branch != 0) {
-      met_dn_phi_branch->GetEntry(index);
+      LoadBranch(met_dn_phi_branch);
     } else {
       printf("branch met_dn_phi_branch does not exist!\n");
       exit(1);
     }
-    met_dn_phi_isLoaded = true;
+    met_dn_phi_loadedEpoch = epoch;
   }
   return met_dn_phi_;
 }
 
 const float &wwwtree::met_gen_pt() {
-  if (not met_gen_pt_isLoaded) {
+  if (met_gen_pt_loadedEpoch != epoch) {
     if (met_gen_pt_branch != 0) {
-      met_gen_pt_branch->GetEntry(index);
+      LoadBranch(met_gen_pt_branch);
     } else {
       printf("branch met_gen_pt_branch does not exist!\n");
       exit(1);
     }
-    met_gen_pt_isLoaded = true;
+    met_gen_pt_loadedEpoch = epoch;
   }
   return met_gen_pt_;
 }
 
 const float &wwwtree::met_gen_phi() {
-  if (not met_gen_phi_isLoaded) {
+  if (met_gen_phi_loadedEpoch != epoch) {
     if (met_gen_phi_branch != 0) {
-      met_gen_phi_branch->GetEntry(index);
+      LoadBranch(met_gen_phi_branch);
     } else {
       printf("branch met_gen_phi_branch does not exist!\n");
       exit(1);
     }
-    met_gen_phi_isLoaded = true;
+    met_gen_phi_loadedEpoch = epoch;
   }
   return met_gen_phi_;
 }
 
 const float &wwwtree::met_jer_pt() {
-  if (not met_jer_pt_isLoaded) {
+  if (met_jer_pt_loadedEpoch != epoch) {
     if (met_jer_pt_branch != 0) {
-      met_jer_pt_branch->GetEntry(index);
+      LoadBranch(met_jer_pt_branch);
     } else {
       printf("branch met_jer_pt_branch does not exist!\n");
       exit(1);
     }
-    met_jer_pt_isLoaded = true;
+    met_jer_pt_loadedEpoch = epoch;
   }
   return met_jer_pt_;
 }
 
 const float &wwwtree::met_jerup_pt() {
-  if (not met_jerup_pt_isLoaded) {
+  if (met_jerup_pt_loadedEpoch != epoch) {
     if (met_jerup_pt_branch != 0) {
-      met_jerup_pt_branch->GetEntry(index);
+      LoadBranch(met_jerup_pt_branch);
     } else {
       printf("branch met_jerup_pt_branch does not exist!\n");
       exit(1);
     }
-    met_jerup_pt_isLoaded = true;
+    met_jerup_pt_loadedEpoch = epoch;
   }
   return met_jerup_pt_;
 }
 
 const float &wwwtree::met_jerdn_pt() {
-  if (not met_jerdn_pt_isLoaded) {
+  if (met_jerdn_pt_loadedEpoch != epoch) {
     if (met_jerdn_pt_branch != 0) {
-      met_jerdn_pt_branch->GetEntry(index);
+      LoadBranch(met_jerdn_pt_branch);
     } else {
       printf("branch met_jerdn_pt_branch does not exist!\n");
       exit(1);
     }
-    met_jerdn_pt_isLoaded = true;
+    met_jerdn_pt_loadedEpoch = epoch;
   }
   return met_jerdn_pt_;
 }
 
 const float &wwwtree::met_jer_phi() {
-  if (not met_jer_phi_isLoaded) {
+  if (met_jer_phi_loadedEpoch != epoch) {
     if (met_jer_phi_branch != 0) {
-      met_jer_phi_branch->GetEntry(index);
+      LoadBranch(met_jer_phi_branch);
     } else {
       printf("branch met_jer_phi_branch does not exist!\n");
       exit(1);
     }
-    met_jer_phi_isLoaded = true;
+    met_jer_phi_loadedEpoch = epoch;
   }
   return met_jer_phi_;
 }
 
 const float &wwwtree::met_jerup_phi() {
-  if (not met_jerup_phi_isLoaded) {
+  if (met_jerup_phi_loadedEpoch != epoch) {
     if (met_jerup_phi_branch != 0) {
-      met_jerup_phi_branch->GetEntry(index);
+      LoadBranch(met_jerup_phi_branch);
     } else {
       printf("branch met_jerup_phi_branch does not exist!\n");
       exit(1);
     }
-    met_jerup_phi_isLoaded = true;
+    met_jerup_phi_loadedEpoch = epoch;
   }
   return met_jerup_phi_;
 }
 
 const float &wwwtree::met_jerdn_phi() {
-  if (not met_jerdn_phi_isLoaded) {
+  if (met_jerdn_phi_loadedEpoch != epoch) {
     if (met_jerdn_phi_branch != 0) {
-      met_jerdn_phi_branch->GetEntry(index);
+      LoadBranch(met_jerdn_phi_branch);
     } else {
       printf("branch met_jerdn_phi_branch does not exist!\n");
       exit(1);
     }
-    met_jerdn_phi_isLoaded = true;
+    met_jerdn_phi_loadedEpoch = epoch;
   }
   return met_jerdn_phi_;
 }
 
 const int &wwwtree::firstgoodvertex() {
-  if (not firstgoodvertex_isLoaded) {
+  if (firstgoodvertex_loadedEpoch != epoch) {
     if (firstgoodvertex_branch != 0) {
-      firstgoodvertex_branch->GetEntry(index);
+      LoadBranch(firstgoodvertex_branch);
     } else {
       printf("branch firstgoodvertex_branch does not exist!\n");
       exit(1);
     }
-    firstgoodvertex_isLoaded = true;
+    firstgoodvertex_loadedEpoch = epoch;
   }
   return firstgoodvertex_;
 }
 
 const int &wwwtree::nTrueInt() {
-  if (not nTrueInt_isLoaded) {
+  if (nTrueInt_loadedEpoch != epoch) {
     if (nTrueInt_branch != 0) {
-      nTrueInt_branch->GetEntry(index);
+      LoadBranch(nTrueInt_branch);
     } else {
       printf("branch nTrueInt_branch does not exist!\n");
       exit(1);
     }
-    nTrueInt_isLoaded = true;
+    nTrueInt_loadedEpoch = epoch;
   }
   return nTrueInt_;
 }
 
 const int &wwwtree::nVert() {
-  if (not nVert_isLoaded) {
+  if (nVert_loadedEpoch != epoch) {
     if (nVert_branch != 0) {
-      nVert_branch->GetEntry(index);
+      LoadBranch(nVert_branch);
     } else {
       printf("branch nVert_branch does not exist!\n");
       exit(1);
     }
-    nVert_isLoaded = true;
+    nVert_loadedEpoch = epoch;
   }
   return nVert_;
 }
 
 const int &wwwtree::nisoTrack_mt2_cleaned_VVV_cutbased_veto() {
-  if (not nisoTrack_mt2_cleaned_VVV_cutbased_veto_isLoaded) {
+  if (nisoTrack_mt2_cleaned_VVV_cutbased_veto_loadedEpoch != epoch) {
     if (nisoTrack_mt2_cleaned_VVV_cutbased_veto_branch != 0) {
-      nisoTrack_mt2_cleaned_VVV_cutbased_veto_branch->GetEntry(index);
+      LoadBranch(nisoTrack_mt2_cleaned_VVV_cutbased_veto_branch);
     } else {
       printf("branch nisoTrack_mt2_cleaned_VVV_cutbased_veto_branch does not exist!\n");
       exit(1);
     }
-    nisoTrack_mt2_cleaned_VVV_cutbased_veto_isLoaded = true;
+    nisoTrack_mt2_cleaned_VVV_cutbased_veto_loadedEpoch = epoch;
   }
   return nisoTrack_mt2_cleaned_VVV_cutbased_veto_;
 }
 
 const float &wwwtree::weight_btagsf() {
-  if (not weight_btagsf_isLoaded) {
+  if (weight_btagsf_loadedEpoch != epoch) {
     if (weight_btagsf_branch != 0) {
-      weight_btagsf_branch->GetEntry(index);
+      LoadBranch(weight_btagsf_branch);
     } else {
       printf("branch weight_btagsf_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_isLoaded = true;
+    weight_btagsf_loadedEpoch = epoch;
   }
   return weight_btagsf_;
 }
 
 const float &wwwtree::weight_btagsf_heavy_DN() {
-  if (not weight_btagsf_heavy_DN_isLoaded) {
+  if (weight_btagsf_heavy_DN_loadedEpoch != epoch) {
     if (weight_btagsf_heavy_DN_branch != 0) {
-      weight_btagsf_heavy_DN_branch->GetEntry(index);
+      LoadBranch(weight_btagsf_heavy_DN_branch);
     } else {
       printf("branch weight_btagsf_heavy_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_heavy_DN_isLoaded = true;
+    weight_btagsf_heavy_DN_loadedEpoch = epoch;
   }
   return weight_btagsf_heavy_DN_;
 }
 
 const float &wwwtree::weight_btagsf_heavy_UP() {
-  if (not weight_btagsf_heavy_UP_isLoaded) {
+  if (weight_btagsf_heavy_UP_loadedEpoch != epoch) {
     if (weight_btagsf_heavy_UP_branch != 0) {
-      weight_btagsf_heavy_UP_branch->GetEntry(index);
+      LoadBranch(weight_btagsf_heavy_UP_branch);
     } else {
       printf("branch weight_btagsf_heavy_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_heavy_UP_isLoaded = true;
+    weight_btagsf_heavy_UP_loadedEpoch = epoch;
   }
   return weight_btagsf_heavy_UP_;
 }
 
 const float &wwwtree::weight_btagsf_light_DN() {
-  if (not weight_btagsf_light_DN_isLoaded) {
+  if (weight_btagsf_light_DN_loadedEpoch != epoch) {
     if (weight_btagsf_light_DN_branch != 0) {
-      weight_btagsf_light_DN_branch->GetEntry(index);
+      LoadBranch(weight_btagsf_light_DN_branch);
     } else {
       printf("branch weight_btagsf_light_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_light_DN_isLoaded = true;
+    weight_btagsf_light_DN_loadedEpoch = epoch;
   }
   return weight_btagsf_light_DN_;
 }
 
 const float &wwwtree::weight_btagsf_light_UP() {
-  if (not weight_btagsf_light_UP_isLoaded) {
+  if (weight_btagsf_light_UP_loadedEpoch != epoch) {
     if (weight_btagsf_light_UP_branch != 0) {
-      weight_btagsf_light_UP_branch->GetEntry(index);
+      LoadBranch(weight_btagsf_light_UP_branch);
     } else {
       printf("branch weight_btagsf_light_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_light_UP_isLoaded = true;
+    weight_btagsf_light_UP_loadedEpoch = epoch;
   }
   return weight_btagsf_light_UP_;
 }
 
 const float &wwwtree::gen_ht() {
-  if (not gen_ht_isLoaded) {
+  if (gen_ht_loadedEpoch != epoch) {
     if (gen_ht_branch != 0) {
-      gen_ht_branch->GetEntry(index);
+      LoadBranch(gen_ht_branch);
     } else {
       printf("branch gen_ht_branch does not exist!\n");
       exit(1);
     }
-    gen_ht_isLoaded = true;
+    gen_ht_loadedEpoch = epoch;
   }
   return gen_ht_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::genPart_p4() {
-  if (not genPart_p4_isLoaded) {
+  if (genPart_p4_loadedEpoch != epoch) {
     if (genPart_p4_branch != 0) {
-      genPart_p4_branch->GetEntry(index);
+      LoadBranch(genPart_p4_branch);
     } else {
       printf("branch genPart_p4_branch does not exist!\n");
       exit(1);
     }
-    genPart_p4_isLoaded = true;
+    genPart_p4_loadedEpoch = epoch;
   }
   return *genPart_p4_;
 }
 
 const vector<int> &wwwtree::genPart_motherId() {
-  if (not genPart_motherId_isLoaded) {
+  if (genPart_motherId_loadedEpoch != epoch) {
     if (genPart_motherId_branch != 0) {
-      genPart_motherId_branch->GetEntry(index);
+      LoadBranch(genPart_motherId_branch);
     } else {
       printf("branch genPart_motherId_branch does not exist!\n");
       exit(1);
     }
-    genPart_motherId_isLoaded = true;
+    genPart_motherId_loadedEpoch = epoch;
   }
   return *genPart_motherId_;
 }
 
 const vector<int> &wwwtree::genPart_pdgId() {
-  if (not genPart_pdgId_isLoaded) {
+  if (genPart_pdgId_loadedEpoch != epoch) {
     if (genPart_pdgId_branch != 0) {
-      genPart_pdgId_branch->GetEntry(index);
+      LoadBranch(genPart_pdgId_branch);
     } else {
       printf("branch genPart_pdgId_branch does not exist!\n");
       exit(1);
     }
-    genPart_pdgId_isLoaded = true;
+    genPart_pdgId_loadedEpoch = epoch;
   }
   return *genPart_pdgId_;
 }
 
 const vector<int> &wwwtree::genPart_charge() {
-  if (not genPart_charge_isLoaded) {
+  if (genPart_charge_loadedEpoch != epoch) {
     if (genPart_charge_branch != 0) {
-      genPart_charge_branch->GetEntry(index);
+      LoadBranch(genPart_charge_branch);
     } else {
       printf("branch genPart_charge_branch does not exist!\n");
       exit(1);
     }
-    genPart_charge_isLoaded = true;
+    genPart_charge_loadedEpoch = epoch;
   }
   return *genPart_charge_;
 }
 
 const vector<int> &wwwtree::genPart_status() {
-  if (not genPart_status_isLoaded) {
+  if (genPart_status_loadedEpoch != epoch) {
     if (genPart_status_branch != 0) {
-      genPart_status_branch->GetEntry(index);
+      LoadBranch(genPart_status_branch);
     } else {
       printf("branch genPart_status_branch does not exist!\n");
       exit(1);
     }
-    genPart_status_isLoaded = true;
+    genPart_status_loadedEpoch = epoch;
   }
   return *genPart_status_;
 }
 
 const int &wwwtree::ngenLep() {
-  if (not ngenLep_isLoaded) {
+  if (ngenLep_loadedEpoch != epoch) {
     if (ngenLep_branch != 0) {
-      ngenLep_branch->GetEntry(index);
+      LoadBranch(ngenLep_branch);
     } else {
       printf("branch ngenLep_branch does not exist!\n");
       exit(1);
     }
-    ngenLep_isLoaded = true;
+    ngenLep_loadedEpoch = epoch;
   }
   return ngenLep_;
 }
 
 const int &wwwtree::ngenLepFromTau() {
-  if (not ngenLepFromTau_isLoaded) {
+  if (ngenLepFromTau_loadedEpoch != epoch) {
     if (ngenLepFromTau_branch != 0) {
-      ngenLepFromTau_branch->GetEntry(index);
+      LoadBranch(ngenLepFromTau_branch);
     } else {
       printf("branch ngenLepFromTau_branch does not exist!\n");
       exit(1);
     }
-    ngenLepFromTau_isLoaded = true;
+    ngenLepFromTau_loadedEpoch = epoch;
   }
   return ngenLepFromTau_;
 }
 
 const int &wwwtree::Flag_AllEventFilters() {
-  if (not Flag_AllEventFilters_isLoaded) {
+  if (Flag_AllEventFilters_loadedEpoch != epoch) {
     if (Flag_AllEventFilters_branch != 0) {
-      Flag_AllEventFilters_branch->GetEntry(index);
+      LoadBranch(Flag_AllEventFilters_branch);
     } else {
       printf("branch Flag_AllEventFilters_branch does not exist!\n");
       exit(1);
     }
-    Flag_AllEventFilters_isLoaded = true;
+    Flag_AllEventFilters_loadedEpoch = epoch;
   }
   return Flag_AllEventFilters_;
 }
 
 const int &wwwtree::Flag_EcalDeadCellTriggerPrimitiveFilter() {
-  if (not Flag_EcalDeadCellTriggerPrimitiveFilter_isLoaded) {
+  if (Flag_EcalDeadCellTriggerPrimitiveFilter_loadedEpoch != epoch) {
     if (Flag_EcalDeadCellTriggerPrimitiveFilter_branch != 0) {
-      Flag_EcalDeadCellTriggerPrimitiveFilter_branch->GetEntry(index);
+      LoadBranch(Flag_EcalDeadCellTriggerPrimitiveFilter_branch);
     } else {
       printf("branch Flag_EcalDeadCellTriggerPrimitiveFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_EcalDeadCellTriggerPrimitiveFilter_isLoaded = true;
+    Flag_EcalDeadCellTriggerPrimitiveFilter_loadedEpoch = epoch;
   }
   return Flag_EcalDeadCellTriggerPrimitiveFilter_;
 }
 
 const int &wwwtree::Flag_HBHEIsoNoiseFilter() {
-  if (not Flag_HBHEIsoNoiseFilter_isLoaded) {
+  if (Flag_HBHEIsoNoiseFilter_loadedEpoch != epoch) {
     if (Flag_HBHEIsoNoiseFilter_branch != 0) {
-      Flag_HBHEIsoNoiseFilter_branch->GetEntry(index);
+      LoadBranch(Flag_HBHEIsoNoiseFilter_branch);
     } else {
       printf("branch Flag_HBHEIsoNoiseFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_HBHEIsoNoiseFilter_isLoaded = true;
+    Flag_HBHEIsoNoiseFilter_loadedEpoch = epoch;
   }
   return Flag_HBHEIsoNoiseFilter_;
 }
 
 const int &wwwtree::Flag_HBHENoiseFilter() {
-  if (not Flag_HBHENoiseFilter_isLoaded) {
+  if (Flag_HBHENoiseFilter_loadedEpoch != epoch) {
     if (Flag_HBHENoiseFilter_branch != 0) {
-      Flag_HBHENoiseFilter_branch->GetEntry(index);
+      LoadBranch(Flag_HBHENoiseFilter_branch);
     } else {
       printf("branch Flag_HBHENoiseFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_HBHENoiseFilter_isLoaded = true;
+    Flag_HBHENoiseFilter_loadedEpoch = epoch;
   }
   return Flag_HBHENoiseFilter_;
 }
 
 const int &wwwtree::Flag_badChargedCandidateFilter() {
-  if (not Flag_badChargedCandidateFilter_isLoaded) {
+  if (Flag_badChargedCandidateFilter_loadedEpoch != epoch) {
     if (Flag_badChargedCandidateFilter_branch != 0) {
-      Flag_badChargedCandidateFilter_branch->GetEntry(index);
+      LoadBranch(Flag_badChargedCandidateFilter_branch);
     } else {
       printf("branch Flag_badChargedCandidateFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_badChargedCandidateFilter_isLoaded = true;
+    Flag_badChargedCandidateFilter_loadedEpoch = epoch;
   }
   return Flag_badChargedCandidateFilter_;
 }
 
 const int &wwwtree::Flag_badMuonFilter() {
-  if (not Flag_badMuonFilter_isLoaded) {
+  if (Flag_badMuonFilter_loadedEpoch != epoch) {
     if (Flag_badMuonFilter_branch != 0) {
-      Flag_badMuonFilter_branch->GetEntry(index);
+      LoadBranch(Flag_badMuonFilter_branch);
     } else {
       printf("branch Flag_badMuonFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_badMuonFilter_isLoaded = true;
+    Flag_badMuonFilter_loadedEpoch = epoch;
   }
   return Flag_badMuonFilter_;
 }
 
 const int &wwwtree::Flag_badMuonFilterv2() {
-  if (not Flag_badMuonFilterv2_isLoaded) {
+  if (Flag_badMuonFilterv2_loadedEpoch != epoch) {
     if (Flag_badMuonFilterv2_branch != 0) {
-      Flag_badMuonFilterv2_branch->GetEntry(index);
+      LoadBranch(Flag_badMuonFilterv2_branch);
     } else {
       printf("branch Flag_badMuonFilterv2_branch does not exist!\n");
       exit(1);
     }
-    Flag_badMuonFilterv2_isLoaded = true;
+    Flag_badMuonFilterv2_loadedEpoch = epoch;
   }
   return Flag_badMuonFilterv2_;
 }
 
 const int &wwwtree::Flag_badChargedCandidateFilterv2() {
-  if (not Flag_badChargedCandidateFilterv2_isLoaded) {
+  if (Flag_badChargedCandidateFilterv2_loadedEpoch != epoch) {
     if (Flag_badChargedCandidateFilterv2_branch != 0) {
-      Flag_badChargedCandidateFilterv2_branch->GetEntry(index);
+      LoadBranch(Flag_badChargedCandidateFilterv2_branch);
     } else {
       printf("branch Flag_badChargedCandidateFilterv2_branch does not exist!\n");
       exit(1);
     }
-    Flag_badChargedCandidateFilterv2_isLoaded = true;
+    Flag_badChargedCandidateFilterv2_loadedEpoch = epoch;
   }
   return Flag_badChargedCandidateFilterv2_;
 }
 
 const int &wwwtree::Flag_eeBadScFilter() {
-  if (not Flag_eeBadScFilter_isLoaded) {
+  if (Flag_eeBadScFilter_loadedEpoch != epoch) {
     if (Flag_eeBadScFilter_branch != 0) {
-      Flag_eeBadScFilter_branch->GetEntry(index);
+      LoadBranch(Flag_eeBadScFilter_branch);
     } else {
       printf("branch Flag_eeBadScFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_eeBadScFilter_isLoaded = true;
+    Flag_eeBadScFilter_loadedEpoch = epoch;
   }
   return Flag_eeBadScFilter_;
 }
 
 const int &wwwtree::Flag_ecalBadCalibFilter() {
-  if (not Flag_ecalBadCalibFilter_isLoaded) {
+  if (Flag_ecalBadCalibFilter_loadedEpoch != epoch) {
     if (Flag_ecalBadCalibFilter_branch != 0) {
-      Flag_ecalBadCalibFilter_branch->GetEntry(index);
+      LoadBranch(Flag_ecalBadCalibFilter_branch);
     } else {
       printf("branch Flag_ecalBadCalibFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_ecalBadCalibFilter_isLoaded = true;
+    Flag_ecalBadCalibFilter_loadedEpoch = epoch;
   }
   return Flag_ecalBadCalibFilter_;
 }
 
 const int &wwwtree::Flag_globalTightHalo2016() {
-  if (not Flag_globalTightHalo2016_isLoaded) {
+  if (Flag_globalTightHalo2016_loadedEpoch != epoch) {
     if (Flag_globalTightHalo2016_branch != 0) {
-      Flag_globalTightHalo2016_branch->GetEntry(index);
+      LoadBranch(Flag_globalTightHalo2016_branch);
     } else {
       printf("branch Flag_globalTightHalo2016_branch does not exist!\n");
       exit(1);
     }
-    Flag_globalTightHalo2016_isLoaded = true;
+    Flag_globalTightHalo2016_loadedEpoch = epoch;
   }
   return Flag_globalTightHalo2016_;
 }
 
 const int &wwwtree::Flag_goodVertices() {
-  if (not Flag_goodVertices_isLoaded) {
+  if (Flag_goodVertices_loadedEpoch != epoch) {
     if (Flag_goodVertices_branch != 0) {
-      Flag_goodVertices_branch->GetEntry(index);
+      LoadBranch(Flag_goodVertices_branch);
     } else {
       printf("branch Flag_goodVertices_branch does not exist!\n");
       exit(1);
     }
-    Flag_goodVertices_isLoaded = true;
+    Flag_goodVertices_loadedEpoch = epoch;
   }
   return Flag_goodVertices_;
 }
 
 const int &wwwtree::Flag_ecalLaserCorrFilter() {
-  if (not Flag_ecalLaserCorrFilter_isLoaded) {
+  if (Flag_ecalLaserCorrFilter_loadedEpoch != epoch) {
     if (Flag_ecalLaserCorrFilter_branch != 0) {
-      Flag_ecalLaserCorrFilter_branch->GetEntry(index);
+      LoadBranch(Flag_ecalLaserCorrFilter_branch);
     } else {
       printf("branch Flag_ecalLaserCorrFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_ecalLaserCorrFilter_isLoaded = true;
+    Flag_ecalLaserCorrFilter_loadedEpoch = epoch;
   }
   return Flag_ecalLaserCorrFilter_;
 }
 
 const int &wwwtree::Flag_hcalLaserEventFilter() {
-  if (not Flag_hcalLaserEventFilter_isLoaded) {
+  if (Flag_hcalLaserEventFilter_loadedEpoch != epoch) {
     if (Flag_hcalLaserEventFilter_branch != 0) {
-      Flag_hcalLaserEventFilter_branch->GetEntry(index);
+      LoadBranch(Flag_hcalLaserEventFilter_branch);
     } else {
       printf("branch Flag_hcalLaserEventFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_hcalLaserEventFilter_isLoaded = true;
+    Flag_hcalLaserEventFilter_loadedEpoch = epoch;
   }
   return Flag_hcalLaserEventFilter_;
 }
 
 const int &wwwtree::Flag_trackingFailureFilter() {
-  if (not Flag_trackingFailureFilter_isLoaded) {
+  if (Flag_trackingFailureFilter_loadedEpoch != epoch) {
     if (Flag_trackingFailureFilter_branch != 0) {
-      Flag_trackingFailureFilter_branch->GetEntry(index);
+      LoadBranch(Flag_trackingFailureFilter_branch);
     } else {
       printf("branch Flag_trackingFailureFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_trackingFailureFilter_isLoaded = true;
+    Flag_trackingFailureFilter_loadedEpoch = epoch;
   }
   return Flag_trackingFailureFilter_;
 }
 
 const int &wwwtree::Flag_CSCTightHaloFilter() {
-  if (not Flag_CSCTightHaloFilter_isLoaded) {
+  if (Flag_CSCTightHaloFilter_loadedEpoch != epoch) {
     if (Flag_CSCTightHaloFilter_branch != 0) {
-      Flag_CSCTightHaloFilter_branch->GetEntry(index);
+      LoadBranch(Flag_CSCTightHaloFilter_branch);
     } else {
       printf("branch Flag_CSCTightHaloFilter_branch does not exist!\n");
       exit(1);
     }
-    Flag_CSCTightHaloFilter_isLoaded = true;
+    Flag_CSCTightHaloFilter_loadedEpoch = epoch;
   }
   return Flag_CSCTightHaloFilter_;
 }
 
 const int &wwwtree::Flag_CSCTightHalo2015Filter() {
-  if (not Flag_CSCTightHalo2015Filter_isLoaded) {
+  if (Flag_CSCTightHalo2015Filter_loadedEpoch != epoch) {
     if (Flag_CSCTightHalo2015Filter_branch != 0) {
-      Flag_CSCTightHalo2015Filter_branch->GetEntry(index);
+      LoadBranch(Flag_CSCTightHalo2015Filter_branch);
     } else {
       printf("branch Flag_CSCTightHalo2015Filter_branch does not exist!\n");
       exit(1);
     }
-    Flag_CSCTightHalo2015Filter_isLoaded = true;
+    Flag_CSCTightHalo2015Filter_loadedEpoch = epoch;
   }
   return Flag_CSCTightHalo2015Filter_;
 }
 
 const int &wwwtree::Flag_badMuons() {
-  if (not Flag_badMuons_isLoaded) {
+  if (Flag_badMuons_loadedEpoch != epoch) {
     if (Flag_badMuons_branch != 0) {
-      Flag_badMuons_branch->GetEntry(index);
+      LoadBranch(Flag_badMuons_branch);
     } else {
       printf("branch Flag_badMuons_branch does not exist!\n");
       exit(1);
     }
-    Flag_badMuons_isLoaded = true;
+    Flag_badMuons_loadedEpoch = epoch;
   }
   return Flag_badMuons_;
 }
 
 const int &wwwtree::Flag_duplicateMuons() {
-  if (not Flag_duplicateMuons_isLoaded) {
+  if (Flag_duplicateMuons_loadedEpoch != epoch) {
     if (Flag_duplicateMuons_branch != 0) {
-      Flag_duplicateMuons_branch->GetEntry(index);
+      LoadBranch(Flag_duplicateMuons_branch);
     } else {
       printf("branch Flag_duplicateMuons_branch does not exist!\n");
       exit(1);
     }
-    Flag_duplicateMuons_isLoaded = true;
+    Flag_duplicateMuons_loadedEpoch = epoch;
   }
   return Flag_duplicateMuons_;
 }
 
 const int &wwwtree::Flag_noBadMuons() {
-  if (not Flag_noBadMuons_isLoaded) {
+  if (Flag_noBadMuons_loadedEpoch != epoch) {
     if (Flag_noBadMuons_branch != 0) {
-      Flag_noBadMuons_branch->GetEntry(index);
+      LoadBranch(Flag_noBadMuons_branch);
     } else {
       printf("branch Flag_noBadMuons_branch does not exist!\n");
       exit(1);
     }
-    Flag_noBadMuons_isLoaded = true;
+    Flag_noBadMuons_loadedEpoch = epoch;
   }
   return Flag_noBadMuons_;
 }
 
 const int &wwwtree::fastsimfilt() {
-  if (not fastsimfilt_isLoaded) {
+  if (fastsimfilt_loadedEpoch != epoch) {
     if (fastsimfilt_branch != 0) {
-      fastsimfilt_branch->GetEntry(index);
+      LoadBranch(fastsimfilt_branch);
     } else {
       printf("branch fastsimfilt_branch does not exist!\n");
       exit(1);
     }
-    fastsimfilt_isLoaded = true;
+    fastsimfilt_loadedEpoch = epoch;
   }
   return fastsimfilt_;
 }
 
 const int &wwwtree::nVlep() {
-  if (not nVlep_isLoaded) {
+  if (nVlep_loadedEpoch != epoch) {
     if (nVlep_branch != 0) {
-      nVlep_branch->GetEntry(index);
+      LoadBranch(nVlep_branch);
     } else {
       printf("branch nVlep_branch does not exist!\n");
       exit(1);
     }
-    nVlep_isLoaded = true;
+    nVlep_loadedEpoch = epoch;
   }
   return nVlep_;
 }
 
 const int &wwwtree::nTlep() {
-  if (not nTlep_isLoaded) {
+  if (nTlep_loadedEpoch != epoch) {
     if (nTlep_branch != 0) {
-      nTlep_branch->GetEntry(index);
+      LoadBranch(nTlep_branch);
     } else {
       printf("branch nTlep_branch does not exist!\n");
       exit(1);
     }
-    nTlep_isLoaded = true;
+    nTlep_loadedEpoch = epoch;
   }
   return nTlep_;
 }
 
 const int &wwwtree::nTlepSS() {
-  if (not nTlepSS_isLoaded) {
+  if (nTlepSS_loadedEpoch != epoch) {
     if (nTlepSS_branch != 0) {
-      nTlepSS_branch->GetEntry(index);
+      LoadBranch(nTlepSS_branch);
     } else {
       printf("branch nTlepSS_branch does not exist!\n");
       exit(1);
     }
-    nTlepSS_isLoaded = true;
+    nTlepSS_loadedEpoch = epoch;
   }
   return nTlepSS_;
 }
 
 const int &wwwtree::nLlep() {
-  if (not nLlep_isLoaded) {
+  if (nLlep_loadedEpoch != epoch) {
     if (nLlep_branch != 0) {
-      nLlep_branch->GetEntry(index);
+      LoadBranch(nLlep_branch);
     } else {
       printf("branch nLlep_branch does not exist!\n");
       exit(1);
     }
-    nLlep_isLoaded = true;
+    nLlep_loadedEpoch = epoch;
   }
   return nLlep_;
 }
 
 const int &wwwtree::nLlep3L() {
-  if (not nLlep3L_isLoaded) {
+  if (nLlep3L_loadedEpoch != epoch) {
     if (nLlep3L_branch != 0) {
-      nLlep3L_branch->GetEntry(index);
+      LoadBranch(nLlep3L_branch);
     } else {
       printf("branch nLlep3L_branch does not exist!\n");
       exit(1);
     }
-    nLlep3L_isLoaded = true;
+    nLlep3L_loadedEpoch = epoch;
   }
   return nLlep3L_;
 }
 
 const int &wwwtree::nTlep3L() {
-  if (not nTlep3L_isLoaded) {
+  if (nTlep3L_loadedEpoch != epoch) {
     if (nTlep3L_branch != 0) {
-      nTlep3L_branch->GetEntry(index);
+      LoadBranch(nTlep3L_branch);
     } else {
       printf("branch nTlep3L_branch does not exist!\n");
       exit(1);
     }
-    nTlep3L_isLoaded = true;
+    nTlep3L_loadedEpoch = epoch;
   }
   return nTlep3L_;
 }
 
 const int &wwwtree::nSFOS() {
-  if (not nSFOS_isLoaded) {
+  if (nSFOS_loadedEpoch != epoch) {
     if (nSFOS_branch != 0) {
-      nSFOS_branch->GetEntry(index);
+      LoadBranch(nSFOS_branch);
     } else {
       printf("branch nSFOS_branch does not exist!\n");
       exit(1);
     }
-    nSFOS_isLoaded = true;
+    nSFOS_loadedEpoch = epoch;
   }
   return nSFOS_;
 }
 
 const int &wwwtree::nSFOSinZ() {
-  if (not nSFOSinZ_isLoaded) {
+  if (nSFOSinZ_loadedEpoch != epoch) {
     if (nSFOSinZ_branch != 0) {
-      nSFOSinZ_branch->GetEntry(index);
+      LoadBranch(nSFOSinZ_branch);
     } else {
       printf("branch nSFOSinZ_branch does not exist!\n");
       exit(1);
     }
-    nSFOSinZ_isLoaded = true;
+    nSFOSinZ_loadedEpoch = epoch;
   }
   return nSFOSinZ_;
 }
 
 const int &wwwtree::nj() {
-  if (not nj_isLoaded) {
+  if (nj_loadedEpoch != epoch) {
     if (nj_branch != 0) {
-      nj_branch->GetEntry(index);
+      LoadBranch(nj_branch);
     } else {
       printf("branch nj_branch does not exist!\n");
       exit(1);
     }
-    nj_isLoaded = true;
+    nj_loadedEpoch = epoch;
   }
   return nj_;
 }
 
 const int &wwwtree::nj_up() {
-  if (not nj_up_isLoaded) {
+  if (nj_up_loadedEpoch != epoch) {
     if (nj_up_branch != 0) {
-      nj_up_branch->GetEntry(index);
+      LoadBranch(nj_up_branch);
     } else {
       printf("branch nj_up_branch does not exist!\n");
       exit(1);
     }
-    nj_up_isLoaded = true;
+    nj_up_loadedEpoch = epoch;
   }
   return nj_up_;
 }
 
 const int &wwwtree::nj_dn() {
-  if (not nj_dn_isLoaded) {
+  if (nj_dn_loadedEpoch != epoch) {
     if (nj_dn_branch != 0) {
-      nj_dn_branch->GetEntry(index);
+      LoadBranch(nj_dn_branch);
     } else {
       printf("branch nj_dn_branch does not exist!\n");
       exit(1);
     }
-    nj_dn_isLoaded = true;
+    nj_dn_loadedEpoch = epoch;
   }
   return nj_dn_;
 }
 
 const int &wwwtree::nj_jer() {
-  if (not nj_jer_isLoaded) {
+  if (nj_jer_loadedEpoch != epoch) {
     if (nj_jer_branch != 0) {
-      nj_jer_branch->GetEntry(index);
+      LoadBranch(nj_jer_branch);
     } else {
       printf("branch nj_jer_branch does not exist!\n");
       exit(1);
     }
-    nj_jer_isLoaded = true;
+    nj_jer_loadedEpoch = epoch;
   }
   return nj_jer_;
 }
 
 const int &wwwtree::nj_jerup() {
-  if (not nj_jerup_isLoaded) {
+  if (nj_jerup_loadedEpoch != epoch) {
     if (nj_jerup_branch != 0) {
-      nj_jerup_branch->GetEntry(index);
+      LoadBranch(nj_jerup_branch);
     } else {
       printf("branch nj_jerup_branch does not exist!\n");
       exit(1);
     }
-    nj_jerup_isLoaded = true;
+    nj_jerup_loadedEpoch = epoch;
   }
   return nj_jerup_;
 }
 
 const int &wwwtree::nj_jerdn() {
-  if (not nj_jerdn_isLoaded) {
+  if (nj_jerdn_loadedEpoch != epoch) {
     if (nj_jerdn_branch != 0) {
-      nj_jerdn_branch->GetEntry(index);
+      LoadBranch(nj_jerdn_branch);
     } else {
       printf("branch nj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    nj_jerdn_isLoaded = true;
+    nj_jerdn_loadedEpoch = epoch;
   }
   return nj_jerdn_;
 }
 
 const int &wwwtree::nj30() {
-  if (not nj30_isLoaded) {
+  if (nj30_loadedEpoch != epoch) {
     if (nj30_branch != 0) {
-      nj30_branch->GetEntry(index);
+      LoadBranch(nj30_branch);
     } else {
       printf("branch nj30_branch does not exist!\n");
       exit(1);
     }
-    nj30_isLoaded = true;
+    nj30_loadedEpoch = epoch;
   }
   return nj30_;
 }
 
 const int &wwwtree::nj30_up() {
-  if (not nj30_up_isLoaded) {
+  if (nj30_up_loadedEpoch != epoch) {
     if (nj30_up_branch != 0) {
-      nj30_up_branch->GetEntry(index);
+      LoadBranch(nj30_up_branch);
     } else {
       printf("branch nj30_up_branch does not exist!\n");
       exit(1);
     }
-    nj30_up_isLoaded = true;
+    nj30_up_loadedEpoch = epoch;
   }
   return nj30_up_;
 }
 
 const int &wwwtree::nj30_dn() {
-  if (not nj30_dn_isLoaded) {
+  if (nj30_dn_loadedEpoch != epoch) {
     if (nj30_dn_branch != 0) {
-      nj30_dn_branch->GetEntry(index);
+      LoadBranch(nj30_dn_branch);
     } else {
       printf("branch nj30_dn_branch does not exist!\n");
       exit(1);
     }
-    nj30_dn_isLoaded = true;
+    nj30_dn_loadedEpoch = epoch;
   }
   return nj30_dn_;
 }
 
 const int &wwwtree::nj30_jer() {
-  if (not nj30_jer_isLoaded) {
+  if (nj30_jer_loadedEpoch != epoch) {
     if (nj30_jer_branch != 0) {
-      nj30_jer_branch->GetEntry(index);
+      LoadBranch(nj30_jer_branch);
     } else {
       printf("branch nj30_jer_branch does not exist!\n");
       exit(1);
     }
-    nj30_jer_isLoaded = true;
+    nj30_jer_loadedEpoch = epoch;
   }
   return nj30_jer_;
 }
 
 const int &wwwtree::nj30_jerup() {
-  if (not nj30_jerup_isLoaded) {
+  if (nj30_jerup_loadedEpoch != epoch) {
     if (nj30_jerup_branch != 0) {
-      nj30_jerup_branch->GetEntry(index);
+      LoadBranch(nj30_jerup_branch);
     } else {
       printf("branch nj30_jerup_branch does not exist!\n");
       exit(1);
     }
-    nj30_jerup_isLoaded = true;
+    nj30_jerup_loadedEpoch = epoch;
   }
   return nj30_jerup_;
 }
 
 const int &wwwtree::nj30_jerdn() {
-  if (not nj30_jerdn_isLoaded) {
+  if (nj30_jerdn_loadedEpoch != epoch) {
     if (nj30_jerdn_branch != 0) {
-      nj30_jerdn_branch->GetEntry(index);
+      LoadBranch(nj30_jerdn_branch);
     } else {
       printf("branch nj30_jerdn_branch does not exist!\n");
       exit(1);
     }
-    nj30_jerdn_isLoaded = true;
+    nj30_jerdn_loadedEpoch = epoch;
   }
   return nj30_jerdn_;
 }
 
 const int &wwwtree::nb() {
-  if (not nb_isLoaded) {
+  if (nb_loadedEpoch != epoch) {
     if (nb_branch != 0) {
-      nb_branch->GetEntry(index);
+      LoadBranch(nb_branch);
     } else {
       printf("branch nb_branch does not exist!\n");
       exit(1);
     }
-    nb_isLoaded = true;
+    nb_loadedEpoch = epoch;
   }
   return nb_;
 }
 
 const int &wwwtree::nb_up() {
-  if (not nb_up_isLoaded) {
+  if (nb_up_loadedEpoch != epoch) {
     if (nb_up_branch != 0) {
-      nb_up_branch->GetEntry(index);
+      LoadBranch(nb_up_branch);
     } else {
       printf("branch nb_up_branch does not exist!\n");
       exit(1);
     }
-    nb_up_isLoaded = true;
+    nb_up_loadedEpoch = epoch;
   }
   return nb_up_;
 }
 
 const int &wwwtree::nb_dn() {
-  if (not nb_dn_isLoaded) {
+  if (nb_dn_loadedEpoch != epoch) {
     if (nb_dn_branch != 0) {
-      nb_dn_branch->GetEntry(index);
+      LoadBranch(nb_dn_branch);
     } else {
       printf("branch nb_dn_branch does not exist!\n");
       exit(1);
     }
-    nb_dn_isLoaded = true;
+    nb_dn_loadedEpoch = epoch;
   }
   return nb_dn_;
 }
 
 const int &wwwtree::nb_jer() {
-  if (not nb_jer_isLoaded) {
+  if (nb_jer_loadedEpoch != epoch) {
     if (nb_jer_branch != 0) {
-      nb_jer_branch->GetEntry(index);
+      LoadBranch(nb_jer_branch);
     } else {
       printf("branch nb_jer_branch does not exist!\n");
       exit(1);
     }
-    nb_jer_isLoaded = true;
+    nb_jer_loadedEpoch = epoch;
   }
   return nb_jer_;
 }
 
 const int &wwwtree::nb_jerup() {
-  if (not nb_jerup_isLoaded) {
+  if (nb_jerup_loadedEpoch != epoch) {
     if (nb_jerup_branch != 0) {
-      nb_jerup_branch->GetEntry(index);
+      LoadBranch(nb_jerup_branch);
     } else {
       printf("branch nb_jerup_branch does not exist!\n");
       exit(1);
     }
-    nb_jerup_isLoaded = true;
+    nb_jerup_loadedEpoch = epoch;
   }
   return nb_jerup_;
 }
 
 const int &wwwtree::nb_jerdn() {
-  if (not nb_jerdn_isLoaded) {
+  if (nb_jerdn_loadedEpoch != epoch) {
     if (nb_jerdn_branch != 0) {
-      nb_jerdn_branch->GetEntry(index);
+      LoadBranch(nb_jerdn_branch);
     } else {
       printf("branch nb_jerdn_branch does not exist!\n");
       exit(1);
     }
-    nb_jerdn_isLoaded = true;
+    nb_jerdn_loadedEpoch = epoch;
   }
   return nb_jerdn_;
 }
 
 const float &wwwtree::Ml0j0() {
-  if (not Ml0j0_isLoaded) {
+  if (Ml0j0_loadedEpoch != epoch) {
     if (Ml0j0_branch != 0) {
-      Ml0j0_branch->GetEntry(index);
+      LoadBranch(Ml0j0_branch);
     } else {
       printf("branch Ml0j0_branch does not exist!\n");
       exit(1);
     }
-    Ml0j0_isLoaded = true;
+    Ml0j0_loadedEpoch = epoch;
   }
   return Ml0j0_;
 }
 
 const float &wwwtree::Ml0j0_up() {
-  if (not Ml0j0_up_isLoaded) {
+  if (Ml0j0_up_loadedEpoch != epoch) {
     if (Ml0j0_up_branch != 0) {
-      Ml0j0_up_branch->GetEntry(index);
+      LoadBranch(Ml0j0_up_branch);
     } else {
       printf("branch Ml0j0_up_branch does not exist!\n");
       exit(1);
     }
-    Ml0j0_up_isLoaded = true;
+    Ml0j0_up_loadedEpoch = epoch;
   }
   return Ml0j0_up_;
 }
 
 const float &wwwtree::Ml0j0_dn() {
-  if (not Ml0j0_dn_isLoaded) {
+  if (Ml0j0_dn_loadedEpoch != epoch) {
     if (Ml0j0_dn_branch != 0) {
-      Ml0j0_dn_branch->GetEntry(index);
+      LoadBranch(Ml0j0_dn_branch);
     } else {
       printf("branch Ml0j0_dn_branch does not exist!\n");
       exit(1);
     }
-    Ml0j0_dn_isLoaded = true;
+    Ml0j0_dn_loadedEpoch = epoch;
   }
   return Ml0j0_dn_;
 }
 
 const float &wwwtree::Ml0j0_jer() {
-  if (not Ml0j0_jer_isLoaded) {
+  if (Ml0j0_jer_loadedEpoch != epoch) {
     if (Ml0j0_jer_branch != 0) {
-      Ml0j0_jer_branch->GetEntry(index);
+      LoadBranch(Ml0j0_jer_branch);
     } else {
       printf("branch Ml0j0_jer_branch does not exist!\n");
       exit(1);
     }
-    Ml0j0_jer_isLoaded = true;
+    Ml0j0_jer_loadedEpoch = epoch;
   }
   return Ml0j0_jer_;
 }
 
 const float &wwwtree::Ml0j0_jerup() {
-  if (not Ml0j0_jerup_isLoaded) {
+  if (Ml0j0_jerup_loadedEpoch != epoch) {
     if (Ml0j0_jerup_branch != 0) {
-      Ml0j0_jerup_branch->GetEntry(index);
+      LoadBranch(Ml0j0_jerup_branch);
     } else {
       printf("branch Ml0j0_jerup_branch does not exist!\n");
       exit(1);
     }
-    Ml0j0_jerup_isLoaded = true;
+    Ml0j0_jerup_loadedEpoch = epoch;
   }
   return Ml0j0_jerup_;
 }
 
 const float &wwwtree::Ml0j0_jerdn() {
-  if (not Ml0j0_jerdn_isLoaded) {
+  if (Ml0j0_jerdn_loadedEpoch != epoch) {
     if (Ml0j0_jerdn_branch != 0) {
-      Ml0j0_jerdn_branch->GetEntry(index);
+      LoadBranch(Ml0j0_jerdn_branch);
     } else {
       printf("branch Ml0j0_jerdn_branch does not exist!\n");
       exit(1);
     }
-    Ml0j0_jerdn_isLoaded = true;
+    Ml0j0_jerdn_loadedEpoch = epoch;
   }
   return Ml0j0_jerdn_;
 }
 
 const float &wwwtree::Ml0j1() {
-  if (not Ml0j1_isLoaded) {
+  if (Ml0j1_loadedEpoch != epoch) {
     if (Ml0j1_branch != 0) {
-      Ml0j1_branch->GetEntry(index);
+      LoadBranch(Ml0j1_branch);
     } else {
       printf("branch Ml0j1_branch does not exist!\n");
       exit(1);
     }
-    Ml0j1_isLoaded = true;
+    Ml0j1_loadedEpoch = epoch;
   }
   return Ml0j1_;
 }
 
 const float &wwwtree::Ml0j1_up() {
-  if (not Ml0j1_up_isLoaded) {
+  if (Ml0j1_up_loadedEpoch != epoch) {
     if (Ml0j1_up_branch != 0) {
-      Ml0j1_up_branch->GetEntry(index);
+      LoadBranch(Ml0j1_up_branch);
     } else {
       printf("branch Ml0j1_up_branch does not exist!\n");
       exit(1);
     }
-    Ml0j1_up_isLoaded = true;
+    Ml0j1_up_loadedEpoch = epoch;
   }
   return Ml0j1_up_;
 }
 
 const float &wwwtree::Ml0j1_dn() {
-  if (not Ml0j1_dn_isLoaded) {
+  if (Ml0j1_dn_loadedEpoch != epoch) {
     if (Ml0j1_dn_branch != 0) {
-      Ml0j1_dn_branch->GetEntry(index);
+      LoadBranch(Ml0j1_dn_branch);
     } else {
       printf("branch Ml0j1_dn_branch does not exist!\n");
       exit(1);
     }
-    Ml0j1_dn_isLoaded = true;
+    Ml0j1_dn_loadedEpoch = epoch;
   }
   return Ml0j1_dn_;
 }
 
 const float &wwwtree::Ml0j1_jer() {
-  if (not Ml0j1_jer_isLoaded) {
+  if (Ml0j1_jer_loadedEpoch != epoch) {
     if (Ml0j1_jer_branch != 0) {
-      Ml0j1_jer_branch->GetEntry(index);
+      LoadBranch(Ml0j1_jer_branch);
     } else {
       printf("branch Ml0j1_jer_branch does not exist!\n");
       exit(1);
     }
-    Ml0j1_jer_isLoaded = true;
+    Ml0j1_jer_loadedEpoch = epoch;
   }
   return Ml0j1_jer_;
 }
 
 const float &wwwtree::Ml0j1_jerup() {
-  if (not Ml0j1_jerup_isLoaded) {
+  if (Ml0j1_jerup_loadedEpoch != epoch) {
     if (Ml0j1_jerup_branch != 0) {
-      Ml0j1_jerup_branch->GetEntry(index);
+      LoadBranch(Ml0j1_jerup_branch);
     } else {
       printf("branch Ml0j1_jerup_branch does not exist!\n");
       exit(1);
     }
-    Ml0j1_jerup_isLoaded = true;
+    Ml0j1_jerup_loadedEpoch = epoch;
   }
   return Ml0j1_jerup_;
 }
 
 const float &wwwtree::Ml0j1_jerdn() {
-  if (not Ml0j1_jerdn_isLoaded) {
+  if (Ml0j1_jerdn_loadedEpoch != epoch) {
     if (Ml0j1_jerdn_branch != 0) {
-      Ml0j1_jerdn_branch->GetEntry(index);
+      LoadBranch(Ml0j1_jerdn_branch);
     } else {
       printf("branch Ml0j1_jerdn_branch does not exist!\n");
       exit(1);
     }
-    Ml0j1_jerdn_isLoaded = true;
+    Ml0j1_jerdn_loadedEpoch = epoch;
   }
   return Ml0j1_jerdn_;
 }
 
 const float &wwwtree::Ml1j0() {
-  if (not Ml1j0_isLoaded) {
+  if (Ml1j0_loadedEpoch != epoch) {
     if (Ml1j0_branch != 0) {
-      Ml1j0_branch->GetEntry(index);
+      LoadBranch(Ml1j0_branch);
     } else {
       printf("branch Ml1j0_branch does not exist!\n");
       exit(1);
     }
-    Ml1j0_isLoaded = true;
+    Ml1j0_loadedEpoch = epoch;
   }
   return Ml1j0_;
 }
 
 const float &wwwtree::Ml1j0_up() {
-  if (not Ml1j0_up_isLoaded) {
+  if (Ml1j0_up_loadedEpoch != epoch) {
     if (Ml1j0_up_branch != 0) {
-      Ml1j0_up_branch->GetEntry(index);
+      LoadBranch(Ml1j0_up_branch);
     } else {
       printf("branch Ml1j0_up_branch does not exist!\n");
       exit(1);
     }
-    Ml1j0_up_isLoaded = true;
+    Ml1j0_up_loadedEpoch = epoch;
   }
   return Ml1j0_up_;
 }
 
 const float &wwwtree::Ml1j0_dn() {
-  if (not Ml1j0_dn_isLoaded) {
+  if (Ml1j0_dn_loadedEpoch != epoch) {
     if (Ml1j0_dn_branch != 0) {
-      Ml1j0_dn_branch->GetEntry(index);
+      LoadBranch(Ml1j0_dn_branch);
     } else {
       printf("branch Ml1j0_dn_branch does not exist!\n");
       exit(1);
     }
-    Ml1j0_dn_isLoaded = true;
+    Ml1j0_dn_loadedEpoch = epoch;
   }
   return Ml1j0_dn_;
 }
 
 const float &wwwtree::Ml1j0_jer() {
-  if (not Ml1j0_jer_isLoaded) {
+  if (Ml1j0_jer_loadedEpoch != epoch) {
     if (Ml1j0_jer_branch != 0) {
-      Ml1j0_jer_branch->GetEntry(index);
+      LoadBranch(Ml1j0_jer_branch);
     } else {
       printf("branch Ml1j0_jer_branch does not exist!\n");
       exit(1);
     }
-    Ml1j0_jer_isLoaded = true;
+    Ml1j0_jer_loadedEpoch = epoch;
   }
   return Ml1j0_jer_;
 }
 
 const float &wwwtree::Ml1j0_jerup() {
-  if (not Ml1j0_jerup_isLoaded) {
+  if (Ml1j0_jerup_loadedEpoch != epoch) {
     if (Ml1j0_jerup_branch != 0) {
-      Ml1j0_jerup_branch->GetEntry(index);
+      LoadBranch(Ml1j0_jerup_branch);
     } else {
       printf("branch Ml1j0_jerup_branch does not exist!\n");
       exit(1);
     }
-    Ml1j0_jerup_isLoaded = true;
+    Ml1j0_jerup_loadedEpoch = epoch;
   }
   return Ml1j0_jerup_;
 }
 
 const float &wwwtree::Ml1j0_jerdn() {
-  if (not Ml1j0_jerdn_isLoaded) {
+  if (Ml1j0_jerdn_loadedEpoch != epoch) {
     if (Ml1j0_jerdn_branch != 0) {
-      Ml1j0_jerdn_branch->GetEntry(index);
+      LoadBranch(Ml1j0_jerdn_branch);
     } else {
       printf("branch Ml1j0_jerdn_branch does not exist!\n");
       exit(1);
     }
-    Ml1j0_jerdn_isLoaded = true;
+    Ml1j0_jerdn_loadedEpoch = epoch;
   }
   return Ml1j0_jerdn_;
 }
 
 const float &wwwtree::Ml1j1() {
-  if (not Ml1j1_isLoaded) {
+  if (Ml1j1_loadedEpoch != epoch) {
     if (Ml1j1_branch != 0) {
-      Ml1j1_branch->GetEntry(index);
+      LoadBranch(Ml1j1_branch);
     } else {
       printf("branch Ml1j1_branch does not exist!\n");
       exit(1);
     }
-    Ml1j1_isLoaded = true;
+    Ml1j1_loadedEpoch = epoch;
   }
   return Ml1j1_;
 }
 
 const float &wwwtree::Ml1j1_up() {
-  if (not Ml1j1_up_isLoaded) {
+  if (Ml1j1_up_loadedEpoch != epoch) {
     if (Ml1j1_up_branch != 0) {
-      Ml1j1_up_branch->GetEntry(index);
+      LoadBranch(Ml1j1_up_branch);
     } else {
       printf("branch Ml1j1_up_branch does not exist!\n");
       exit(1);
     }
-    Ml1j1_up_isLoaded = true;
+    Ml1j1_up_loadedEpoch = epoch;
   }
   return Ml1j1_up_;
 }
 
 const float &wwwtree::Ml1j1_dn() {
-  if (not Ml1j1_dn_isLoaded) {
+  if (Ml1j1_dn_loadedEpoch != epoch) {
     if (Ml1j1_dn_branch != 0) {
-      Ml1j1_dn_branch->GetEntry(index);
+      LoadBranch(Ml1j1_dn_branch);
     } else {
       printf("branch Ml1j1_dn_branch does not exist!\n");
       exit(1);
     }
-    Ml1j1_dn_isLoaded = true;
+    Ml1j1_dn_loadedEpoch = epoch;
   }
   return Ml1j1_dn_;
 }
 
 const float &wwwtree::Ml1j1_jer() {
-  if (not Ml1j1_jer_isLoaded) {
+  if (Ml1j1_jer_loadedEpoch != epoch) {
     if (Ml1j1_jer_branch != 0) {
-      Ml1j1_jer_branch->GetEntry(index);
+      LoadBranch(Ml1j1_jer_branch);
     } else {
       printf("branch Ml1j1_jer_branch does not exist!\n");
       exit(1);
     }
-    Ml1j1_jer_isLoaded = true;
+    Ml1j1_jer_loadedEpoch = epoch;
   }
   return Ml1j1_jer_;
 }
 
 const float &wwwtree::Ml1j1_jerup() {
-  if (not Ml1j1_jerup_isLoaded) {
+  if (Ml1j1_jerup_loadedEpoch != epoch) {
     if (Ml1j1_jerup_branch != 0) {
-      Ml1j1_jerup_branch->GetEntry(index);
+      LoadBranch(Ml1j1_jerup_branch);
     } else {
       printf("branch Ml1j1_jerup_branch does not exist!\n");
       exit(1);
     }
-    Ml1j1_jerup_isLoaded = true;
+    Ml1j1_jerup_loadedEpoch = epoch;
   }
   return Ml1j1_jerup_;
 }
 
 const float &wwwtree::Ml1j1_jerdn() {
-  if (not Ml1j1_jerdn_isLoaded) {
+  if (Ml1j1_jerdn_loadedEpoch != epoch) {
     if (Ml1j1_jerdn_branch != 0) {
-      Ml1j1_jerdn_branch->GetEntry(index);
+      LoadBranch(Ml1j1_jerdn_branch);
     } else {
       printf("branch Ml1j1_jerdn_branch does not exist!\n");
       exit(1);
     }
-    Ml1j1_jerdn_isLoaded = true;
+    Ml1j1_jerdn_loadedEpoch = epoch;
   }
   return Ml1j1_jerdn_;
 }
 
 const float &wwwtree::MinMlj() {
-  if (not MinMlj_isLoaded) {
+  if (MinMlj_loadedEpoch != epoch) {
     if (MinMlj_branch != 0) {
-      MinMlj_branch->GetEntry(index);
+      LoadBranch(MinMlj_branch);
     } else {
       printf("branch MinMlj_branch does not exist!\n");
       exit(1);
     }
-    MinMlj_isLoaded = true;
+    MinMlj_loadedEpoch = epoch;
   }
   return MinMlj_;
 }
 
 const float &wwwtree::MinMlj_up() {
-  if (not MinMlj_up_isLoaded) {
+  if (MinMlj_up_loadedEpoch != epoch) {
     if (MinMlj_up_branch != 0) {
-      MinMlj_up_branch->GetEntry(index);
+      LoadBranch(MinMlj_up_branch);
     } else {
       printf("branch MinMlj_up_branch does not exist!\n");
       exit(1);
     }
-    MinMlj_up_isLoaded = true;
+    MinMlj_up_loadedEpoch = epoch;
   }
   return MinMlj_up_;
 }
 
 const float &wwwtree::MinMlj_dn() {
-  if (not MinMlj_dn_isLoaded) {
+  if (MinMlj_dn_loadedEpoch != epoch) {
     if (MinMlj_dn_branch != 0) {
-      MinMlj_dn_branch->GetEntry(index);
+      LoadBranch(MinMlj_dn_branch);
     } else {
       printf("branch MinMlj_dn_branch does not exist!\n");
       exit(1);
     }
-    MinMlj_dn_isLoaded = true;
+    MinMlj_dn_loadedEpoch = epoch;
   }
   return MinMlj_dn_;
 }
 
 const float &wwwtree::MinMlj_jer() {
-  if (not MinMlj_jer_isLoaded) {
+  if (MinMlj_jer_loadedEpoch != epoch) {
     if (MinMlj_jer_branch != 0) {
-      MinMlj_jer_branch->GetEntry(index);
+      LoadBranch(MinMlj_jer_branch);
     } else {
       printf("branch MinMlj_jer_branch does not exist!\n");
       exit(1);
     }
-    MinMlj_jer_isLoaded = true;
+    MinMlj_jer_loadedEpoch = epoch;
   }
   return MinMlj_jer_;
 }
 
 const float &wwwtree::MinMlj_jerup() {
-  if (not MinMlj_jerup_isLoaded) {
+  if (MinMlj_jerup_loadedEpoch != epoch) {
     if (MinMlj_jerup_branch != 0) {
-      MinMlj_jerup_branch->GetEntry(index);
+      LoadBranch(MinMlj_jerup_branch);
     } else {
       printf("branch MinMlj_jerup_branch does not exist!\n");
       exit(1);
     }
-    MinMlj_jerup_isLoaded = true;
+    MinMlj_jerup_loadedEpoch = epoch;
   }
   return MinMlj_jerup_;
 }
 
 const float &wwwtree::MinMlj_jerdn() {
-  if (not MinMlj_jerdn_isLoaded) {
+  if (MinMlj_jerdn_loadedEpoch != epoch) {
     if (MinMlj_jerdn_branch != 0) {
-      MinMlj_jerdn_branch->GetEntry(index);
+      LoadBranch(MinMlj_jerdn_branch);
     } else {
       printf("branch MinMlj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MinMlj_jerdn_isLoaded = true;
+    MinMlj_jerdn_loadedEpoch = epoch;
   }
   return MinMlj_jerdn_;
 }
 
 const float &wwwtree::SumMinMlj01() {
-  if (not SumMinMlj01_isLoaded) {
+  if (SumMinMlj01_loadedEpoch != epoch) {
     if (SumMinMlj01_branch != 0) {
-      SumMinMlj01_branch->GetEntry(index);
+      LoadBranch(SumMinMlj01_branch);
     } else {
       printf("branch SumMinMlj01_branch does not exist!\n");
       exit(1);
     }
-    SumMinMlj01_isLoaded = true;
+    SumMinMlj01_loadedEpoch = epoch;
   }
   return SumMinMlj01_;
 }
 
 const float &wwwtree::SumMinMlj01_up() {
-  if (not SumMinMlj01_up_isLoaded) {
+  if (SumMinMlj01_up_loadedEpoch != epoch) {
     if (SumMinMlj01_up_branch != 0) {
-      SumMinMlj01_up_branch->GetEntry(index);
+      LoadBranch(SumMinMlj01_up_branch);
     } else {
       printf("branch SumMinMlj01_up_branch does not exist!\n");
       exit(1);
     }
-    SumMinMlj01_up_isLoaded = true;
+    SumMinMlj01_up_loadedEpoch = epoch;
   }
   return SumMinMlj01_up_;
 }
 
 const float &wwwtree::SumMinMlj01_dn() {
-  if (not SumMinMlj01_dn_isLoaded) {
+  if (SumMinMlj01_dn_loadedEpoch != epoch) {
     if (SumMinMlj01_dn_branch != 0) {
-      SumMinMlj01_dn_branch->GetEntry(index);
+      LoadBranch(SumMinMlj01_dn_branch);
     } else {
       printf("branch SumMinMlj01_dn_branch does not exist!\n");
       exit(1);
     }
-    SumMinMlj01_dn_isLoaded = true;
+    SumMinMlj01_dn_loadedEpoch = epoch;
   }
   return SumMinMlj01_dn_;
 }
 
 const float &wwwtree::SumMinMlj01_jer() {
-  if (not SumMinMlj01_jer_isLoaded) {
+  if (SumMinMlj01_jer_loadedEpoch != epoch) {
     if (SumMinMlj01_jer_branch != 0) {
-      SumMinMlj01_jer_branch->GetEntry(index);
+      LoadBranch(SumMinMlj01_jer_branch);
     } else {
       printf("branch SumMinMlj01_jer_branch does not exist!\n");
       exit(1);
     }
-    SumMinMlj01_jer_isLoaded = true;
+    SumMinMlj01_jer_loadedEpoch = epoch;
   }
   return SumMinMlj01_jer_;
 }
 
 const float &wwwtree::SumMinMlj01_jerup() {
-  if (not SumMinMlj01_jerup_isLoaded) {
+  if (SumMinMlj01_jerup_loadedEpoch != epoch) {
     if (SumMinMlj01_jerup_branch != 0) {
-      SumMinMlj01_jerup_branch->GetEntry(index);
+      LoadBranch(SumMinMlj01_jerup_branch);
     } else {
       printf("branch SumMinMlj01_jerup_branch does not exist!\n");
       exit(1);
     }
-    SumMinMlj01_jerup_isLoaded = true;
+    SumMinMlj01_jerup_loadedEpoch = epoch;
   }
   return SumMinMlj01_jerup_;
 }
 
 const float &wwwtree::SumMinMlj01_jerdn() {
-  if (not SumMinMlj01_jerdn_isLoaded) {
+  if (SumMinMlj01_jerdn_loadedEpoch != epoch) {
     if (SumMinMlj01_jerdn_branch != 0) {
-      SumMinMlj01_jerdn_branch->GetEntry(index);
+      LoadBranch(SumMinMlj01_jerdn_branch);
     } else {
       printf("branch SumMinMlj01_jerdn_branch does not exist!\n");
       exit(1);
     }
-    SumMinMlj01_jerdn_isLoaded = true;
+    SumMinMlj01_jerdn_loadedEpoch = epoch;
   }
   return SumMinMlj01_jerdn_;
 }
 
 const float &wwwtree::MaxMlj() {
-  if (not MaxMlj_isLoaded) {
+  if (MaxMlj_loadedEpoch != epoch) {
     if (MaxMlj_branch != 0) {
-      MaxMlj_branch->GetEntry(index);
+      LoadBranch(MaxMlj_branch);
     } else {
       printf("branch MaxMlj_branch does not exist!\n");
       exit(1);
     }
-    MaxMlj_isLoaded = true;
+    MaxMlj_loadedEpoch = epoch;
   }
   return MaxMlj_;
 }
 
 const float &wwwtree::MaxMlj_up() {
-  if (not MaxMlj_up_isLoaded) {
+  if (MaxMlj_up_loadedEpoch != epoch) {
     if (MaxMlj_up_branch != 0) {
-      MaxMlj_up_branch->GetEntry(index);
+      LoadBranch(MaxMlj_up_branch);
     } else {
       printf("branch MaxMlj_up_branch does not exist!\n");
       exit(1);
     }
-    MaxMlj_up_isLoaded = true;
+    MaxMlj_up_loadedEpoch = epoch;
   }
   return MaxMlj_up_;
 }
 
 const float &wwwtree::MaxMlj_dn() {
-  if (not MaxMlj_dn_isLoaded) {
+  if (MaxMlj_dn_loadedEpoch != epoch) {
     if (MaxMlj_dn_branch != 0) {
-      MaxMlj_dn_branch->GetEntry(index);
+      LoadBranch(MaxMlj_dn_branch);
     } else {
       printf("branch MaxMlj_dn_branch does not exist!\n");
       exit(1);
     }
-    MaxMlj_dn_isLoaded = true;
+    MaxMlj_dn_loadedEpoch = epoch;
   }
   return MaxMlj_dn_;
 }
 
 const float &wwwtree::MaxMlj_jer() {
-  if (not MaxMlj_jer_isLoaded) {
+  if (MaxMlj_jer_loadedEpoch != epoch) {
     if (MaxMlj_jer_branch != 0) {
-      MaxMlj_jer_branch->GetEntry(index);
+      LoadBranch(MaxMlj_jer_branch);
     } else {
       printf("branch MaxMlj_jer_branch does not exist!\n");
       exit(1);
     }
-    MaxMlj_jer_isLoaded = true;
+    MaxMlj_jer_loadedEpoch = epoch;
   }
   return MaxMlj_jer_;
 }
 
 const float &wwwtree::MaxMlj_jerup() {
-  if (not MaxMlj_jerup_isLoaded) {
+  if (MaxMlj_jerup_loadedEpoch != epoch) {
     if (MaxMlj_jerup_branch != 0) {
-      MaxMlj_jerup_branch->GetEntry(index);
+      LoadBranch(MaxMlj_jerup_branch);
     } else {
       printf("branch MaxMlj_jerup_branch does not exist!\n");
       exit(1);
     }
-    MaxMlj_jerup_isLoaded = true;
+    MaxMlj_jerup_loadedEpoch = epoch;
   }
   return MaxMlj_jerup_;
 }
 
 const float &wwwtree::MaxMlj_jerdn() {
-  if (not MaxMlj_jerdn_isLoaded) {
+  if (MaxMlj_jerdn_loadedEpoch != epoch) {
     if (MaxMlj_jerdn_branch != 0) {
-      MaxMlj_jerdn_branch->GetEntry(index);
+      LoadBranch(MaxMlj_jerdn_branch);
     } else {
       printf("branch MaxMlj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MaxMlj_jerdn_isLoaded = true;
+    MaxMlj_jerdn_loadedEpoch = epoch;
   }
   return MaxMlj_jerdn_;
 }
 
 const float &wwwtree::SumMlj() {
-  if (not SumMlj_isLoaded) {
+  if (SumMlj_loadedEpoch != epoch) {
     if (SumMlj_branch != 0) {
-      SumMlj_branch->GetEntry(index);
+      LoadBranch(SumMlj_branch);
     } else {
       printf("branch SumMlj_branch does not exist!\n");
       exit(1);
     }
-    SumMlj_isLoaded = true;
+    SumMlj_loadedEpoch = epoch;
   }
   return SumMlj_;
 }
 
 const float &wwwtree::SumMlj_up() {
-  if (not SumMlj_up_isLoaded) {
+  if (SumMlj_up_loadedEpoch != epoch) {
     if (SumMlj_up_branch != 0) {
-      SumMlj_up_branch->GetEntry(index);
+      LoadBranch(SumMlj_up_branch);
     } else {
       printf("branch SumMlj_up_branch does not exist!\n");
       exit(1);
     }
-    SumMlj_up_isLoaded = true;
+    SumMlj_up_loadedEpoch = epoch;
   }
   return SumMlj_up_;
 }
 
 const float &wwwtree::SumMlj_dn() {
-  if (not SumMlj_dn_isLoaded) {
+  if (SumMlj_dn_loadedEpoch != epoch) {
     if (SumMlj_dn_branch != 0) {
-      SumMlj_dn_branch->GetEntry(index);
+      LoadBranch(SumMlj_dn_branch);
     } else {
       printf("branch SumMlj_dn_branch does not exist!\n");
       exit(1);
     }
-    SumMlj_dn_isLoaded = true;
+    SumMlj_dn_loadedEpoch = epoch;
   }
   return SumMlj_dn_;
 }
 
 const float &wwwtree::SumMlj_jer() {
-  if (not SumMlj_jer_isLoaded) {
+  if (SumMlj_jer_loadedEpoch != epoch) {
     if (SumMlj_jer_branch != 0) {
-      SumMlj_jer_branch->GetEntry(index);
+      LoadBranch(SumMlj_jer_branch);
     } else {
       printf("branch SumMlj_jer_branch does not exist!\n");
       exit(1);
     }
-    SumMlj_jer_isLoaded = true;
+    SumMlj_jer_loadedEpoch = epoch;
   }
   return SumMlj_jer_;
 }
 
 const float &wwwtree::SumMlj_jerup() {
-  if (not SumMlj_jerup_isLoaded) {
+  if (SumMlj_jerup_loadedEpoch != epoch) {
     if (SumMlj_jerup_branch != 0) {
-      SumMlj_jerup_branch->GetEntry(index);
+      LoadBranch(SumMlj_jerup_branch);
     } else {
       printf("branch SumMlj_jerup_branch does not exist!\n");
       exit(1);
     }
-    SumMlj_jerup_isLoaded = true;
+    SumMlj_jerup_loadedEpoch = epoch;
   }
   return SumMlj_jerup_;
 }
 
 const float &wwwtree::SumMlj_jerdn() {
-  if (not SumMlj_jerdn_isLoaded) {
+  if (SumMlj_jerdn_loadedEpoch != epoch) {
     if (SumMlj_jerdn_branch != 0) {
-      SumMlj_jerdn_branch->GetEntry(index);
+      LoadBranch(SumMlj_jerdn_branch);
     } else {
       printf("branch SumMlj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    SumMlj_jerdn_isLoaded = true;
+    SumMlj_jerdn_loadedEpoch = epoch;
   }
   return SumMlj_jerdn_;
 }
 
 const float &wwwtree::Ml0jj() {
-  if (not Ml0jj_isLoaded) {
+  if (Ml0jj_loadedEpoch != epoch) {
     if (Ml0jj_branch != 0) {
-      Ml0jj_branch->GetEntry(index);
+      LoadBranch(Ml0jj_branch);
     } else {
       printf("branch Ml0jj_branch does not exist!\n");
       exit(1);
     }
-    Ml0jj_isLoaded = true;
+    Ml0jj_loadedEpoch = epoch;
   }
   return Ml0jj_;
 }
 
 const float &wwwtree::Ml0jj_up() {
-  if (not Ml0jj_up_isLoaded) {
+  if (Ml0jj_up_loadedEpoch != epoch) {
     if (Ml0jj_up_branch != 0) {
-      Ml0jj_up_branch->GetEntry(index);
+      LoadBranch(Ml0jj_up_branch);
     } else {
       printf("branch Ml0jj_up_branch does not exist!\n");
       exit(1);
     }
-    Ml0jj_up_isLoaded = true;
+    Ml0jj_up_loadedEpoch = epoch;
   }
   return Ml0jj_up_;
 }
 
 const float &wwwtree::Ml0jj_dn() {
-  if (not Ml0jj_dn_isLoaded) {
+  if (Ml0jj_dn_loadedEpoch != epoch) {
     if (Ml0jj_dn_branch != 0) {
-      Ml0jj_dn_branch->GetEntry(index);
+      LoadBranch(Ml0jj_dn_branch);
     } else {
       printf("branch Ml0jj_dn_branch does not exist!\n");
       exit(1);
     }
-    Ml0jj_dn_isLoaded = true;
+    Ml0jj_dn_loadedEpoch = epoch;
   }
   return Ml0jj_dn_;
 }
 
 const float &wwwtree::Ml0jj_jer() {
-  if (not Ml0jj_jer_isLoaded) {
+  if (Ml0jj_jer_loadedEpoch != epoch) {
     if (Ml0jj_jer_branch != 0) {
-      Ml0jj_jer_branch->GetEntry(index);
+      LoadBranch(Ml0jj_jer_branch);
     } else {
       printf("branch Ml0jj_jer_branch does not exist!\n");
       exit(1);
     }
-    Ml0jj_jer_isLoaded = true;
+    Ml0jj_jer_loadedEpoch = epoch;
   }
   return Ml0jj_jer_;
 }
 
 const float &wwwtree::Ml0jj_jerup() {
-  if (not Ml0jj_jerup_isLoaded) {
+  if (Ml0jj_jerup_loadedEpoch != epoch) {
     if (Ml0jj_jerup_branch != 0) {
-      Ml0jj_jerup_branch->GetEntry(index);
+      LoadBranch(Ml0jj_jerup_branch);
     } else {
       printf("branch Ml0jj_jerup_branch does not exist!\n");
       exit(1);
     }
-    Ml0jj_jerup_isLoaded = true;
+    Ml0jj_jerup_loadedEpoch = epoch;
   }
   return Ml0jj_jerup_;
 }
 
 const float &wwwtree::Ml0jj_jerdn() {
-  if (not Ml0jj_jerdn_isLoaded) {
+  if (Ml0jj_jerdn_loadedEpoch != epoch) {
     if (Ml0jj_jerdn_branch != 0) {
-      Ml0jj_jerdn_branch->GetEntry(index);
+      LoadBranch(Ml0jj_jerdn_branch);
     } else {
       printf("branch Ml0jj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    Ml0jj_jerdn_isLoaded = true;
+    Ml0jj_jerdn_loadedEpoch = epoch;
   }
   return Ml0jj_jerdn_;
 }
 
 const float &wwwtree::Ml1jj() {
-  if (not Ml1jj_isLoaded) {
+  if (Ml1jj_loadedEpoch != epoch) {
     if (Ml1jj_branch != 0) {
-      Ml1jj_branch->GetEntry(index);
+      LoadBranch(Ml1jj_branch);
     } else {
       printf("branch Ml1jj_branch does not exist!\n");
       exit(1);
     }
-    Ml1jj_isLoaded = true;
+    Ml1jj_loadedEpoch = epoch;
   }
   return Ml1jj_;
 }
 
 const float &wwwtree::Ml1jj_up() {
-  if (not Ml1jj_up_isLoaded) {
+  if (Ml1jj_up_loadedEpoch != epoch) {
     if (Ml1jj_up_branch != 0) {
-      Ml1jj_up_branch->GetEntry(index);
+      LoadBranch(Ml1jj_up_branch);
     } else {
       printf("branch Ml1jj_up_branch does not exist!\n");
       exit(1);
     }
-    Ml1jj_up_isLoaded = true;
+    Ml1jj_up_loadedEpoch = epoch;
   }
   return Ml1jj_up_;
 }
 
 const float &wwwtree::Ml1jj_dn() {
-  if (not Ml1jj_dn_isLoaded) {
+  if (Ml1jj_dn_loadedEpoch != epoch) {
     if (Ml1jj_dn_branch != 0) {
-      Ml1jj_dn_branch->GetEntry(index);
+      LoadBranch(Ml1jj_dn_branch);
     } else {
       printf("branch Ml1jj_dn_branch does not exist!\n");
       exit(1);
     }
-    Ml1jj_dn_isLoaded = true;
+    Ml1jj_dn_loadedEpoch = epoch;
   }
   return Ml1jj_dn_;
 }
 
 const float &wwwtree::Ml1jj_jer() {
-  if (not Ml1jj_jer_isLoaded) {
+  if (Ml1jj_jer_loadedEpoch != epoch) {
     if (Ml1jj_jer_branch != 0) {
-      Ml1jj_jer_branch->GetEntry(index);
+      LoadBranch(Ml1jj_jer_branch);
     } else {
       printf("branch Ml1jj_jer_branch does not exist!\n");
       exit(1);
     }
-    Ml1jj_jer_isLoaded = true;
+    Ml1jj_jer_loadedEpoch = epoch;
   }
   return Ml1jj_jer_;
 }
 
 const float &wwwtree::Ml1jj_jerup() {
-  if (not Ml1jj_jerup_isLoaded) {
+  if (Ml1jj_jerup_loadedEpoch != epoch) {
     if (Ml1jj_jerup_branch != 0) {
-      Ml1jj_jerup_branch->GetEntry(index);
+      LoadBranch(Ml1jj_jerup_branch);
     } else {
       printf("branch Ml1jj_jerup_branch does not exist!\n");
       exit(1);
     }
-    Ml1jj_jerup_isLoaded = true;
+    Ml1jj_jerup_loadedEpoch = epoch;
   }
   return Ml1jj_jerup_;
 }
 
 const float &wwwtree::Ml1jj_jerdn() {
-  if (not Ml1jj_jerdn_isLoaded) {
+  if (Ml1jj_jerdn_loadedEpoch != epoch) {
     if (Ml1jj_jerdn_branch != 0) {
-      Ml1jj_jerdn_branch->GetEntry(index);
+      LoadBranch(Ml1jj_jerdn_branch);
     } else {
       printf("branch Ml1jj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    Ml1jj_jerdn_isLoaded = true;
+    Ml1jj_jerdn_loadedEpoch = epoch;
   }
   return Ml1jj_jerdn_;
 }
 
 const float &wwwtree::MinMljj() {
-  if (not MinMljj_isLoaded) {
+  if (MinMljj_loadedEpoch != epoch) {
     if (MinMljj_branch != 0) {
-      MinMljj_branch->GetEntry(index);
+      LoadBranch(MinMljj_branch);
     } else {
       printf("branch MinMljj_branch does not exist!\n");
       exit(1);
     }
-    MinMljj_isLoaded = true;
+    MinMljj_loadedEpoch = epoch;
   }
   return MinMljj_;
 }
 
 const float &wwwtree::MinMljj_up() {
-  if (not MinMljj_up_isLoaded) {
+  if (MinMljj_up_loadedEpoch != epoch) {
     if (MinMljj_up_branch != 0) {
-      MinMljj_up_branch->GetEntry(index);
+      LoadBranch(MinMljj_up_branch);
     } else {
       printf("branch MinMljj_up_branch does not exist!\n");
       exit(1);
     }
-    MinMljj_up_isLoaded = true;
+    MinMljj_up_loadedEpoch = epoch;
   }
   return MinMljj_up_;
 }
 
 const float &wwwtree::MinMljj_dn() {
-  if (not MinMljj_dn_isLoaded) {
+  if (MinMljj_dn_loadedEpoch != epoch) {
     if (MinMljj_dn_branch != 0) {
-      MinMljj_dn_branch->GetEntry(index);
+      LoadBranch(MinMljj_dn_branch);
     } else {
       printf("branch MinMljj_dn_branch does not exist!\n");
       exit(1);
     }
-    MinMljj_dn_isLoaded = true;
+    MinMljj_dn_loadedEpoch = epoch;
   }
   return MinMljj_dn_;
 }
 
 const float &wwwtree::MinMljj_jer() {
-  if (not MinMljj_jer_isLoaded) {
+  if (MinMljj_jer_loadedEpoch != epoch) {
     if (MinMljj_jer_branch != 0) {
-      MinMljj_jer_branch->GetEntry(index);
+      LoadBranch(MinMljj_jer_branch);
     } else {
       printf("branch MinMljj_jer_branch does not exist!\n");
       exit(1);
     }
-    MinMljj_jer_isLoaded = true;
+    MinMljj_jer_loadedEpoch = epoch;
   }
   return MinMljj_jer_;
 }
 
 const float &wwwtree::MinMljj_jerup() {
-  if (not MinMljj_jerup_isLoaded) {
+  if (MinMljj_jerup_loadedEpoch != epoch) {
     if (MinMljj_jerup_branch != 0) {
-      MinMljj_jerup_branch->GetEntry(index);
+      LoadBranch(MinMljj_jerup_branch);
     } else {
       printf("branch MinMljj_jerup_branch does not exist!\n");
       exit(1);
     }
-    MinMljj_jerup_isLoaded = true;
+    MinMljj_jerup_loadedEpoch = epoch;
   }
   return MinMljj_jerup_;
 }
 
 const float &wwwtree::MinMljj_jerdn() {
-  if (not MinMljj_jerdn_isLoaded) {
+  if (MinMljj_jerdn_loadedEpoch != epoch) {
     if (MinMljj_jerdn_branch != 0) {
-      MinMljj_jerdn_branch->GetEntry(index);
+      LoadBranch(MinMljj_jerdn_branch);
     } else {
       printf("branch MinMljj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MinMljj_jerdn_isLoaded = true;
+    MinMljj_jerdn_loadedEpoch = epoch;
   }
   return MinMljj_jerdn_;
 }
 
 const float &wwwtree::MaxMljj() {
-  if (not MaxMljj_isLoaded) {
+  if (MaxMljj_loadedEpoch != epoch) {
     if (MaxMljj_branch != 0) {
-      MaxMljj_branch->GetEntry(index);
+      LoadBranch(MaxMljj_branch);
     } else {
       printf("branch MaxMljj_branch does not exist!\n");
       exit(1);
     }
-    MaxMljj_isLoaded = true;
+    MaxMljj_loadedEpoch = epoch;
   }
   return MaxMljj_;
 }
 
 const float &wwwtree::MaxMljj_up() {
-  if (not MaxMljj_up_isLoaded) {
+  if (MaxMljj_up_loadedEpoch != epoch) {
     if (MaxMljj_up_branch != 0) {
-      MaxMljj_up_branch->GetEntry(index);
+      LoadBranch(MaxMljj_up_branch);
     } else {
       printf("branch MaxMljj_up_branch does not exist!\n");
       exit(1);
     }
-    MaxMljj_up_isLoaded = true;
+    MaxMljj_up_loadedEpoch = epoch;
   }
   return MaxMljj_up_;
 }
 
 const float &wwwtree::MaxMljj_dn() {
-  if (not MaxMljj_dn_isLoaded) {
+  if (MaxMljj_dn_loadedEpoch != epoch) {
     if (MaxMljj_dn_branch != 0) {
-      MaxMljj_dn_branch->GetEntry(index);
+      LoadBranch(MaxMljj_dn_branch);
     } else {
       printf("branch MaxMljj_dn_branch does not exist!\n");
       exit(1);
     }
-    MaxMljj_dn_isLoaded = true;
+    MaxMljj_dn_loadedEpoch = epoch;
   }
   return MaxMljj_dn_;
 }
 
 const float &wwwtree::MaxMljj_jer() {
-  if (not MaxMljj_jer_isLoaded) {
+  if (MaxMljj_jer_loadedEpoch != epoch) {
     if (MaxMljj_jer_branch != 0) {
-      MaxMljj_jer_branch->GetEntry(index);
+      LoadBranch(MaxMljj_jer_branch);
     } else {
       printf("branch MaxMljj_jer_branch does not exist!\n");
       exit(1);
     }
-    MaxMljj_jer_isLoaded = true;
+    MaxMljj_jer_loadedEpoch = epoch;
   }
   return MaxMljj_jer_;
 }
 
 const float &wwwtree::MaxMljj_jerup() {
-  if (not MaxMljj_jerup_isLoaded) {
+  if (MaxMljj_jerup_loadedEpoch != epoch) {
     if (MaxMljj_jerup_branch != 0) {
-      MaxMljj_jerup_branch->GetEntry(index);
+      LoadBranch(MaxMljj_jerup_branch);
     } else {
       printf("branch MaxMljj_jerup_branch does not exist!\n");
       exit(1);
     }
-    MaxMljj_jerup_isLoaded = true;
+    MaxMljj_jerup_loadedEpoch = epoch;
   }
   return MaxMljj_jerup_;
 }
 
 const float &wwwtree::MaxMljj_jerdn() {
-  if (not MaxMljj_jerdn_isLoaded) {
+  if (MaxMljj_jerdn_loadedEpoch != epoch) {
     if (MaxMljj_jerdn_branch != 0) {
-      MaxMljj_jerdn_branch->GetEntry(index);
+      LoadBranch(MaxMljj_jerdn_branch);
     } else {
       printf("branch MaxMljj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MaxMljj_jerdn_isLoaded = true;
+    MaxMljj_jerdn_loadedEpoch = epoch;
   }
   return MaxMljj_jerdn_;
 }
 
 const float &wwwtree::SumMljj() {
-  if (not SumMljj_isLoaded) {
+  if (SumMljj_loadedEpoch != epoch) {
     if (SumMljj_branch != 0) {
-      SumMljj_branch->GetEntry(index);
+      LoadBranch(SumMljj_branch);
     } else {
       printf("branch SumMljj_branch does not exist!\n");
       exit(1);
     }
-    SumMljj_isLoaded = true;
+    SumMljj_loadedEpoch = epoch;
   }
   return SumMljj_;
 }
 
 const float &wwwtree::SumMljj_up() {
-  if (not SumMljj_up_isLoaded) {
+  if (SumMljj_up_loadedEpoch != epoch) {
     if (SumMljj_up_branch != 0) {
-      SumMljj_up_branch->GetEntry(index);
+      LoadBranch(SumMljj_up_branch);
     } else {
       printf("branch SumMljj_up_branch does not exist!\n");
       exit(1);
     }
-    SumMljj_up_isLoaded = true;
+    SumMljj_up_loadedEpoch = epoch;
   }
   return SumMljj_up_;
 }
 
 const float &wwwtree::SumMljj_dn() {
-  if (not SumMljj_dn_isLoaded) {
+  if (SumMljj_dn_loadedEpoch != epoch) {
     if (SumMljj_dn_branch != 0) {
-      SumMljj_dn_branch->GetEntry(index);
+      LoadBranch(SumMljj_dn_branch);
     } else {
       printf("branch SumMljj_dn_branch does not exist!\n");
       exit(1);
     }
-    SumMljj_dn_isLoaded = true;
+    SumMljj_dn_loadedEpoch = epoch;
   }
   return SumMljj_dn_;
 }
 
 const float &wwwtree::SumMljj_jer() {
-  if (not SumMljj_jer_isLoaded) {
+  if (SumMljj_jer_loadedEpoch != epoch) {
     if (SumMljj_jer_branch != 0) {
-      SumMljj_jer_branch->GetEntry(index);
+      LoadBranch(SumMljj_jer_branch);
     } else {
       printf("branch SumMljj_jer_branch does not exist!\n");
       exit(1);
     }
-    SumMljj_jer_isLoaded = true;
+    SumMljj_jer_loadedEpoch = epoch;
   }
   return SumMljj_jer_;
 }
 
 const float &wwwtree::SumMljj_jerup() {
-  if (not SumMljj_jerup_isLoaded) {
+  if (SumMljj_jerup_loadedEpoch != epoch) {
     if (SumMljj_jerup_branch != 0) {
-      SumMljj_jerup_branch->GetEntry(index);
+      LoadBranch(SumMljj_jerup_branch);
     } else {
       printf("branch SumMljj_jerup_branch does not exist!\n");
       exit(1);
     }
-    SumMljj_jerup_isLoaded = true;
+    SumMljj_jerup_loadedEpoch = epoch;
   }
   return SumMljj_jerup_;
 }
 
 const float &wwwtree::SumMljj_jerdn() {
-  if (not SumMljj_jerdn_isLoaded) {
+  if (SumMljj_jerdn_loadedEpoch != epoch) {
     if (SumMljj_jerdn_branch != 0) {
-      SumMljj_jerdn_branch->GetEntry(index);
+      LoadBranch(SumMljj_jerdn_branch);
     } else {
       printf("branch SumMljj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    SumMljj_jerdn_isLoaded = true;
+    SumMljj_jerdn_loadedEpoch = epoch;
   }
   return SumMljj_jerdn_;
 }
 
 const float &wwwtree::Mjj() {
-  if (not Mjj_isLoaded) {
+  if (Mjj_loadedEpoch != epoch) {
     if (Mjj_branch != 0) {
-      Mjj_branch->GetEntry(index);
+      LoadBranch(Mjj_branch);
     } else {
       printf("branch Mjj_branch does not exist!\n");
       exit(1);
     }
-    Mjj_isLoaded = true;
+    Mjj_loadedEpoch = epoch;
   }
   return Mjj_;
 }
 
 const float &wwwtree::Mjj_up() {
-  if (not Mjj_up_isLoaded) {
+  if (Mjj_up_loadedEpoch != epoch) {
     if (Mjj_up_branch != 0) {
-      Mjj_up_branch->GetEntry(index);
+      LoadBranch(Mjj_up_branch);
     } else {
       printf("branch Mjj_up_branch does not exist!\n");
       exit(1);
     }
-    Mjj_up_isLoaded = true;
+    Mjj_up_loadedEpoch = epoch;
   }
   return Mjj_up_;
 }
 
 const float &wwwtree::Mjj_dn() {
-  if (not Mjj_dn_isLoaded) {
+  if (Mjj_dn_loadedEpoch != epoch) {
     if (Mjj_dn_branch != 0) {
-      Mjj_dn_branch->GetEntry(index);
+      LoadBranch(Mjj_dn_branch);
     } else {
       printf("branch Mjj_dn_branch does not exist!\n");
       exit(1);
     }
-    Mjj_dn_isLoaded = true;
+    Mjj_dn_loadedEpoch = epoch;
   }
   return Mjj_dn_;
 }
 
 const float &wwwtree::Mjj_jer() {
-  if (not Mjj_jer_isLoaded) {
+  if (Mjj_jer_loadedEpoch != epoch) {
     if (Mjj_jer_branch != 0) {
-      Mjj_jer_branch->GetEntry(index);
+      LoadBranch(Mjj_jer_branch);
     } else {
       printf("branch Mjj_jer_branch does not exist!\n");
       exit(1);
     }
-    Mjj_jer_isLoaded = true;
+    Mjj_jer_loadedEpoch = epoch;
   }
   return Mjj_jer_;
 }
 
 const float &wwwtree::Mjj_jerup() {
-  if (not Mjj_jerup_isLoaded) {
+  if (Mjj_jerup_loadedEpoch != epoch) {
     if (Mjj_jerup_branch != 0) {
-      Mjj_jerup_branch->GetEntry(index);
+      LoadBranch(Mjj_jerup_branch);
     } else {
       printf("branch Mjj_jerup_branch does not exist!\n");
       exit(1);
     }
-    Mjj_jerup_isLoaded = true;
+    Mjj_jerup_loadedEpoch = epoch;
   }
   return Mjj_jerup_;
 }
 
 const float &wwwtree::Mjj_jerdn() {
-  if (not Mjj_jerdn_isLoaded) {
+  if (Mjj_jerdn_loadedEpoch != epoch) {
     if (Mjj_jerdn_branch != 0) {
-      Mjj_jerdn_branch->GetEntry(index);
+      LoadBranch(Mjj_jerdn_branch);
     } else {
       printf("branch Mjj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    Mjj_jerdn_isLoaded = true;
+    Mjj_jerdn_loadedEpoch = epoch;
   }
   return Mjj_jerdn_;
 }
 
 const float &wwwtree::DRjj() {
-  if (not DRjj_isLoaded) {
+  if (DRjj_loadedEpoch != epoch) {
     if (DRjj_branch != 0) {
-      DRjj_branch->GetEntry(index);
+      LoadBranch(DRjj_branch);
     } else {
       printf("branch DRjj_branch does not exist!\n");
       exit(1);
     }
-    DRjj_isLoaded = true;
+    DRjj_loadedEpoch = epoch;
   }
   return DRjj_;
 }
 
 const float &wwwtree::DRjj_up() {
-  if (not DRjj_up_isLoaded) {
+  if (DRjj_up_loadedEpoch != epoch) {
     if (DRjj_up_branch != 0) {
-      DRjj_up_branch->GetEntry(index);
+      LoadBranch(DRjj_up_branch);
     } else {
       printf("branch DRjj_up_branch does not exist!\n");
       exit(1);
     }
-    DRjj_up_isLoaded = true;
+    DRjj_up_loadedEpoch = epoch;
   }
   return DRjj_up_;
 }
 
 const float &wwwtree::DRjj_dn() {
-  if (not DRjj_dn_isLoaded) {
+  if (DRjj_dn_loadedEpoch != epoch) {
     if (DRjj_dn_branch != 0) {
-      DRjj_dn_branch->GetEntry(index);
+      LoadBranch(DRjj_dn_branch);
     } else {
       printf("branch DRjj_dn_branch does not exist!\n");
       exit(1);
     }
-    DRjj_dn_isLoaded = true;
+    DRjj_dn_loadedEpoch = epoch;
   }
   return DRjj_dn_;
 }
 
 const float &wwwtree::DRjj_jer() {
-  if (not DRjj_jer_isLoaded) {
+  if (DRjj_jer_loadedEpoch != epoch) {
     if (DRjj_jer_branch != 0) {
-      DRjj_jer_branch->GetEntry(index);
+      LoadBranch(DRjj_jer_branch);
     } else {
       printf("branch DRjj_jer_branch does not exist!\n");
       exit(1);
     }
-    DRjj_jer_isLoaded = true;
+    DRjj_jer_loadedEpoch = epoch;
   }
   return DRjj_jer_;
 }
 
 const float &wwwtree::DRjj_jerup() {
-  if (not DRjj_jerup_isLoaded) {
+  if (DRjj_jerup_loadedEpoch != epoch) {
     if (DRjj_jerup_branch != 0) {
-      DRjj_jerup_branch->GetEntry(index);
+      LoadBranch(DRjj_jerup_branch);
     } else {
       printf("branch DRjj_jerup_branch does not exist!\n");
       exit(1);
     }
-    DRjj_jerup_isLoaded = true;
+    DRjj_jerup_loadedEpoch = epoch;
   }
   return DRjj_jerup_;
 }
 
 const float &wwwtree::DRjj_jerdn() {
-  if (not DRjj_jerdn_isLoaded) {
+  if (DRjj_jerdn_loadedEpoch != epoch) {
     if (DRjj_jerdn_branch != 0) {
-      DRjj_jerdn_branch->GetEntry(index);
+      LoadBranch(DRjj_jerdn_branch);
     } else {
       printf("branch DRjj_jerdn_branch does not exist!\n");
       exit(1);
     }
-    DRjj_jerdn_isLoaded = true;
+    DRjj_jerdn_loadedEpoch = epoch;
   }
   return DRjj_jerdn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4() {
-  if (not jet0_wtag_p4_isLoaded) {
+  if (jet0_wtag_p4_loadedEpoch != epoch) {
     if (jet0_wtag_p4_branch != 0) {
-      jet0_wtag_p4_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_branch);
     } else {
       printf("branch jet0_wtag_p4_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_isLoaded = true;
+    jet0_wtag_p4_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_up() {
-  if (not jet0_wtag_p4_up_isLoaded) {
+  if (jet0_wtag_p4_up_loadedEpoch != epoch) {
     if (jet0_wtag_p4_up_branch != 0) {
-      jet0_wtag_p4_up_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_up_branch);
     } else {
       printf("branch jet0_wtag_p4_up_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_up_isLoaded = true;
+    jet0_wtag_p4_up_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_up_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_dn() {
-  if (not jet0_wtag_p4_dn_isLoaded) {
+  if (jet0_wtag_p4_dn_loadedEpoch != epoch) {
     if (jet0_wtag_p4_dn_branch != 0) {
-      jet0_wtag_p4_dn_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_dn_branch);
     } else {
       printf("branch jet0_wtag_p4_dn_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_dn_isLoaded = true;
+    jet0_wtag_p4_dn_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_dn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_jer() {
-  if (not jet0_wtag_p4_jer_isLoaded) {
+  if (jet0_wtag_p4_jer_loadedEpoch != epoch) {
     if (jet0_wtag_p4_jer_branch != 0) {
-      jet0_wtag_p4_jer_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_jer_branch);
     } else {
       printf("branch jet0_wtag_p4_jer_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_jer_isLoaded = true;
+    jet0_wtag_p4_jer_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_jer_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_jerup() {
-  if (not jet0_wtag_p4_jerup_isLoaded) {
+  if (jet0_wtag_p4_jerup_loadedEpoch != epoch) {
     if (jet0_wtag_p4_jerup_branch != 0) {
-      jet0_wtag_p4_jerup_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_jerup_branch);
     } else {
       printf("branch jet0_wtag_p4_jerup_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_jerup_isLoaded = true;
+    jet0_wtag_p4_jerup_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_jerup_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_jerdn() {
-  if (not jet0_wtag_p4_jerdn_isLoaded) {
+  if (jet0_wtag_p4_jerdn_loadedEpoch != epoch) {
     if (jet0_wtag_p4_jerdn_branch != 0) {
-      jet0_wtag_p4_jerdn_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_jerdn_branch);
     } else {
       printf("branch jet0_wtag_p4_jerdn_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_jerdn_isLoaded = true;
+    jet0_wtag_p4_jerdn_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_jerdn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4() {
-  if (not jet1_wtag_p4_isLoaded) {
+  if (jet1_wtag_p4_loadedEpoch != epoch) {
     if (jet1_wtag_p4_branch != 0) {
-      jet1_wtag_p4_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_branch);
     } else {
       printf("branch jet1_wtag_p4_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_isLoaded = true;
+    jet1_wtag_p4_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_up() {
-  if (not jet1_wtag_p4_up_isLoaded) {
+  if (jet1_wtag_p4_up_loadedEpoch != epoch) {
     if (jet1_wtag_p4_up_branch != 0) {
-      jet1_wtag_p4_up_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_up_branch);
     } else {
       printf("branch jet1_wtag_p4_up_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_up_isLoaded = true;
+    jet1_wtag_p4_up_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_up_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_dn() {
-  if (not jet1_wtag_p4_dn_isLoaded) {
+  if (jet1_wtag_p4_dn_loadedEpoch != epoch) {
     if (jet1_wtag_p4_dn_branch != 0) {
-      jet1_wtag_p4_dn_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_dn_branch);
     } else {
       printf("branch jet1_wtag_p4_dn_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_dn_isLoaded = true;
+    jet1_wtag_p4_dn_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_dn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_jer() {
-  if (not jet1_wtag_p4_jer_isLoaded) {
+  if (jet1_wtag_p4_jer_loadedEpoch != epoch) {
     if (jet1_wtag_p4_jer_branch != 0) {
-      jet1_wtag_p4_jer_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_jer_branch);
     } else {
       printf("branch jet1_wtag_p4_jer_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_jer_isLoaded = true;
+    jet1_wtag_p4_jer_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_jer_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_jerup() {
-  if (not jet1_wtag_p4_jerup_isLoaded) {
+  if (jet1_wtag_p4_jerup_loadedEpoch != epoch) {
     if (jet1_wtag_p4_jerup_branch != 0) {
-      jet1_wtag_p4_jerup_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_jerup_branch);
     } else {
       printf("branch jet1_wtag_p4_jerup_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_jerup_isLoaded = true;
+    jet1_wtag_p4_jerup_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_jerup_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_jerdn() {
-  if (not jet1_wtag_p4_jerdn_isLoaded) {
+  if (jet1_wtag_p4_jerdn_loadedEpoch != epoch) {
     if (jet1_wtag_p4_jerdn_branch != 0) {
-      jet1_wtag_p4_jerdn_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_jerdn_branch);
     } else {
       printf("branch jet1_wtag_p4_jerdn_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_jerdn_isLoaded = true;
+    jet1_wtag_p4_jerdn_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_jerdn_;
 }
 
 const float &wwwtree::MjjDR1() {
-  if (not MjjDR1_isLoaded) {
+  if (MjjDR1_loadedEpoch != epoch) {
     if (MjjDR1_branch != 0) {
-      MjjDR1_branch->GetEntry(index);
+      LoadBranch(MjjDR1_branch);
     } else {
       printf("branch MjjDR1_branch does not exist!\n");
       exit(1);
     }
-    MjjDR1_isLoaded = true;
+    MjjDR1_loadedEpoch = epoch;
   }
   return MjjDR1_;
 }
 
 const float &wwwtree::MjjDR1_up() {
-  if (not MjjDR1_up_isLoaded) {
+  if (MjjDR1_up_loadedEpoch != epoch) {
     if (MjjDR1_up_branch != 0) {
-      MjjDR1_up_branch->GetEntry(index);
+      LoadBranch(MjjDR1_up_branch);
     } else {
       printf("branch MjjDR1_up_branch does not exist!\n");
       exit(1);
     }
-    MjjDR1_up_isLoaded = true;
+    MjjDR1_up_loadedEpoch = epoch;
   }
   return MjjDR1_up_;
 }
 
 const float &wwwtree::MjjDR1_dn() {
-  if (not MjjDR1_dn_isLoaded) {
+  if (MjjDR1_dn_loadedEpoch != epoch) {
     if (MjjDR1_dn_branch != 0) {
-      MjjDR1_dn_branch->GetEntry(index);
+      LoadBranch(MjjDR1_dn_branch);
     } else {
       printf("branch MjjDR1_dn_branch does not exist!\n");
       exit(1);
     }
-    MjjDR1_dn_isLoaded = true;
+    MjjDR1_dn_loadedEpoch = epoch;
   }
   return MjjDR1_dn_;
 }
 
 const float &wwwtree::MjjDR1_jer() {
-  if (not MjjDR1_jer_isLoaded) {
+  if (MjjDR1_jer_loadedEpoch != epoch) {
     if (MjjDR1_jer_branch != 0) {
-      MjjDR1_jer_branch->GetEntry(index);
+      LoadBranch(MjjDR1_jer_branch);
     } else {
       printf("branch MjjDR1_jer_branch does not exist!\n");
       exit(1);
     }
-    MjjDR1_jer_isLoaded = true;
+    MjjDR1_jer_loadedEpoch = epoch;
   }
   return MjjDR1_jer_;
 }
 
 const float &wwwtree::MjjDR1_jerup() {
-  if (not MjjDR1_jerup_isLoaded) {
+  if (MjjDR1_jerup_loadedEpoch != epoch) {
     if (MjjDR1_jerup_branch != 0) {
-      MjjDR1_jerup_branch->GetEntry(index);
+      LoadBranch(MjjDR1_jerup_branch);
     } else {
       printf("branch MjjDR1_jerup_branch does not exist!\n");
       exit(1);
     }
-    MjjDR1_jerup_isLoaded = true;
+    MjjDR1_jerup_loadedEpoch = epoch;
   }
   return MjjDR1_jerup_;
 }
 
 const float &wwwtree::MjjDR1_jerdn() {
-  if (not MjjDR1_jerdn_isLoaded) {
+  if (MjjDR1_jerdn_loadedEpoch != epoch) {
     if (MjjDR1_jerdn_branch != 0) {
-      MjjDR1_jerdn_branch->GetEntry(index);
+      LoadBranch(MjjDR1_jerdn_branch);
     } else {
       printf("branch MjjDR1_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MjjDR1_jerdn_isLoaded = true;
+    MjjDR1_jerdn_loadedEpoch = epoch;
   }
   return MjjDR1_jerdn_;
 }
 
 const float &wwwtree::DRjjDR1() {
-  if (not DRjjDR1_isLoaded) {
+  if (DRjjDR1_loadedEpoch != epoch) {
     if (DRjjDR1_branch != 0) {
-      DRjjDR1_branch->GetEntry(index);
+      LoadBranch(DRjjDR1_branch);
     } else {
       printf("branch DRjjDR1_branch does not exist!\n");
       exit(1);
     }
-    DRjjDR1_isLoaded = true;
+    DRjjDR1_loadedEpoch = epoch;
   }
   return DRjjDR1_;
 }
 
 const float &wwwtree::DRjjDR1_up() {
-  if (not DRjjDR1_up_isLoaded) {
+  if (DRjjDR1_up_loadedEpoch != epoch) {
     if (DRjjDR1_up_branch != 0) {
-      DRjjDR1_up_branch->GetEntry(index);
+      LoadBranch(DRjjDR1_up_branch);
     } else {
       printf("branch DRjjDR1_up_branch does not exist!\n");
       exit(1);
     }
-    DRjjDR1_up_isLoaded = true;
+    DRjjDR1_up_loadedEpoch = epoch;
   }
   return DRjjDR1_up_;
 }
 
 const float &wwwtree::DRjjDR1_dn() {
-  if (not DRjjDR1_dn_isLoaded) {
+  if (DRjjDR1_dn_loadedEpoch != epoch) {
     if (DRjjDR1_dn_branch != 0) {
-      DRjjDR1_dn_branch->GetEntry(index);
+      LoadBranch(DRjjDR1_dn_branch);
     } else {
       printf("branch DRjjDR1_dn_branch does not exist!\n");
       exit(1);
     }
-    DRjjDR1_dn_isLoaded = true;
+    DRjjDR1_dn_loadedEpoch = epoch;
   }
   return DRjjDR1_dn_;
 }
 
 const float &wwwtree::DRjjDR1_jer() {
-  if (not DRjjDR1_jer_isLoaded) {
+  if (DRjjDR1_jer_loadedEpoch != epoch) {
     if (DRjjDR1_jer_branch != 0) {
-      DRjjDR1_jer_branch->GetEntry(index);
+      LoadBranch(DRjjDR1_jer_branch);
     } else {
       printf("branch DRjjDR1_jer_branch does not exist!\n");
       exit(1);
     }
-    DRjjDR1_jer_isLoaded = true;
+    DRjjDR1_jer_loadedEpoch = epoch;
   }
   return DRjjDR1_jer_;
 }
 
 const float &wwwtree::DRjjDR1_jerup() {
-  if (not DRjjDR1_jerup_isLoaded) {
+  if (DRjjDR1_jerup_loadedEpoch != epoch) {
     if (DRjjDR1_jerup_branch != 0) {
-      DRjjDR1_jerup_branch->GetEntry(index);
+      LoadBranch(DRjjDR1_jerup_branch);
     } else {
       printf("branch DRjjDR1_jerup_branch does not exist!\n");
       exit(1);
     }
-    DRjjDR1_jerup_isLoaded = true;
+    DRjjDR1_jerup_loadedEpoch = epoch;
   }
   return DRjjDR1_jerup_;
 }
 
 const float &wwwtree::DRjjDR1_jerdn() {
-  if (not DRjjDR1_jerdn_isLoaded) {
+  if (DRjjDR1_jerdn_loadedEpoch != epoch) {
     if (DRjjDR1_jerdn_branch != 0) {
-      DRjjDR1_jerdn_branch->GetEntry(index);
+      LoadBranch(DRjjDR1_jerdn_branch);
     } else {
       printf("branch DRjjDR1_jerdn_branch does not exist!\n");
       exit(1);
     }
-    DRjjDR1_jerdn_isLoaded = true;
+    DRjjDR1_jerdn_loadedEpoch = epoch;
   }
   return DRjjDR1_jerdn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_DR1() {
-  if (not jet0_wtag_p4_DR1_isLoaded) {
+  if (jet0_wtag_p4_DR1_loadedEpoch != epoch) {
     if (jet0_wtag_p4_DR1_branch != 0) {
-      jet0_wtag_p4_DR1_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_DR1_branch);
     } else {
       printf("branch jet0_wtag_p4_DR1_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_DR1_isLoaded = true;
+    jet0_wtag_p4_DR1_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_DR1_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_DR1_up() {
-  if (not jet0_wtag_p4_DR1_up_isLoaded) {
+  if (jet0_wtag_p4_DR1_up_loadedEpoch != epoch) {
     if (jet0_wtag_p4_DR1_up_branch != 0) {
-      jet0_wtag_p4_DR1_up_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_DR1_up_branch);
     } else {
       printf("branch jet0_wtag_p4_DR1_up_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_DR1_up_isLoaded = true;
+    jet0_wtag_p4_DR1_up_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_DR1_up_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_DR1_dn() {
-  if (not jet0_wtag_p4_DR1_dn_isLoaded) {
+  if (jet0_wtag_p4_DR1_dn_loadedEpoch != epoch) {
     if (jet0_wtag_p4_DR1_dn_branch != 0) {
-      jet0_wtag_p4_DR1_dn_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_DR1_dn_branch);
     } else {
       printf("branch jet0_wtag_p4_DR1_dn_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_DR1_dn_isLoaded = true;
+    jet0_wtag_p4_DR1_dn_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_DR1_dn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_DR1_jer() {
-  if (not jet0_wtag_p4_DR1_jer_isLoaded) {
+  if (jet0_wtag_p4_DR1_jer_loadedEpoch != epoch) {
     if (jet0_wtag_p4_DR1_jer_branch != 0) {
-      jet0_wtag_p4_DR1_jer_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_DR1_jer_branch);
     } else {
       printf("branch jet0_wtag_p4_DR1_jer_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_DR1_jer_isLoaded = true;
+    jet0_wtag_p4_DR1_jer_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_DR1_jer_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_DR1_jerup() {
-  if (not jet0_wtag_p4_DR1_jerup_isLoaded) {
+  if (jet0_wtag_p4_DR1_jerup_loadedEpoch != epoch) {
     if (jet0_wtag_p4_DR1_jerup_branch != 0) {
-      jet0_wtag_p4_DR1_jerup_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_DR1_jerup_branch);
     } else {
       printf("branch jet0_wtag_p4_DR1_jerup_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_DR1_jerup_isLoaded = true;
+    jet0_wtag_p4_DR1_jerup_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_DR1_jerup_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet0_wtag_p4_DR1_jerdn() {
-  if (not jet0_wtag_p4_DR1_jerdn_isLoaded) {
+  if (jet0_wtag_p4_DR1_jerdn_loadedEpoch != epoch) {
     if (jet0_wtag_p4_DR1_jerdn_branch != 0) {
-      jet0_wtag_p4_DR1_jerdn_branch->GetEntry(index);
+      LoadBranch(jet0_wtag_p4_DR1_jerdn_branch);
     } else {
       printf("branch jet0_wtag_p4_DR1_jerdn_branch does not exist!\n");
       exit(1);
     }
-    jet0_wtag_p4_DR1_jerdn_isLoaded = true;
+    jet0_wtag_p4_DR1_jerdn_loadedEpoch = epoch;
   }
   return *jet0_wtag_p4_DR1_jerdn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_DR1() {
-  if (not jet1_wtag_p4_DR1_isLoaded) {
+  if (jet1_wtag_p4_DR1_loadedEpoch != epoch) {
     if (jet1_wtag_p4_DR1_branch != 0) {
-      jet1_wtag_p4_DR1_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_DR1_branch);
     } else {
       printf("branch jet1_wtag_p4_DR1_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_DR1_isLoaded = true;
+    jet1_wtag_p4_DR1_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_DR1_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_DR1_up() {
-  if (not jet1_wtag_p4_DR1_up_isLoaded) {
+  if (jet1_wtag_p4_DR1_up_loadedEpoch != epoch) {
     if (jet1_wtag_p4_DR1_up_branch != 0) {
-      jet1_wtag_p4_DR1_up_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_DR1_up_branch);
     } else {
       printf("branch jet1_wtag_p4_DR1_up_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_DR1_up_isLoaded = true;
+    jet1_wtag_p4_DR1_up_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_DR1_up_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_DR1_dn() {
-  if (not jet1_wtag_p4_DR1_dn_isLoaded) {
+  if (jet1_wtag_p4_DR1_dn_loadedEpoch != epoch) {
     if (jet1_wtag_p4_DR1_dn_branch != 0) {
-      jet1_wtag_p4_DR1_dn_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_DR1_dn_branch);
     } else {
       printf("branch jet1_wtag_p4_DR1_dn_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_DR1_dn_isLoaded = true;
+    jet1_wtag_p4_DR1_dn_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_DR1_dn_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_DR1_jer() {
-  if (not jet1_wtag_p4_DR1_jer_isLoaded) {
+  if (jet1_wtag_p4_DR1_jer_loadedEpoch != epoch) {
     if (jet1_wtag_p4_DR1_jer_branch != 0) {
-      jet1_wtag_p4_DR1_jer_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_DR1_jer_branch);
     } else {
       printf("branch jet1_wtag_p4_DR1_jer_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_DR1_jer_isLoaded = true;
+    jet1_wtag_p4_DR1_jer_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_DR1_jer_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_DR1_jerup() {
-  if (not jet1_wtag_p4_DR1_jerup_isLoaded) {
+  if (jet1_wtag_p4_DR1_jerup_loadedEpoch != epoch) {
     if (jet1_wtag_p4_DR1_jerup_branch != 0) {
-      jet1_wtag_p4_DR1_jerup_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_DR1_jerup_branch);
     } else {
       printf("branch jet1_wtag_p4_DR1_jerup_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_DR1_jerup_isLoaded = true;
+    jet1_wtag_p4_DR1_jerup_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_DR1_jerup_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &wwwtree::jet1_wtag_p4_DR1_jerdn() {
-  if (not jet1_wtag_p4_DR1_jerdn_isLoaded) {
+  if (jet1_wtag_p4_DR1_jerdn_loadedEpoch != epoch) {
     if (jet1_wtag_p4_DR1_jerdn_branch != 0) {
-      jet1_wtag_p4_DR1_jerdn_branch->GetEntry(index);
+      LoadBranch(jet1_wtag_p4_DR1_jerdn_branch);
     } else {
       printf("branch jet1_wtag_p4_DR1_jerdn_branch does not exist!\n");
       exit(1);
     }
-    jet1_wtag_p4_DR1_jerdn_isLoaded = true;
+    jet1_wtag_p4_DR1_jerdn_loadedEpoch = epoch;
   }
   return *jet1_wtag_p4_DR1_jerdn_;
 }
 
 const float &wwwtree::MjjVBF() {
-  if (not MjjVBF_isLoaded) {
+  if (MjjVBF_loadedEpoch != epoch) {
     if (MjjVBF_branch != 0) {
-      MjjVBF_branch->GetEntry(index);
+      LoadBranch(MjjVBF_branch);
     } else {
       printf("branch MjjVBF_branch does not exist!\n");
       exit(1);
     }
-    MjjVBF_isLoaded = true;
+    MjjVBF_loadedEpoch = epoch;
   }
   return MjjVBF_;
 }
 
 const float &wwwtree::MjjVBF_up() {
-  if (not MjjVBF_up_isLoaded) {
+  if (MjjVBF_up_loadedEpoch != epoch) {
     if (MjjVBF_up_branch != 0) {
-      MjjVBF_up_branch->GetEntry(index);
+      LoadBranch(MjjVBF_up_branch);
     } else {
       printf("branch MjjVBF_up_branch does not exist!\n");
       exit(1);
     }
-    MjjVBF_up_isLoaded = true;
+    MjjVBF_up_loadedEpoch = epoch;
   }
   return MjjVBF_up_;
 }
 
 const float &wwwtree::MjjVBF_dn() {
-  if (not MjjVBF_dn_isLoaded) {
+  if (MjjVBF_dn_loadedEpoch != epoch) {
     if (MjjVBF_dn_branch != 0) {
-      MjjVBF_dn_branch->GetEntry(index);
+      LoadBranch(MjjVBF_dn_branch);
     } else {
       printf("branch MjjVBF_dn_branch does not exist!\n");
       exit(1);
     }
-    MjjVBF_dn_isLoaded = true;
+    MjjVBF_dn_loadedEpoch = epoch;
   }
   return MjjVBF_dn_;
 }
 
 const float &wwwtree::MjjVBF_jer() {
-  if (not MjjVBF_jer_isLoaded) {
+  if (MjjVBF_jer_loadedEpoch != epoch) {
     if (MjjVBF_jer_branch != 0) {
-      MjjVBF_jer_branch->GetEntry(index);
+      LoadBranch(MjjVBF_jer_branch);
     } else {
       printf("branch MjjVBF_jer_branch does not exist!\n");
       exit(1);
     }
-    MjjVBF_jer_isLoaded = true;
+    MjjVBF_jer_loadedEpoch = epoch;
   }
   return MjjVBF_jer_;
 }
 
 const float &wwwtree::MjjVBF_jerup() {
-  if (not MjjVBF_jerup_isLoaded) {
+  if (MjjVBF_jerup_loadedEpoch != epoch) {
     if (MjjVBF_jerup_branch != 0) {
-      MjjVBF_jerup_branch->GetEntry(index);
+      LoadBranch(MjjVBF_jerup_branch);
     } else {
       printf("branch MjjVBF_jerup_branch does not exist!\n");
       exit(1);
     }
-    MjjVBF_jerup_isLoaded = true;
+    MjjVBF_jerup_loadedEpoch = epoch;
   }
   return MjjVBF_jerup_;
 }
 
 const float &wwwtree::MjjVBF_jerdn() {
-  if (not MjjVBF_jerdn_isLoaded) {
+  if (MjjVBF_jerdn_loadedEpoch != epoch) {
     if (MjjVBF_jerdn_branch != 0) {
-      MjjVBF_jerdn_branch->GetEntry(index);
+      LoadBranch(MjjVBF_jerdn_branch);
     } else {
       printf("branch MjjVBF_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MjjVBF_jerdn_isLoaded = true;
+    MjjVBF_jerdn_loadedEpoch = epoch;
   }
   return MjjVBF_jerdn_;
 }
 
 const float &wwwtree::DetajjVBF() {
-  if (not DetajjVBF_isLoaded) {
+  if (DetajjVBF_loadedEpoch != epoch) {
     if (DetajjVBF_branch != 0) {
-      DetajjVBF_branch->GetEntry(index);
+      LoadBranch(DetajjVBF_branch);
     } else {
       printf("branch DetajjVBF_branch does not exist!\n");
       exit(1);
     }
-    DetajjVBF_isLoaded = true;
+    DetajjVBF_loadedEpoch = epoch;
   }
   return DetajjVBF_;
 }
 
 const float &wwwtree::DetajjVBF_up() {
-  if (not DetajjVBF_up_isLoaded) {
+  if (DetajjVBF_up_loadedEpoch != epoch) {
     if (DetajjVBF_up_branch != 0) {
-      DetajjVBF_up_branch->GetEntry(index);
+      LoadBranch(DetajjVBF_up_branch);
     } else {
       printf("branch DetajjVBF_up_branch does not exist!\n");
       exit(1);
     }
-    DetajjVBF_up_isLoaded = true;
+    DetajjVBF_up_loadedEpoch = epoch;
   }
   return DetajjVBF_up_;
 }
 
 const float &wwwtree::DetajjVBF_dn() {
-  if (not DetajjVBF_dn_isLoaded) {
+  if (DetajjVBF_dn_loadedEpoch != epoch) {
     if (DetajjVBF_dn_branch != 0) {
-      DetajjVBF_dn_branch->GetEntry(index);
+      LoadBranch(DetajjVBF_dn_branch);
     } else {
       printf("branch DetajjVBF_dn_branch does not exist!\n");
       exit(1);
     }
-    DetajjVBF_dn_isLoaded = true;
+    DetajjVBF_dn_loadedEpoch = epoch;
   }
   return DetajjVBF_dn_;
 }
 
 const float &wwwtree::DetajjVBF_jer() {
-  if (not DetajjVBF_jer_isLoaded) {
+  if (DetajjVBF_jer_loadedEpoch != epoch) {
     if (DetajjVBF_jer_branch != 0) {
-      DetajjVBF_jer_branch->GetEntry(index);
+      LoadBranch(DetajjVBF_jer_branch);
     } else {
       printf("branch DetajjVBF_jer_branch does not exist!\n");
       exit(1);
     }
-    DetajjVBF_jer_isLoaded = true;
+    DetajjVBF_jer_loadedEpoch = epoch;
   }
   return DetajjVBF_jer_;
 }
 
 const float &wwwtree::DetajjVBF_jerup() {
-  if (not DetajjVBF_jerup_isLoaded) {
+  if (DetajjVBF_jerup_loadedEpoch != epoch) {
     if (DetajjVBF_jerup_branch != 0) {
-      DetajjVBF_jerup_branch->GetEntry(index);
+      LoadBranch(DetajjVBF_jerup_branch);
     } else {
       printf("branch DetajjVBF_jerup_branch does not exist!\n");
       exit(1);
     }
-    DetajjVBF_jerup_isLoaded = true;
+    DetajjVBF_jerup_loadedEpoch = epoch;
   }
   return DetajjVBF_jerup_;
 }
 
 const float &wwwtree::DetajjVBF_jerdn() {
-  if (not DetajjVBF_jerdn_isLoaded) {
+  if (DetajjVBF_jerdn_loadedEpoch != epoch) {
     if (DetajjVBF_jerdn_branch != 0) {
-      DetajjVBF_jerdn_branch->GetEntry(index);
+      LoadBranch(DetajjVBF_jerdn_branch);
     } else {
       printf("branch DetajjVBF_jerdn_branch does not exist!\n");
       exit(1);
     }
-    DetajjVBF_jerdn_isLoaded = true;
+    DetajjVBF_jerdn_loadedEpoch = epoch;
   }
   return DetajjVBF_jerdn_;
 }
 
 const float &wwwtree::MjjL() {
-  if (not MjjL_isLoaded) {
+  if (MjjL_loadedEpoch != epoch) {
     if (MjjL_branch != 0) {
-      MjjL_branch->GetEntry(index);
+      LoadBranch(MjjL_branch);
     } else {
       printf("branch MjjL_branch does not exist!\n");
       exit(1);
     }
-    MjjL_isLoaded = true;
+    MjjL_loadedEpoch = epoch;
   }
   return MjjL_;
 }
 
 const float &wwwtree::MjjL_up() {
-  if (not MjjL_up_isLoaded) {
+  if (MjjL_up_loadedEpoch != epoch) {
     if (MjjL_up_branch != 0) {
-      MjjL_up_branch->GetEntry(index);
+      LoadBranch(MjjL_up_branch);
     } else {
       printf("branch MjjL_up_branch does not exist!\n");
       exit(1);
     }
-    MjjL_up_isLoaded = true;
+    MjjL_up_loadedEpoch = epoch;
   }
   return MjjL_up_;
 }
 
 const float &wwwtree::MjjL_dn() {
-  if (not MjjL_dn_isLoaded) {
+  if (MjjL_dn_loadedEpoch != epoch) {
     if (MjjL_dn_branch != 0) {
-      MjjL_dn_branch->GetEntry(index);
+      LoadBranch(MjjL_dn_branch);
     } else {
       printf("branch MjjL_dn_branch does not exist!\n");
       exit(1);
     }
-    MjjL_dn_isLoaded = true;
+    MjjL_dn_loadedEpoch = epoch;
   }
   return MjjL_dn_;
 }
 
 const float &wwwtree::MjjL_jer() {
-  if (not MjjL_jer_isLoaded) {
+  if (MjjL_jer_loadedEpoch != epoch) {
     if (MjjL_jer_branch != 0) {
-      MjjL_jer_branch->GetEntry(index);
+      LoadBranch(MjjL_jer_branch);
     } else {
       printf("branch MjjL_jer_branch does not exist!\n");
       exit(1);
     }
-    MjjL_jer_isLoaded = true;
+    MjjL_jer_loadedEpoch = epoch;
   }
   return MjjL_jer_;
 }
 
 const float &wwwtree::MjjL_jerup() {
-  if (not MjjL_jerup_isLoaded) {
+  if (MjjL_jerup_loadedEpoch != epoch) {
     if (MjjL_jerup_branch != 0) {
-      MjjL_jerup_branch->GetEntry(index);
+      LoadBranch(MjjL_jerup_branch);
     } else {
       printf("branch MjjL_jerup_branch does not exist!\n");
       exit(1);
     }
-    MjjL_jerup_isLoaded = true;
+    MjjL_jerup_loadedEpoch = epoch;
   }
   return MjjL_jerup_;
 }
 
 const float &wwwtree::MjjL_jerdn() {
-  if (not MjjL_jerdn_isLoaded) {
+  if (MjjL_jerdn_loadedEpoch != epoch) {
     if (MjjL_jerdn_branch != 0) {
-      MjjL_jerdn_branch->GetEntry(index);
+      LoadBranch(MjjL_jerdn_branch);
     } else {
       printf("branch MjjL_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MjjL_jerdn_isLoaded = true;
+    MjjL_jerdn_loadedEpoch = epoch;
   }
   return MjjL_jerdn_;
 }
 
 const float &wwwtree::DetajjL() {
-  if (not DetajjL_isLoaded) {
+  if (DetajjL_loadedEpoch != epoch) {
     if (DetajjL_branch != 0) {
-      DetajjL_branch->GetEntry(index);
+      LoadBranch(DetajjL_branch);
     } else {
       printf("branch DetajjL_branch does not exist!\n");
       exit(1);
     }
-    DetajjL_isLoaded = true;
+    DetajjL_loadedEpoch = epoch;
   }
   return DetajjL_;
 }
 
 const float &wwwtree::DetajjL_up() {
-  if (not DetajjL_up_isLoaded) {
+  if (DetajjL_up_loadedEpoch != epoch) {
     if (DetajjL_up_branch != 0) {
-      DetajjL_up_branch->GetEntry(index);
+      LoadBranch(DetajjL_up_branch);
     } else {
       printf("branch DetajjL_up_branch does not exist!\n");
       exit(1);
     }
-    DetajjL_up_isLoaded = true;
+    DetajjL_up_loadedEpoch = epoch;
   }
   return DetajjL_up_;
 }
 
 const float &wwwtree::DetajjL_dn() {
-  if (not DetajjL_dn_isLoaded) {
+  if (DetajjL_dn_loadedEpoch != epoch) {
     if (DetajjL_dn_branch != 0) {
-      DetajjL_dn_branch->GetEntry(index);
+      LoadBranch(DetajjL_dn_branch);
     } else {
       printf("branch DetajjL_dn_branch does not exist!\n");
       exit(1);
     }
-    DetajjL_dn_isLoaded = true;
+    DetajjL_dn_loadedEpoch = epoch;
   }
   return DetajjL_dn_;
 }
 
 const float &wwwtree::DetajjL_jer() {
-  if (not DetajjL_jer_isLoaded) {
+  if (DetajjL_jer_loadedEpoch != epoch) {
     if (DetajjL_jer_branch != 0) {
-      DetajjL_jer_branch->GetEntry(index);
+      LoadBranch(DetajjL_jer_branch);
     } else {
       printf("branch DetajjL_jer_branch does not exist!\n");
       exit(1);
     }
-    DetajjL_jer_isLoaded = true;
+    DetajjL_jer_loadedEpoch = epoch;
   }
   return DetajjL_jer_;
 }
 
 const float &wwwtree::DetajjL_jerup() {
-  if (not DetajjL_jerup_isLoaded) {
+  if (DetajjL_jerup_loadedEpoch != epoch) {
     if (DetajjL_jerup_branch != 0) {
-      DetajjL_jerup_branch->GetEntry(index);
+      LoadBranch(DetajjL_jerup_branch);
     } else {
       printf("branch DetajjL_jerup_branch does not exist!\n");
       exit(1);
     }
-    DetajjL_jerup_isLoaded = true;
+    DetajjL_jerup_loadedEpoch = epoch;
   }
   return DetajjL_jerup_;
 }
 
 const float &wwwtree::DetajjL_jerdn() {
-  if (not DetajjL_jerdn_isLoaded) {
+  if (DetajjL_jerdn_loadedEpoch != epoch) {
     if (DetajjL_jerdn_branch != 0) {
-      DetajjL_jerdn_branch->GetEntry(index);
+      LoadBranch(DetajjL_jerdn_branch);
     } else {
       printf("branch DetajjL_jerdn_branch does not exist!\n");
       exit(1);
     }
-    DetajjL_jerdn_isLoaded = true;
+    DetajjL_jerdn_loadedEpoch = epoch;
   }
   return DetajjL_jerdn_;
 }
 
 const float &wwwtree::MllSS() {
-  if (not MllSS_isLoaded) {
+  if (MllSS_loadedEpoch != epoch) {
     if (MllSS_branch != 0) {
-      MllSS_branch->GetEntry(index);
+      LoadBranch(MllSS_branch);
     } else {
       printf("branch MllSS_branch does not exist!\n");
       exit(1);
     }
-    MllSS_isLoaded = true;
+    MllSS_loadedEpoch = epoch;
   }
   return MllSS_;
 }
 
 const float &wwwtree::MeeSS() {
-  if (not MeeSS_isLoaded) {
+  if (MeeSS_loadedEpoch != epoch) {
     if (MeeSS_branch != 0) {
-      MeeSS_branch->GetEntry(index);
+      LoadBranch(MeeSS_branch);
     } else {
       printf("branch MeeSS_branch does not exist!\n");
       exit(1);
     }
-    MeeSS_isLoaded = true;
+    MeeSS_loadedEpoch = epoch;
   }
   return MeeSS_;
 }
 
 const float &wwwtree::Mll3L() {
-  if (not Mll3L_isLoaded) {
+  if (Mll3L_loadedEpoch != epoch) {
     if (Mll3L_branch != 0) {
-      Mll3L_branch->GetEntry(index);
+      LoadBranch(Mll3L_branch);
     } else {
       printf("branch Mll3L_branch does not exist!\n");
       exit(1);
     }
-    Mll3L_isLoaded = true;
+    Mll3L_loadedEpoch = epoch;
   }
   return Mll3L_;
 }
 
 const float &wwwtree::Mee3L() {
-  if (not Mee3L_isLoaded) {
+  if (Mee3L_loadedEpoch != epoch) {
     if (Mee3L_branch != 0) {
-      Mee3L_branch->GetEntry(index);
+      LoadBranch(Mee3L_branch);
     } else {
       printf("branch Mee3L_branch does not exist!\n");
       exit(1);
     }
-    Mee3L_isLoaded = true;
+    Mee3L_loadedEpoch = epoch;
   }
   return Mee3L_;
 }
 
 const float &wwwtree::Mll3L1() {
-  if (not Mll3L1_isLoaded) {
+  if (Mll3L1_loadedEpoch != epoch) {
     if (Mll3L1_branch != 0) {
-      Mll3L1_branch->GetEntry(index);
+      LoadBranch(Mll3L1_branch);
     } else {
       printf("branch Mll3L1_branch does not exist!\n");
       exit(1);
     }
-    Mll3L1_isLoaded = true;
+    Mll3L1_loadedEpoch = epoch;
   }
   return Mll3L1_;
 }
 
 const float &wwwtree::M3l() {
-  if (not M3l_isLoaded) {
+  if (M3l_loadedEpoch != epoch) {
     if (M3l_branch != 0) {
-      M3l_branch->GetEntry(index);
+      LoadBranch(M3l_branch);
     } else {
       printf("branch M3l_branch does not exist!\n");
       exit(1);
     }
-    M3l_isLoaded = true;
+    M3l_loadedEpoch = epoch;
   }
   return M3l_;
 }
 
 const float &wwwtree::Pt3l() {
-  if (not Pt3l_isLoaded) {
+  if (Pt3l_loadedEpoch != epoch) {
     if (Pt3l_branch != 0) {
-      Pt3l_branch->GetEntry(index);
+      LoadBranch(Pt3l_branch);
     } else {
       printf("branch Pt3l_branch does not exist!\n");
       exit(1);
     }
-    Pt3l_isLoaded = true;
+    Pt3l_loadedEpoch = epoch;
   }
   return Pt3l_;
 }
 
 const float &wwwtree::M01() {
-  if (not M01_isLoaded) {
+  if (M01_loadedEpoch != epoch) {
     if (M01_branch != 0) {
-      M01_branch->GetEntry(index);
+      LoadBranch(M01_branch);
     } else {
       printf("branch M01_branch does not exist!\n");
       exit(1);
     }
-    M01_isLoaded = true;
+    M01_loadedEpoch = epoch;
   }
   return M01_;
 }
 
 const float &wwwtree::M02() {
-  if (not M02_isLoaded) {
+  if (M02_loadedEpoch != epoch) {
     if (M02_branch != 0) {
-      M02_branch->GetEntry(index);
+      LoadBranch(M02_branch);
     } else {
       printf("branch M02_branch does not exist!\n");
       exit(1);
     }
-    M02_isLoaded = true;
+    M02_loadedEpoch = epoch;
   }
   return M02_;
 }
 
 const float &wwwtree::M12() {
-  if (not M12_isLoaded) {
+  if (M12_loadedEpoch != epoch) {
     if (M12_branch != 0) {
-      M12_branch->GetEntry(index);
+      LoadBranch(M12_branch);
     } else {
       printf("branch M12_branch does not exist!\n");
       exit(1);
     }
-    M12_isLoaded = true;
+    M12_loadedEpoch = epoch;
   }
   return M12_;
 }
 
 const int &wwwtree::isSFOS01() {
-  if (not isSFOS01_isLoaded) {
+  if (isSFOS01_loadedEpoch != epoch) {
     if (isSFOS01_branch != 0) {
-      isSFOS01_branch->GetEntry(index);
+      LoadBranch(isSFOS01_branch);
     } else {
       printf("branch isSFOS01_branch does not exist!\n");
       exit(1);
     }
-    isSFOS01_isLoaded = true;
+    isSFOS01_loadedEpoch = epoch;
   }
   return isSFOS01_;
 }
 
 const int &wwwtree::isSFOS02() {
-  if (not isSFOS02_isLoaded) {
+  if (isSFOS02_loadedEpoch != epoch) {
     if (isSFOS02_branch != 0) {
-      isSFOS02_branch->GetEntry(index);
+      LoadBranch(isSFOS02_branch);
     } else {
       printf("branch isSFOS02_branch does not exist!\n");
       exit(1);
     }
-    isSFOS02_isLoaded = true;
+    isSFOS02_loadedEpoch = epoch;
   }
   return isSFOS02_;
 }
 
 const int &wwwtree::isSFOS12() {
-  if (not isSFOS12_isLoaded) {
+  if (isSFOS12_loadedEpoch != epoch) {
     if (isSFOS12_branch != 0) {
-      isSFOS12_branch->GetEntry(index);
+      LoadBranch(isSFOS12_branch);
     } else {
       printf("branch isSFOS12_branch does not exist!\n");
       exit(1);
     }
-    isSFOS12_isLoaded = true;
+    isSFOS12_loadedEpoch = epoch;
   }
   return isSFOS12_;
 }
 
 const float &wwwtree::DPhi3lMET() {
-  if (not DPhi3lMET_isLoaded) {
+  if (DPhi3lMET_loadedEpoch != epoch) {
     if (DPhi3lMET_branch != 0) {
-      DPhi3lMET_branch->GetEntry(index);
+      LoadBranch(DPhi3lMET_branch);
     } else {
       printf("branch DPhi3lMET_branch does not exist!\n");
       exit(1);
     }
-    DPhi3lMET_isLoaded = true;
+    DPhi3lMET_loadedEpoch = epoch;
   }
   return DPhi3lMET_;
 }
 
 const float &wwwtree::DPhi3lMET_up() {
-  if (not DPhi3lMET_up_isLoaded) {
+  if (DPhi3lMET_up_loadedEpoch != epoch) {
     if (DPhi3lMET_up_branch != 0) {
-      DPhi3lMET_up_branch->GetEntry(index);
+      LoadBranch(DPhi3lMET_up_branch);
     } else {
       printf("branch DPhi3lMET_up_branch does not exist!\n");
       exit(1);
     }
-    DPhi3lMET_up_isLoaded = true;
+    DPhi3lMET_up_loadedEpoch = epoch;
   }
   return DPhi3lMET_up_;
 }
 
 const float &wwwtree::DPhi3lMET_dn() {
-  if (not DPhi3lMET_dn_isLoaded) {
+  if (DPhi3lMET_dn_loadedEpoch != epoch) {
     if (DPhi3lMET_dn_branch != 0) {
-      DPhi3lMET_dn_branch->GetEntry(index);
+      LoadBranch(DPhi3lMET_dn_branch);
     } else {
       printf("branch DPhi3lMET_dn_branch does not exist!\n");
       exit(1);
     }
-    DPhi3lMET_dn_isLoaded = true;
+    DPhi3lMET_dn_loadedEpoch = epoch;
   }
   return DPhi3lMET_dn_;
 }
 
 const float &wwwtree::DPhi3lMET_jer() {
-  if (not DPhi3lMET_jer_isLoaded) {
+  if (DPhi3lMET_jer_loadedEpoch != epoch) {
     if (DPhi3lMET_jer_branch != 0) {
-      DPhi3lMET_jer_branch->GetEntry(index);
+      LoadBranch(DPhi3lMET_jer_branch);
     } else {
       printf("branch DPhi3lMET_jer_branch does not exist!\n");
       exit(1);
     }
-    DPhi3lMET_jer_isLoaded = true;
+    DPhi3lMET_jer_loadedEpoch = epoch;
   }
   return DPhi3lMET_jer_;
 }
 
 const float &wwwtree::DPhi3lMET_jerup() {
-  if (not DPhi3lMET_jerup_isLoaded) {
+  if (DPhi3lMET_jerup_loadedEpoch != epoch) {
     if (DPhi3lMET_jerup_branch != 0) {
-      DPhi3lMET_jerup_branch->GetEntry(index);
+      LoadBranch(DPhi3lMET_jerup_branch);
     } else {
       printf("branch DPhi3lMET_jerup_branch does not exist!\n");
       exit(1);
     }
-    DPhi3lMET_jerup_isLoaded = true;
+    DPhi3lMET_jerup_loadedEpoch = epoch;
   }
   return DPhi3lMET_jerup_;
 }
 
 const float &wwwtree::DPhi3lMET_jerdn() {
-  if (not DPhi3lMET_jerdn_isLoaded) {
+  if (DPhi3lMET_jerdn_loadedEpoch != epoch) {
     if (DPhi3lMET_jerdn_branch != 0) {
-      DPhi3lMET_jerdn_branch->GetEntry(index);
+      LoadBranch(DPhi3lMET_jerdn_branch);
     } else {
       printf("branch DPhi3lMET_jerdn_branch does not exist!\n");
       exit(1);
     }
-    DPhi3lMET_jerdn_isLoaded = true;
+    DPhi3lMET_jerdn_loadedEpoch = epoch;
   }
   return DPhi3lMET_jerdn_;
 }
 
 const float &wwwtree::DPhi3lMET_gen() {
-  if (not DPhi3lMET_gen_isLoaded) {
+  if (DPhi3lMET_gen_loadedEpoch != epoch) {
     if (DPhi3lMET_gen_branch != 0) {
-      DPhi3lMET_gen_branch->GetEntry(index);
+      LoadBranch(DPhi3lMET_gen_branch);
     } else {
       printf("branch DPhi3lMET_gen_branch does not exist!\n");
       exit(1);
     }
-    DPhi3lMET_gen_isLoaded = true;
+    DPhi3lMET_gen_loadedEpoch = epoch;
   }
   return DPhi3lMET_gen_;
 }
 
 const float &wwwtree::MTmax() {
-  if (not MTmax_isLoaded) {
+  if (MTmax_loadedEpoch != epoch) {
     if (MTmax_branch != 0) {
-      MTmax_branch->GetEntry(index);
+      LoadBranch(MTmax_branch);
     } else {
       printf("branch MTmax_branch does not exist!\n");
       exit(1);
     }
-    MTmax_isLoaded = true;
+    MTmax_loadedEpoch = epoch;
   }
   return MTmax_;
 }
 
 const float &wwwtree::MTmax_up() {
-  if (not MTmax_up_isLoaded) {
+  if (MTmax_up_loadedEpoch != epoch) {
     if (MTmax_up_branch != 0) {
-      MTmax_up_branch->GetEntry(index);
+      LoadBranch(MTmax_up_branch);
     } else {
       printf("branch MTmax_up_branch does not exist!\n");
       exit(1);
     }
-    MTmax_up_isLoaded = true;
+    MTmax_up_loadedEpoch = epoch;
   }
   return MTmax_up_;
 }
 
 const float &wwwtree::MTmax_dn() {
-  if (not MTmax_dn_isLoaded) {
+  if (MTmax_dn_loadedEpoch != epoch) {
     if (MTmax_dn_branch != 0) {
-      MTmax_dn_branch->GetEntry(index);
+      LoadBranch(MTmax_dn_branch);
     } else {
       printf("branch MTmax_dn_branch does not exist!\n");
       exit(1);
     }
-    MTmax_dn_isLoaded = true;
+    MTmax_dn_loadedEpoch = epoch;
   }
   return MTmax_dn_;
 }
 
 const float &wwwtree::MTmax_jer() {
-  if (not MTmax_jer_isLoaded) {
+  if (MTmax_jer_loadedEpoch != epoch) {
     if (MTmax_jer_branch != 0) {
-      MTmax_jer_branch->GetEntry(index);
+      LoadBranch(MTmax_jer_branch);
     } else {
       printf("branch MTmax_jer_branch does not exist!\n");
       exit(1);
     }
-    MTmax_jer_isLoaded = true;
+    MTmax_jer_loadedEpoch = epoch;
   }
   return MTmax_jer_;
 }
 
 const float &wwwtree::MTmax_jerup() {
-  if (not MTmax_jerup_isLoaded) {
+  if (MTmax_jerup_loadedEpoch != epoch) {
     if (MTmax_jerup_branch != 0) {
-      MTmax_jerup_branch->GetEntry(index);
+      LoadBranch(MTmax_jerup_branch);
     } else {
       printf("branch MTmax_jerup_branch does not exist!\n");
       exit(1);
     }
-    MTmax_jerup_isLoaded = true;
+    MTmax_jerup_loadedEpoch = epoch;
   }
   return MTmax_jerup_;
 }
 
 const float &wwwtree::MTmax_jerdn() {
-  if (not MTmax_jerdn_isLoaded) {
+  if (MTmax_jerdn_loadedEpoch != epoch) {
     if (MTmax_jerdn_branch != 0) {
-      MTmax_jerdn_branch->GetEntry(index);
+      LoadBranch(MTmax_jerdn_branch);
     } else {
       printf("branch MTmax_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MTmax_jerdn_isLoaded = true;
+    MTmax_jerdn_loadedEpoch = epoch;
   }
   return MTmax_jerdn_;
 }
 
 const float &wwwtree::MTmax_gen() {
-  if (not MTmax_gen_isLoaded) {
+  if (MTmax_gen_loadedEpoch != epoch) {
     if (MTmax_gen_branch != 0) {
-      MTmax_gen_branch->GetEntry(index);
+      LoadBranch(MTmax_gen_branch);
     } else {
       printf("branch MTmax_gen_branch does not exist!\n");
       exit(1);
     }
-    MTmax_gen_isLoaded = true;
+    MTmax_gen_loadedEpoch = epoch;
   }
   return MTmax_gen_;
 }
 
 const float &wwwtree::MTmin() {
-  if (not MTmin_isLoaded) {
+  if (MTmin_loadedEpoch != epoch) {
     if (MTmin_branch != 0) {
-      MTmin_branch->GetEntry(index);
+      LoadBranch(MTmin_branch);
     } else {
       printf("branch MTmin_branch does not exist!\n");
       exit(1);
     }
-    MTmin_isLoaded = true;
+    MTmin_loadedEpoch = epoch;
   }
   return MTmin_;
 }
 
 const float &wwwtree::MTmin_up() {
-  if (not MTmin_up_isLoaded) {
+  if (MTmin_up_loadedEpoch != epoch) {
     if (MTmin_up_branch != 0) {
-      MTmin_up_branch->GetEntry(index);
+      LoadBranch(MTmin_up_branch);
     } else {
       printf("branch MTmin_up_branch does not exist!\n");
       exit(1);
     }
-    MTmin_up_isLoaded = true;
+    MTmin_up_loadedEpoch = epoch;
   }
   return MTmin_up_;
 }
 
 const float &wwwtree::MTmin_dn() {
-  if (not MTmin_dn_isLoaded) {
+  if (MTmin_dn_loadedEpoch != epoch) {
     if (MTmin_dn_branch != 0) {
-      MTmin_dn_branch->GetEntry(index);
+      LoadBranch(MTmin_dn_branch);
     } else {
       printf("branch MTmin_dn_branch does not exist!\n");
       exit(1);
     }
-    MTmin_dn_isLoaded = true;
+    MTmin_dn_loadedEpoch = epoch;
   }
   return MTmin_dn_;
 }
 
 const float &wwwtree::MTmin_jer() {
-  if (not MTmin_jer_isLoaded) {
+  if (MTmin_jer_loadedEpoch != epoch) {
     if (MTmin_jer_branch != 0) {
-      MTmin_jer_branch->GetEntry(index);
+      LoadBranch(MTmin_jer_branch);
     } else {
       printf("branch MTmin_jer_branch does not exist!\n");
       exit(1);
     }
-    MTmin_jer_isLoaded = true;
+    MTmin_jer_loadedEpoch = epoch;
   }
   return MTmin_jer_;
 }
 
 const float &wwwtree::MTmin_jerup() {
-  if (not MTmin_jerup_isLoaded) {
+  if (MTmin_jerup_loadedEpoch != epoch) {
     if (MTmin_jerup_branch != 0) {
-      MTmin_jerup_branch->GetEntry(index);
+      LoadBranch(MTmin_jerup_branch);
     } else {
       printf("branch MTmin_jerup_branch does not exist!\n");
       exit(1);
     }
-    MTmin_jerup_isLoaded = true;
+    MTmin_jerup_loadedEpoch = epoch;
   }
   return MTmin_jerup_;
 }
 
 const float &wwwtree::MTmin_jerdn() {
-  if (not MTmin_jerdn_isLoaded) {
+  if (MTmin_jerdn_loadedEpoch != epoch) {
     if (MTmin_jerdn_branch != 0) {
-      MTmin_jerdn_branch->GetEntry(index);
+      LoadBranch(MTmin_jerdn_branch);
     } else {
       printf("branch MTmin_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MTmin_jerdn_isLoaded = true;
+    MTmin_jerdn_loadedEpoch = epoch;
   }
   return MTmin_jerdn_;
 }
 
 const float &wwwtree::MTmin_gen() {
-  if (not MTmin_gen_isLoaded) {
+  if (MTmin_gen_loadedEpoch != epoch) {
     if (MTmin_gen_branch != 0) {
-      MTmin_gen_branch->GetEntry(index);
+      LoadBranch(MTmin_gen_branch);
     } else {
       printf("branch MTmin_gen_branch does not exist!\n");
       exit(1);
     }
-    MTmin_gen_isLoaded = true;
+    MTmin_gen_loadedEpoch = epoch;
   }
   return MTmin_gen_;
 }
 
 const float &wwwtree::MT3rd() {
-  if (not MT3rd_isLoaded) {
+  if (MT3rd_loadedEpoch != epoch) {
     if (MT3rd_branch != 0) {
-      MT3rd_branch->GetEntry(index);
+      LoadBranch(MT3rd_branch);
     } else {
       printf("branch MT3rd_branch does not exist!\n");
       exit(1);
     }
-    MT3rd_isLoaded = true;
+    MT3rd_loadedEpoch = epoch;
   }
   return MT3rd_;
 }
 
 const float &wwwtree::MT3rd_up() {
-  if (not MT3rd_up_isLoaded) {
+  if (MT3rd_up_loadedEpoch != epoch) {
     if (MT3rd_up_branch != 0) {
-      MT3rd_up_branch->GetEntry(index);
+      LoadBranch(MT3rd_up_branch);
     } else {
       printf("branch MT3rd_up_branch does not exist!\n");
       exit(1);
     }
-    MT3rd_up_isLoaded = true;
+    MT3rd_up_loadedEpoch = epoch;
   }
   return MT3rd_up_;
 }
 
 const float &wwwtree::MT3rd_dn() {
-  if (not MT3rd_dn_isLoaded) {
+  if (MT3rd_dn_loadedEpoch != epoch) {
     if (MT3rd_dn_branch != 0) {
-      MT3rd_dn_branch->GetEntry(index);
+      LoadBranch(MT3rd_dn_branch);
     } else {
       printf("branch MT3rd_dn_branch does not exist!\n");
       exit(1);
     }
-    MT3rd_dn_isLoaded = true;
+    MT3rd_dn_loadedEpoch = epoch;
   }
   return MT3rd_dn_;
 }
 
 const float &wwwtree::MT3rd_jer() {
-  if (not MT3rd_jer_isLoaded) {
+  if (MT3rd_jer_loadedEpoch != epoch) {
     if (MT3rd_jer_branch != 0) {
-      MT3rd_jer_branch->GetEntry(index);
+      LoadBranch(MT3rd_jer_branch);
     } else {
       printf("branch MT3rd_jer_branch does not exist!\n");
       exit(1);
     }
-    MT3rd_jer_isLoaded = true;
+    MT3rd_jer_loadedEpoch = epoch;
   }
   return MT3rd_jer_;
 }
 
 const float &wwwtree::MT3rd_jerup() {
-  if (not MT3rd_jerup_isLoaded) {
+  if (MT3rd_jerup_loadedEpoch != epoch) {
     if (MT3rd_jerup_branch != 0) {
-      MT3rd_jerup_branch->GetEntry(index);
+      LoadBranch(MT3rd_jerup_branch);
     } else {
       printf("branch MT3rd_jerup_branch does not exist!\n");
       exit(1);
     }
-    MT3rd_jerup_isLoaded = true;
+    MT3rd_jerup_loadedEpoch = epoch;
   }
   return MT3rd_jerup_;
 }
 
 const float &wwwtree::MT3rd_jerdn() {
-  if (not MT3rd_jerdn_isLoaded) {
+  if (MT3rd_jerdn_loadedEpoch != epoch) {
     if (MT3rd_jerdn_branch != 0) {
-      MT3rd_jerdn_branch->GetEntry(index);
+      LoadBranch(MT3rd_jerdn_branch);
     } else {
       printf("branch MT3rd_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MT3rd_jerdn_isLoaded = true;
+    MT3rd_jerdn_loadedEpoch = epoch;
   }
   return MT3rd_jerdn_;
 }
 
 const float &wwwtree::MT3rd_gen() {
-  if (not MT3rd_gen_isLoaded) {
+  if (MT3rd_gen_loadedEpoch != epoch) {
     if (MT3rd_gen_branch != 0) {
-      MT3rd_gen_branch->GetEntry(index);
+      LoadBranch(MT3rd_gen_branch);
     } else {
       printf("branch MT3rd_gen_branch does not exist!\n");
       exit(1);
     }
-    MT3rd_gen_isLoaded = true;
+    MT3rd_gen_loadedEpoch = epoch;
   }
   return MT3rd_gen_;
 }
 
 const float &wwwtree::MTmax3L() {
-  if (not MTmax3L_isLoaded) {
+  if (MTmax3L_loadedEpoch != epoch) {
     if (MTmax3L_branch != 0) {
-      MTmax3L_branch->GetEntry(index);
+      LoadBranch(MTmax3L_branch);
     } else {
       printf("branch MTmax3L_branch does not exist!\n");
       exit(1);
     }
-    MTmax3L_isLoaded = true;
+    MTmax3L_loadedEpoch = epoch;
   }
   return MTmax3L_;
 }
 
 const float &wwwtree::MTmax3L_up() {
-  if (not MTmax3L_up_isLoaded) {
+  if (MTmax3L_up_loadedEpoch != epoch) {
     if (MTmax3L_up_branch != 0) {
-      MTmax3L_up_branch->GetEntry(index);
+      LoadBranch(MTmax3L_up_branch);
     } else {
       printf("branch MTmax3L_up_branch does not exist!\n");
       exit(1);
     }
-    MTmax3L_up_isLoaded = true;
+    MTmax3L_up_loadedEpoch = epoch;
   }
   return MTmax3L_up_;
 }
 
 const float &wwwtree::MTmax3L_dn() {
-  if (not MTmax3L_dn_isLoaded) {
+  if (MTmax3L_dn_loadedEpoch != epoch) {
     if (MTmax3L_dn_branch != 0) {
-      MTmax3L_dn_branch->GetEntry(index);
+      LoadBranch(MTmax3L_dn_branch);
     } else {
       printf("branch MTmax3L_dn_branch does not exist!\n");
       exit(1);
     }
-    MTmax3L_dn_isLoaded = true;
+    MTmax3L_dn_loadedEpoch = epoch;
   }
   return MTmax3L_dn_;
 }
 
 const float &wwwtree::MTmax3L_jer() {
-  if (not MTmax3L_jer_isLoaded) {
+  if (MTmax3L_jer_loadedEpoch != epoch) {
     if (MTmax3L_jer_branch != 0) {
-      MTmax3L_jer_branch->GetEntry(index);
+      LoadBranch(MTmax3L_jer_branch);
     } else {
       printf("branch MTmax3L_jer_branch does not exist!\n");
       exit(1);
     }
-    MTmax3L_jer_isLoaded = true;
+    MTmax3L_jer_loadedEpoch = epoch;
   }
   return MTmax3L_jer_;
 }
 
 const float &wwwtree::MTmax3L_jerup() {
-  if (not MTmax3L_jerup_isLoaded) {
+  if (MTmax3L_jerup_loadedEpoch != epoch) {
     if (MTmax3L_jerup_branch != 0) {
-      MTmax3L_jerup_branch->GetEntry(index);
+      LoadBranch(MTmax3L_jerup_branch);
     } else {
       printf("branch MTmax3L_jerup_branch does not exist!\n");
       exit(1);
     }
-    MTmax3L_jerup_isLoaded = true;
+    MTmax3L_jerup_loadedEpoch = epoch;
   }
   return MTmax3L_jerup_;
 }
 
 const float &wwwtree::MTmax3L_jerdn() {
-  if (not MTmax3L_jerdn_isLoaded) {
+  if (MTmax3L_jerdn_loadedEpoch != epoch) {
     if (MTmax3L_jerdn_branch != 0) {
-      MTmax3L_jerdn_branch->GetEntry(index);
+      LoadBranch(MTmax3L_jerdn_branch);
     } else {
       printf("branch MTmax3L_jerdn_branch does not exist!\n");
       exit(1);
     }
-    MTmax3L_jerdn_isLoaded = true;
+    MTmax3L_jerdn_loadedEpoch = epoch;
   }
   return MTmax3L_jerdn_;
 }
 
 const float &wwwtree::MTmax3L_gen() {
-  if (not MTmax3L_gen_isLoaded) {
+  if (MTmax3L_gen_loadedEpoch != epoch) {
     if (MTmax3L_gen_branch != 0) {
-      MTmax3L_gen_branch->GetEntry(index);
+      LoadBranch(MTmax3L_gen_branch);
     } else {
       printf("branch MTmax3L_gen_branch does not exist!\n");
       exit(1);
     }
-    MTmax3L_gen_isLoaded = true;
+    MTmax3L_gen_loadedEpoch = epoch;
   }
   return MTmax3L_gen_;
 }
 
 const int &wwwtree::passSSee() {
-  if (not passSSee_isLoaded) {
+  if (passSSee_loadedEpoch != epoch) {
     if (passSSee_branch != 0) {
-      passSSee_branch->GetEntry(index);
+      LoadBranch(passSSee_branch);
     } else {
       printf("branch passSSee_branch does not exist!\n");
       exit(1);
     }
-    passSSee_isLoaded = true;
+    passSSee_loadedEpoch = epoch;
   }
   return passSSee_;
 }
 
 const int &wwwtree::passSSem() {
-  if (not passSSem_isLoaded) {
+  if (passSSem_loadedEpoch != epoch) {
     if (passSSem_branch != 0) {
-      passSSem_branch->GetEntry(index);
+      LoadBranch(passSSem_branch);
     } else {
       printf("branch passSSem_branch does not exist!\n");
       exit(1);
     }
-    passSSem_isLoaded = true;
+    passSSem_loadedEpoch = epoch;
   }
   return passSSem_;
 }
 
 const int &wwwtree::passSSmm() {
-  if (not passSSmm_isLoaded) {
+  if (passSSmm_loadedEpoch != epoch) {
     if (passSSmm_branch != 0) {
-      passSSmm_branch->GetEntry(index);
+      LoadBranch(passSSmm_branch);
     } else {
       printf("branch passSSmm_branch does not exist!\n");
       exit(1);
     }
-    passSSmm_isLoaded = true;
+    passSSmm_loadedEpoch = epoch;
   }
   return passSSmm_;
 }
 
 const int &wwwtree::lep_idx0_SS() {
-  if (not lep_idx0_SS_isLoaded) {
+  if (lep_idx0_SS_loadedEpoch != epoch) {
     if (lep_idx0_SS_branch != 0) {
-      lep_idx0_SS_branch->GetEntry(index);
+      LoadBranch(lep_idx0_SS_branch);
     } else {
       printf("branch lep_idx0_SS_branch does not exist!\n");
       exit(1);
     }
-    lep_idx0_SS_isLoaded = true;
+    lep_idx0_SS_loadedEpoch = epoch;
   }
   return lep_idx0_SS_;
 }
 
 const int &wwwtree::lep_idx1_SS() {
-  if (not lep_idx1_SS_isLoaded) {
+  if (lep_idx1_SS_loadedEpoch != epoch) {
     if (lep_idx1_SS_branch != 0) {
-      lep_idx1_SS_branch->GetEntry(index);
+      LoadBranch(lep_idx1_SS_branch);
     } else {
       printf("branch lep_idx1_SS_branch does not exist!\n");
       exit(1);
     }
-    lep_idx1_SS_isLoaded = true;
+    lep_idx1_SS_loadedEpoch = epoch;
   }
   return lep_idx1_SS_;
 }
 
 const TString &wwwtree::bkgtype() {
-  if (not bkgtype_isLoaded) {
+  if (bkgtype_loadedEpoch != epoch) {
     if (bkgtype_branch != 0) {
-      bkgtype_branch->GetEntry(index);
+      LoadBranch(bkgtype_branch);
     } else {
       printf("branch bkgtype_branch does not exist!\n");
       exit(1);
     }
-    bkgtype_isLoaded = true;
+    bkgtype_loadedEpoch = epoch;
   }
   return *bkgtype_;
 }
 
 const int &wwwtree::vetophoton() {
-  if (not vetophoton_isLoaded) {
+  if (vetophoton_loadedEpoch != epoch) {
     if (vetophoton_branch != 0) {
-      vetophoton_branch->GetEntry(index);
+      LoadBranch(vetophoton_branch);
     } else {
       printf("branch vetophoton_branch does not exist!\n");
       exit(1);
     }
-    vetophoton_isLoaded = true;
+    vetophoton_loadedEpoch = epoch;
   }
   return vetophoton_;
 }
 
 const float &wwwtree::purewgt() {
-  if (not purewgt_isLoaded) {
+  if (purewgt_loadedEpoch != epoch) {
     if (purewgt_branch != 0) {
-      purewgt_branch->GetEntry(index);
+      LoadBranch(purewgt_branch);
     } else {
       printf("branch purewgt_branch does not exist!\n");
       exit(1);
     }
-    purewgt_isLoaded = true;
+    purewgt_loadedEpoch = epoch;
   }
   return purewgt_;
 }
 
 const float &wwwtree::purewgt_up() {
-  if (not purewgt_up_isLoaded) {
+  if (purewgt_up_loadedEpoch != epoch) {
     if (purewgt_up_branch != 0) {
-      purewgt_up_branch->GetEntry(index);
+      LoadBranch(purewgt_up_branch);
     } else {
       printf("branch purewgt_up_branch does not exist!\n");
       exit(1);
     }
-    purewgt_up_isLoaded = true;
+    purewgt_up_loadedEpoch = epoch;
   }
   return purewgt_up_;
 }
 
 const float &wwwtree::purewgt_dn() {
-  if (not purewgt_dn_isLoaded) {
+  if (purewgt_dn_loadedEpoch != epoch) {
     if (purewgt_dn_branch != 0) {
-      purewgt_dn_branch->GetEntry(index);
+      LoadBranch(purewgt_dn_branch);
     } else {
       printf("branch purewgt_dn_branch does not exist!\n");
       exit(1);
     }
-    purewgt_dn_isLoaded = true;
+    purewgt_dn_loadedEpoch = epoch;
   }
   return purewgt_dn_;
 }
 
 const float &wwwtree::ffwgt() {
-  if (not ffwgt_isLoaded) {
+  if (ffwgt_loadedEpoch != epoch) {
     if (ffwgt_branch != 0) {
-      ffwgt_branch->GetEntry(index);
+      LoadBranch(ffwgt_branch);
     } else {
       printf("branch ffwgt_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_isLoaded = true;
+    ffwgt_loadedEpoch = epoch;
   }
   return ffwgt_;
 }
 
 const float &wwwtree::ffwgt_up() {
-  if (not ffwgt_up_isLoaded) {
+  if (ffwgt_up_loadedEpoch != epoch) {
     if (ffwgt_up_branch != 0) {
-      ffwgt_up_branch->GetEntry(index);
+      LoadBranch(ffwgt_up_branch);
     } else {
       printf("branch ffwgt_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_up_isLoaded = true;
+    ffwgt_up_loadedEpoch = epoch;
   }
   return ffwgt_up_;
 }
 
 const float &wwwtree::ffwgt_dn() {
-  if (not ffwgt_dn_isLoaded) {
+  if (ffwgt_dn_loadedEpoch != epoch) {
     if (ffwgt_dn_branch != 0) {
-      ffwgt_dn_branch->GetEntry(index);
+      LoadBranch(ffwgt_dn_branch);
     } else {
       printf("branch ffwgt_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_dn_isLoaded = true;
+    ffwgt_dn_loadedEpoch = epoch;
   }
   return ffwgt_dn_;
 }
 
 const float &wwwtree::ffwgt_el_up() {
-  if (not ffwgt_el_up_isLoaded) {
+  if (ffwgt_el_up_loadedEpoch != epoch) {
     if (ffwgt_el_up_branch != 0) {
-      ffwgt_el_up_branch->GetEntry(index);
+      LoadBranch(ffwgt_el_up_branch);
     } else {
       printf("branch ffwgt_el_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_el_up_isLoaded = true;
+    ffwgt_el_up_loadedEpoch = epoch;
   }
   return ffwgt_el_up_;
 }
 
 const float &wwwtree::ffwgt_el_dn() {
-  if (not ffwgt_el_dn_isLoaded) {
+  if (ffwgt_el_dn_loadedEpoch != epoch) {
     if (ffwgt_el_dn_branch != 0) {
-      ffwgt_el_dn_branch->GetEntry(index);
+      LoadBranch(ffwgt_el_dn_branch);
     } else {
       printf("branch ffwgt_el_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_el_dn_isLoaded = true;
+    ffwgt_el_dn_loadedEpoch = epoch;
   }
   return ffwgt_el_dn_;
 }
 
 const float &wwwtree::ffwgt_mu_up() {
-  if (not ffwgt_mu_up_isLoaded) {
+  if (ffwgt_mu_up_loadedEpoch != epoch) {
     if (ffwgt_mu_up_branch != 0) {
-      ffwgt_mu_up_branch->GetEntry(index);
+      LoadBranch(ffwgt_mu_up_branch);
     } else {
       printf("branch ffwgt_mu_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_mu_up_isLoaded = true;
+    ffwgt_mu_up_loadedEpoch = epoch;
   }
   return ffwgt_mu_up_;
 }
 
 const float &wwwtree::ffwgt_mu_dn() {
-  if (not ffwgt_mu_dn_isLoaded) {
+  if (ffwgt_mu_dn_loadedEpoch != epoch) {
     if (ffwgt_mu_dn_branch != 0) {
-      ffwgt_mu_dn_branch->GetEntry(index);
+      LoadBranch(ffwgt_mu_dn_branch);
     } else {
       printf("branch ffwgt_mu_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_mu_dn_isLoaded = true;
+    ffwgt_mu_dn_loadedEpoch = epoch;
   }
   return ffwgt_mu_dn_;
 }
 
 const float &wwwtree::ffwgt_closure_up() {
-  if (not ffwgt_closure_up_isLoaded) {
+  if (ffwgt_closure_up_loadedEpoch != epoch) {
     if (ffwgt_closure_up_branch != 0) {
-      ffwgt_closure_up_branch->GetEntry(index);
+      LoadBranch(ffwgt_closure_up_branch);
     } else {
       printf("branch ffwgt_closure_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_closure_up_isLoaded = true;
+    ffwgt_closure_up_loadedEpoch = epoch;
   }
   return ffwgt_closure_up_;
 }
 
 const float &wwwtree::ffwgt_closure_dn() {
-  if (not ffwgt_closure_dn_isLoaded) {
+  if (ffwgt_closure_dn_loadedEpoch != epoch) {
     if (ffwgt_closure_dn_branch != 0) {
-      ffwgt_closure_dn_branch->GetEntry(index);
+      LoadBranch(ffwgt_closure_dn_branch);
     } else {
       printf("branch ffwgt_closure_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_closure_dn_isLoaded = true;
+    ffwgt_closure_dn_loadedEpoch = epoch;
   }
   return ffwgt_closure_dn_;
 }
 
 const float &wwwtree::ffwgt_closure_el_up() {
-  if (not ffwgt_closure_el_up_isLoaded) {
+  if (ffwgt_closure_el_up_loadedEpoch != epoch) {
     if (ffwgt_closure_el_up_branch != 0) {
-      ffwgt_closure_el_up_branch->GetEntry(index);
+      LoadBranch(ffwgt_closure_el_up_branch);
     } else {
       printf("branch ffwgt_closure_el_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_closure_el_up_isLoaded = true;
+    ffwgt_closure_el_up_loadedEpoch = epoch;
   }
   return ffwgt_closure_el_up_;
 }
 
 const float &wwwtree::ffwgt_closure_el_dn() {
-  if (not ffwgt_closure_el_dn_isLoaded) {
+  if (ffwgt_closure_el_dn_loadedEpoch != epoch) {
     if (ffwgt_closure_el_dn_branch != 0) {
-      ffwgt_closure_el_dn_branch->GetEntry(index);
+      LoadBranch(ffwgt_closure_el_dn_branch);
     } else {
       printf("branch ffwgt_closure_el_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_closure_el_dn_isLoaded = true;
+    ffwgt_closure_el_dn_loadedEpoch = epoch;
   }
   return ffwgt_closure_el_dn_;
 }
 
 const float &wwwtree::ffwgt_closure_mu_up() {
-  if (not ffwgt_closure_mu_up_isLoaded) {
+  if (ffwgt_closure_mu_up_loadedEpoch != epoch) {
     if (ffwgt_closure_mu_up_branch != 0) {
-      ffwgt_closure_mu_up_branch->GetEntry(index);
+      LoadBranch(ffwgt_closure_mu_up_branch);
     } else {
       printf("branch ffwgt_closure_mu_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_closure_mu_up_isLoaded = true;
+    ffwgt_closure_mu_up_loadedEpoch = epoch;
   }
   return ffwgt_closure_mu_up_;
 }
 
 const float &wwwtree::ffwgt_closure_mu_dn() {
-  if (not ffwgt_closure_mu_dn_isLoaded) {
+  if (ffwgt_closure_mu_dn_loadedEpoch != epoch) {
     if (ffwgt_closure_mu_dn_branch != 0) {
-      ffwgt_closure_mu_dn_branch->GetEntry(index);
+      LoadBranch(ffwgt_closure_mu_dn_branch);
     } else {
       printf("branch ffwgt_closure_mu_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_closure_mu_dn_isLoaded = true;
+    ffwgt_closure_mu_dn_loadedEpoch = epoch;
   }
   return ffwgt_closure_mu_dn_;
 }
 
 const float &wwwtree::ffwgt_full_up() {
-  if (not ffwgt_full_up_isLoaded) {
+  if (ffwgt_full_up_loadedEpoch != epoch) {
     if (ffwgt_full_up_branch != 0) {
-      ffwgt_full_up_branch->GetEntry(index);
+      LoadBranch(ffwgt_full_up_branch);
     } else {
       printf("branch ffwgt_full_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_full_up_isLoaded = true;
+    ffwgt_full_up_loadedEpoch = epoch;
   }
   return ffwgt_full_up_;
 }
 
 const float &wwwtree::ffwgt_full_dn() {
-  if (not ffwgt_full_dn_isLoaded) {
+  if (ffwgt_full_dn_loadedEpoch != epoch) {
     if (ffwgt_full_dn_branch != 0) {
-      ffwgt_full_dn_branch->GetEntry(index);
+      LoadBranch(ffwgt_full_dn_branch);
     } else {
       printf("branch ffwgt_full_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgt_full_dn_isLoaded = true;
+    ffwgt_full_dn_loadedEpoch = epoch;
   }
   return ffwgt_full_dn_;
 }
 
 const float &wwwtree::ffwgtqcd() {
-  if (not ffwgtqcd_isLoaded) {
+  if (ffwgtqcd_loadedEpoch != epoch) {
     if (ffwgtqcd_branch != 0) {
-      ffwgtqcd_branch->GetEntry(index);
+      LoadBranch(ffwgtqcd_branch);
     } else {
       printf("branch ffwgtqcd_branch does not exist!\n");
       exit(1);
     }
-    ffwgtqcd_isLoaded = true;
+    ffwgtqcd_loadedEpoch = epoch;
   }
   return ffwgtqcd_;
 }
 
 const float &wwwtree::ffwgtqcd_up() {
-  if (not ffwgtqcd_up_isLoaded) {
+  if (ffwgtqcd_up_loadedEpoch != epoch) {
     if (ffwgtqcd_up_branch != 0) {
-      ffwgtqcd_up_branch->GetEntry(index);
+      LoadBranch(ffwgtqcd_up_branch);
     } else {
       printf("branch ffwgtqcd_up_branch does not exist!\n");
       exit(1);
     }
-    ffwgtqcd_up_isLoaded = true;
+    ffwgtqcd_up_loadedEpoch = epoch;
   }
   return ffwgtqcd_up_;
 }
 
 const float &wwwtree::ffwgtqcd_dn() {
-  if (not ffwgtqcd_dn_isLoaded) {
+  if (ffwgtqcd_dn_loadedEpoch != epoch) {
     if (ffwgtqcd_dn_branch != 0) {
-      ffwgtqcd_dn_branch->GetEntry(index);
+      LoadBranch(ffwgtqcd_dn_branch);
     } else {
       printf("branch ffwgtqcd_dn_branch does not exist!\n");
       exit(1);
     }
-    ffwgtqcd_dn_isLoaded = true;
+    ffwgtqcd_dn_loadedEpoch = epoch;
   }
   return ffwgtqcd_dn_;
 }
 
 const float &wwwtree::lepsf() {
-  if (not lepsf_isLoaded) {
+  if (lepsf_loadedEpoch != epoch) {
     if (lepsf_branch != 0) {
-      lepsf_branch->GetEntry(index);
+      LoadBranch(lepsf_branch);
     } else {
       printf("branch lepsf_branch does not exist!\n");
       exit(1);
     }
-    lepsf_isLoaded = true;
+    lepsf_loadedEpoch = epoch;
   }
   return lepsf_;
 }
 
 const float &wwwtree::lepsf_up() {
-  if (not lepsf_up_isLoaded) {
+  if (lepsf_up_loadedEpoch != epoch) {
     if (lepsf_up_branch != 0) {
-      lepsf_up_branch->GetEntry(index);
+      LoadBranch(lepsf_up_branch);
     } else {
       printf("branch lepsf_up_branch does not exist!\n");
       exit(1);
     }
-    lepsf_up_isLoaded = true;
+    lepsf_up_loadedEpoch = epoch;
   }
   return lepsf_up_;
 }
 
 const float &wwwtree::lepsf_dn() {
-  if (not lepsf_dn_isLoaded) {
+  if (lepsf_dn_loadedEpoch != epoch) {
     if (lepsf_dn_branch != 0) {
-      lepsf_dn_branch->GetEntry(index);
+      LoadBranch(lepsf_dn_branch);
     } else {
       printf("branch lepsf_dn_branch does not exist!\n");
       exit(1);
     }
-    lepsf_dn_isLoaded = true;
+    lepsf_dn_loadedEpoch = epoch;
   }
   return lepsf_dn_;
 }
 
 const float &wwwtree::trigeff() {
-  if (not trigeff_isLoaded) {
+  if (trigeff_loadedEpoch != epoch) {
     if (trigeff_branch != 0) {
-      trigeff_branch->GetEntry(index);
+      LoadBranch(trigeff_branch);
     } else {
       printf("branch trigeff_branch does not exist!\n");
       exit(1);
     }
-    trigeff_isLoaded = true;
+    trigeff_loadedEpoch = epoch;
   }
   return trigeff_;
 }
 
 const float &wwwtree::trigeff_up() {
-  if (not trigeff_up_isLoaded) {
+  if (trigeff_up_loadedEpoch != epoch) {
     if (trigeff_up_branch != 0) {
-      trigeff_up_branch->GetEntry(index);
+      LoadBranch(trigeff_up_branch);
     } else {
       printf("branch trigeff_up_branch does not exist!\n");
       exit(1);
     }
-    trigeff_up_isLoaded = true;
+    trigeff_up_loadedEpoch = epoch;
   }
   return trigeff_up_;
 }
 
 const float &wwwtree::trigeff_dn() {
-  if (not trigeff_dn_isLoaded) {
+  if (trigeff_dn_loadedEpoch != epoch) {
     if (trigeff_dn_branch != 0) {
-      trigeff_dn_branch->GetEntry(index);
+      LoadBranch(trigeff_dn_branch);
     } else {
       printf("branch trigeff_dn_branch does not exist!\n");
       exit(1);
     }
-    trigeff_dn_isLoaded = true;
+    trigeff_dn_loadedEpoch = epoch;
   }
   return trigeff_dn_;
 }
 
 const float &wwwtree::trigsf() {
-  if (not trigsf_isLoaded) {
+  if (trigsf_loadedEpoch != epoch) {
     if (trigsf_branch != 0) {
-      trigsf_branch->GetEntry(index);
+      LoadBranch(trigsf_branch);
     } else {
       printf("branch trigsf_branch does not exist!\n");
       exit(1);
     }
-    trigsf_isLoaded = true;
+    trigsf_loadedEpoch = epoch;
   }
   return trigsf_;
 }
 
 const float &wwwtree::trigsf_up() {
-  if (not trigsf_up_isLoaded) {
+  if (trigsf_up_loadedEpoch != epoch) {
     if (trigsf_up_branch != 0) {
-      trigsf_up_branch->GetEntry(index);
+      LoadBranch(trigsf_up_branch);
     } else {
       printf("branch trigsf_up_branch does not exist!\n");
       exit(1);
     }
-    trigsf_up_isLoaded = true;
+    trigsf_up_loadedEpoch = epoch;
   }
   return trigsf_up_;
 }
 
 const float &wwwtree::trigsf_dn() {
-  if (not trigsf_dn_isLoaded) {
+  if (trigsf_dn_loadedEpoch != epoch) {
     if (trigsf_dn_branch != 0) {
-      trigsf_dn_branch->GetEntry(index);
+      LoadBranch(trigsf_dn_branch);
     } else {
       printf("branch trigsf_dn_branch does not exist!\n");
       exit(1);
     }
-    trigsf_dn_isLoaded = true;
+    trigsf_dn_loadedEpoch = epoch;
   }
   return trigsf_dn_;
 }
 
 const float &wwwtree::musmear_sf() {
-  if (not musmear_sf_isLoaded) {
+  if (musmear_sf_loadedEpoch != epoch) {
     if (musmear_sf_branch != 0) {
-      musmear_sf_branch->GetEntry(index);
+      LoadBranch(musmear_sf_branch);
     } else {
       printf("branch musmear_sf_branch does not exist!\n");
       exit(1);
     }
-    musmear_sf_isLoaded = true;
+    musmear_sf_loadedEpoch = epoch;
   }
   return musmear_sf_;
 }
 
 const int &wwwtree::iswhwww() {
-  if (not iswhwww_isLoaded) {
+  if (iswhwww_loadedEpoch != epoch) {
     if (iswhwww_branch != 0) {
-      iswhwww_branch->GetEntry(index);
+      LoadBranch(iswhwww_branch);
     } else {
       printf("branch iswhwww_branch does not exist!\n");
       exit(1);
     }
-    iswhwww_isLoaded = true;
+    iswhwww_loadedEpoch = epoch;
   }
   return iswhwww_;
 }
 
 const int &wwwtree::www_channel() {
-  if (not www_channel_isLoaded) {
+  if (www_channel_loadedEpoch != epoch) {
     if (www_channel_branch != 0) {
-      www_channel_branch->GetEntry(index);
+      LoadBranch(www_channel_branch);
     } else {
       printf("branch www_channel_branch does not exist!\n");
       exit(1);
     }
-    www_channel_isLoaded = true;
+    www_channel_loadedEpoch = epoch;
   }
   return www_channel_;
 }
 
 const int &wwwtree::has_tau() {
-  if (not has_tau_isLoaded) {
+  if (has_tau_loadedEpoch != epoch) {
     if (has_tau_branch != 0) {
-      has_tau_branch->GetEntry(index);
+      LoadBranch(has_tau_branch);
     } else {
       printf("branch has_tau_branch does not exist!\n");
       exit(1);
     }
-    has_tau_isLoaded = true;
+    has_tau_loadedEpoch = epoch;
   }
   return has_tau_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::w_p4() {
-  if (not w_p4_isLoaded) {
+  if (w_p4_loadedEpoch != epoch) {
     if (w_p4_branch != 0) {
-      w_p4_branch->GetEntry(index);
+      LoadBranch(w_p4_branch);
     } else {
       printf("branch w_p4_branch does not exist!\n");
       exit(1);
     }
-    w_p4_isLoaded = true;
+    w_p4_loadedEpoch = epoch;
   }
   return *w_p4_;
 }
 
 const vector<int> &wwwtree::w_islep() {
-  if (not w_islep_isLoaded) {
+  if (w_islep_loadedEpoch != epoch) {
     if (w_islep_branch != 0) {
-      w_islep_branch->GetEntry(index);
+      LoadBranch(w_islep_branch);
     } else {
       printf("branch w_islep_branch does not exist!\n");
       exit(1);
     }
-    w_islep_isLoaded = true;
+    w_islep_loadedEpoch = epoch;
   }
   return *w_islep_;
 }
 
 const vector<int> &wwwtree::w_isstar() {
-  if (not w_isstar_isLoaded) {
+  if (w_isstar_loadedEpoch != epoch) {
     if (w_isstar_branch != 0) {
-      w_isstar_branch->GetEntry(index);
+      LoadBranch(w_isstar_branch);
     } else {
       printf("branch w_isstar_branch does not exist!\n");
       exit(1);
     }
-    w_isstar_isLoaded = true;
+    w_isstar_loadedEpoch = epoch;
   }
   return *w_isstar_;
 }
 
 const vector<int> &wwwtree::w_isH() {
-  if (not w_isH_isLoaded) {
+  if (w_isH_loadedEpoch != epoch) {
     if (w_isH_branch != 0) {
-      w_isH_branch->GetEntry(index);
+      LoadBranch(w_isH_branch);
     } else {
       printf("branch w_isH_branch does not exist!\n");
       exit(1);
     }
-    w_isH_isLoaded = true;
+    w_isH_loadedEpoch = epoch;
   }
   return *w_isH_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::l_p4() {
-  if (not l_p4_isLoaded) {
+  if (l_p4_loadedEpoch != epoch) {
     if (l_p4_branch != 0) {
-      l_p4_branch->GetEntry(index);
+      LoadBranch(l_p4_branch);
     } else {
       printf("branch l_p4_branch does not exist!\n");
       exit(1);
     }
-    l_p4_isLoaded = true;
+    l_p4_loadedEpoch = epoch;
   }
   return *l_p4_;
 }
 
 const vector<float> &wwwtree::l_w_pt() {
-  if (not l_w_pt_isLoaded) {
+  if (l_w_pt_loadedEpoch != epoch) {
     if (l_w_pt_branch != 0) {
-      l_w_pt_branch->GetEntry(index);
+      LoadBranch(l_w_pt_branch);
     } else {
       printf("branch l_w_pt_branch does not exist!\n");
       exit(1);
     }
-    l_w_pt_isLoaded = true;
+    l_w_pt_loadedEpoch = epoch;
   }
   return *l_w_pt_;
 }
 
 const vector<float> &wwwtree::l_w_eta() {
-  if (not l_w_eta_isLoaded) {
+  if (l_w_eta_loadedEpoch != epoch) {
     if (l_w_eta_branch != 0) {
-      l_w_eta_branch->GetEntry(index);
+      LoadBranch(l_w_eta_branch);
     } else {
       printf("branch l_w_eta_branch does not exist!\n");
       exit(1);
     }
-    l_w_eta_isLoaded = true;
+    l_w_eta_loadedEpoch = epoch;
   }
   return *l_w_eta_;
 }
 
 const vector<float> &wwwtree::l_w_phi() {
-  if (not l_w_phi_isLoaded) {
+  if (l_w_phi_loadedEpoch != epoch) {
     if (l_w_phi_branch != 0) {
-      l_w_phi_branch->GetEntry(index);
+      LoadBranch(l_w_phi_branch);
     } else {
       printf("branch l_w_phi_branch does not exist!\n");
       exit(1);
     }
-    l_w_phi_isLoaded = true;
+    l_w_phi_loadedEpoch = epoch;
   }
   return *l_w_phi_;
 }
 
 const vector<float> &wwwtree::l_w_mass() {
-  if (not l_w_mass_isLoaded) {
+  if (l_w_mass_loadedEpoch != epoch) {
     if (l_w_mass_branch != 0) {
-      l_w_mass_branch->GetEntry(index);
+      LoadBranch(l_w_mass_branch);
     } else {
       printf("branch l_w_mass_branch does not exist!\n");
       exit(1);
     }
-    l_w_mass_isLoaded = true;
+    l_w_mass_loadedEpoch = epoch;
   }
   return *l_w_mass_;
 }
 
 const vector<int> &wwwtree::l_w_id() {
-  if (not l_w_id_isLoaded) {
+  if (l_w_id_loadedEpoch != epoch) {
     if (l_w_id_branch != 0) {
-      l_w_id_branch->GetEntry(index);
+      LoadBranch(l_w_id_branch);
     } else {
       printf("branch l_w_id_branch does not exist!\n");
       exit(1);
     }
-    l_w_id_isLoaded = true;
+    l_w_id_loadedEpoch = epoch;
   }
   return *l_w_id_;
 }
 
 const vector<int> &wwwtree::l_isstar() {
-  if (not l_isstar_isLoaded) {
+  if (l_isstar_loadedEpoch != epoch) {
     if (l_isstar_branch != 0) {
-      l_isstar_branch->GetEntry(index);
+      LoadBranch(l_isstar_branch);
     } else {
       printf("branch l_isstar_branch does not exist!\n");
       exit(1);
     }
-    l_isstar_isLoaded = true;
+    l_isstar_loadedEpoch = epoch;
   }
   return *l_isstar_;
 }
 
 const vector<int> &wwwtree::l_isH() {
-  if (not l_isH_isLoaded) {
+  if (l_isH_loadedEpoch != epoch) {
     if (l_isH_branch != 0) {
-      l_isH_branch->GetEntry(index);
+      LoadBranch(l_isH_branch);
     } else {
       printf("branch l_isH_branch does not exist!\n");
       exit(1);
     }
-    l_isH_isLoaded = true;
+    l_isH_loadedEpoch = epoch;
   }
   return *l_isH_;
 }
 
 const vector<int> &wwwtree::l_istau() {
-  if (not l_istau_isLoaded) {
+  if (l_istau_loadedEpoch != epoch) {
     if (l_istau_branch != 0) {
-      l_istau_branch->GetEntry(index);
+      LoadBranch(l_istau_branch);
     } else {
       printf("branch l_istau_branch does not exist!\n");
       exit(1);
     }
-    l_istau_isLoaded = true;
+    l_istau_loadedEpoch = epoch;
   }
   return *l_istau_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &wwwtree::q_p4() {
-  if (not q_p4_isLoaded) {
+  if (q_p4_loadedEpoch != epoch) {
     if (q_p4_branch != 0) {
-      q_p4_branch->GetEntry(index);
+      LoadBranch(q_p4_branch);
     } else {
       printf("branch q_p4_branch does not exist!\n");
       exit(1);
     }
-    q_p4_isLoaded = true;
+    q_p4_loadedEpoch = epoch;
   }
   return *q_p4_;
 }
 
 const vector<float> &wwwtree::q_w_pt() {
-  if (not q_w_pt_isLoaded) {
+  if (q_w_pt_loadedEpoch != epoch) {
     if (q_w_pt_branch != 0) {
-      q_w_pt_branch->GetEntry(index);
+      LoadBranch(q_w_pt_branch);
     } else {
       printf("branch q_w_pt_branch does not exist!\n");
       exit(1);
     }
-    q_w_pt_isLoaded = true;
+    q_w_pt_loadedEpoch = epoch;
   }
   return *q_w_pt_;
 }
 
 const vector<float> &wwwtree::q_w_eta() {
-  if (not q_w_eta_isLoaded) {
+  if (q_w_eta_loadedEpoch != epoch) {
     if (q_w_eta_branch != 0) {
-      q_w_eta_branch->GetEntry(index);
+      LoadBranch(q_w_eta_branch);
     } else {
       printf("branch q_w_eta_branch does not exist!\n");
       exit(1);
     }
-    q_w_eta_isLoaded = true;
+    q_w_eta_loadedEpoch = epoch;
   }
   return *q_w_eta_;
 }
 
 const vector<float> &wwwtree::q_w_phi() {
-  if (not q_w_phi_isLoaded) {
+  if (q_w_phi_loadedEpoch != epoch) {
     if (q_w_phi_branch != 0) {
-      q_w_phi_branch->GetEntry(index);
+      LoadBranch(q_w_phi_branch);
     } else {
       printf("branch q_w_phi_branch does not exist!\n");
       exit(1);
     }
-    q_w_phi_isLoaded = true;
+    q_w_phi_loadedEpoch = epoch;
   }
   return *q_w_phi_;
 }
 
 const vector<float> &wwwtree::q_w_mass() {
-  if (not q_w_mass_isLoaded) {
+  if (q_w_mass_loadedEpoch != epoch) {
     if (q_w_mass_branch != 0) {
-      q_w_mass_branch->GetEntry(index);
+      LoadBranch(q_w_mass_branch);
     } else {
       printf("branch q_w_mass_branch does not exist!\n");
       exit(1);
     }
-    q_w_mass_isLoaded = true;
+    q_w_mass_loadedEpoch = epoch;
   }
   return *q_w_mass_;
 }
 
 const vector<int> &wwwtree::q_w_id() {
-  if (not q_w_id_isLoaded) {
+  if (q_w_id_loadedEpoch != epoch) {
     if (q_w_id_branch != 0) {
-      q_w_id_branch->GetEntry(index);
+      LoadBranch(q_w_id_branch);
     } else {
       printf("branch q_w_id_branch does not exist!\n");
       exit(1);
     }
-    q_w_id_isLoaded = true;
+    q_w_id_loadedEpoch = epoch;
   }
   return *q_w_id_;
 }
 
 const vector<int> &wwwtree::q_isstar() {
-  if (not q_isstar_isLoaded) {
+  if (q_isstar_loadedEpoch != epoch) {
     if (q_isstar_branch != 0) {
-      q_isstar_branch->GetEntry(index);
+      LoadBranch(q_isstar_branch);
     } else {
       printf("branch q_isstar_branch does not exist!\n");
       exit(1);
     }
-    q_isstar_isLoaded = true;
+    q_isstar_loadedEpoch = epoch;
   }
   return *q_isstar_;
 }
 
 const vector<int> &wwwtree::q_isH() {
-  if (not q_isH_isLoaded) {
+  if (q_isH_loadedEpoch != epoch) {
     if (q_isH_branch != 0) {
-      q_isH_branch->GetEntry(index);
+      LoadBranch(q_isH_branch);
     } else {
       printf("branch q_isH_branch does not exist!\n");
       exit(1);
     }
-    q_isH_isLoaded = true;
+    q_isH_loadedEpoch = epoch;
   }
   return *q_isH_;
 }
 
 const float &wwwtree::dRllSS() {
-  if (not dRllSS_isLoaded) {
+  if (dRllSS_loadedEpoch != epoch) {
     if (dRllSS_branch != 0) {
-      dRllSS_branch->GetEntry(index);
+      LoadBranch(dRllSS_branch);
     } else {
       printf("branch dRllSS_branch does not exist!\n");
       exit(1);
     }
-    dRllSS_isLoaded = true;
+    dRllSS_loadedEpoch = epoch;
   }
   return dRllSS_;
 }
 
 const float &wwwtree::dRqqSS() {
-  if (not dRqqSS_isLoaded) {
+  if (dRqqSS_loadedEpoch != epoch) {
     if (dRqqSS_branch != 0) {
-      dRqqSS_branch->GetEntry(index);
+      LoadBranch(dRqqSS_branch);
     } else {
       printf("branch dRqqSS_branch does not exist!\n");
       exit(1);
     }
-    dRqqSS_isLoaded = true;
+    dRqqSS_loadedEpoch = epoch;
   }
   return dRqqSS_;
 }
 
 const float &wwwtree::DPhill_higgs() {
-  if (not DPhill_higgs_isLoaded) {
+  if (DPhill_higgs_loadedEpoch != epoch) {
     if (DPhill_higgs_branch != 0) {
-      DPhill_higgs_branch->GetEntry(index);
+      LoadBranch(DPhill_higgs_branch);
     } else {
       printf("branch DPhill_higgs_branch does not exist!\n");
       exit(1);
     }
-    DPhill_higgs_isLoaded = true;
+    DPhill_higgs_loadedEpoch = epoch;
   }
   return DPhill_higgs_;
 }
 
 const float &wwwtree::Mll_higgs() {
-  if (not Mll_higgs_isLoaded) {
+  if (Mll_higgs_loadedEpoch != epoch) {
     if (Mll_higgs_branch != 0) {
-      Mll_higgs_branch->GetEntry(index);
+      LoadBranch(Mll_higgs_branch);
     } else {
       printf("branch Mll_higgs_branch does not exist!\n");
       exit(1);
     }
-    Mll_higgs_isLoaded = true;
+    Mll_higgs_loadedEpoch = epoch;
   }
   return Mll_higgs_;
 }
 
 const float &wwwtree::MT_higgs() {
-  if (not MT_higgs_isLoaded) {
+  if (MT_higgs_loadedEpoch != epoch) {
     if (MT_higgs_branch != 0) {
-      MT_higgs_branch->GetEntry(index);
+      LoadBranch(MT_higgs_branch);
     } else {
       printf("branch MT_higgs_branch does not exist!\n");
       exit(1);
     }
-    MT_higgs_isLoaded = true;
+    MT_higgs_loadedEpoch = epoch;
   }
   return MT_higgs_;
 }
@@ -8692,6 +8750,505 @@ void wwwtree::progress( int nEventsTotal, int nEventsChain ){
   }
 }
 
+void wwwtree::StartBranchTracing() {
+  // record every branch that an accessor loads until ActivateTracedBranches() is called (on top of the kept branches)
+  trace_branches_ = true;
+  traced_branches_ = kept_branches_;
+}
+
+void wwwtree::ActivateTracedBranches() {
+  // switch off every branch that was not accessed during the tracing
+  trace_branches_ = false;
+  branch_selection_active_ = true;
+  ApplyBranchSelection();
+  printf("wwwtree: %d branches were accessed during tracing, all other branches are switched off\n", (int) traced_branches_.size());
+}
+
+void wwwtree::ApplyBranchSelection() {
+  if (not tree_) return;
+  tree_->SetBranchStatus("*", 0);
+  tree_->DropBranchFromCache("*", kTRUE);
+  for (auto& name : traced_branches_) {
+    TBranch *branch = tree_->GetBranch(name);
+    if (not branch) continue;
+    SetBranchStatusRecursive(branch, true);
+    tree_->AddBranchToCache(branch, kTRUE);
+  }
+  tree_->StopCacheLearningPhase();
+}
+
+void wwwtree::KeepBranches(const set<TString> &names) {
+  kept_branches_.insert(names.begin(), names.end());
+  traced_branches_.insert(names.begin(), names.end());
+  if (branch_selection_active_) ApplyBranchSelection();
+}
+
+void wwwtree::TraceBranch(TBranch *branch) {
+  if (trace_branches_) traced_branches_.insert(branch->GetName());
+  if (branch->TestBit(kDoNotProcess)) {
+    // branch was not used during the tracing (e.g. only accessed in a rare region), switch it back on
+    printf("wwwtree: branch %s was not traced but is being accessed, switching it back on\n", branch->GetName());
+    traced_branches_.insert(branch->GetName());
+    SetBranchStatusRecursive(branch, true);
+    if (tree_) tree_->AddBranchToCache(branch, kTRUE);
+  }
+}
+
+template <class T> bool wwwtree::LoadInline(TBranch *branch, T *array) {
+  // same tracing as LoadBranch, the basket is read through the TTreeCache like for GetEntry
+  if (not branch) return false;
+  if (trace_branches_ or branch->TestBit(kDoNotProcess)) TraceBranch(branch);
+  Int_t n = WWWColumns::readVectorEntry(branch, index, array, wwwleptons::kMaxLeptons);
+  if (n < 0) return false;
+  leptons_.n = n;
+  return true;
+}
+
+const float *wwwtree::lep_pt_array() {
+  if (not inline_leptons_) return lep_pt().data();
+  if (lep_pt_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pt_branch, leptons_.lep_pt)) return lep_pt().data();
+    lep_pt_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pt;
+}
+
+const float *wwwtree::lep_eta_array() {
+  if (not inline_leptons_) return lep_eta().data();
+  if (lep_eta_inlineEpoch != epoch) {
+    if (not LoadInline(lep_eta_branch, leptons_.lep_eta)) return lep_eta().data();
+    lep_eta_inlineEpoch = epoch;
+  }
+  return leptons_.lep_eta;
+}
+
+const float *wwwtree::lep_phi_array() {
+  if (not inline_leptons_) return lep_phi().data();
+  if (lep_phi_inlineEpoch != epoch) {
+    if (not LoadInline(lep_phi_branch, leptons_.lep_phi)) return lep_phi().data();
+    lep_phi_inlineEpoch = epoch;
+  }
+  return leptons_.lep_phi;
+}
+
+const float *wwwtree::lep_coneCorrPt_array() {
+  if (not inline_leptons_) return lep_coneCorrPt().data();
+  if (lep_coneCorrPt_inlineEpoch != epoch) {
+    if (not LoadInline(lep_coneCorrPt_branch, leptons_.lep_coneCorrPt)) return lep_coneCorrPt().data();
+    lep_coneCorrPt_inlineEpoch = epoch;
+  }
+  return leptons_.lep_coneCorrPt;
+}
+
+const float *wwwtree::lep_ip3d_array() {
+  if (not inline_leptons_) return lep_ip3d().data();
+  if (lep_ip3d_inlineEpoch != epoch) {
+    if (not LoadInline(lep_ip3d_branch, leptons_.lep_ip3d)) return lep_ip3d().data();
+    lep_ip3d_inlineEpoch = epoch;
+  }
+  return leptons_.lep_ip3d;
+}
+
+const float *wwwtree::lep_ip3derr_array() {
+  if (not inline_leptons_) return lep_ip3derr().data();
+  if (lep_ip3derr_inlineEpoch != epoch) {
+    if (not LoadInline(lep_ip3derr_branch, leptons_.lep_ip3derr)) return lep_ip3derr().data();
+    lep_ip3derr_inlineEpoch = epoch;
+  }
+  return leptons_.lep_ip3derr;
+}
+
+const int *wwwtree::lep_isTriggerSafe_v1_array() {
+  if (not inline_leptons_) return lep_isTriggerSafe_v1().data();
+  if (lep_isTriggerSafe_v1_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isTriggerSafe_v1_branch, leptons_.lep_isTriggerSafe_v1)) return lep_isTriggerSafe_v1().data();
+    lep_isTriggerSafe_v1_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isTriggerSafe_v1;
+}
+
+const int *wwwtree::lep_lostHits_array() {
+  if (not inline_leptons_) return lep_lostHits().data();
+  if (lep_lostHits_inlineEpoch != epoch) {
+    if (not LoadInline(lep_lostHits_branch, leptons_.lep_lostHits)) return lep_lostHits().data();
+    lep_lostHits_inlineEpoch = epoch;
+  }
+  return leptons_.lep_lostHits;
+}
+
+const int *wwwtree::lep_convVeto_array() {
+  if (not inline_leptons_) return lep_convVeto().data();
+  if (lep_convVeto_inlineEpoch != epoch) {
+    if (not LoadInline(lep_convVeto_branch, leptons_.lep_convVeto)) return lep_convVeto().data();
+    lep_convVeto_inlineEpoch = epoch;
+  }
+  return leptons_.lep_convVeto;
+}
+
+const int *wwwtree::lep_motherIdSS_array() {
+  if (not inline_leptons_) return lep_motherIdSS().data();
+  if (lep_motherIdSS_inlineEpoch != epoch) {
+    if (not LoadInline(lep_motherIdSS_branch, leptons_.lep_motherIdSS)) return lep_motherIdSS().data();
+    lep_motherIdSS_inlineEpoch = epoch;
+  }
+  return leptons_.lep_motherIdSS;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_3l_fo_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_3l_fo().data();
+  if (lep_pass_VVV_cutbased_3l_fo_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_3l_fo_branch, leptons_.lep_pass_VVV_cutbased_3l_fo)) return lep_pass_VVV_cutbased_3l_fo().data();
+    lep_pass_VVV_cutbased_3l_fo_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_3l_fo;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_3l_tight_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_3l_tight().data();
+  if (lep_pass_VVV_cutbased_3l_tight_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_3l_tight_branch, leptons_.lep_pass_VVV_cutbased_3l_tight)) return lep_pass_VVV_cutbased_3l_tight().data();
+    lep_pass_VVV_cutbased_3l_tight_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_3l_tight;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_fo_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_fo().data();
+  if (lep_pass_VVV_cutbased_fo_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_fo_branch, leptons_.lep_pass_VVV_cutbased_fo)) return lep_pass_VVV_cutbased_fo().data();
+    lep_pass_VVV_cutbased_fo_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_fo;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_tight_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_tight().data();
+  if (lep_pass_VVV_cutbased_tight_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_tight_branch, leptons_.lep_pass_VVV_cutbased_tight)) return lep_pass_VVV_cutbased_tight().data();
+    lep_pass_VVV_cutbased_tight_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_tight;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_veto_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_veto().data();
+  if (lep_pass_VVV_cutbased_veto_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_veto_branch, leptons_.lep_pass_VVV_cutbased_veto)) return lep_pass_VVV_cutbased_veto().data();
+    lep_pass_VVV_cutbased_veto_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_veto;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_fo_noiso_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_fo_noiso().data();
+  if (lep_pass_VVV_cutbased_fo_noiso_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_fo_noiso_branch, leptons_.lep_pass_VVV_cutbased_fo_noiso)) return lep_pass_VVV_cutbased_fo_noiso().data();
+    lep_pass_VVV_cutbased_fo_noiso_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_fo_noiso;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_tight_noiso_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_tight_noiso().data();
+  if (lep_pass_VVV_cutbased_tight_noiso_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_tight_noiso_branch, leptons_.lep_pass_VVV_cutbased_tight_noiso)) return lep_pass_VVV_cutbased_tight_noiso().data();
+    lep_pass_VVV_cutbased_tight_noiso_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_tight_noiso;
+}
+
+const int *wwwtree::lep_pass_VVV_cutbased_veto_noiso_array() {
+  if (not inline_leptons_) return lep_pass_VVV_cutbased_veto_noiso().data();
+  if (lep_pass_VVV_cutbased_veto_noiso_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_VVV_cutbased_veto_noiso_branch, leptons_.lep_pass_VVV_cutbased_veto_noiso)) return lep_pass_VVV_cutbased_veto_noiso().data();
+    lep_pass_VVV_cutbased_veto_noiso_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_VVV_cutbased_veto_noiso;
+}
+
+const int *wwwtree::lep_pass_POG_veto_array() {
+  if (not inline_leptons_) return lep_pass_POG_veto().data();
+  if (lep_pass_POG_veto_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_POG_veto_branch, leptons_.lep_pass_POG_veto)) return lep_pass_POG_veto().data();
+    lep_pass_POG_veto_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_POG_veto;
+}
+
+const int *wwwtree::lep_pass_POG_loose_array() {
+  if (not inline_leptons_) return lep_pass_POG_loose().data();
+  if (lep_pass_POG_loose_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_POG_loose_branch, leptons_.lep_pass_POG_loose)) return lep_pass_POG_loose().data();
+    lep_pass_POG_loose_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_POG_loose;
+}
+
+const int *wwwtree::lep_pass_POG_medium_array() {
+  if (not inline_leptons_) return lep_pass_POG_medium().data();
+  if (lep_pass_POG_medium_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_POG_medium_branch, leptons_.lep_pass_POG_medium)) return lep_pass_POG_medium().data();
+    lep_pass_POG_medium_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_POG_medium;
+}
+
+const int *wwwtree::lep_pass_POG_tight_array() {
+  if (not inline_leptons_) return lep_pass_POG_tight().data();
+  if (lep_pass_POG_tight_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pass_POG_tight_branch, leptons_.lep_pass_POG_tight)) return lep_pass_POG_tight().data();
+    lep_pass_POG_tight_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pass_POG_tight;
+}
+
+const int *wwwtree::lep_pdgId_array() {
+  if (not inline_leptons_) return lep_pdgId().data();
+  if (lep_pdgId_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pdgId_branch, leptons_.lep_pdgId)) return lep_pdgId().data();
+    lep_pdgId_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pdgId;
+}
+
+const float *wwwtree::lep_dxy_array() {
+  if (not inline_leptons_) return lep_dxy().data();
+  if (lep_dxy_inlineEpoch != epoch) {
+    if (not LoadInline(lep_dxy_branch, leptons_.lep_dxy)) return lep_dxy().data();
+    lep_dxy_inlineEpoch = epoch;
+  }
+  return leptons_.lep_dxy;
+}
+
+const float *wwwtree::lep_dz_array() {
+  if (not inline_leptons_) return lep_dz().data();
+  if (lep_dz_inlineEpoch != epoch) {
+    if (not LoadInline(lep_dz_branch, leptons_.lep_dz)) return lep_dz().data();
+    lep_dz_inlineEpoch = epoch;
+  }
+  return leptons_.lep_dz;
+}
+
+const float *wwwtree::lep_pterr_array() {
+  if (not inline_leptons_) return lep_pterr().data();
+  if (lep_pterr_inlineEpoch != epoch) {
+    if (not LoadInline(lep_pterr_branch, leptons_.lep_pterr)) return lep_pterr().data();
+    lep_pterr_inlineEpoch = epoch;
+  }
+  return leptons_.lep_pterr;
+}
+
+const float *wwwtree::lep_relIso04DB_array() {
+  if (not inline_leptons_) return lep_relIso04DB().data();
+  if (lep_relIso04DB_inlineEpoch != epoch) {
+    if (not LoadInline(lep_relIso04DB_branch, leptons_.lep_relIso04DB)) return lep_relIso04DB().data();
+    lep_relIso04DB_inlineEpoch = epoch;
+  }
+  return leptons_.lep_relIso04DB;
+}
+
+const float *wwwtree::lep_relIso03EA_array() {
+  if (not inline_leptons_) return lep_relIso03EA().data();
+  if (lep_relIso03EA_inlineEpoch != epoch) {
+    if (not LoadInline(lep_relIso03EA_branch, leptons_.lep_relIso03EA)) return lep_relIso03EA().data();
+    lep_relIso03EA_inlineEpoch = epoch;
+  }
+  return leptons_.lep_relIso03EA;
+}
+
+const float *wwwtree::lep_relIso03EALep_array() {
+  if (not inline_leptons_) return lep_relIso03EALep().data();
+  if (lep_relIso03EALep_inlineEpoch != epoch) {
+    if (not LoadInline(lep_relIso03EALep_branch, leptons_.lep_relIso03EALep)) return lep_relIso03EALep().data();
+    lep_relIso03EALep_inlineEpoch = epoch;
+  }
+  return leptons_.lep_relIso03EALep;
+}
+
+const float *wwwtree::lep_relIso03EAv2_array() {
+  if (not inline_leptons_) return lep_relIso03EAv2().data();
+  if (lep_relIso03EAv2_inlineEpoch != epoch) {
+    if (not LoadInline(lep_relIso03EAv2_branch, leptons_.lep_relIso03EAv2)) return lep_relIso03EAv2().data();
+    lep_relIso03EAv2_inlineEpoch = epoch;
+  }
+  return leptons_.lep_relIso03EAv2;
+}
+
+const float *wwwtree::lep_relIso04EAv2_array() {
+  if (not inline_leptons_) return lep_relIso04EAv2().data();
+  if (lep_relIso04EAv2_inlineEpoch != epoch) {
+    if (not LoadInline(lep_relIso04EAv2_branch, leptons_.lep_relIso04EAv2)) return lep_relIso04EAv2().data();
+    lep_relIso04EAv2_inlineEpoch = epoch;
+  }
+  return leptons_.lep_relIso04EAv2;
+}
+
+const float *wwwtree::lep_relIso03EAv2Lep_array() {
+  if (not inline_leptons_) return lep_relIso03EAv2Lep().data();
+  if (lep_relIso03EAv2Lep_inlineEpoch != epoch) {
+    if (not LoadInline(lep_relIso03EAv2Lep_branch, leptons_.lep_relIso03EAv2Lep)) return lep_relIso03EAv2Lep().data();
+    lep_relIso03EAv2Lep_inlineEpoch = epoch;
+  }
+  return leptons_.lep_relIso03EAv2Lep;
+}
+
+const int *wwwtree::lep_tightCharge_array() {
+  if (not inline_leptons_) return lep_tightCharge().data();
+  if (lep_tightCharge_inlineEpoch != epoch) {
+    if (not LoadInline(lep_tightCharge_branch, leptons_.lep_tightCharge)) return lep_tightCharge().data();
+    lep_tightCharge_inlineEpoch = epoch;
+  }
+  return leptons_.lep_tightCharge;
+}
+
+const float *wwwtree::lep_trk_pt_array() {
+  if (not inline_leptons_) return lep_trk_pt().data();
+  if (lep_trk_pt_inlineEpoch != epoch) {
+    if (not LoadInline(lep_trk_pt_branch, leptons_.lep_trk_pt)) return lep_trk_pt().data();
+    lep_trk_pt_inlineEpoch = epoch;
+  }
+  return leptons_.lep_trk_pt;
+}
+
+const int *wwwtree::lep_charge_array() {
+  if (not inline_leptons_) return lep_charge().data();
+  if (lep_charge_inlineEpoch != epoch) {
+    if (not LoadInline(lep_charge_branch, leptons_.lep_charge)) return lep_charge().data();
+    lep_charge_inlineEpoch = epoch;
+  }
+  return leptons_.lep_charge;
+}
+
+const float *wwwtree::lep_etaSC_array() {
+  if (not inline_leptons_) return lep_etaSC().data();
+  if (lep_etaSC_inlineEpoch != epoch) {
+    if (not LoadInline(lep_etaSC_branch, leptons_.lep_etaSC)) return lep_etaSC().data();
+    lep_etaSC_inlineEpoch = epoch;
+  }
+  return leptons_.lep_etaSC;
+}
+
+const float *wwwtree::lep_MVA_array() {
+  if (not inline_leptons_) return lep_MVA().data();
+  if (lep_MVA_inlineEpoch != epoch) {
+    if (not LoadInline(lep_MVA_branch, leptons_.lep_MVA)) return lep_MVA().data();
+    lep_MVA_inlineEpoch = epoch;
+  }
+  return leptons_.lep_MVA;
+}
+
+const int *wwwtree::lep_isMediumPOG_array() {
+  if (not inline_leptons_) return lep_isMediumPOG().data();
+  if (lep_isMediumPOG_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isMediumPOG_branch, leptons_.lep_isMediumPOG)) return lep_isMediumPOG().data();
+    lep_isMediumPOG_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isMediumPOG;
+}
+
+const int *wwwtree::lep_isTightPOG_array() {
+  if (not inline_leptons_) return lep_isTightPOG().data();
+  if (lep_isTightPOG_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isTightPOG_branch, leptons_.lep_isTightPOG)) return lep_isTightPOG().data();
+    lep_isTightPOG_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isTightPOG;
+}
+
+const int *wwwtree::lep_isFromW_array() {
+  if (not inline_leptons_) return lep_isFromW().data();
+  if (lep_isFromW_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isFromW_branch, leptons_.lep_isFromW)) return lep_isFromW().data();
+    lep_isFromW_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isFromW;
+}
+
+const int *wwwtree::lep_isFromZ_array() {
+  if (not inline_leptons_) return lep_isFromZ().data();
+  if (lep_isFromZ_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isFromZ_branch, leptons_.lep_isFromZ)) return lep_isFromZ().data();
+    lep_isFromZ_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isFromZ;
+}
+
+const int *wwwtree::lep_isFromB_array() {
+  if (not inline_leptons_) return lep_isFromB().data();
+  if (lep_isFromB_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isFromB_branch, leptons_.lep_isFromB)) return lep_isFromB().data();
+    lep_isFromB_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isFromB;
+}
+
+const int *wwwtree::lep_isFromC_array() {
+  if (not inline_leptons_) return lep_isFromC().data();
+  if (lep_isFromC_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isFromC_branch, leptons_.lep_isFromC)) return lep_isFromC().data();
+    lep_isFromC_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isFromC;
+}
+
+const int *wwwtree::lep_isFromL_array() {
+  if (not inline_leptons_) return lep_isFromL().data();
+  if (lep_isFromL_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isFromL_branch, leptons_.lep_isFromL)) return lep_isFromL().data();
+    lep_isFromL_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isFromL;
+}
+
+const int *wwwtree::lep_isFromLF_array() {
+  if (not inline_leptons_) return lep_isFromLF().data();
+  if (lep_isFromLF_inlineEpoch != epoch) {
+    if (not LoadInline(lep_isFromLF_branch, leptons_.lep_isFromLF)) return lep_isFromLF().data();
+    lep_isFromLF_inlineEpoch = epoch;
+  }
+  return leptons_.lep_isFromLF;
+}
+
+const int *wwwtree::lep_genPart_index_array() {
+  if (not inline_leptons_) return lep_genPart_index().data();
+  if (lep_genPart_index_inlineEpoch != epoch) {
+    if (not LoadInline(lep_genPart_index_branch, leptons_.lep_genPart_index)) return lep_genPart_index().data();
+    lep_genPart_index_inlineEpoch = epoch;
+  }
+  return leptons_.lep_genPart_index;
+}
+
+const float *wwwtree::lep_r9_array() {
+  if (not inline_leptons_) return lep_r9().data();
+  if (lep_r9_inlineEpoch != epoch) {
+    if (not LoadInline(lep_r9_branch, leptons_.lep_r9)) return lep_r9().data();
+    lep_r9_inlineEpoch = epoch;
+  }
+  return leptons_.lep_r9;
+}
+
+const int *wwwtree::lep_nlayers_array() {
+  if (not inline_leptons_) return lep_nlayers().data();
+  if (lep_nlayers_inlineEpoch != epoch) {
+    if (not LoadInline(lep_nlayers_branch, leptons_.lep_nlayers)) return lep_nlayers().data();
+    lep_nlayers_inlineEpoch = epoch;
+  }
+  return leptons_.lep_nlayers;
+}
+
+void wwwtree::LoadFromColumns(TBranch *branch) {
+  // the column index is stored in the unique ID of the branch by WWWColumns::setTree
+  if (not columns_->copy(branch->GetUniqueID() - 1, index, branch->GetAddress()))
+    branch->GetEntry(index);
+}
+
+void wwwtree::SetBranchStatusRecursive(TBranch *branch, bool status) {
+  branch->SetStatus(status);
+  TObjArray *subbranches = branch->GetListOfBranches();
+  for (int i = 0; i < subbranches->GetEntriesFast(); ++i)
+    SetBranchStatusRecursive((TBranch*) subbranches->At(i), status);
+}
+
 namespace tas {
 
 const int &run() { return www.run(); }
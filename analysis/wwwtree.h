@@ -14,1544 +14,1602 @@
 #include "TFile.h"
 #include "TBits.h"
 #include <vector> 
+#include <set> 
 #include <unistd.h> 
 typedef ROOT::Math::LorentzVector< ROOT::Math::PxPyPzE4D<float> > LorentzVector;
 
 using namespace std; 
+// Fixed capacity structure of arrays for the per-lepton float/int branches (see wwwtree::SetInlineLeptons)
+struct wwwleptons {
+  static const unsigned int kMaxLeptons = 10;
+  unsigned int n;
+  float lep_pt[kMaxLeptons];
+  float lep_eta[kMaxLeptons];
+  float lep_phi[kMaxLeptons];
+  float lep_coneCorrPt[kMaxLeptons];
+  float lep_ip3d[kMaxLeptons];
+  float lep_ip3derr[kMaxLeptons];
+  int lep_isTriggerSafe_v1[kMaxLeptons];
+  int lep_lostHits[kMaxLeptons];
+  int lep_convVeto[kMaxLeptons];
+  int lep_motherIdSS[kMaxLeptons];
+  int lep_pass_VVV_cutbased_3l_fo[kMaxLeptons];
+  int lep_pass_VVV_cutbased_3l_tight[kMaxLeptons];
+  int lep_pass_VVV_cutbased_fo[kMaxLeptons];
+  int lep_pass_VVV_cutbased_tight[kMaxLeptons];
+  int lep_pass_VVV_cutbased_veto[kMaxLeptons];
+  int lep_pass_VVV_cutbased_fo_noiso[kMaxLeptons];
+  int lep_pass_VVV_cutbased_tight_noiso[kMaxLeptons];
+  int lep_pass_VVV_cutbased_veto_noiso[kMaxLeptons];
+  int lep_pass_POG_veto[kMaxLeptons];
+  int lep_pass_POG_loose[kMaxLeptons];
+  int lep_pass_POG_medium[kMaxLeptons];
+  int lep_pass_POG_tight[kMaxLeptons];
+  int lep_pdgId[kMaxLeptons];
+  float lep_dxy[kMaxLeptons];
+  float lep_dz[kMaxLeptons];
+  float lep_pterr[kMaxLeptons];
+  float lep_relIso04DB[kMaxLeptons];
+  float lep_relIso03EA[kMaxLeptons];
+  float lep_relIso03EALep[kMaxLeptons];
+  float lep_relIso03EAv2[kMaxLeptons];
+  float lep_relIso04EAv2[kMaxLeptons];
+  float lep_relIso03EAv2Lep[kMaxLeptons];
+  int lep_tightCharge[kMaxLeptons];
+  float lep_trk_pt[kMaxLeptons];
+  int lep_charge[kMaxLeptons];
+  float lep_etaSC[kMaxLeptons];
+  float lep_MVA[kMaxLeptons];
+  int lep_isMediumPOG[kMaxLeptons];
+  int lep_isTightPOG[kMaxLeptons];
+  int lep_isFromW[kMaxLeptons];
+  int lep_isFromZ[kMaxLeptons];
+  int lep_isFromB[kMaxLeptons];
+  int lep_isFromC[kMaxLeptons];
+  int lep_isFromL[kMaxLeptons];
+  int lep_isFromLF[kMaxLeptons];
+  int lep_genPart_index[kMaxLeptons];
+  float lep_r9[kMaxLeptons];
+  int lep_nlayers[kMaxLeptons];
+};
+
+class WWWColumns;
 class wwwtree {
  private: 
  protected: 
   unsigned int index;
+  unsigned int epoch;
   int      run_;
   TBranch *run_branch;
-  bool     run_isLoaded;
+  unsigned int run_loadedEpoch;
   int      lumi_;
   TBranch *lumi_branch;
-  bool     lumi_isLoaded;
+  unsigned int lumi_loadedEpoch;
   unsigned long long evt_;
   TBranch *evt_branch;
-  bool     evt_isLoaded;
+  unsigned int evt_loadedEpoch;
   int      isData_;
   TBranch *isData_branch;
-  bool     isData_isLoaded;
+  unsigned int isData_loadedEpoch;
   float    evt_scale1fb_;
   TBranch *evt_scale1fb_branch;
-  bool     evt_scale1fb_isLoaded;
+  unsigned int evt_scale1fb_loadedEpoch;
   float    xsec_br_;
   TBranch *xsec_br_branch;
-  bool     xsec_br_isLoaded;
+  unsigned int xsec_br_loadedEpoch;
   int      evt_passgoodrunlist_;
   TBranch *evt_passgoodrunlist_branch;
-  bool     evt_passgoodrunlist_isLoaded;
+  unsigned int evt_passgoodrunlist_loadedEpoch;
   TString *CMS4path_;
   TBranch *CMS4path_branch;
-  bool     CMS4path_isLoaded;
+  unsigned int CMS4path_loadedEpoch;
   int      CMS4index_;
   TBranch *CMS4index_branch;
-  bool     CMS4index_isLoaded;
+  unsigned int CMS4index_loadedEpoch;
   float    weight_fr_r1_f1_;
   TBranch *weight_fr_r1_f1_branch;
-  bool     weight_fr_r1_f1_isLoaded;
+  unsigned int weight_fr_r1_f1_loadedEpoch;
   float    weight_fr_r1_f2_;
   TBranch *weight_fr_r1_f2_branch;
-  bool     weight_fr_r1_f2_isLoaded;
+  unsigned int weight_fr_r1_f2_loadedEpoch;
   float    weight_fr_r1_f0p5_;
   TBranch *weight_fr_r1_f0p5_branch;
-  bool     weight_fr_r1_f0p5_isLoaded;
+  unsigned int weight_fr_r1_f0p5_loadedEpoch;
   float    weight_fr_r2_f1_;
   TBranch *weight_fr_r2_f1_branch;
-  bool     weight_fr_r2_f1_isLoaded;
+  unsigned int weight_fr_r2_f1_loadedEpoch;
   float    weight_fr_r2_f2_;
   TBranch *weight_fr_r2_f2_branch;
-  bool     weight_fr_r2_f2_isLoaded;
+  unsigned int weight_fr_r2_f2_loadedEpoch;
   float    weight_fr_r2_f0p5_;
   TBranch *weight_fr_r2_f0p5_branch;
-  bool     weight_fr_r2_f0p5_isLoaded;
+  unsigned int weight_fr_r2_f0p5_loadedEpoch;
   float    weight_fr_r0p5_f1_;
   TBranch *weight_fr_r0p5_f1_branch;
-  bool     weight_fr_r0p5_f1_isLoaded;
+  unsigned int weight_fr_r0p5_f1_loadedEpoch;
   float    weight_fr_r0p5_f2_;
   TBranch *weight_fr_r0p5_f2_branch;
-  bool     weight_fr_r0p5_f2_isLoaded;
+  unsigned int weight_fr_r0p5_f2_loadedEpoch;
   float    weight_fr_r0p5_f0p5_;
   TBranch *weight_fr_r0p5_f0p5_branch;
-  bool     weight_fr_r0p5_f0p5_isLoaded;
+  unsigned int weight_fr_r0p5_f0p5_loadedEpoch;
   float    weight_pdf_up_;
   TBranch *weight_pdf_up_branch;
-  bool     weight_pdf_up_isLoaded;
+  unsigned int weight_pdf_up_loadedEpoch;
   float    weight_pdf_down_;
   TBranch *weight_pdf_down_branch;
-  bool     weight_pdf_down_isLoaded;
+  unsigned int weight_pdf_down_loadedEpoch;
   float    weight_alphas_down_;
   TBranch *weight_alphas_down_branch;
-  bool     weight_alphas_down_isLoaded;
+  unsigned int weight_alphas_down_loadedEpoch;
   float    weight_alphas_up_;
   TBranch *weight_alphas_up_branch;
-  bool     weight_alphas_up_isLoaded;
+  unsigned int weight_alphas_up_loadedEpoch;
   float    weight_isr_;
   TBranch *weight_isr_branch;
-  bool     weight_isr_isLoaded;
+  unsigned int weight_isr_loadedEpoch;
   float    weight_isr_up_;
   TBranch *weight_isr_up_branch;
-  bool     weight_isr_up_isLoaded;
+  unsigned int weight_isr_up_loadedEpoch;
   float    weight_isr_down_;
   TBranch *weight_isr_down_branch;
-  bool     weight_isr_down_isLoaded;
+  unsigned int weight_isr_down_loadedEpoch;
   int      HLT_DoubleMu_;
   TBranch *HLT_DoubleMu_branch;
-  bool     HLT_DoubleMu_isLoaded;
+  unsigned int HLT_DoubleMu_loadedEpoch;
   int      HLT_DoubleEl_;
   TBranch *HLT_DoubleEl_branch;
-  bool     HLT_DoubleEl_isLoaded;
+  unsigned int HLT_DoubleEl_loadedEpoch;
   int      HLT_DoubleEl_DZ_;
   TBranch *HLT_DoubleEl_DZ_branch;
-  bool     HLT_DoubleEl_DZ_isLoaded;
+  unsigned int HLT_DoubleEl_DZ_loadedEpoch;
   int      HLT_DoubleEl_DZ_2_;
   TBranch *HLT_DoubleEl_DZ_2_branch;
-  bool     HLT_DoubleEl_DZ_2_isLoaded;
+  unsigned int HLT_DoubleEl_DZ_2_loadedEpoch;
   int      HLT_MuEG_;
   TBranch *HLT_MuEG_branch;
-  bool     HLT_MuEG_isLoaded;
+  unsigned int HLT_MuEG_loadedEpoch;
   int      HLT_SingleEl8_;
   TBranch *HLT_SingleEl8_branch;
-  bool     HLT_SingleEl8_isLoaded;
+  unsigned int HLT_SingleEl8_loadedEpoch;
   int      HLT_SingleEl17_;
   TBranch *HLT_SingleEl17_branch;
-  bool     HLT_SingleEl17_isLoaded;
+  unsigned int HLT_SingleEl17_loadedEpoch;
   int      HLT_SingleIsoEl8_;
   TBranch *HLT_SingleIsoEl8_branch;
-  bool     HLT_SingleIsoEl8_isLoaded;
+  unsigned int HLT_SingleIsoEl8_loadedEpoch;
   int      HLT_SingleIsoEl17_;
   TBranch *HLT_SingleIsoEl17_branch;
-  bool     HLT_SingleIsoEl17_isLoaded;
+  unsigned int HLT_SingleIsoEl17_loadedEpoch;
   int      HLT_SingleIsoEl23_;
   TBranch *HLT_SingleIsoEl23_branch;
-  bool     HLT_SingleIsoEl23_isLoaded;
+  unsigned int HLT_SingleIsoEl23_loadedEpoch;
   int      HLT_SingleIsoMu8_;
   TBranch *HLT_SingleIsoMu8_branch;
-  bool     HLT_SingleIsoMu8_isLoaded;
+  unsigned int HLT_SingleIsoMu8_loadedEpoch;
   int      HLT_SingleIsoMu17_;
   TBranch *HLT_SingleIsoMu17_branch;
-  bool     HLT_SingleIsoMu17_isLoaded;
+  unsigned int HLT_SingleIsoMu17_loadedEpoch;
   int      HLT_PFMET140_PFMHT140_IDTight_;
   TBranch *HLT_PFMET140_PFMHT140_IDTight_branch;
-  bool     HLT_PFMET140_PFMHT140_IDTight_isLoaded;
+  unsigned int HLT_PFMET140_PFMHT140_IDTight_loadedEpoch;
   int      mc_HLT_DoubleMu_;
   TBranch *mc_HLT_DoubleMu_branch;
-  bool     mc_HLT_DoubleMu_isLoaded;
+  unsigned int mc_HLT_DoubleMu_loadedEpoch;
   int      mc_HLT_DoubleEl_;
   TBranch *mc_HLT_DoubleEl_branch;
-  bool     mc_HLT_DoubleEl_isLoaded;
+  unsigned int mc_HLT_DoubleEl_loadedEpoch;
   int      mc_HLT_DoubleEl_DZ_;
   TBranch *mc_HLT_DoubleEl_DZ_branch;
-  bool     mc_HLT_DoubleEl_DZ_isLoaded;
+  unsigned int mc_HLT_DoubleEl_DZ_loadedEpoch;
   int      mc_HLT_DoubleEl_DZ_2_;
   TBranch *mc_HLT_DoubleEl_DZ_2_branch;
-  bool     mc_HLT_DoubleEl_DZ_2_isLoaded;
+  unsigned int mc_HLT_DoubleEl_DZ_2_loadedEpoch;
   int      mc_HLT_MuEG_;
   TBranch *mc_HLT_MuEG_branch;
-  bool     mc_HLT_MuEG_isLoaded;
+  unsigned int mc_HLT_MuEG_loadedEpoch;
   int      mc_HLT_SingleEl8_;
   TBranch *mc_HLT_SingleEl8_branch;
-  bool     mc_HLT_SingleEl8_isLoaded;
+  unsigned int mc_HLT_SingleEl8_loadedEpoch;
   int      mc_HLT_SingleEl17_;
   TBranch *mc_HLT_SingleEl17_branch;
-  bool     mc_HLT_SingleEl17_isLoaded;
+  unsigned int mc_HLT_SingleEl17_loadedEpoch;
   int      mc_HLT_SingleIsoEl8_;
   TBranch *mc_HLT_SingleIsoEl8_branch;
-  bool     mc_HLT_SingleIsoEl8_isLoaded;
+  unsigned int mc_HLT_SingleIsoEl8_loadedEpoch;
   int      mc_HLT_SingleIsoEl17_;
   TBranch *mc_HLT_SingleIsoEl17_branch;
-  bool     mc_HLT_SingleIsoEl17_isLoaded;
+  unsigned int mc_HLT_SingleIsoEl17_loadedEpoch;
   int      mc_HLT_SingleIsoEl23_;
   TBranch *mc_HLT_SingleIsoEl23_branch;
-  bool     mc_HLT_SingleIsoEl23_isLoaded;
+  unsigned int mc_HLT_SingleIsoEl23_loadedEpoch;
   int      mc_HLT_SingleIsoMu8_;
   TBranch *mc_HLT_SingleIsoMu8_branch;
-  bool     mc_HLT_SingleIsoMu8_isLoaded;
+  unsigned int mc_HLT_SingleIsoMu8_loadedEpoch;
   int      mc_HLT_SingleIsoMu17_;
   TBranch *mc_HLT_SingleIsoMu17_branch;
-  bool     mc_HLT_SingleIsoMu17_isLoaded;
+  unsigned int mc_HLT_SingleIsoMu17_loadedEpoch;
   int      mc_HLT_PFMET140_PFMHT140_IDTight_;
   TBranch *mc_HLT_PFMET140_PFMHT140_IDTight_branch;
-  bool     mc_HLT_PFMET140_PFMHT140_IDTight_isLoaded;
+  unsigned int mc_HLT_PFMET140_PFMHT140_IDTight_loadedEpoch;
   int      pass_duplicate_ee_em_mm_;
   TBranch *pass_duplicate_ee_em_mm_branch;
-  bool     pass_duplicate_ee_em_mm_isLoaded;
+  unsigned int pass_duplicate_ee_em_mm_loadedEpoch;
   int      pass_duplicate_mm_em_ee_;
   TBranch *pass_duplicate_mm_em_ee_branch;
-  bool     pass_duplicate_mm_em_ee_isLoaded;
+  unsigned int pass_duplicate_mm_em_ee_loadedEpoch;
   int      is2016_;
   TBranch *is2016_branch;
-  bool     is2016_isLoaded;
+  unsigned int is2016_loadedEpoch;
   int      is2017_;
   TBranch *is2017_branch;
-  bool     is2017_isLoaded;
+  unsigned int is2017_loadedEpoch;
   int      HLT_MuEG_2016_;
   TBranch *HLT_MuEG_2016_branch;
-  bool     HLT_MuEG_2016_isLoaded;
+  unsigned int HLT_MuEG_2016_loadedEpoch;
   int      mc_HLT_MuEG_2016_;
   TBranch *mc_HLT_MuEG_2016_branch;
-  bool     mc_HLT_MuEG_2016_isLoaded;
+  unsigned int mc_HLT_MuEG_2016_loadedEpoch;
   int      pass_duplicate_ee_em2016_mm_;
   TBranch *pass_duplicate_ee_em2016_mm_branch;
-  bool     pass_duplicate_ee_em2016_mm_isLoaded;
+  unsigned int pass_duplicate_ee_em2016_mm_loadedEpoch;
   int      pass_duplicate_mm_em2016_ee_;
   TBranch *pass_duplicate_mm_em2016_ee_branch;
-  bool     pass_duplicate_mm_em2016_ee_isLoaded;
+  unsigned int pass_duplicate_mm_em2016_ee_loadedEpoch;
   int      passTrigger_;
   TBranch *passTrigger_branch;
-  bool     passTrigger_isLoaded;
+  unsigned int passTrigger_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *lep_p4_;
   TBranch *lep_p4_branch;
-  bool     lep_p4_isLoaded;
+  unsigned int lep_p4_loadedEpoch;
   vector<float> *lep_pt_;
   TBranch *lep_pt_branch;
-  bool     lep_pt_isLoaded;
+  unsigned int lep_pt_loadedEpoch;
   vector<float> *lep_eta_;
   TBranch *lep_eta_branch;
-  bool     lep_eta_isLoaded;
+  unsigned int lep_eta_loadedEpoch;
   vector<float> *lep_phi_;
   TBranch *lep_phi_branch;
-  bool     lep_phi_isLoaded;
+  unsigned int lep_phi_loadedEpoch;
   vector<float> *lep_coneCorrPt_;
   TBranch *lep_coneCorrPt_branch;
-  bool     lep_coneCorrPt_isLoaded;
+  unsigned int lep_coneCorrPt_loadedEpoch;
   vector<float> *lep_ip3d_;
   TBranch *lep_ip3d_branch;
-  bool     lep_ip3d_isLoaded;
+  unsigned int lep_ip3d_loadedEpoch;
   vector<float> *lep_ip3derr_;
   TBranch *lep_ip3derr_branch;
-  bool     lep_ip3derr_isLoaded;
+  unsigned int lep_ip3derr_loadedEpoch;
   vector<int> *lep_isTriggerSafe_v1_;
   TBranch *lep_isTriggerSafe_v1_branch;
-  bool     lep_isTriggerSafe_v1_isLoaded;
+  unsigned int lep_isTriggerSafe_v1_loadedEpoch;
   vector<int> *lep_lostHits_;
   TBranch *lep_lostHits_branch;
-  bool     lep_lostHits_isLoaded;
+  unsigned int lep_lostHits_loadedEpoch;
   vector<int> *lep_convVeto_;
   TBranch *lep_convVeto_branch;
-  bool     lep_convVeto_isLoaded;
+  unsigned int lep_convVeto_loadedEpoch;
   vector<int> *lep_motherIdSS_;
   TBranch *lep_motherIdSS_branch;
-  bool     lep_motherIdSS_isLoaded;
+  unsigned int lep_motherIdSS_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_3l_fo_;
   TBranch *lep_pass_VVV_cutbased_3l_fo_branch;
-  bool     lep_pass_VVV_cutbased_3l_fo_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_3l_fo_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_3l_tight_;
   TBranch *lep_pass_VVV_cutbased_3l_tight_branch;
-  bool     lep_pass_VVV_cutbased_3l_tight_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_3l_tight_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_fo_;
   TBranch *lep_pass_VVV_cutbased_fo_branch;
-  bool     lep_pass_VVV_cutbased_fo_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_fo_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_tight_;
   TBranch *lep_pass_VVV_cutbased_tight_branch;
-  bool     lep_pass_VVV_cutbased_tight_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_tight_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_veto_;
   TBranch *lep_pass_VVV_cutbased_veto_branch;
-  bool     lep_pass_VVV_cutbased_veto_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_veto_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_fo_noiso_;
   TBranch *lep_pass_VVV_cutbased_fo_noiso_branch;
-  bool     lep_pass_VVV_cutbased_fo_noiso_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_fo_noiso_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_tight_noiso_;
   TBranch *lep_pass_VVV_cutbased_tight_noiso_branch;
-  bool     lep_pass_VVV_cutbased_tight_noiso_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_tight_noiso_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_veto_noiso_;
   TBranch *lep_pass_VVV_cutbased_veto_noiso_branch;
-  bool     lep_pass_VVV_cutbased_veto_noiso_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_veto_noiso_loadedEpoch;
   vector<int> *lep_pass_POG_veto_;
   TBranch *lep_pass_POG_veto_branch;
-  bool     lep_pass_POG_veto_isLoaded;
+  unsigned int lep_pass_POG_veto_loadedEpoch;
   vector<int> *lep_pass_POG_loose_;
   TBranch *lep_pass_POG_loose_branch;
-  bool     lep_pass_POG_loose_isLoaded;
+  unsigned int lep_pass_POG_loose_loadedEpoch;
   vector<int> *lep_pass_POG_medium_;
   TBranch *lep_pass_POG_medium_branch;
-  bool     lep_pass_POG_medium_isLoaded;
+  unsigned int lep_pass_POG_medium_loadedEpoch;
   vector<int> *lep_pass_POG_tight_;
   TBranch *lep_pass_POG_tight_branch;
-  bool     lep_pass_POG_tight_isLoaded;
+  unsigned int lep_pass_POG_tight_loadedEpoch;
   vector<int> *lep_pdgId_;
   TBranch *lep_pdgId_branch;
-  bool     lep_pdgId_isLoaded;
+  unsigned int lep_pdgId_loadedEpoch;
   vector<float> *lep_dxy_;
   TBranch *lep_dxy_branch;
-  bool     lep_dxy_isLoaded;
+  unsigned int lep_dxy_loadedEpoch;
   vector<float> *lep_dz_;
   TBranch *lep_dz_branch;
-  bool     lep_dz_isLoaded;
+  unsigned int lep_dz_loadedEpoch;
   vector<float> *lep_pterr_;
   TBranch *lep_pterr_branch;
-  bool     lep_pterr_isLoaded;
+  unsigned int lep_pterr_loadedEpoch;
   vector<float> *lep_relIso04DB_;
   TBranch *lep_relIso04DB_branch;
-  bool     lep_relIso04DB_isLoaded;
+  unsigned int lep_relIso04DB_loadedEpoch;
   vector<float> *lep_relIso03EA_;
   TBranch *lep_relIso03EA_branch;
-  bool     lep_relIso03EA_isLoaded;
+  unsigned int lep_relIso03EA_loadedEpoch;
   vector<float> *lep_relIso03EALep_;
   TBranch *lep_relIso03EALep_branch;
-  bool     lep_relIso03EALep_isLoaded;
+  unsigned int lep_relIso03EALep_loadedEpoch;
   vector<float> *lep_relIso03EAv2_;
   TBranch *lep_relIso03EAv2_branch;
-  bool     lep_relIso03EAv2_isLoaded;
+  unsigned int lep_relIso03EAv2_loadedEpoch;
   vector<float> *lep_relIso04EAv2_;
   TBranch *lep_relIso04EAv2_branch;
-  bool     lep_relIso04EAv2_isLoaded;
+  unsigned int lep_relIso04EAv2_loadedEpoch;
   vector<float> *lep_relIso03EAv2Lep_;
   TBranch *lep_relIso03EAv2Lep_branch;
-  bool     lep_relIso03EAv2Lep_isLoaded;
+  unsigned int lep_relIso03EAv2Lep_loadedEpoch;
   vector<int> *lep_tightCharge_;
   TBranch *lep_tightCharge_branch;
-  bool     lep_tightCharge_isLoaded;
+  unsigned int lep_tightCharge_loadedEpoch;
   vector<float> *lep_trk_pt_;
   TBranch *lep_trk_pt_branch;
-  bool     lep_trk_pt_isLoaded;
+  unsigned int lep_trk_pt_loadedEpoch;
   vector<int> *lep_charge_;
   TBranch *lep_charge_branch;
-  bool     lep_charge_isLoaded;
+  unsigned int lep_charge_loadedEpoch;
   vector<float> *lep_etaSC_;
   TBranch *lep_etaSC_branch;
-  bool     lep_etaSC_isLoaded;
+  unsigned int lep_etaSC_loadedEpoch;
   vector<float> *lep_MVA_;
   TBranch *lep_MVA_branch;
-  bool     lep_MVA_isLoaded;
+  unsigned int lep_MVA_loadedEpoch;
   vector<int> *lep_isMediumPOG_;
   TBranch *lep_isMediumPOG_branch;
-  bool     lep_isMediumPOG_isLoaded;
+  unsigned int lep_isMediumPOG_loadedEpoch;
   vector<int> *lep_isTightPOG_;
   TBranch *lep_isTightPOG_branch;
-  bool     lep_isTightPOG_isLoaded;
+  unsigned int lep_isTightPOG_loadedEpoch;
   vector<int> *lep_isFromW_;
   TBranch *lep_isFromW_branch;
-  bool     lep_isFromW_isLoaded;
+  unsigned int lep_isFromW_loadedEpoch;
   vector<int> *lep_isFromZ_;
   TBranch *lep_isFromZ_branch;
-  bool     lep_isFromZ_isLoaded;
+  unsigned int lep_isFromZ_loadedEpoch;
   vector<int> *lep_isFromB_;
   TBranch *lep_isFromB_branch;
-  bool     lep_isFromB_isLoaded;
+  unsigned int lep_isFromB_loadedEpoch;
   vector<int> *lep_isFromC_;
   TBranch *lep_isFromC_branch;
-  bool     lep_isFromC_isLoaded;
+  unsigned int lep_isFromC_loadedEpoch;
   vector<int> *lep_isFromL_;
   TBranch *lep_isFromL_branch;
-  bool     lep_isFromL_isLoaded;
+  unsigned int lep_isFromL_loadedEpoch;
   vector<int> *lep_isFromLF_;
   TBranch *lep_isFromLF_branch;
-  bool     lep_isFromLF_isLoaded;
+  unsigned int lep_isFromLF_loadedEpoch;
   vector<int> *lep_genPart_index_;
   TBranch *lep_genPart_index_branch;
-  bool     lep_genPart_index_isLoaded;
+  unsigned int lep_genPart_index_loadedEpoch;
   vector<float> *lep_r9_;
   TBranch *lep_r9_branch;
-  bool     lep_r9_isLoaded;
+  unsigned int lep_r9_loadedEpoch;
   vector<int> *lep_nlayers_;
   TBranch *lep_nlayers_branch;
-  bool     lep_nlayers_isLoaded;
+  unsigned int lep_nlayers_loadedEpoch;
   float    el_pt_;
   TBranch *el_pt_branch;
-  bool     el_pt_isLoaded;
+  unsigned int el_pt_loadedEpoch;
   float    el_eta_;
   TBranch *el_eta_branch;
-  bool     el_eta_isLoaded;
+  unsigned int el_eta_loadedEpoch;
   float    el_phi_;
   TBranch *el_phi_branch;
-  bool     el_phi_isLoaded;
+  unsigned int el_phi_loadedEpoch;
   float    el_relIso03EA_;
   TBranch *el_relIso03EA_branch;
-  bool     el_relIso03EA_isLoaded;
+  unsigned int el_relIso03EA_loadedEpoch;
   float    el_relIso03EALep_;
   TBranch *el_relIso03EALep_branch;
-  bool     el_relIso03EALep_isLoaded;
+  unsigned int el_relIso03EALep_loadedEpoch;
   float    el_ip3d_;
   TBranch *el_ip3d_branch;
-  bool     el_ip3d_isLoaded;
+  unsigned int el_ip3d_loadedEpoch;
   float    mu_pt_;
   TBranch *mu_pt_branch;
-  bool     mu_pt_isLoaded;
+  unsigned int mu_pt_loadedEpoch;
   float    mu_eta_;
   TBranch *mu_eta_branch;
-  bool     mu_eta_isLoaded;
+  unsigned int mu_eta_loadedEpoch;
   float    mu_phi_;
   TBranch *mu_phi_branch;
-  bool     mu_phi_isLoaded;
+  unsigned int mu_phi_loadedEpoch;
   float    mu_relIso04DB_;
   TBranch *mu_relIso04DB_branch;
-  bool     mu_relIso04DB_isLoaded;
+  unsigned int mu_relIso04DB_loadedEpoch;
   float    mu_relIso03EA_;
   TBranch *mu_relIso03EA_branch;
-  bool     mu_relIso03EA_isLoaded;
+  unsigned int mu_relIso03EA_loadedEpoch;
   float    mu_relIso03EALep_;
   TBranch *mu_relIso03EALep_branch;
-  bool     mu_relIso03EALep_isLoaded;
+  unsigned int mu_relIso03EALep_loadedEpoch;
   float    mu_ip3d_;
   TBranch *mu_ip3d_branch;
-  bool     mu_ip3d_isLoaded;
+  unsigned int mu_ip3d_loadedEpoch;
   float    lbnt_pt_;
   TBranch *lbnt_pt_branch;
-  bool     lbnt_pt_isLoaded;
+  unsigned int lbnt_pt_loadedEpoch;
   float    lbnt_coneCorrPt_;
   TBranch *lbnt_coneCorrPt_branch;
-  bool     lbnt_coneCorrPt_isLoaded;
+  unsigned int lbnt_coneCorrPt_loadedEpoch;
   float    lbnt_abseta_;
   TBranch *lbnt_abseta_branch;
-  bool     lbnt_abseta_isLoaded;
+  unsigned int lbnt_abseta_loadedEpoch;
   float    lbnt_pdgId_;
   TBranch *lbnt_pdgId_branch;
-  bool     lbnt_pdgId_isLoaded;
+  unsigned int lbnt_pdgId_loadedEpoch;
   float    lbnt_el_pt_;
   TBranch *lbnt_el_pt_branch;
-  bool     lbnt_el_pt_isLoaded;
+  unsigned int lbnt_el_pt_loadedEpoch;
   float    lbnt_el_coneCorrPt_;
   TBranch *lbnt_el_coneCorrPt_branch;
-  bool     lbnt_el_coneCorrPt_isLoaded;
+  unsigned int lbnt_el_coneCorrPt_loadedEpoch;
   float    lbnt_el_abseta_;
   TBranch *lbnt_el_abseta_branch;
-  bool     lbnt_el_abseta_isLoaded;
+  unsigned int lbnt_el_abseta_loadedEpoch;
   float    lbnt_mu_pt_;
   TBranch *lbnt_mu_pt_branch;
-  bool     lbnt_mu_pt_isLoaded;
+  unsigned int lbnt_mu_pt_loadedEpoch;
   float    lbnt_mu_coneCorrPt_;
   TBranch *lbnt_mu_coneCorrPt_branch;
-  bool     lbnt_mu_coneCorrPt_isLoaded;
+  unsigned int lbnt_mu_coneCorrPt_loadedEpoch;
   float    lbnt_mu_abseta_;
   TBranch *lbnt_mu_abseta_branch;
-  bool     lbnt_mu_abseta_isLoaded;
+  unsigned int lbnt_mu_abseta_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_p4_;
   TBranch *jets_p4_branch;
-  bool     jets_p4_isLoaded;
+  unsigned int jets_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_up_p4_;
   TBranch *jets_up_p4_branch;
-  bool     jets_up_p4_isLoaded;
+  unsigned int jets_up_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_dn_p4_;
   TBranch *jets_dn_p4_branch;
-  bool     jets_dn_p4_isLoaded;
+  unsigned int jets_dn_p4_loadedEpoch;
   vector<float> *jets_csv_;
   TBranch *jets_csv_branch;
-  bool     jets_csv_isLoaded;
+  unsigned int jets_csv_loadedEpoch;
   vector<float> *jets_up_csv_;
   TBranch *jets_up_csv_branch;
-  bool     jets_up_csv_isLoaded;
+  unsigned int jets_up_csv_loadedEpoch;
   vector<float> *jets_dn_csv_;
   TBranch *jets_dn_csv_branch;
-  bool     jets_dn_csv_isLoaded;
+  unsigned int jets_dn_csv_loadedEpoch;
   vector<float> *jets_jer_csv_;
   TBranch *jets_jer_csv_branch;
-  bool     jets_jer_csv_isLoaded;
+  unsigned int jets_jer_csv_loadedEpoch;
   vector<float> *jets_jerup_csv_;
   TBranch *jets_jerup_csv_branch;
-  bool     jets_jerup_csv_isLoaded;
+  unsigned int jets_jerup_csv_loadedEpoch;
   vector<float> *jets_jerdn_csv_;
   TBranch *jets_jerdn_csv_branch;
-  bool     jets_jerdn_csv_isLoaded;
+  unsigned int jets_jerdn_csv_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_jer_p4_;
   TBranch *jets_jer_p4_branch;
-  bool     jets_jer_p4_isLoaded;
+  unsigned int jets_jer_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_jerup_p4_;
   TBranch *jets_jerup_p4_branch;
-  bool     jets_jerup_p4_isLoaded;
+  unsigned int jets_jerup_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_jerdn_p4_;
   TBranch *jets_jerdn_p4_branch;
-  bool     jets_jerdn_p4_isLoaded;
+  unsigned int jets_jerdn_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets30_p4_;
   TBranch *jets30_p4_branch;
-  bool     jets30_p4_isLoaded;
+  unsigned int jets30_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets30_up_p4_;
   TBranch *jets30_up_p4_branch;
-  bool     jets30_up_p4_isLoaded;
+  unsigned int jets30_up_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets30_dn_p4_;
   TBranch *jets30_dn_p4_branch;
-  bool     jets30_dn_p4_isLoaded;
+  unsigned int jets30_dn_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets30_jer_p4_;
   TBranch *jets30_jer_p4_branch;
-  bool     jets30_jer_p4_isLoaded;
+  unsigned int jets30_jer_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets30_jerup_p4_;
   TBranch *jets30_jerup_p4_branch;
-  bool     jets30_jerup_p4_isLoaded;
+  unsigned int jets30_jerup_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets30_jerdn_p4_;
   TBranch *jets30_jerdn_p4_branch;
-  bool     jets30_jerdn_p4_isLoaded;
+  unsigned int jets30_jerdn_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *ak8jets_p4_;
   TBranch *ak8jets_p4_branch;
-  bool     ak8jets_p4_isLoaded;
+  unsigned int ak8jets_p4_loadedEpoch;
   vector<float> *ak8jets_softdropMass_;
   TBranch *ak8jets_softdropMass_branch;
-  bool     ak8jets_softdropMass_isLoaded;
+  unsigned int ak8jets_softdropMass_loadedEpoch;
   vector<float> *ak8jets_prunedMass_;
   TBranch *ak8jets_prunedMass_branch;
-  bool     ak8jets_prunedMass_isLoaded;
+  unsigned int ak8jets_prunedMass_loadedEpoch;
   vector<float> *ak8jets_trimmedMass_;
   TBranch *ak8jets_trimmedMass_branch;
-  bool     ak8jets_trimmedMass_isLoaded;
+  unsigned int ak8jets_trimmedMass_loadedEpoch;
   vector<float> *ak8jets_mass_;
   TBranch *ak8jets_mass_branch;
-  bool     ak8jets_mass_isLoaded;
+  unsigned int ak8jets_mass_loadedEpoch;
   vector<float> *ak8jets_nJettinessTau1_;
   TBranch *ak8jets_nJettinessTau1_branch;
-  bool     ak8jets_nJettinessTau1_isLoaded;
+  unsigned int ak8jets_nJettinessTau1_loadedEpoch;
   vector<float> *ak8jets_nJettinessTau2_;
   TBranch *ak8jets_nJettinessTau2_branch;
-  bool     ak8jets_nJettinessTau2_isLoaded;
+  unsigned int ak8jets_nJettinessTau2_loadedEpoch;
   vector<float> *ak8jets_softdropPuppiSubjet1_;
   TBranch *ak8jets_softdropPuppiSubjet1_branch;
-  bool     ak8jets_softdropPuppiSubjet1_isLoaded;
+  unsigned int ak8jets_softdropPuppiSubjet1_loadedEpoch;
   vector<float> *ak8jets_softdropPuppiSubjet2_;
   TBranch *ak8jets_softdropPuppiSubjet2_branch;
-  bool     ak8jets_softdropPuppiSubjet2_isLoaded;
+  unsigned int ak8jets_softdropPuppiSubjet2_loadedEpoch;
   vector<float> *ak8jets_puppi_softdropMass_;
   TBranch *ak8jets_puppi_softdropMass_branch;
-  bool     ak8jets_puppi_softdropMass_isLoaded;
+  unsigned int ak8jets_puppi_softdropMass_loadedEpoch;
   vector<float> *ak8jets_puppi_nJettinessTau1_;
   TBranch *ak8jets_puppi_nJettinessTau1_branch;
-  bool     ak8jets_puppi_nJettinessTau1_isLoaded;
+  unsigned int ak8jets_puppi_nJettinessTau1_loadedEpoch;
   vector<float> *ak8jets_puppi_nJettinessTau2_;
   TBranch *ak8jets_puppi_nJettinessTau2_branch;
-  bool     ak8jets_puppi_nJettinessTau2_isLoaded;
+  unsigned int ak8jets_puppi_nJettinessTau2_loadedEpoch;
   vector<float> *ak8jets_puppi_eta_;
   TBranch *ak8jets_puppi_eta_branch;
-  bool     ak8jets_puppi_eta_isLoaded;
+  unsigned int ak8jets_puppi_eta_loadedEpoch;
   vector<float> *ak8jets_puppi_phi_;
   TBranch *ak8jets_puppi_phi_branch;
-  bool     ak8jets_puppi_phi_isLoaded;
+  unsigned int ak8jets_puppi_phi_loadedEpoch;
   vector<float> *ak8jets_puppi_pt_;
   TBranch *ak8jets_puppi_pt_branch;
-  bool     ak8jets_puppi_pt_isLoaded;
+  unsigned int ak8jets_puppi_pt_loadedEpoch;
   vector<float> *ak8jets_puppi_mass_;
   TBranch *ak8jets_puppi_mass_branch;
-  bool     ak8jets_puppi_mass_isLoaded;
+  unsigned int ak8jets_puppi_mass_loadedEpoch;
   float    met_pt_;
   TBranch *met_pt_branch;
-  bool     met_pt_isLoaded;
+  unsigned int met_pt_loadedEpoch;
   float    met_phi_;
   TBranch *met_phi_branch;
-  bool     met_phi_isLoaded;
+  unsigned int met_phi_loadedEpoch;
   float    met_up_pt_;
   TBranch *met_up_pt_branch;
-  bool     met_up_pt_isLoaded;
+  unsigned int met_up_pt_loadedEpoch;
   float    met_up_phi_;
   TBranch *met_up_phi_branch;
-  bool     met_up_phi_isLoaded;
+  unsigned int met_up_phi_loadedEpoch;
   float    met_dn_pt_;
   TBranch *met_dn_pt_branch;
-  bool     met_dn_pt_isLoaded;
+  unsigned int met_dn_pt_loadedEpoch;
   float    met_dn_phi_;
   TBranch *met_dn_phi_branch;
-  bool     met_dn_phi_isLoaded;
+  unsigned int met_dn_phi_loadedEpoch;
   float    met_gen_pt_;
   TBranch *met_gen_pt_branch;
-  bool     met_gen_pt_isLoaded;
+  unsigned int met_gen_pt_loadedEpoch;
   float    met_gen_phi_;
   TBranch *met_gen_phi_branch;
-  bool     met_gen_phi_isLoaded;
+  unsigned int met_gen_phi_loadedEpoch;
   float    met_jer_pt_;
   TBranch *met_jer_pt_branch;
-  bool     met_jer_pt_isLoaded;
+  unsigned int met_jer_pt_loadedEpoch;
   float    met_jerup_pt_;
   TBranch *met_jerup_pt_branch;
-  bool     met_jerup_pt_isLoaded;
+  unsigned int met_jerup_pt_loadedEpoch;
   float    met_jerdn_pt_;
   TBranch *met_jerdn_pt_branch;
-  bool     met_jerdn_pt_isLoaded;
+  unsigned int met_jerdn_pt_loadedEpoch;
   float    met_jer_phi_;
   TBranch *met_jer_phi_branch;
-  bool     met_jer_phi_isLoaded;
+  unsigned int met_jer_phi_loadedEpoch;
   float    met_jerup_phi_;
   TBranch *met_jerup_phi_branch;
-  bool     met_jerup_phi_isLoaded;
+  unsigned int met_jerup_phi_loadedEpoch;
   float    met_jerdn_phi_;
   TBranch *met_jerdn_phi_branch;
-  bool     met_jerdn_phi_isLoaded;
+  unsigned int met_jerdn_phi_loadedEpoch;
   int      firstgoodvertex_;
   TBranch *firstgoodvertex_branch;
-  bool     firstgoodvertex_isLoaded;
+  unsigned int firstgoodvertex_loadedEpoch;
   int      nTrueInt_;
   TBranch *nTrueInt_branch;
-  bool     nTrueInt_isLoaded;
+  unsigned int nTrueInt_loadedEpoch;
   int      nVert_;
   TBranch *nVert_branch;
-  bool     nVert_isLoaded;
+  unsigned int nVert_loadedEpoch;
   int      nisoTrack_mt2_cleaned_VVV_cutbased_veto_;
   TBranch *nisoTrack_mt2_cleaned_VVV_cutbased_veto_branch;
-  bool     nisoTrack_mt2_cleaned_VVV_cutbased_veto_isLoaded;
+  unsigned int nisoTrack_mt2_cleaned_VVV_cutbased_veto_loadedEpoch;
   float    weight_btagsf_;
   TBranch *weight_btagsf_branch;
-  bool     weight_btagsf_isLoaded;
+  unsigned int weight_btagsf_loadedEpoch;
   float    weight_btagsf_heavy_DN_;
   TBranch *weight_btagsf_heavy_DN_branch;
-  bool     weight_btagsf_heavy_DN_isLoaded;
+  unsigned int weight_btagsf_heavy_DN_loadedEpoch;
   float    weight_btagsf_heavy_UP_;
   TBranch *weight_btagsf_heavy_UP_branch;
-  bool     weight_btagsf_heavy_UP_isLoaded;
+  unsigned int weight_btagsf_heavy_UP_loadedEpoch;
   float    weight_btagsf_light_DN_;
   TBranch *weight_btagsf_light_DN_branch;
-  bool     weight_btagsf_light_DN_isLoaded;
+  unsigned int weight_btagsf_light_DN_loadedEpoch;
   float    weight_btagsf_light_UP_;
   TBranch *weight_btagsf_light_UP_branch;
-  bool     weight_btagsf_light_UP_isLoaded;
+  unsigned int weight_btagsf_light_UP_loadedEpoch;
   float    gen_ht_;
   TBranch *gen_ht_branch;
-  bool     gen_ht_isLoaded;
+  unsigned int gen_ht_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genPart_p4_;
   TBranch *genPart_p4_branch;
-  bool     genPart_p4_isLoaded;
+  unsigned int genPart_p4_loadedEpoch;
   vector<int> *genPart_motherId_;
   TBranch *genPart_motherId_branch;
-  bool     genPart_motherId_isLoaded;
+  unsigned int genPart_motherId_loadedEpoch;
   vector<int> *genPart_pdgId_;
   TBranch *genPart_pdgId_branch;
-  bool     genPart_pdgId_isLoaded;
+  unsigned int genPart_pdgId_loadedEpoch;
   vector<int> *genPart_charge_;
   TBranch *genPart_charge_branch;
-  bool     genPart_charge_isLoaded;
+  unsigned int genPart_charge_loadedEpoch;
   vector<int> *genPart_status_;
   TBranch *genPart_status_branch;
-  bool     genPart_status_isLoaded;
+  unsigned int genPart_status_loadedEpoch;
   int      ngenLep_;
   TBranch *ngenLep_branch;
-  bool     ngenLep_isLoaded;
+  unsigned int ngenLep_loadedEpoch;
   int      ngenLepFromTau_;
   TBranch *ngenLepFromTau_branch;
-  bool     ngenLepFromTau_isLoaded;
+  unsigned int ngenLepFromTau_loadedEpoch;
   int      Flag_AllEventFilters_;
   TBranch *Flag_AllEventFilters_branch;
-  bool     Flag_AllEventFilters_isLoaded;
+  unsigned int Flag_AllEventFilters_loadedEpoch;
   int      Flag_EcalDeadCellTriggerPrimitiveFilter_;
   TBranch *Flag_EcalDeadCellTriggerPrimitiveFilter_branch;
-  bool     Flag_EcalDeadCellTriggerPrimitiveFilter_isLoaded;
+  unsigned int Flag_EcalDeadCellTriggerPrimitiveFilter_loadedEpoch;
   int      Flag_HBHEIsoNoiseFilter_;
   TBranch *Flag_HBHEIsoNoiseFilter_branch;
-  bool     Flag_HBHEIsoNoiseFilter_isLoaded;
+  unsigned int Flag_HBHEIsoNoiseFilter_loadedEpoch;
   int      Flag_HBHENoiseFilter_;
   TBranch *Flag_HBHENoiseFilter_branch;
-  bool     Flag_HBHENoiseFilter_isLoaded;
+  unsigned int Flag_HBHENoiseFilter_loadedEpoch;
   int      Flag_badChargedCandidateFilter_;
   TBranch *Flag_badChargedCandidateFilter_branch;
-  bool     Flag_badChargedCandidateFilter_isLoaded;
+  unsigned int Flag_badChargedCandidateFilter_loadedEpoch;
   int      Flag_badMuonFilter_;
   TBranch *Flag_badMuonFilter_branch;
-  bool     Flag_badMuonFilter_isLoaded;
+  unsigned int Flag_badMuonFilter_loadedEpoch;
   int      Flag_badMuonFilterv2_;
   TBranch *Flag_badMuonFilterv2_branch;
-  bool     Flag_badMuonFilterv2_isLoaded;
+  unsigned int Flag_badMuonFilterv2_loadedEpoch;
   int      Flag_badChargedCandidateFilterv2_;
   TBranch *Flag_badChargedCandidateFilterv2_branch;
-  bool     Flag_badChargedCandidateFilterv2_isLoaded;
+  unsigned int Flag_badChargedCandidateFilterv2_loadedEpoch;
   int      Flag_eeBadScFilter_;
   TBranch *Flag_eeBadScFilter_branch;
-  bool     Flag_eeBadScFilter_isLoaded;
+  unsigned int Flag_eeBadScFilter_loadedEpoch;
   int      Flag_ecalBadCalibFilter_;
   TBranch *Flag_ecalBadCalibFilter_branch;
-  bool     Flag_ecalBadCalibFilter_isLoaded;
+  unsigned int Flag_ecalBadCalibFilter_loadedEpoch;
   int      Flag_globalTightHalo2016_;
   TBranch *Flag_globalTightHalo2016_branch;
-  bool     Flag_globalTightHalo2016_isLoaded;
+  unsigned int Flag_globalTightHalo2016_loadedEpoch;
   int      Flag_goodVertices_;
   TBranch *Flag_goodVertices_branch;
-  bool     Flag_goodVertices_isLoaded;
+  unsigned int Flag_goodVertices_loadedEpoch;
   int      Flag_ecalLaserCorrFilter_;
   TBranch *Flag_ecalLaserCorrFilter_branch;
-  bool     Flag_ecalLaserCorrFilter_isLoaded;
+  unsigned int Flag_ecalLaserCorrFilter_loadedEpoch;
   int      Flag_hcalLaserEventFilter_;
   TBranch *Flag_hcalLaserEventFilter_branch;
-  bool     Flag_hcalLaserEventFilter_isLoaded;
+  unsigned int Flag_hcalLaserEventFilter_loadedEpoch;
   int      Flag_trackingFailureFilter_;
   TBranch *Flag_trackingFailureFilter_branch;
-  bool     Flag_trackingFailureFilter_isLoaded;
+  unsigned int Flag_trackingFailureFilter_loadedEpoch;
   int      Flag_CSCTightHaloFilter_;
   TBranch *Flag_CSCTightHaloFilter_branch;
-  bool     Flag_CSCTightHaloFilter_isLoaded;
+  unsigned int Flag_CSCTightHaloFilter_loadedEpoch;
   int      Flag_CSCTightHalo2015Filter_;
   TBranch *Flag_CSCTightHalo2015Filter_branch;
-  bool     Flag_CSCTightHalo2015Filter_isLoaded;
+  unsigned int Flag_CSCTightHalo2015Filter_loadedEpoch;
   int      Flag_badMuons_;
   TBranch *Flag_badMuons_branch;
-  bool     Flag_badMuons_isLoaded;
+  unsigned int Flag_badMuons_loadedEpoch;
   int      Flag_duplicateMuons_;
   TBranch *Flag_duplicateMuons_branch;
-  bool     Flag_duplicateMuons_isLoaded;
+  unsigned int Flag_duplicateMuons_loadedEpoch;
   int      Flag_noBadMuons_;
   TBranch *Flag_noBadMuons_branch;
-  bool     Flag_noBadMuons_isLoaded;
+  unsigned int Flag_noBadMuons_loadedEpoch;
   int      fastsimfilt_;
   TBranch *fastsimfilt_branch;
-  bool     fastsimfilt_isLoaded;
+  unsigned int fastsimfilt_loadedEpoch;
   int      nVlep_;
   TBranch *nVlep_branch;
-  bool     nVlep_isLoaded;
+  unsigned int nVlep_loadedEpoch;
   int      nTlep_;
   TBranch *nTlep_branch;
-  bool     nTlep_isLoaded;
+  unsigned int nTlep_loadedEpoch;
   int      nTlepSS_;
   TBranch *nTlepSS_branch;
-  bool     nTlepSS_isLoaded;
+  unsigned int nTlepSS_loadedEpoch;
   int      nLlep_;
   TBranch *nLlep_branch;
-  bool     nLlep_isLoaded;
+  unsigned int nLlep_loadedEpoch;
   int      nLlep3L_;
   TBranch *nLlep3L_branch;
-  bool     nLlep3L_isLoaded;
+  unsigned int nLlep3L_loadedEpoch;
   int      nTlep3L_;
   TBranch *nTlep3L_branch;
-  bool     nTlep3L_isLoaded;
+  unsigned int nTlep3L_loadedEpoch;
   int      nSFOS_;
   TBranch *nSFOS_branch;
-  bool     nSFOS_isLoaded;
+  unsigned int nSFOS_loadedEpoch;
   int      nSFOSinZ_;
   TBranch *nSFOSinZ_branch;
-  bool     nSFOSinZ_isLoaded;
+  unsigned int nSFOSinZ_loadedEpoch;
   int      nj_;
   TBranch *nj_branch;
-  bool     nj_isLoaded;
+  unsigned int nj_loadedEpoch;
   int      nj_up_;
   TBranch *nj_up_branch;
-  bool     nj_up_isLoaded;
+  unsigned int nj_up_loadedEpoch;
   int      nj_dn_;
   TBranch *nj_dn_branch;
-  bool     nj_dn_isLoaded;
+  unsigned int nj_dn_loadedEpoch;
   int      nj_jer_;
   TBranch *nj_jer_branch;
-  bool     nj_jer_isLoaded;
+  unsigned int nj_jer_loadedEpoch;
   int      nj_jerup_;
   TBranch *nj_jerup_branch;
-  bool     nj_jerup_isLoaded;
+  unsigned int nj_jerup_loadedEpoch;
   int      nj_jerdn_;
   TBranch *nj_jerdn_branch;
-  bool     nj_jerdn_isLoaded;
+  unsigned int nj_jerdn_loadedEpoch;
   int      nj30_;
   TBranch *nj30_branch;
-  bool     nj30_isLoaded;
+  unsigned int nj30_loadedEpoch;
   int      nj30_up_;
   TBranch *nj30_up_branch;
-  bool     nj30_up_isLoaded;
+  unsigned int nj30_up_loadedEpoch;
   int      nj30_dn_;
   TBranch *nj30_dn_branch;
-  bool     nj30_dn_isLoaded;
+  unsigned int nj30_dn_loadedEpoch;
   int      nj30_jer_;
   TBranch *nj30_jer_branch;
-  bool     nj30_jer_isLoaded;
+  unsigned int nj30_jer_loadedEpoch;
   int      nj30_jerup_;
   TBranch *nj30_jerup_branch;
-  bool     nj30_jerup_isLoaded;
+  unsigned int nj30_jerup_loadedEpoch;
   int      nj30_jerdn_;
   TBranch *nj30_jerdn_branch;
-  bool     nj30_jerdn_isLoaded;
+  unsigned int nj30_jerdn_loadedEpoch;
   int      nb_;
   TBranch *nb_branch;
-  bool     nb_isLoaded;
+  unsigned int nb_loadedEpoch;
   int      nb_up_;
   TBranch *nb_up_branch;
-  bool     nb_up_isLoaded;
+  unsigned int nb_up_loadedEpoch;
   int      nb_dn_;
   TBranch *nb_dn_branch;
-  bool     nb_dn_isLoaded;
+  unsigned int nb_dn_loadedEpoch;
   int      nb_jer_;
   TBranch *nb_jer_branch;
-  bool     nb_jer_isLoaded;
+  unsigned int nb_jer_loadedEpoch;
   int      nb_jerup_;
   TBranch *nb_jerup_branch;
-  bool     nb_jerup_isLoaded;
+  unsigned int nb_jerup_loadedEpoch;
   int      nb_jerdn_;
   TBranch *nb_jerdn_branch;
-  bool     nb_jerdn_isLoaded;
+  unsigned int nb_jerdn_loadedEpoch;
   float    Ml0j0_;
   TBranch *Ml0j0_branch;
-  bool     Ml0j0_isLoaded;
+  unsigned int Ml0j0_loadedEpoch;
   float    Ml0j0_up_;
   TBranch *Ml0j0_up_branch;
-  bool     Ml0j0_up_isLoaded;
+  unsigned int Ml0j0_up_loadedEpoch;
   float    Ml0j0_dn_;
   TBranch *Ml0j0_dn_branch;
-  bool     Ml0j0_dn_isLoaded;
+  unsigned int Ml0j0_dn_loadedEpoch;
   float    Ml0j0_jer_;
   TBranch *Ml0j0_jer_branch;
-  bool     Ml0j0_jer_isLoaded;
+  unsigned int Ml0j0_jer_loadedEpoch;
   float    Ml0j0_jerup_;
   TBranch *Ml0j0_jerup_branch;
-  bool     Ml0j0_jerup_isLoaded;
+  unsigned int Ml0j0_jerup_loadedEpoch;
   float    Ml0j0_jerdn_;
   TBranch *Ml0j0_jerdn_branch;
-  bool     Ml0j0_jerdn_isLoaded;
+  unsigned int Ml0j0_jerdn_loadedEpoch;
   float    Ml0j1_;
   TBranch *Ml0j1_branch;
-  bool     Ml0j1_isLoaded;
+  unsigned int Ml0j1_loadedEpoch;
   float    Ml0j1_up_;
   TBranch *Ml0j1_up_branch;
-  bool     Ml0j1_up_isLoaded;
+  unsigned int Ml0j1_up_loadedEpoch;
   float    Ml0j1_dn_;
   TBranch *Ml0j1_dn_branch;
-  bool     Ml0j1_dn_isLoaded;
+  unsigned int Ml0j1_dn_loadedEpoch;
   float    Ml0j1_jer_;
   TBranch *Ml0j1_jer_branch;
-  bool     Ml0j1_jer_isLoaded;
+  unsigned int Ml0j1_jer_loadedEpoch;
   float    Ml0j1_jerup_;
   TBranch *Ml0j1_jerup_branch;
-  bool     Ml0j1_jerup_isLoaded;
+  unsigned int Ml0j1_jerup_loadedEpoch;
   float    Ml0j1_jerdn_;
   TBranch *Ml0j1_jerdn_branch;
-  bool     Ml0j1_jerdn_isLoaded;
+  unsigned int Ml0j1_jerdn_loadedEpoch;
   float    Ml1j0_;
   TBranch *Ml1j0_branch;
-  bool     Ml1j0_isLoaded;
+  unsigned int Ml1j0_loadedEpoch;
   float    Ml1j0_up_;
   TBranch *Ml1j0_up_branch;
-  bool     Ml1j0_up_isLoaded;
+  unsigned int Ml1j0_up_loadedEpoch;
   float    Ml1j0_dn_;
   TBranch *Ml1j0_dn_branch;
-  bool     Ml1j0_dn_isLoaded;
+  unsigned int Ml1j0_dn_loadedEpoch;
   float    Ml1j0_jer_;
   TBranch *Ml1j0_jer_branch;
-  bool     Ml1j0_jer_isLoaded;
+  unsigned int Ml1j0_jer_loadedEpoch;
   float    Ml1j0_jerup_;
   TBranch *Ml1j0_jerup_branch;
-  bool     Ml1j0_jerup_isLoaded;
+  unsigned int Ml1j0_jerup_loadedEpoch;
   float    Ml1j0_jerdn_;
   TBranch *Ml1j0_jerdn_branch;
-  bool     Ml1j0_jerdn_isLoaded;
+  unsigned int Ml1j0_jerdn_loadedEpoch;
   float    Ml1j1_;
   TBranch *Ml1j1_branch;
-  bool     Ml1j1_isLoaded;
+  unsigned int Ml1j1_loadedEpoch;
   float    Ml1j1_up_;
   TBranch *Ml1j1_up_branch;
-  bool     Ml1j1_up_isLoaded;
+  unsigned int Ml1j1_up_loadedEpoch;
   float    Ml1j1_dn_;
   TBranch *Ml1j1_dn_branch;
-  bool     Ml1j1_dn_isLoaded;
+  unsigned int Ml1j1_dn_loadedEpoch;
   float    Ml1j1_jer_;
   TBranch *Ml1j1_jer_branch;
-  bool     Ml1j1_jer_isLoaded;
+  unsigned int Ml1j1_jer_loadedEpoch;
   float    Ml1j1_jerup_;
   TBranch *Ml1j1_jerup_branch;
-  bool     Ml1j1_jerup_isLoaded;
+  unsigned int Ml1j1_jerup_loadedEpoch;
   float    Ml1j1_jerdn_;
   TBranch *Ml1j1_jerdn_branch;
-  bool     Ml1j1_jerdn_isLoaded;
+  unsigned int Ml1j1_jerdn_loadedEpoch;
   float    MinMlj_;
   TBranch *MinMlj_branch;
-  bool     MinMlj_isLoaded;
+  unsigned int MinMlj_loadedEpoch;
   float    MinMlj_up_;
   TBranch *MinMlj_up_branch;
-  bool     MinMlj_up_isLoaded;
+  unsigned int MinMlj_up_loadedEpoch;
   float    MinMlj_dn_;
   TBranch *MinMlj_dn_branch;
-  bool     MinMlj_dn_isLoaded;
+  unsigned int MinMlj_dn_loadedEpoch;
   float    MinMlj_jer_;
   TBranch *MinMlj_jer_branch;
-  bool     MinMlj_jer_isLoaded;
+  unsigned int MinMlj_jer_loadedEpoch;
   float    MinMlj_jerup_;
   TBranch *MinMlj_jerup_branch;
-  bool     MinMlj_jerup_isLoaded;
+  unsigned int MinMlj_jerup_loadedEpoch;
   float    MinMlj_jerdn_;
   TBranch *MinMlj_jerdn_branch;
-  bool     MinMlj_jerdn_isLoaded;
+  unsigned int MinMlj_jerdn_loadedEpoch;
   float    SumMinMlj01_;
   TBranch *SumMinMlj01_branch;
-  bool     SumMinMlj01_isLoaded;
+  unsigned int SumMinMlj01_loadedEpoch;
   float    SumMinMlj01_up_;
   TBranch *SumMinMlj01_up_branch;
-  bool     SumMinMlj01_up_isLoaded;
+  unsigned int SumMinMlj01_up_loadedEpoch;
   float    SumMinMlj01_dn_;
   TBranch *SumMinMlj01_dn_branch;
-  bool     SumMinMlj01_dn_isLoaded;
+  unsigned int SumMinMlj01_dn_loadedEpoch;
   float    SumMinMlj01_jer_;
   TBranch *SumMinMlj01_jer_branch;
-  bool     SumMinMlj01_jer_isLoaded;
+  unsigned int SumMinMlj01_jer_loadedEpoch;
   float    SumMinMlj01_jerup_;
   TBranch *SumMinMlj01_jerup_branch;
-  bool     SumMinMlj01_jerup_isLoaded;
+  unsigned int SumMinMlj01_jerup_loadedEpoch;
   float    SumMinMlj01_jerdn_;
   TBranch *SumMinMlj01_jerdn_branch;
-  bool     SumMinMlj01_jerdn_isLoaded;
+  unsigned int SumMinMlj01_jerdn_loadedEpoch;
   float    MaxMlj_;
   TBranch *MaxMlj_branch;
-  bool     MaxMlj_isLoaded;
+  unsigned int MaxMlj_loadedEpoch;
   float    MaxMlj_up_;
   TBranch *MaxMlj_up_branch;
-  bool     MaxMlj_up_isLoaded;
+  unsigned int MaxMlj_up_loadedEpoch;
   float    MaxMlj_dn_;
   TBranch *MaxMlj_dn_branch;
-  bool     MaxMlj_dn_isLoaded;
+  unsigned int MaxMlj_dn_loadedEpoch;
   float    MaxMlj_jer_;
   TBranch *MaxMlj_jer_branch;
-  bool     MaxMlj_jer_isLoaded;
+  unsigned int MaxMlj_jer_loadedEpoch;
   float    MaxMlj_jerup_;
   TBranch *MaxMlj_jerup_branch;
-  bool     MaxMlj_jerup_isLoaded;
+  unsigned int MaxMlj_jerup_loadedEpoch;
   float    MaxMlj_jerdn_;
   TBranch *MaxMlj_jerdn_branch;
-  bool     MaxMlj_jerdn_isLoaded;
+  unsigned int MaxMlj_jerdn_loadedEpoch;
   float    SumMlj_;
   TBranch *SumMlj_branch;
-  bool     SumMlj_isLoaded;
+  unsigned int SumMlj_loadedEpoch;
   float    SumMlj_up_;
   TBranch *SumMlj_up_branch;
-  bool     SumMlj_up_isLoaded;
+  unsigned int SumMlj_up_loadedEpoch;
   float    SumMlj_dn_;
   TBranch *SumMlj_dn_branch;
-  bool     SumMlj_dn_isLoaded;
+  unsigned int SumMlj_dn_loadedEpoch;
   float    SumMlj_jer_;
   TBranch *SumMlj_jer_branch;
-  bool     SumMlj_jer_isLoaded;
+  unsigned int SumMlj_jer_loadedEpoch;
   float    SumMlj_jerup_;
   TBranch *SumMlj_jerup_branch;
-  bool     SumMlj_jerup_isLoaded;
+  unsigned int SumMlj_jerup_loadedEpoch;
   float    SumMlj_jerdn_;
   TBranch *SumMlj_jerdn_branch;
-  bool     SumMlj_jerdn_isLoaded;
+  unsigned int SumMlj_jerdn_loadedEpoch;
   float    Ml0jj_;
   TBranch *Ml0jj_branch;
-  bool     Ml0jj_isLoaded;
+  unsigned int Ml0jj_loadedEpoch;
   float    Ml0jj_up_;
   TBranch *Ml0jj_up_branch;
-  bool     Ml0jj_up_isLoaded;
+  unsigned int Ml0jj_up_loadedEpoch;
   float    Ml0jj_dn_;
   TBranch *Ml0jj_dn_branch;
-  bool     Ml0jj_dn_isLoaded;
+  unsigned int Ml0jj_dn_loadedEpoch;
   float    Ml0jj_jer_;
   TBranch *Ml0jj_jer_branch;
-  bool     Ml0jj_jer_isLoaded;
+  unsigned int Ml0jj_jer_loadedEpoch;
   float    Ml0jj_jerup_;
   TBranch *Ml0jj_jerup_branch;
-  bool     Ml0jj_jerup_isLoaded;
+  unsigned int Ml0jj_jerup_loadedEpoch;
   float    Ml0jj_jerdn_;
   TBranch *Ml0jj_jerdn_branch;
-  bool     Ml0jj_jerdn_isLoaded;
+  unsigned int Ml0jj_jerdn_loadedEpoch;
   float    Ml1jj_;
   TBranch *Ml1jj_branch;
-  bool     Ml1jj_isLoaded;
+  unsigned int Ml1jj_loadedEpoch;
   float    Ml1jj_up_;
   TBranch *Ml1jj_up_branch;
-  bool     Ml1jj_up_isLoaded;
+  unsigned int Ml1jj_up_loadedEpoch;
   float    Ml1jj_dn_;
   TBranch *Ml1jj_dn_branch;
-  bool     Ml1jj_dn_isLoaded;
+  unsigned int Ml1jj_dn_loadedEpoch;
   float    Ml1jj_jer_;
   TBranch *Ml1jj_jer_branch;
-  bool     Ml1jj_jer_isLoaded;
+  unsigned int Ml1jj_jer_loadedEpoch;
   float    Ml1jj_jerup_;
   TBranch *Ml1jj_jerup_branch;
-  bool     Ml1jj_jerup_isLoaded;
+  unsigned int Ml1jj_jerup_loadedEpoch;
   float    Ml1jj_jerdn_;
   TBranch *Ml1jj_jerdn_branch;
-  bool     Ml1jj_jerdn_isLoaded;
+  unsigned int Ml1jj_jerdn_loadedEpoch;
   float    MinMljj_;
   TBranch *MinMljj_branch;
-  bool     MinMljj_isLoaded;
+  unsigned int MinMljj_loadedEpoch;
   float    MinMljj_up_;
   TBranch *MinMljj_up_branch;
-  bool     MinMljj_up_isLoaded;
+  unsigned int MinMljj_up_loadedEpoch;
   float    MinMljj_dn_;
   TBranch *MinMljj_dn_branch;
-  bool     MinMljj_dn_isLoaded;
+  unsigned int MinMljj_dn_loadedEpoch;
   float    MinMljj_jer_;
   TBranch *MinMljj_jer_branch;
-  bool     MinMljj_jer_isLoaded;
+  unsigned int MinMljj_jer_loadedEpoch;
   float    MinMljj_jerup_;
   TBranch *MinMljj_jerup_branch;
-  bool     MinMljj_jerup_isLoaded;
+  unsigned int MinMljj_jerup_loadedEpoch;
   float    MinMljj_jerdn_;
   TBranch *MinMljj_jerdn_branch;
-  bool     MinMljj_jerdn_isLoaded;
+  unsigned int MinMljj_jerdn_loadedEpoch;
   float    MaxMljj_;
   TBranch *MaxMljj_branch;
-  bool     MaxMljj_isLoaded;
+  unsigned int MaxMljj_loadedEpoch;
   float    MaxMljj_up_;
   TBranch *MaxMljj_up_branch;
-  bool     MaxMljj_up_isLoaded;
+  unsigned int MaxMljj_up_loadedEpoch;
   float    MaxMljj_dn_;
   TBranch *MaxMljj_dn_branch;
-  bool     MaxMljj_dn_isLoaded;
+  unsigned int MaxMljj_dn_loadedEpoch;
   float    MaxMljj_jer_;
   TBranch *MaxMljj_jer_branch;
-  bool     MaxMljj_jer_isLoaded;
+  unsigned int MaxMljj_jer_loadedEpoch;
   float    MaxMljj_jerup_;
   TBranch *MaxMljj_jerup_branch;
-  bool     MaxMljj_jerup_isLoaded;
+  unsigned int MaxMljj_jerup_loadedEpoch;
   float    MaxMljj_jerdn_;
   TBranch *MaxMljj_jerdn_branch;
-  bool     MaxMljj_jerdn_isLoaded;
+  unsigned int MaxMljj_jerdn_loadedEpoch;
   float    SumMljj_;
   TBranch *SumMljj_branch;
-  bool     SumMljj_isLoaded;
+  unsigned int SumMljj_loadedEpoch;
   float    SumMljj_up_;
   TBranch *SumMljj_up_branch;
-  bool     SumMljj_up_isLoaded;
+  unsigned int SumMljj_up_loadedEpoch;
   float    SumMljj_dn_;
   TBranch *SumMljj_dn_branch;
-  bool     SumMljj_dn_isLoaded;
+  unsigned int SumMljj_dn_loadedEpoch;
   float    SumMljj_jer_;
   TBranch *SumMljj_jer_branch;
-  bool     SumMljj_jer_isLoaded;
+  unsigned int SumMljj_jer_loadedEpoch;
   float    SumMljj_jerup_;
   TBranch *SumMljj_jerup_branch;
-  bool     SumMljj_jerup_isLoaded;
+  unsigned int SumMljj_jerup_loadedEpoch;
   float    SumMljj_jerdn_;
   TBranch *SumMljj_jerdn_branch;
-  bool     SumMljj_jerdn_isLoaded;
+  unsigned int SumMljj_jerdn_loadedEpoch;
   float    Mjj_;
   TBranch *Mjj_branch;
-  bool     Mjj_isLoaded;
+  unsigned int Mjj_loadedEpoch;
   float    Mjj_up_;
   TBranch *Mjj_up_branch;
-  bool     Mjj_up_isLoaded;
+  unsigned int Mjj_up_loadedEpoch;
   float    Mjj_dn_;
   TBranch *Mjj_dn_branch;
-  bool     Mjj_dn_isLoaded;
+  unsigned int Mjj_dn_loadedEpoch;
   float    Mjj_jer_;
   TBranch *Mjj_jer_branch;
-  bool     Mjj_jer_isLoaded;
+  unsigned int Mjj_jer_loadedEpoch;
   float    Mjj_jerup_;
   TBranch *Mjj_jerup_branch;
-  bool     Mjj_jerup_isLoaded;
+  unsigned int Mjj_jerup_loadedEpoch;
   float    Mjj_jerdn_;
   TBranch *Mjj_jerdn_branch;
-  bool     Mjj_jerdn_isLoaded;
+  unsigned int Mjj_jerdn_loadedEpoch;
   float    DRjj_;
   TBranch *DRjj_branch;
-  bool     DRjj_isLoaded;
+  unsigned int DRjj_loadedEpoch;
   float    DRjj_up_;
   TBranch *DRjj_up_branch;
-  bool     DRjj_up_isLoaded;
+  unsigned int DRjj_up_loadedEpoch;
   float    DRjj_dn_;
   TBranch *DRjj_dn_branch;
-  bool     DRjj_dn_isLoaded;
+  unsigned int DRjj_dn_loadedEpoch;
   float    DRjj_jer_;
   TBranch *DRjj_jer_branch;
-  bool     DRjj_jer_isLoaded;
+  unsigned int DRjj_jer_loadedEpoch;
   float    DRjj_jerup_;
   TBranch *DRjj_jerup_branch;
-  bool     DRjj_jerup_isLoaded;
+  unsigned int DRjj_jerup_loadedEpoch;
   float    DRjj_jerdn_;
   TBranch *DRjj_jerdn_branch;
-  bool     DRjj_jerdn_isLoaded;
+  unsigned int DRjj_jerdn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_;
   TBranch *jet0_wtag_p4_branch;
-  bool     jet0_wtag_p4_isLoaded;
+  unsigned int jet0_wtag_p4_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_up_;
   TBranch *jet0_wtag_p4_up_branch;
-  bool     jet0_wtag_p4_up_isLoaded;
+  unsigned int jet0_wtag_p4_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_dn_;
   TBranch *jet0_wtag_p4_dn_branch;
-  bool     jet0_wtag_p4_dn_isLoaded;
+  unsigned int jet0_wtag_p4_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_jer_;
   TBranch *jet0_wtag_p4_jer_branch;
-  bool     jet0_wtag_p4_jer_isLoaded;
+  unsigned int jet0_wtag_p4_jer_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_jerup_;
   TBranch *jet0_wtag_p4_jerup_branch;
-  bool     jet0_wtag_p4_jerup_isLoaded;
+  unsigned int jet0_wtag_p4_jerup_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_jerdn_;
   TBranch *jet0_wtag_p4_jerdn_branch;
-  bool     jet0_wtag_p4_jerdn_isLoaded;
+  unsigned int jet0_wtag_p4_jerdn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_;
   TBranch *jet1_wtag_p4_branch;
-  bool     jet1_wtag_p4_isLoaded;
+  unsigned int jet1_wtag_p4_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_up_;
   TBranch *jet1_wtag_p4_up_branch;
-  bool     jet1_wtag_p4_up_isLoaded;
+  unsigned int jet1_wtag_p4_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_dn_;
   TBranch *jet1_wtag_p4_dn_branch;
-  bool     jet1_wtag_p4_dn_isLoaded;
+  unsigned int jet1_wtag_p4_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_jer_;
   TBranch *jet1_wtag_p4_jer_branch;
-  bool     jet1_wtag_p4_jer_isLoaded;
+  unsigned int jet1_wtag_p4_jer_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_jerup_;
   TBranch *jet1_wtag_p4_jerup_branch;
-  bool     jet1_wtag_p4_jerup_isLoaded;
+  unsigned int jet1_wtag_p4_jerup_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_jerdn_;
   TBranch *jet1_wtag_p4_jerdn_branch;
-  bool     jet1_wtag_p4_jerdn_isLoaded;
+  unsigned int jet1_wtag_p4_jerdn_loadedEpoch;
   float    MjjDR1_;
   TBranch *MjjDR1_branch;
-  bool     MjjDR1_isLoaded;
+  unsigned int MjjDR1_loadedEpoch;
   float    MjjDR1_up_;
   TBranch *MjjDR1_up_branch;
-  bool     MjjDR1_up_isLoaded;
+  unsigned int MjjDR1_up_loadedEpoch;
   float    MjjDR1_dn_;
   TBranch *MjjDR1_dn_branch;
-  bool     MjjDR1_dn_isLoaded;
+  unsigned int MjjDR1_dn_loadedEpoch;
   float    MjjDR1_jer_;
   TBranch *MjjDR1_jer_branch;
-  bool     MjjDR1_jer_isLoaded;
+  unsigned int MjjDR1_jer_loadedEpoch;
   float    MjjDR1_jerup_;
   TBranch *MjjDR1_jerup_branch;
-  bool     MjjDR1_jerup_isLoaded;
+  unsigned int MjjDR1_jerup_loadedEpoch;
   float    MjjDR1_jerdn_;
   TBranch *MjjDR1_jerdn_branch;
-  bool     MjjDR1_jerdn_isLoaded;
+  unsigned int MjjDR1_jerdn_loadedEpoch;
   float    DRjjDR1_;
   TBranch *DRjjDR1_branch;
-  bool     DRjjDR1_isLoaded;
+  unsigned int DRjjDR1_loadedEpoch;
   float    DRjjDR1_up_;
   TBranch *DRjjDR1_up_branch;
-  bool     DRjjDR1_up_isLoaded;
+  unsigned int DRjjDR1_up_loadedEpoch;
   float    DRjjDR1_dn_;
   TBranch *DRjjDR1_dn_branch;
-  bool     DRjjDR1_dn_isLoaded;
+  unsigned int DRjjDR1_dn_loadedEpoch;
   float    DRjjDR1_jer_;
   TBranch *DRjjDR1_jer_branch;
-  bool     DRjjDR1_jer_isLoaded;
+  unsigned int DRjjDR1_jer_loadedEpoch;
   float    DRjjDR1_jerup_;
   TBranch *DRjjDR1_jerup_branch;
-  bool     DRjjDR1_jerup_isLoaded;
+  unsigned int DRjjDR1_jerup_loadedEpoch;
   float    DRjjDR1_jerdn_;
   TBranch *DRjjDR1_jerdn_branch;
-  bool     DRjjDR1_jerdn_isLoaded;
+  unsigned int DRjjDR1_jerdn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_;
   TBranch *jet0_wtag_p4_DR1_branch;
-  bool     jet0_wtag_p4_DR1_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_up_;
   TBranch *jet0_wtag_p4_DR1_up_branch;
-  bool     jet0_wtag_p4_DR1_up_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_dn_;
   TBranch *jet0_wtag_p4_DR1_dn_branch;
-  bool     jet0_wtag_p4_DR1_dn_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_jer_;
   TBranch *jet0_wtag_p4_DR1_jer_branch;
-  bool     jet0_wtag_p4_DR1_jer_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_jer_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_jerup_;
   TBranch *jet0_wtag_p4_DR1_jerup_branch;
-  bool     jet0_wtag_p4_DR1_jerup_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_jerup_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_jerdn_;
   TBranch *jet0_wtag_p4_DR1_jerdn_branch;
-  bool     jet0_wtag_p4_DR1_jerdn_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_jerdn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_;
   TBranch *jet1_wtag_p4_DR1_branch;
-  bool     jet1_wtag_p4_DR1_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_up_;
   TBranch *jet1_wtag_p4_DR1_up_branch;
-  bool     jet1_wtag_p4_DR1_up_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_dn_;
   TBranch *jet1_wtag_p4_DR1_dn_branch;
-  bool     jet1_wtag_p4_DR1_dn_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_jer_;
   TBranch *jet1_wtag_p4_DR1_jer_branch;
-  bool     jet1_wtag_p4_DR1_jer_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_jer_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_jerup_;
   TBranch *jet1_wtag_p4_DR1_jerup_branch;
-  bool     jet1_wtag_p4_DR1_jerup_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_jerup_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_jerdn_;
   TBranch *jet1_wtag_p4_DR1_jerdn_branch;
-  bool     jet1_wtag_p4_DR1_jerdn_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_jerdn_loadedEpoch;
   float    MjjVBF_;
   TBranch *MjjVBF_branch;
-  bool     MjjVBF_isLoaded;
+  unsigned int MjjVBF_loadedEpoch;
   float    MjjVBF_up_;
   TBranch *MjjVBF_up_branch;
-  bool     MjjVBF_up_isLoaded;
+  unsigned int MjjVBF_up_loadedEpoch;
   float    MjjVBF_dn_;
   TBranch *MjjVBF_dn_branch;
-  bool     MjjVBF_dn_isLoaded;
+  unsigned int MjjVBF_dn_loadedEpoch;
   float    MjjVBF_jer_;
   TBranch *MjjVBF_jer_branch;
-  bool     MjjVBF_jer_isLoaded;
+  unsigned int MjjVBF_jer_loadedEpoch;
   float    MjjVBF_jerup_;
   TBranch *MjjVBF_jerup_branch;
-  bool     MjjVBF_jerup_isLoaded;
+  unsigned int MjjVBF_jerup_loadedEpoch;
   float    MjjVBF_jerdn_;
   TBranch *MjjVBF_jerdn_branch;
-  bool     MjjVBF_jerdn_isLoaded;
+  unsigned int MjjVBF_jerdn_loadedEpoch;
   float    DetajjVBF_;
   TBranch *DetajjVBF_branch;
-  bool     DetajjVBF_isLoaded;
+  unsigned int DetajjVBF_loadedEpoch;
   float    DetajjVBF_up_;
   TBranch *DetajjVBF_up_branch;
-  bool     DetajjVBF_up_isLoaded;
+  unsigned int DetajjVBF_up_loadedEpoch;
   float    DetajjVBF_dn_;
   TBranch *DetajjVBF_dn_branch;
-  bool     DetajjVBF_dn_isLoaded;
+  unsigned int DetajjVBF_dn_loadedEpoch;
   float    DetajjVBF_jer_;
   TBranch *DetajjVBF_jer_branch;
-  bool     DetajjVBF_jer_isLoaded;
+  unsigned int DetajjVBF_jer_loadedEpoch;
   float    DetajjVBF_jerup_;
   TBranch *DetajjVBF_jerup_branch;
-  bool     DetajjVBF_jerup_isLoaded;
+  unsigned int DetajjVBF_jerup_loadedEpoch;
   float    DetajjVBF_jerdn_;
   TBranch *DetajjVBF_jerdn_branch;
-  bool     DetajjVBF_jerdn_isLoaded;
+  unsigned int DetajjVBF_jerdn_loadedEpoch;
   float    MjjL_;
   TBranch *MjjL_branch;
-  bool     MjjL_isLoaded;
+  unsigned int MjjL_loadedEpoch;
   float    MjjL_up_;
   TBranch *MjjL_up_branch;
-  bool     MjjL_up_isLoaded;
+  unsigned int MjjL_up_loadedEpoch;
   float    MjjL_dn_;
   TBranch *MjjL_dn_branch;
-  bool     MjjL_dn_isLoaded;
+  unsigned int MjjL_dn_loadedEpoch;
   float    MjjL_jer_;
   TBranch *MjjL_jer_branch;
-  bool     MjjL_jer_isLoaded;
+  unsigned int MjjL_jer_loadedEpoch;
   float    MjjL_jerup_;
   TBranch *MjjL_jerup_branch;
-  bool     MjjL_jerup_isLoaded;
+  unsigned int MjjL_jerup_loadedEpoch;
   float    MjjL_jerdn_;
   TBranch *MjjL_jerdn_branch;
-  bool     MjjL_jerdn_isLoaded;
+  unsigned int MjjL_jerdn_loadedEpoch;
   float    DetajjL_;
   TBranch *DetajjL_branch;
-  bool     DetajjL_isLoaded;
+  unsigned int DetajjL_loadedEpoch;
   float    DetajjL_up_;
   TBranch *DetajjL_up_branch;
-  bool     DetajjL_up_isLoaded;
+  unsigned int DetajjL_up_loadedEpoch;
   float    DetajjL_dn_;
   TBranch *DetajjL_dn_branch;
-  bool     DetajjL_dn_isLoaded;
+  unsigned int DetajjL_dn_loadedEpoch;
   float    DetajjL_jer_;
   TBranch *DetajjL_jer_branch;
-  bool     DetajjL_jer_isLoaded;
+  unsigned int DetajjL_jer_loadedEpoch;
   float    DetajjL_jerup_;
   TBranch *DetajjL_jerup_branch;
-  bool     DetajjL_jerup_isLoaded;
+  unsigned int DetajjL_jerup_loadedEpoch;
   float    DetajjL_jerdn_;
   TBranch *DetajjL_jerdn_branch;
-  bool     DetajjL_jerdn_isLoaded;
+  unsigned int DetajjL_jerdn_loadedEpoch;
   float    MllSS_;
   TBranch *MllSS_branch;
-  bool     MllSS_isLoaded;
+  unsigned int MllSS_loadedEpoch;
   float    MeeSS_;
   TBranch *MeeSS_branch;
-  bool     MeeSS_isLoaded;
+  unsigned int MeeSS_loadedEpoch;
   float    Mll3L_;
   TBranch *Mll3L_branch;
-  bool     Mll3L_isLoaded;
+  unsigned int Mll3L_loadedEpoch;
   float    Mee3L_;
   TBranch *Mee3L_branch;
-  bool     Mee3L_isLoaded;
+  unsigned int Mee3L_loadedEpoch;
   float    Mll3L1_;
   TBranch *Mll3L1_branch;
-  bool     Mll3L1_isLoaded;
+  unsigned int Mll3L1_loadedEpoch;
   float    M3l_;
   TBranch *M3l_branch;
-  bool     M3l_isLoaded;
+  unsigned int M3l_loadedEpoch;
   float    Pt3l_;
   TBranch *Pt3l_branch;
-  bool     Pt3l_isLoaded;
+  unsigned int Pt3l_loadedEpoch;
   float    M01_;
   TBranch *M01_branch;
-  bool     M01_isLoaded;
+  unsigned int M01_loadedEpoch;
   float    M02_;
   TBranch *M02_branch;
-  bool     M02_isLoaded;
+  unsigned int M02_loadedEpoch;
   float    M12_;
   TBranch *M12_branch;
-  bool     M12_isLoaded;
+  unsigned int M12_loadedEpoch;
   int      isSFOS01_;
   TBranch *isSFOS01_branch;
-  bool     isSFOS01_isLoaded;
+  unsigned int isSFOS01_loadedEpoch;
   int      isSFOS02_;
   TBranch *isSFOS02_branch;
-  bool     isSFOS02_isLoaded;
+  unsigned int isSFOS02_loadedEpoch;
   int      isSFOS12_;
   TBranch *isSFOS12_branch;
-  bool     isSFOS12_isLoaded;
+  unsigned int isSFOS12_loadedEpoch;
   float    DPhi3lMET_;
   TBranch *DPhi3lMET_branch;
-  bool     DPhi3lMET_isLoaded;
+  unsigned int DPhi3lMET_loadedEpoch;
   float    DPhi3lMET_up_;
   TBranch *DPhi3lMET_up_branch;
-  bool     DPhi3lMET_up_isLoaded;
+  unsigned int DPhi3lMET_up_loadedEpoch;
   float    DPhi3lMET_dn_;
   TBranch *DPhi3lMET_dn_branch;
-  bool     DPhi3lMET_dn_isLoaded;
+  unsigned int DPhi3lMET_dn_loadedEpoch;
   float    DPhi3lMET_jer_;
   TBranch *DPhi3lMET_jer_branch;
-  bool     DPhi3lMET_jer_isLoaded;
+  unsigned int DPhi3lMET_jer_loadedEpoch;
   float    DPhi3lMET_jerup_;
   TBranch *DPhi3lMET_jerup_branch;
-  bool     DPhi3lMET_jerup_isLoaded;
+  unsigned int DPhi3lMET_jerup_loadedEpoch;
   float    DPhi3lMET_jerdn_;
   TBranch *DPhi3lMET_jerdn_branch;
-  bool     DPhi3lMET_jerdn_isLoaded;
+  unsigned int DPhi3lMET_jerdn_loadedEpoch;
   float    DPhi3lMET_gen_;
   TBranch *DPhi3lMET_gen_branch;
-  bool     DPhi3lMET_gen_isLoaded;
+  unsigned int DPhi3lMET_gen_loadedEpoch;
   float    MTmax_;
   TBranch *MTmax_branch;
-  bool     MTmax_isLoaded;
+  unsigned int MTmax_loadedEpoch;
   float    MTmax_up_;
   TBranch *MTmax_up_branch;
-  bool     MTmax_up_isLoaded;
+  unsigned int MTmax_up_loadedEpoch;
   float    MTmax_dn_;
   TBranch *MTmax_dn_branch;
-  bool     MTmax_dn_isLoaded;
+  unsigned int MTmax_dn_loadedEpoch;
   float    MTmax_jer_;
   TBranch *MTmax_jer_branch;
-  bool     MTmax_jer_isLoaded;
+  unsigned int MTmax_jer_loadedEpoch;
   float    MTmax_jerup_;
   TBranch *MTmax_jerup_branch;
-  bool     MTmax_jerup_isLoaded;
+  unsigned int MTmax_jerup_loadedEpoch;
   float    MTmax_jerdn_;
   TBranch *MTmax_jerdn_branch;
-  bool     MTmax_jerdn_isLoaded;
+  unsigned int MTmax_jerdn_loadedEpoch;
   float    MTmax_gen_;
   TBranch *MTmax_gen_branch;
-  bool     MTmax_gen_isLoaded;
+  unsigned int MTmax_gen_loadedEpoch;
   float    MTmin_;
   TBranch *MTmin_branch;
-  bool     MTmin_isLoaded;
+  unsigned int MTmin_loadedEpoch;
   float    MTmin_up_;
   TBranch *MTmin_up_branch;
-  bool     MTmin_up_isLoaded;
+  unsigned int MTmin_up_loadedEpoch;
   float    MTmin_dn_;
   TBranch *MTmin_dn_branch;
-  bool     MTmin_dn_isLoaded;
+  unsigned int MTmin_dn_loadedEpoch;
   float    MTmin_jer_;
   TBranch *MTmin_jer_branch;
-  bool     MTmin_jer_isLoaded;
+  unsigned int MTmin_jer_loadedEpoch;
   float    MTmin_jerup_;
   TBranch *MTmin_jerup_branch;
-  bool     MTmin_jerup_isLoaded;
+  unsigned int MTmin_jerup_loadedEpoch;
   float    MTmin_jerdn_;
   TBranch *MTmin_jerdn_branch;
-  bool     MTmin_jerdn_isLoaded;
+  unsigned int MTmin_jerdn_loadedEpoch;
   float    MTmin_gen_;
   TBranch *MTmin_gen_branch;
-  bool     MTmin_gen_isLoaded;
+  unsigned int MTmin_gen_loadedEpoch;
   float    MT3rd_;
   TBranch *MT3rd_branch;
-  bool     MT3rd_isLoaded;
+  unsigned int MT3rd_loadedEpoch;
   float    MT3rd_up_;
   TBranch *MT3rd_up_branch;
-  bool     MT3rd_up_isLoaded;
+  unsigned int MT3rd_up_loadedEpoch;
   float    MT3rd_dn_;
   TBranch *MT3rd_dn_branch;
-  bool     MT3rd_dn_isLoaded;
+  unsigned int MT3rd_dn_loadedEpoch;
   float    MT3rd_jer_;
   TBranch *MT3rd_jer_branch;
-  bool     MT3rd_jer_isLoaded;
+  unsigned int MT3rd_jer_loadedEpoch;
   float    MT3rd_jerup_;
   TBranch *MT3rd_jerup_branch;
-  bool     MT3rd_jerup_isLoaded;
+  unsigned int MT3rd_jerup_loadedEpoch;
   float    MT3rd_jerdn_;
   TBranch *MT3rd_jerdn_branch;
-  bool     MT3rd_jerdn_isLoaded;
+  unsigned int MT3rd_jerdn_loadedEpoch;
   float    MT3rd_gen_;
   TBranch *MT3rd_gen_branch;
-  bool     MT3rd_gen_isLoaded;
+  unsigned int MT3rd_gen_loadedEpoch;
   float    MTmax3L_;
   TBranch *MTmax3L_branch;
-  bool     MTmax3L_isLoaded;
+  unsigned int MTmax3L_loadedEpoch;
   float    MTmax3L_up_;
   TBranch *MTmax3L_up_branch;
-  bool     MTmax3L_up_isLoaded;
+  unsigned int MTmax3L_up_loadedEpoch;
   float    MTmax3L_dn_;
   TBranch *MTmax3L_dn_branch;
-  bool     MTmax3L_dn_isLoaded;
+  unsigned int MTmax3L_dn_loadedEpoch;
   float    MTmax3L_jer_;
   TBranch *MTmax3L_jer_branch;
-  bool     MTmax3L_jer_isLoaded;
+  unsigned int MTmax3L_jer_loadedEpoch;
   float    MTmax3L_jerup_;
   TBranch *MTmax3L_jerup_branch;
-  bool     MTmax3L_jerup_isLoaded;
+  unsigned int MTmax3L_jerup_loadedEpoch;
   float    MTmax3L_jerdn_;
   TBranch *MTmax3L_jerdn_branch;
-  bool     MTmax3L_jerdn_isLoaded;
+  unsigned int MTmax3L_jerdn_loadedEpoch;
   float    MTmax3L_gen_;
   TBranch *MTmax3L_gen_branch;
-  bool     MTmax3L_gen_isLoaded;
+  unsigned int MTmax3L_gen_loadedEpoch;
   int      passSSee_;
   TBranch *passSSee_branch;
-  bool     passSSee_isLoaded;
+  unsigned int passSSee_loadedEpoch;
   int      passSSem_;
   TBranch *passSSem_branch;
-  bool     passSSem_isLoaded;
+  unsigned int passSSem_loadedEpoch;
   int      passSSmm_;
   TBranch *passSSmm_branch;
-  bool     passSSmm_isLoaded;
+  unsigned int passSSmm_loadedEpoch;
   int      lep_idx0_SS_;
   TBranch *lep_idx0_SS_branch;
-  bool     lep_idx0_SS_isLoaded;
+  unsigned int lep_idx0_SS_loadedEpoch;
   int      lep_idx1_SS_;
   TBranch *lep_idx1_SS_branch;
-  bool     lep_idx1_SS_isLoaded;
+  unsigned int lep_idx1_SS_loadedEpoch;
   TString *bkgtype_;
   TBranch *bkgtype_branch;
-  bool     bkgtype_isLoaded;
+  unsigned int bkgtype_loadedEpoch;
   int      vetophoton_;
   TBranch *vetophoton_branch;
-  bool     vetophoton_isLoaded;
+  unsigned int vetophoton_loadedEpoch;
   float    purewgt_;
   TBranch *purewgt_branch;
-  bool     purewgt_isLoaded;
+  unsigned int purewgt_loadedEpoch;
   float    purewgt_up_;
   TBranch *purewgt_up_branch;
-  bool     purewgt_up_isLoaded;
+  unsigned int purewgt_up_loadedEpoch;
   float    purewgt_dn_;
   TBranch *purewgt_dn_branch;
-  bool     purewgt_dn_isLoaded;
+  unsigned int purewgt_dn_loadedEpoch;
   float    ffwgt_;
   TBranch *ffwgt_branch;
-  bool     ffwgt_isLoaded;
+  unsigned int ffwgt_loadedEpoch;
   float    ffwgt_up_;
   TBranch *ffwgt_up_branch;
-  bool     ffwgt_up_isLoaded;
+  unsigned int ffwgt_up_loadedEpoch;
   float    ffwgt_dn_;
   TBranch *ffwgt_dn_branch;
-  bool     ffwgt_dn_isLoaded;
+  unsigned int ffwgt_dn_loadedEpoch;
   float    ffwgt_el_up_;
   TBranch *ffwgt_el_up_branch;
-  bool     ffwgt_el_up_isLoaded;
+  unsigned int ffwgt_el_up_loadedEpoch;
   float    ffwgt_el_dn_;
   TBranch *ffwgt_el_dn_branch;
-  bool     ffwgt_el_dn_isLoaded;
+  unsigned int ffwgt_el_dn_loadedEpoch;
   float    ffwgt_mu_up_;
   TBranch *ffwgt_mu_up_branch;
-  bool     ffwgt_mu_up_isLoaded;
+  unsigned int ffwgt_mu_up_loadedEpoch;
   float    ffwgt_mu_dn_;
   TBranch *ffwgt_mu_dn_branch;
-  bool     ffwgt_mu_dn_isLoaded;
+  unsigned int ffwgt_mu_dn_loadedEpoch;
   float    ffwgt_closure_up_;
   TBranch *ffwgt_closure_up_branch;
-  bool     ffwgt_closure_up_isLoaded;
+  unsigned int ffwgt_closure_up_loadedEpoch;
   float    ffwgt_closure_dn_;
   TBranch *ffwgt_closure_dn_branch;
-  bool     ffwgt_closure_dn_isLoaded;
+  unsigned int ffwgt_closure_dn_loadedEpoch;
   float    ffwgt_closure_el_up_;
   TBranch *ffwgt_closure_el_up_branch;
-  bool     ffwgt_closure_el_up_isLoaded;
+  unsigned int ffwgt_closure_el_up_loadedEpoch;
   float    ffwgt_closure_el_dn_;
   TBranch *ffwgt_closure_el_dn_branch;
-  bool     ffwgt_closure_el_dn_isLoaded;
+  unsigned int ffwgt_closure_el_dn_loadedEpoch;
   float    ffwgt_closure_mu_up_;
   TBranch *ffwgt_closure_mu_up_branch;
-  bool     ffwgt_closure_mu_up_isLoaded;
+  unsigned int ffwgt_closure_mu_up_loadedEpoch;
   float    ffwgt_closure_mu_dn_;
   TBranch *ffwgt_closure_mu_dn_branch;
-  bool     ffwgt_closure_mu_dn_isLoaded;
+  unsigned int ffwgt_closure_mu_dn_loadedEpoch;
   float    ffwgt_full_up_;
   TBranch *ffwgt_full_up_branch;
-  bool     ffwgt_full_up_isLoaded;
+  unsigned int ffwgt_full_up_loadedEpoch;
   float    ffwgt_full_dn_;
   TBranch *ffwgt_full_dn_branch;
-  bool     ffwgt_full_dn_isLoaded;
+  unsigned int ffwgt_full_dn_loadedEpoch;
   float    ffwgtqcd_;
   TBranch *ffwgtqcd_branch;
-  bool     ffwgtqcd_isLoaded;
+  unsigned int ffwgtqcd_loadedEpoch;
   float    ffwgtqcd_up_;
   TBranch *ffwgtqcd_up_branch;
-  bool     ffwgtqcd_up_isLoaded;
+  unsigned int ffwgtqcd_up_loadedEpoch;
   float    ffwgtqcd_dn_;
   TBranch *ffwgtqcd_dn_branch;
-  bool     ffwgtqcd_dn_isLoaded;
+  unsigned int ffwgtqcd_dn_loadedEpoch;
   float    lepsf_;
   TBranch *lepsf_branch;
-  bool     lepsf_isLoaded;
+  unsigned int lepsf_loadedEpoch;
   float    lepsf_up_;
   TBranch *lepsf_up_branch;
-  bool     lepsf_up_isLoaded;
+  unsigned int lepsf_up_loadedEpoch;
   float    lepsf_dn_;
   TBranch *lepsf_dn_branch;
-  bool     lepsf_dn_isLoaded;
+  unsigned int lepsf_dn_loadedEpoch;
   float    trigeff_;
   TBranch *trigeff_branch;
-  bool     trigeff_isLoaded;
+  unsigned int trigeff_loadedEpoch;
   float    trigeff_up_;
   TBranch *trigeff_up_branch;
-  bool     trigeff_up_isLoaded;
+  unsigned int trigeff_up_loadedEpoch;
   float    trigeff_dn_;
   TBranch *trigeff_dn_branch;
-  bool     trigeff_dn_isLoaded;
+  unsigned int trigeff_dn_loadedEpoch;
   float    trigsf_;
   TBranch *trigsf_branch;
-  bool     trigsf_isLoaded;
+  unsigned int trigsf_loadedEpoch;
   float    trigsf_up_;
   TBranch *trigsf_up_branch;
-  bool     trigsf_up_isLoaded;
+  unsigned int trigsf_up_loadedEpoch;
   float    trigsf_dn_;
   TBranch *trigsf_dn_branch;
-  bool     trigsf_dn_isLoaded;
+  unsigned int trigsf_dn_loadedEpoch;
   float    musmear_sf_;
   TBranch *musmear_sf_branch;
-  bool     musmear_sf_isLoaded;
+  unsigned int musmear_sf_loadedEpoch;
   int      iswhwww_;
   TBranch *iswhwww_branch;
-  bool     iswhwww_isLoaded;
+  unsigned int iswhwww_loadedEpoch;
   int      www_channel_;
   TBranch *www_channel_branch;
-  bool     www_channel_isLoaded;
+  unsigned int www_channel_loadedEpoch;
   int      has_tau_;
   TBranch *has_tau_branch;
-  bool     has_tau_isLoaded;
+  unsigned int has_tau_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *w_p4_;
   TBranch *w_p4_branch;
-  bool     w_p4_isLoaded;
+  unsigned int w_p4_loadedEpoch;
   vector<int> *w_islep_;
   TBranch *w_islep_branch;
-  bool     w_islep_isLoaded;
+  unsigned int w_islep_loadedEpoch;
   vector<int> *w_isstar_;
   TBranch *w_isstar_branch;
-  bool     w_isstar_isLoaded;
+  unsigned int w_isstar_loadedEpoch;
   vector<int> *w_isH_;
   TBranch *w_isH_branch;
-  bool     w_isH_isLoaded;
+  unsigned int w_isH_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *l_p4_;
   TBranch *l_p4_branch;
-  bool     l_p4_isLoaded;
+  unsigned int l_p4_loadedEpoch;
   vector<float> *l_w_pt_;
   TBranch *l_w_pt_branch;
-  bool     l_w_pt_isLoaded;
+  unsigned int l_w_pt_loadedEpoch;
   vector<float> *l_w_eta_;
   TBranch *l_w_eta_branch;
-  bool     l_w_eta_isLoaded;
+  unsigned int l_w_eta_loadedEpoch;
   vector<float> *l_w_phi_;
   TBranch *l_w_phi_branch;
-  bool     l_w_phi_isLoaded;
+  unsigned int l_w_phi_loadedEpoch;
   vector<float> *l_w_mass_;
   TBranch *l_w_mass_branch;
-  bool     l_w_mass_isLoaded;
+  unsigned int l_w_mass_loadedEpoch;
   vector<int> *l_w_id_;
   TBranch *l_w_id_branch;
-  bool     l_w_id_isLoaded;
+  unsigned int l_w_id_loadedEpoch;
   vector<int> *l_isstar_;
   TBranch *l_isstar_branch;
-  bool     l_isstar_isLoaded;
+  unsigned int l_isstar_loadedEpoch;
   vector<int> *l_isH_;
   TBranch *l_isH_branch;
-  bool     l_isH_isLoaded;
+  unsigned int l_isH_loadedEpoch;
   vector<int> *l_istau_;
   TBranch *l_istau_branch;
-  bool     l_istau_isLoaded;
+  unsigned int l_istau_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *q_p4_;
   TBranch *q_p4_branch;
-  bool     q_p4_isLoaded;
+  unsigned int q_p4_loadedEpoch;
   vector<float> *q_w_pt_;
   TBranch *q_w_pt_branch;
-  bool     q_w_pt_isLoaded;
+  unsigned int q_w_pt_loadedEpoch;
   vector<float> *q_w_eta_;
   TBranch *q_w_eta_branch;
-  bool     q_w_eta_isLoaded;
+  unsigned int q_w_eta_loadedEpoch;
   vector<float> *q_w_phi_;
   TBranch *q_w_phi_branch;
-  bool     q_w_phi_isLoaded;
+  unsigned int q_w_phi_loadedEpoch;
   vector<float> *q_w_mass_;
   TBranch *q_w_mass_branch;
-  bool     q_w_mass_isLoaded;
+  unsigned int q_w_mass_loadedEpoch;
   vector<int> *q_w_id_;
   TBranch *q_w_id_branch;
-  bool     q_w_id_isLoaded;
+  unsigned int q_w_id_loadedEpoch;
   vector<int> *q_isstar_;
   TBranch *q_isstar_branch;
-  bool     q_isstar_isLoaded;
+  unsigned int q_isstar_loadedEpoch;
   vector<int> *q_isH_;
   TBranch *q_isH_branch;
-  bool     q_isH_isLoaded;
+  unsigned int q_isH_loadedEpoch;
   float    dRllSS_;
   TBranch *dRllSS_branch;
-  bool     dRllSS_isLoaded;
+  unsigned int dRllSS_loadedEpoch;
   float    dRqqSS_;
   TBranch *dRqqSS_branch;
-  bool     dRqqSS_isLoaded;
+  unsigned int dRqqSS_loadedEpoch;
   float    DPhill_higgs_;
   TBranch *DPhill_higgs_branch;
-  bool     DPhill_higgs_isLoaded;
+  unsigned int DPhill_higgs_loadedEpoch;
   float    Mll_higgs_;
   TBranch *Mll_higgs_branch;
-  bool     Mll_higgs_isLoaded;
+  unsigned int Mll_higgs_loadedEpoch;
   float    MT_higgs_;
   TBranch *MT_higgs_branch;
-  bool     MT_higgs_isLoaded;
+  unsigned int MT_higgs_loadedEpoch;
 public: 
 void Init(TTree *tree);
 void GetEntry(unsigned int idx); 
+void ResetLoadEpochs(); 
 void LoadAllBranches(); 
   const int &run();
   const int &lumi();
@@ -2064,6 +2122,139 @@ void LoadAllBranches();
   const float &MT_higgs();
 
   static void progress(int nEventsTotal, int nEventsChain);
+
+  // Branch usage tracing: record which branches are accessed during a warm-up and
+  // then switch off all the other branches so that only those are read and cached
+  void StartBranchTracing();
+  void ActivateTracedBranches();
+  const set<TString> &TracedBranches() { return traced_branches_; }
+  bool TracingBranches() { return trace_branches_; }
+  bool BranchSelectionActive() { return branch_selection_active_; }
+  // Branches read outside the accessors (e.g. in columns by WWWColumns), kept on and cached whatever the tracing records
+  void KeepBranches(const set<TString> &names);
+  static void SetBranchStatusRecursive(TBranch *branch, bool status);
+
+  // Columnar blocks: serve the flat scalar branches from the arrays of a WWWColumns block (0 to detach)
+  void AttachColumns(WWWColumns *columns) { columns_ = columns; }
+
+  // Inline lepton storage (opt-in): the per-lepton float/int vector branches are read straight from their baskets into the
+  // fixed capacity arrays of a wwwleptons structure of arrays, without streaming them into the vectors, and the _array()
+  // accessors point there (otherwise, or for an event with more values than the capacity, they point into the vectors)
+  void SetInlineLeptons(bool use) { inline_leptons_ = use; }
+  const float *lep_pt_array();
+  const float *lep_eta_array();
+  const float *lep_phi_array();
+  const float *lep_coneCorrPt_array();
+  const float *lep_ip3d_array();
+  const float *lep_ip3derr_array();
+  const int *lep_isTriggerSafe_v1_array();
+  const int *lep_lostHits_array();
+  const int *lep_convVeto_array();
+  const int *lep_motherIdSS_array();
+  const int *lep_pass_VVV_cutbased_3l_fo_array();
+  const int *lep_pass_VVV_cutbased_3l_tight_array();
+  const int *lep_pass_VVV_cutbased_fo_array();
+  const int *lep_pass_VVV_cutbased_tight_array();
+  const int *lep_pass_VVV_cutbased_veto_array();
+  const int *lep_pass_VVV_cutbased_fo_noiso_array();
+  const int *lep_pass_VVV_cutbased_tight_noiso_array();
+  const int *lep_pass_VVV_cutbased_veto_noiso_array();
+  const int *lep_pass_POG_veto_array();
+  const int *lep_pass_POG_loose_array();
+  const int *lep_pass_POG_medium_array();
+  const int *lep_pass_POG_tight_array();
+  const int *lep_pdgId_array();
+  const float *lep_dxy_array();
+  const float *lep_dz_array();
+  const float *lep_pterr_array();
+  const float *lep_relIso04DB_array();
+  const float *lep_relIso03EA_array();
+  const float *lep_relIso03EALep_array();
+  const float *lep_relIso03EAv2_array();
+  const float *lep_relIso04EAv2_array();
+  const float *lep_relIso03EAv2Lep_array();
+  const int *lep_tightCharge_array();
+  const float *lep_trk_pt_array();
+  const int *lep_charge_array();
+  const float *lep_etaSC_array();
+  const float *lep_MVA_array();
+  const int *lep_isMediumPOG_array();
+  const int *lep_isTightPOG_array();
+  const int *lep_isFromW_array();
+  const int *lep_isFromZ_array();
+  const int *lep_isFromB_array();
+  const int *lep_isFromC_array();
+  const int *lep_isFromL_array();
+  const int *lep_isFromLF_array();
+  const int *lep_genPart_index_array();
+  const float *lep_r9_array();
+  const int *lep_nlayers_array();
+ protected:
+  inline void LoadBranch(TBranch *branch) {
+    if (trace_branches_ or branch->TestBit(kDoNotProcess)) TraceBranch(branch);
+    if (columns_ and branch->GetUniqueID() != 0) LoadFromColumns(branch);
+    else branch->GetEntry(index);
+  }
+  void LoadFromColumns(TBranch *branch);
+  template <class T> bool LoadInline(TBranch *branch, T *array);
+  void TraceBranch(TBranch *branch);
+  void ApplyBranchSelection();
+  TTree *tree_;
+  bool trace_branches_;
+  bool branch_selection_active_;
+  set<TString> traced_branches_;
+  set<TString> kept_branches_;
+  WWWColumns *columns_;
+  bool inline_leptons_;
+  wwwleptons leptons_;
+  unsigned int lep_pt_inlineEpoch;
+  unsigned int lep_eta_inlineEpoch;
+  unsigned int lep_phi_inlineEpoch;
+  unsigned int lep_coneCorrPt_inlineEpoch;
+  unsigned int lep_ip3d_inlineEpoch;
+  unsigned int lep_ip3derr_inlineEpoch;
+  unsigned int lep_isTriggerSafe_v1_inlineEpoch;
+  unsigned int lep_lostHits_inlineEpoch;
+  unsigned int lep_convVeto_inlineEpoch;
+  unsigned int lep_motherIdSS_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_3l_fo_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_3l_tight_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_fo_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_tight_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_veto_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_fo_noiso_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_tight_noiso_inlineEpoch;
+  unsigned int lep_pass_VVV_cutbased_veto_noiso_inlineEpoch;
+  unsigned int lep_pass_POG_veto_inlineEpoch;
+  unsigned int lep_pass_POG_loose_inlineEpoch;
+  unsigned int lep_pass_POG_medium_inlineEpoch;
+  unsigned int lep_pass_POG_tight_inlineEpoch;
+  unsigned int lep_pdgId_inlineEpoch;
+  unsigned int lep_dxy_inlineEpoch;
+  unsigned int lep_dz_inlineEpoch;
+  unsigned int lep_pterr_inlineEpoch;
+  unsigned int lep_relIso04DB_inlineEpoch;
+  unsigned int lep_relIso03EA_inlineEpoch;
+  unsigned int lep_relIso03EALep_inlineEpoch;
+  unsigned int lep_relIso03EAv2_inlineEpoch;
+  unsigned int lep_relIso04EAv2_inlineEpoch;
+  unsigned int lep_relIso03EAv2Lep_inlineEpoch;
+  unsigned int lep_tightCharge_inlineEpoch;
+  unsigned int lep_trk_pt_inlineEpoch;
+  unsigned int lep_charge_inlineEpoch;
+  unsigned int lep_etaSC_inlineEpoch;
+  unsigned int lep_MVA_inlineEpoch;
+  unsigned int lep_isMediumPOG_inlineEpoch;
+  unsigned int lep_isTightPOG_inlineEpoch;
+  unsigned int lep_isFromW_inlineEpoch;
+  unsigned int lep_isFromZ_inlineEpoch;
+  unsigned int lep_isFromB_inlineEpoch;
+  unsigned int lep_isFromC_inlineEpoch;
+  unsigned int lep_isFromL_inlineEpoch;
+  unsigned int lep_isFromLF_inlineEpoch;
+  unsigned int lep_genPart_index_inlineEpoch;
+  unsigned int lep_r9_inlineEpoch;
+  unsigned int lep_nlayers_inlineEpoch;
 };
 
 #ifndef __CINT__
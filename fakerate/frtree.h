@@ -22,975 +22,977 @@ class frtree {
  private: 
  protected: 
   unsigned int index;
+  unsigned int epoch;
   int      run_;
   TBranch *run_branch;
-  bool     run_isLoaded;
+  unsigned int run_loadedEpoch;
   int      lumi_;
   TBranch *lumi_branch;
-  bool     lumi_isLoaded;
+  unsigned int lumi_loadedEpoch;
   unsigned long long evt_;
   TBranch *evt_branch;
-  bool     evt_isLoaded;
+  unsigned int evt_loadedEpoch;
   int      isData_;
   TBranch *isData_branch;
-  bool     isData_isLoaded;
+  unsigned int isData_loadedEpoch;
   float    evt_scale1fb_;
   TBranch *evt_scale1fb_branch;
-  bool     evt_scale1fb_isLoaded;
+  unsigned int evt_scale1fb_loadedEpoch;
   float    xsec_br_;
   TBranch *xsec_br_branch;
-  bool     xsec_br_isLoaded;
+  unsigned int xsec_br_loadedEpoch;
   int      evt_passgoodrunlist_;
   TBranch *evt_passgoodrunlist_branch;
-  bool     evt_passgoodrunlist_isLoaded;
+  unsigned int evt_passgoodrunlist_loadedEpoch;
   TString *CMS4path_;
   TBranch *CMS4path_branch;
-  bool     CMS4path_isLoaded;
+  unsigned int CMS4path_loadedEpoch;
   int      CMS4index_;
   TBranch *CMS4index_branch;
-  bool     CMS4index_isLoaded;
+  unsigned int CMS4index_loadedEpoch;
   float    weight_fr_r1_f1_;
   TBranch *weight_fr_r1_f1_branch;
-  bool     weight_fr_r1_f1_isLoaded;
+  unsigned int weight_fr_r1_f1_loadedEpoch;
   float    weight_fr_r1_f2_;
   TBranch *weight_fr_r1_f2_branch;
-  bool     weight_fr_r1_f2_isLoaded;
+  unsigned int weight_fr_r1_f2_loadedEpoch;
   float    weight_fr_r1_f0p5_;
   TBranch *weight_fr_r1_f0p5_branch;
-  bool     weight_fr_r1_f0p5_isLoaded;
+  unsigned int weight_fr_r1_f0p5_loadedEpoch;
   float    weight_fr_r2_f1_;
   TBranch *weight_fr_r2_f1_branch;
-  bool     weight_fr_r2_f1_isLoaded;
+  unsigned int weight_fr_r2_f1_loadedEpoch;
   float    weight_fr_r2_f2_;
   TBranch *weight_fr_r2_f2_branch;
-  bool     weight_fr_r2_f2_isLoaded;
+  unsigned int weight_fr_r2_f2_loadedEpoch;
   float    weight_fr_r2_f0p5_;
   TBranch *weight_fr_r2_f0p5_branch;
-  bool     weight_fr_r2_f0p5_isLoaded;
+  unsigned int weight_fr_r2_f0p5_loadedEpoch;
   float    weight_fr_r0p5_f1_;
   TBranch *weight_fr_r0p5_f1_branch;
-  bool     weight_fr_r0p5_f1_isLoaded;
+  unsigned int weight_fr_r0p5_f1_loadedEpoch;
   float    weight_fr_r0p5_f2_;
   TBranch *weight_fr_r0p5_f2_branch;
-  bool     weight_fr_r0p5_f2_isLoaded;
+  unsigned int weight_fr_r0p5_f2_loadedEpoch;
   float    weight_fr_r0p5_f0p5_;
   TBranch *weight_fr_r0p5_f0p5_branch;
-  bool     weight_fr_r0p5_f0p5_isLoaded;
+  unsigned int weight_fr_r0p5_f0p5_loadedEpoch;
   float    weight_pdf_up_;
   TBranch *weight_pdf_up_branch;
-  bool     weight_pdf_up_isLoaded;
+  unsigned int weight_pdf_up_loadedEpoch;
   float    weight_pdf_down_;
   TBranch *weight_pdf_down_branch;
-  bool     weight_pdf_down_isLoaded;
+  unsigned int weight_pdf_down_loadedEpoch;
   float    weight_alphas_down_;
   TBranch *weight_alphas_down_branch;
-  bool     weight_alphas_down_isLoaded;
+  unsigned int weight_alphas_down_loadedEpoch;
   float    weight_alphas_up_;
   TBranch *weight_alphas_up_branch;
-  bool     weight_alphas_up_isLoaded;
+  unsigned int weight_alphas_up_loadedEpoch;
   float    weight_isr_;
   TBranch *weight_isr_branch;
-  bool     weight_isr_isLoaded;
+  unsigned int weight_isr_loadedEpoch;
   float    weight_isr_up_;
   TBranch *weight_isr_up_branch;
-  bool     weight_isr_up_isLoaded;
+  unsigned int weight_isr_up_loadedEpoch;
   float    weight_isr_down_;
   TBranch *weight_isr_down_branch;
-  bool     weight_isr_down_isLoaded;
+  unsigned int weight_isr_down_loadedEpoch;
   int      HLT_DoubleMu_;
   TBranch *HLT_DoubleMu_branch;
-  bool     HLT_DoubleMu_isLoaded;
+  unsigned int HLT_DoubleMu_loadedEpoch;
   int      HLT_DoubleEl_;
   TBranch *HLT_DoubleEl_branch;
-  bool     HLT_DoubleEl_isLoaded;
+  unsigned int HLT_DoubleEl_loadedEpoch;
   int      HLT_DoubleEl_DZ_;
   TBranch *HLT_DoubleEl_DZ_branch;
-  bool     HLT_DoubleEl_DZ_isLoaded;
+  unsigned int HLT_DoubleEl_DZ_loadedEpoch;
   int      HLT_DoubleEl_DZ_2_;
   TBranch *HLT_DoubleEl_DZ_2_branch;
-  bool     HLT_DoubleEl_DZ_2_isLoaded;
+  unsigned int HLT_DoubleEl_DZ_2_loadedEpoch;
   int      HLT_MuEG_;
   TBranch *HLT_MuEG_branch;
-  bool     HLT_MuEG_isLoaded;
+  unsigned int HLT_MuEG_loadedEpoch;
   int      HLT_SingleEl8_;
   TBranch *HLT_SingleEl8_branch;
-  bool     HLT_SingleEl8_isLoaded;
+  unsigned int HLT_SingleEl8_loadedEpoch;
   int      HLT_SingleEl17_;
   TBranch *HLT_SingleEl17_branch;
-  bool     HLT_SingleEl17_isLoaded;
+  unsigned int HLT_SingleEl17_loadedEpoch;
   int      HLT_SingleIsoEl8_;
   TBranch *HLT_SingleIsoEl8_branch;
-  bool     HLT_SingleIsoEl8_isLoaded;
+  unsigned int HLT_SingleIsoEl8_loadedEpoch;
   int      HLT_SingleIsoEl17_;
   TBranch *HLT_SingleIsoEl17_branch;
-  bool     HLT_SingleIsoEl17_isLoaded;
+  unsigned int HLT_SingleIsoEl17_loadedEpoch;
   int      HLT_SingleIsoEl23_;
   TBranch *HLT_SingleIsoEl23_branch;
-  bool     HLT_SingleIsoEl23_isLoaded;
+  unsigned int HLT_SingleIsoEl23_loadedEpoch;
   int      HLT_SingleIsoMu8_;
   TBranch *HLT_SingleIsoMu8_branch;
-  bool     HLT_SingleIsoMu8_isLoaded;
+  unsigned int HLT_SingleIsoMu8_loadedEpoch;
   int      HLT_SingleIsoMu17_;
   TBranch *HLT_SingleIsoMu17_branch;
-  bool     HLT_SingleIsoMu17_isLoaded;
+  unsigned int HLT_SingleIsoMu17_loadedEpoch;
   int      HLT_PFMET140_PFMHT140_IDTight_;
   TBranch *HLT_PFMET140_PFMHT140_IDTight_branch;
-  bool     HLT_PFMET140_PFMHT140_IDTight_isLoaded;
+  unsigned int HLT_PFMET140_PFMHT140_IDTight_loadedEpoch;
   int      mc_HLT_DoubleMu_;
   TBranch *mc_HLT_DoubleMu_branch;
-  bool     mc_HLT_DoubleMu_isLoaded;
+  unsigned int mc_HLT_DoubleMu_loadedEpoch;
   int      mc_HLT_DoubleEl_;
   TBranch *mc_HLT_DoubleEl_branch;
-  bool     mc_HLT_DoubleEl_isLoaded;
+  unsigned int mc_HLT_DoubleEl_loadedEpoch;
   int      mc_HLT_DoubleEl_DZ_;
   TBranch *mc_HLT_DoubleEl_DZ_branch;
-  bool     mc_HLT_DoubleEl_DZ_isLoaded;
+  unsigned int mc_HLT_DoubleEl_DZ_loadedEpoch;
   int      mc_HLT_DoubleEl_DZ_2_;
   TBranch *mc_HLT_DoubleEl_DZ_2_branch;
-  bool     mc_HLT_DoubleEl_DZ_2_isLoaded;
+  unsigned int mc_HLT_DoubleEl_DZ_2_loadedEpoch;
   int      mc_HLT_MuEG_;
   TBranch *mc_HLT_MuEG_branch;
-  bool     mc_HLT_MuEG_isLoaded;
+  unsigned int mc_HLT_MuEG_loadedEpoch;
   int      mc_HLT_SingleEl8_;
   TBranch *mc_HLT_SingleEl8_branch;
-  bool     mc_HLT_SingleEl8_isLoaded;
+  unsigned int mc_HLT_SingleEl8_loadedEpoch;
   int      mc_HLT_SingleEl17_;
   TBranch *mc_HLT_SingleEl17_branch;
-  bool     mc_HLT_SingleEl17_isLoaded;
+  unsigned int mc_HLT_SingleEl17_loadedEpoch;
   int      mc_HLT_SingleIsoEl8_;
   TBranch *mc_HLT_SingleIsoEl8_branch;
-  bool     mc_HLT_SingleIsoEl8_isLoaded;
+  unsigned int mc_HLT_SingleIsoEl8_loadedEpoch;
   int      mc_HLT_SingleIsoEl17_;
   TBranch *mc_HLT_SingleIsoEl17_branch;
-  bool     mc_HLT_SingleIsoEl17_isLoaded;
+  unsigned int mc_HLT_SingleIsoEl17_loadedEpoch;
   int      mc_HLT_SingleIsoEl23_;
   TBranch *mc_HLT_SingleIsoEl23_branch;
-  bool     mc_HLT_SingleIsoEl23_isLoaded;
+  unsigned int mc_HLT_SingleIsoEl23_loadedEpoch;
   int      mc_HLT_SingleIsoMu8_;
   TBranch *mc_HLT_SingleIsoMu8_branch;
-  bool     mc_HLT_SingleIsoMu8_isLoaded;
+  unsigned int mc_HLT_SingleIsoMu8_loadedEpoch;
   int      mc_HLT_SingleIsoMu17_;
   TBranch *mc_HLT_SingleIsoMu17_branch;
-  bool     mc_HLT_SingleIsoMu17_isLoaded;
+  unsigned int mc_HLT_SingleIsoMu17_loadedEpoch;
   int      mc_HLT_PFMET140_PFMHT140_IDTight_;
   TBranch *mc_HLT_PFMET140_PFMHT140_IDTight_branch;
-  bool     mc_HLT_PFMET140_PFMHT140_IDTight_isLoaded;
+  unsigned int mc_HLT_PFMET140_PFMHT140_IDTight_loadedEpoch;
   int      pass_duplicate_ee_em_mm_;
   TBranch *pass_duplicate_ee_em_mm_branch;
-  bool     pass_duplicate_ee_em_mm_isLoaded;
+  unsigned int pass_duplicate_ee_em_mm_loadedEpoch;
   int      pass_duplicate_mm_em_ee_;
   TBranch *pass_duplicate_mm_em_ee_branch;
-  bool     pass_duplicate_mm_em_ee_isLoaded;
+  unsigned int pass_duplicate_mm_em_ee_loadedEpoch;
   int      is2016_;
   TBranch *is2016_branch;
-  bool     is2016_isLoaded;
+  unsigned int is2016_loadedEpoch;
   int      is2017_;
   TBranch *is2017_branch;
-  bool     is2017_isLoaded;
+  unsigned int is2017_loadedEpoch;
   int      HLT_MuEG_2016_;
   TBranch *HLT_MuEG_2016_branch;
-  bool     HLT_MuEG_2016_isLoaded;
+  unsigned int HLT_MuEG_2016_loadedEpoch;
   int      mc_HLT_MuEG_2016_;
   TBranch *mc_HLT_MuEG_2016_branch;
-  bool     mc_HLT_MuEG_2016_isLoaded;
+  unsigned int mc_HLT_MuEG_2016_loadedEpoch;
   int      pass_duplicate_ee_em2016_mm_;
   TBranch *pass_duplicate_ee_em2016_mm_branch;
-  bool     pass_duplicate_ee_em2016_mm_isLoaded;
+  unsigned int pass_duplicate_ee_em2016_mm_loadedEpoch;
   int      pass_duplicate_mm_em2016_ee_;
   TBranch *pass_duplicate_mm_em2016_ee_branch;
-  bool     pass_duplicate_mm_em2016_ee_isLoaded;
+  unsigned int pass_duplicate_mm_em2016_ee_loadedEpoch;
   int      passTrigger_;
   TBranch *passTrigger_branch;
-  bool     passTrigger_isLoaded;
+  unsigned int passTrigger_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *lep_p4_;
   TBranch *lep_p4_branch;
-  bool     lep_p4_isLoaded;
+  unsigned int lep_p4_loadedEpoch;
   vector<float> *lep_pt_;
   TBranch *lep_pt_branch;
-  bool     lep_pt_isLoaded;
+  unsigned int lep_pt_loadedEpoch;
   vector<float> *lep_eta_;
   TBranch *lep_eta_branch;
-  bool     lep_eta_isLoaded;
+  unsigned int lep_eta_loadedEpoch;
   vector<float> *lep_phi_;
   TBranch *lep_phi_branch;
-  bool     lep_phi_isLoaded;
+  unsigned int lep_phi_loadedEpoch;
   vector<float> *lep_coneCorrPt_;
   TBranch *lep_coneCorrPt_branch;
-  bool     lep_coneCorrPt_isLoaded;
+  unsigned int lep_coneCorrPt_loadedEpoch;
   vector<float> *lep_ip3d_;
   TBranch *lep_ip3d_branch;
-  bool     lep_ip3d_isLoaded;
+  unsigned int lep_ip3d_loadedEpoch;
   vector<float> *lep_ip3derr_;
   TBranch *lep_ip3derr_branch;
-  bool     lep_ip3derr_isLoaded;
+  unsigned int lep_ip3derr_loadedEpoch;
   vector<int> *lep_isTriggerSafe_v1_;
   TBranch *lep_isTriggerSafe_v1_branch;
-  bool     lep_isTriggerSafe_v1_isLoaded;
+  unsigned int lep_isTriggerSafe_v1_loadedEpoch;
   vector<int> *lep_lostHits_;
   TBranch *lep_lostHits_branch;
-  bool     lep_lostHits_isLoaded;
+  unsigned int lep_lostHits_loadedEpoch;
   vector<int> *lep_convVeto_;
   TBranch *lep_convVeto_branch;
-  bool     lep_convVeto_isLoaded;
+  unsigned int lep_convVeto_loadedEpoch;
   vector<int> *lep_motherIdSS_;
   TBranch *lep_motherIdSS_branch;
-  bool     lep_motherIdSS_isLoaded;
+  unsigned int lep_motherIdSS_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_3l_fo_;
   TBranch *lep_pass_VVV_cutbased_3l_fo_branch;
-  bool     lep_pass_VVV_cutbased_3l_fo_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_3l_fo_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_3l_tight_;
   TBranch *lep_pass_VVV_cutbased_3l_tight_branch;
-  bool     lep_pass_VVV_cutbased_3l_tight_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_3l_tight_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_fo_;
   TBranch *lep_pass_VVV_cutbased_fo_branch;
-  bool     lep_pass_VVV_cutbased_fo_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_fo_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_tight_;
   TBranch *lep_pass_VVV_cutbased_tight_branch;
-  bool     lep_pass_VVV_cutbased_tight_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_tight_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_veto_;
   TBranch *lep_pass_VVV_cutbased_veto_branch;
-  bool     lep_pass_VVV_cutbased_veto_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_veto_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_fo_noiso_;
   TBranch *lep_pass_VVV_cutbased_fo_noiso_branch;
-  bool     lep_pass_VVV_cutbased_fo_noiso_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_fo_noiso_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_tight_noiso_;
   TBranch *lep_pass_VVV_cutbased_tight_noiso_branch;
-  bool     lep_pass_VVV_cutbased_tight_noiso_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_tight_noiso_loadedEpoch;
   vector<int> *lep_pass_VVV_cutbased_veto_noiso_;
   TBranch *lep_pass_VVV_cutbased_veto_noiso_branch;
-  bool     lep_pass_VVV_cutbased_veto_noiso_isLoaded;
+  unsigned int lep_pass_VVV_cutbased_veto_noiso_loadedEpoch;
   vector<int> *lep_pass_POG_veto_;
   TBranch *lep_pass_POG_veto_branch;
-  bool     lep_pass_POG_veto_isLoaded;
+  unsigned int lep_pass_POG_veto_loadedEpoch;
   vector<int> *lep_pass_POG_loose_;
   TBranch *lep_pass_POG_loose_branch;
-  bool     lep_pass_POG_loose_isLoaded;
+  unsigned int lep_pass_POG_loose_loadedEpoch;
   vector<int> *lep_pass_POG_medium_;
   TBranch *lep_pass_POG_medium_branch;
-  bool     lep_pass_POG_medium_isLoaded;
+  unsigned int lep_pass_POG_medium_loadedEpoch;
   vector<int> *lep_pass_POG_tight_;
   TBranch *lep_pass_POG_tight_branch;
-  bool     lep_pass_POG_tight_isLoaded;
+  unsigned int lep_pass_POG_tight_loadedEpoch;
   vector<int> *lep_pdgId_;
   TBranch *lep_pdgId_branch;
-  bool     lep_pdgId_isLoaded;
+  unsigned int lep_pdgId_loadedEpoch;
   vector<float> *lep_dxy_;
   TBranch *lep_dxy_branch;
-  bool     lep_dxy_isLoaded;
+  unsigned int lep_dxy_loadedEpoch;
   vector<float> *lep_dz_;
   TBranch *lep_dz_branch;
-  bool     lep_dz_isLoaded;
+  unsigned int lep_dz_loadedEpoch;
   vector<float> *lep_pterr_;
   TBranch *lep_pterr_branch;
-  bool     lep_pterr_isLoaded;
+  unsigned int lep_pterr_loadedEpoch;
   vector<float> *lep_relIso04DB_;
   TBranch *lep_relIso04DB_branch;
-  bool     lep_relIso04DB_isLoaded;
+  unsigned int lep_relIso04DB_loadedEpoch;
   vector<float> *lep_relIso03EA_;
   TBranch *lep_relIso03EA_branch;
-  bool     lep_relIso03EA_isLoaded;
+  unsigned int lep_relIso03EA_loadedEpoch;
   vector<float> *lep_relIso03EALep_;
   TBranch *lep_relIso03EALep_branch;
-  bool     lep_relIso03EALep_isLoaded;
+  unsigned int lep_relIso03EALep_loadedEpoch;
   vector<float> *lep_relIso03EAv2_;
   TBranch *lep_relIso03EAv2_branch;
-  bool     lep_relIso03EAv2_isLoaded;
+  unsigned int lep_relIso03EAv2_loadedEpoch;
   vector<float> *lep_relIso04EAv2_;
   TBranch *lep_relIso04EAv2_branch;
-  bool     lep_relIso04EAv2_isLoaded;
+  unsigned int lep_relIso04EAv2_loadedEpoch;
   vector<float> *lep_relIso03EAv2Lep_;
   TBranch *lep_relIso03EAv2Lep_branch;
-  bool     lep_relIso03EAv2Lep_isLoaded;
+  unsigned int lep_relIso03EAv2Lep_loadedEpoch;
   vector<int> *lep_tightCharge_;
   TBranch *lep_tightCharge_branch;
-  bool     lep_tightCharge_isLoaded;
+  unsigned int lep_tightCharge_loadedEpoch;
   vector<float> *lep_trk_pt_;
   TBranch *lep_trk_pt_branch;
-  bool     lep_trk_pt_isLoaded;
+  unsigned int lep_trk_pt_loadedEpoch;
   vector<int> *lep_charge_;
   TBranch *lep_charge_branch;
-  bool     lep_charge_isLoaded;
+  unsigned int lep_charge_loadedEpoch;
   vector<float> *lep_etaSC_;
   TBranch *lep_etaSC_branch;
-  bool     lep_etaSC_isLoaded;
+  unsigned int lep_etaSC_loadedEpoch;
   vector<float> *lep_MVA_;
   TBranch *lep_MVA_branch;
-  bool     lep_MVA_isLoaded;
+  unsigned int lep_MVA_loadedEpoch;
   vector<int> *lep_isMediumPOG_;
   TBranch *lep_isMediumPOG_branch;
-  bool     lep_isMediumPOG_isLoaded;
+  unsigned int lep_isMediumPOG_loadedEpoch;
   vector<int> *lep_isTightPOG_;
   TBranch *lep_isTightPOG_branch;
-  bool     lep_isTightPOG_isLoaded;
+  unsigned int lep_isTightPOG_loadedEpoch;
   vector<int> *lep_isFromW_;
   TBranch *lep_isFromW_branch;
-  bool     lep_isFromW_isLoaded;
+  unsigned int lep_isFromW_loadedEpoch;
   vector<int> *lep_isFromZ_;
   TBranch *lep_isFromZ_branch;
-  bool     lep_isFromZ_isLoaded;
+  unsigned int lep_isFromZ_loadedEpoch;
   vector<int> *lep_isFromB_;
   TBranch *lep_isFromB_branch;
-  bool     lep_isFromB_isLoaded;
+  unsigned int lep_isFromB_loadedEpoch;
   vector<int> *lep_isFromC_;
   TBranch *lep_isFromC_branch;
-  bool     lep_isFromC_isLoaded;
+  unsigned int lep_isFromC_loadedEpoch;
   vector<int> *lep_isFromL_;
   TBranch *lep_isFromL_branch;
-  bool     lep_isFromL_isLoaded;
+  unsigned int lep_isFromL_loadedEpoch;
   vector<int> *lep_isFromLF_;
   TBranch *lep_isFromLF_branch;
-  bool     lep_isFromLF_isLoaded;
+  unsigned int lep_isFromLF_loadedEpoch;
   vector<int> *lep_genPart_index_;
   TBranch *lep_genPart_index_branch;
-  bool     lep_genPart_index_isLoaded;
+  unsigned int lep_genPart_index_loadedEpoch;
   vector<float> *lep_r9_;
   TBranch *lep_r9_branch;
-  bool     lep_r9_isLoaded;
+  unsigned int lep_r9_loadedEpoch;
   vector<int> *lep_nlayers_;
   TBranch *lep_nlayers_branch;
-  bool     lep_nlayers_isLoaded;
+  unsigned int lep_nlayers_loadedEpoch;
   float    el_pt_;
   TBranch *el_pt_branch;
-  bool     el_pt_isLoaded;
+  unsigned int el_pt_loadedEpoch;
   float    el_eta_;
   TBranch *el_eta_branch;
-  bool     el_eta_isLoaded;
+  unsigned int el_eta_loadedEpoch;
   float    el_phi_;
   TBranch *el_phi_branch;
-  bool     el_phi_isLoaded;
+  unsigned int el_phi_loadedEpoch;
   float    el_relIso03EA_;
   TBranch *el_relIso03EA_branch;
-  bool     el_relIso03EA_isLoaded;
+  unsigned int el_relIso03EA_loadedEpoch;
   float    el_relIso03EALep_;
   TBranch *el_relIso03EALep_branch;
-  bool     el_relIso03EALep_isLoaded;
+  unsigned int el_relIso03EALep_loadedEpoch;
   float    el_ip3d_;
   TBranch *el_ip3d_branch;
-  bool     el_ip3d_isLoaded;
+  unsigned int el_ip3d_loadedEpoch;
   float    mu_pt_;
   TBranch *mu_pt_branch;
-  bool     mu_pt_isLoaded;
+  unsigned int mu_pt_loadedEpoch;
   float    mu_eta_;
   TBranch *mu_eta_branch;
-  bool     mu_eta_isLoaded;
+  unsigned int mu_eta_loadedEpoch;
   float    mu_phi_;
   TBranch *mu_phi_branch;
-  bool     mu_phi_isLoaded;
+  unsigned int mu_phi_loadedEpoch;
   float    mu_relIso04DB_;
   TBranch *mu_relIso04DB_branch;
-  bool     mu_relIso04DB_isLoaded;
+  unsigned int mu_relIso04DB_loadedEpoch;
   float    mu_relIso03EA_;
   TBranch *mu_relIso03EA_branch;
-  bool     mu_relIso03EA_isLoaded;
+  unsigned int mu_relIso03EA_loadedEpoch;
   float    mu_relIso03EALep_;
   TBranch *mu_relIso03EALep_branch;
-  bool     mu_relIso03EALep_isLoaded;
+  unsigned int mu_relIso03EALep_loadedEpoch;
   float    mu_ip3d_;
   TBranch *mu_ip3d_branch;
-  bool     mu_ip3d_isLoaded;
+  unsigned int mu_ip3d_loadedEpoch;
   float    lbnt_pt_;
   TBranch *lbnt_pt_branch;
-  bool     lbnt_pt_isLoaded;
+  unsigned int lbnt_pt_loadedEpoch;
   float    lbnt_coneCorrPt_;
   TBranch *lbnt_coneCorrPt_branch;
-  bool     lbnt_coneCorrPt_isLoaded;
+  unsigned int lbnt_coneCorrPt_loadedEpoch;
   float    lbnt_abseta_;
   TBranch *lbnt_abseta_branch;
-  bool     lbnt_abseta_isLoaded;
+  unsigned int lbnt_abseta_loadedEpoch;
   float    lbnt_pdgId_;
   TBranch *lbnt_pdgId_branch;
-  bool     lbnt_pdgId_isLoaded;
+  unsigned int lbnt_pdgId_loadedEpoch;
   float    lbnt_el_pt_;
   TBranch *lbnt_el_pt_branch;
-  bool     lbnt_el_pt_isLoaded;
+  unsigned int lbnt_el_pt_loadedEpoch;
   float    lbnt_el_coneCorrPt_;
   TBranch *lbnt_el_coneCorrPt_branch;
-  bool     lbnt_el_coneCorrPt_isLoaded;
+  unsigned int lbnt_el_coneCorrPt_loadedEpoch;
   float    lbnt_el_abseta_;
   TBranch *lbnt_el_abseta_branch;
-  bool     lbnt_el_abseta_isLoaded;
+  unsigned int lbnt_el_abseta_loadedEpoch;
   float    lbnt_mu_pt_;
   TBranch *lbnt_mu_pt_branch;
-  bool     lbnt_mu_pt_isLoaded;
+  unsigned int lbnt_mu_pt_loadedEpoch;
   float    lbnt_mu_coneCorrPt_;
   TBranch *lbnt_mu_coneCorrPt_branch;
-  bool     lbnt_mu_coneCorrPt_isLoaded;
+  unsigned int lbnt_mu_coneCorrPt_loadedEpoch;
   float    lbnt_mu_abseta_;
   TBranch *lbnt_mu_abseta_branch;
-  bool     lbnt_mu_abseta_isLoaded;
+  unsigned int lbnt_mu_abseta_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_p4_;
   TBranch *jets_p4_branch;
-  bool     jets_p4_isLoaded;
+  unsigned int jets_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_up_p4_;
   TBranch *jets_up_p4_branch;
-  bool     jets_up_p4_isLoaded;
+  unsigned int jets_up_p4_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jets_dn_p4_;
   TBranch *jets_dn_p4_branch;
-  bool     jets_dn_p4_isLoaded;
+  unsigned int jets_dn_p4_loadedEpoch;
   vector<float> *jets_csv_;
   TBranch *jets_csv_branch;
-  bool     jets_csv_isLoaded;
+  unsigned int jets_csv_loadedEpoch;
   vector<float> *jets_up_csv_;
   TBranch *jets_up_csv_branch;
-  bool     jets_up_csv_isLoaded;
+  unsigned int jets_up_csv_loadedEpoch;
   vector<float> *jets_dn_csv_;
   TBranch *jets_dn_csv_branch;
-  bool     jets_dn_csv_isLoaded;
+  unsigned int jets_dn_csv_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *ak8jets_p4_;
   TBranch *ak8jets_p4_branch;
-  bool     ak8jets_p4_isLoaded;
+  unsigned int ak8jets_p4_loadedEpoch;
   vector<float> *ak8jets_softdropMass_;
   TBranch *ak8jets_softdropMass_branch;
-  bool     ak8jets_softdropMass_isLoaded;
+  unsigned int ak8jets_softdropMass_loadedEpoch;
   vector<float> *ak8jets_prunedMass_;
   TBranch *ak8jets_prunedMass_branch;
-  bool     ak8jets_prunedMass_isLoaded;
+  unsigned int ak8jets_prunedMass_loadedEpoch;
   vector<float> *ak8jets_trimmedMass_;
   TBranch *ak8jets_trimmedMass_branch;
-  bool     ak8jets_trimmedMass_isLoaded;
+  unsigned int ak8jets_trimmedMass_loadedEpoch;
   vector<float> *ak8jets_mass_;
   TBranch *ak8jets_mass_branch;
-  bool     ak8jets_mass_isLoaded;
+  unsigned int ak8jets_mass_loadedEpoch;
   vector<float> *ak8jets_nJettinessTau1_;
   TBranch *ak8jets_nJettinessTau1_branch;
-  bool     ak8jets_nJettinessTau1_isLoaded;
+  unsigned int ak8jets_nJettinessTau1_loadedEpoch;
   vector<float> *ak8jets_nJettinessTau2_;
   TBranch *ak8jets_nJettinessTau2_branch;
-  bool     ak8jets_nJettinessTau2_isLoaded;
+  unsigned int ak8jets_nJettinessTau2_loadedEpoch;
   vector<float> *ak8jets_softdropPuppiSubjet1_;
   TBranch *ak8jets_softdropPuppiSubjet1_branch;
-  bool     ak8jets_softdropPuppiSubjet1_isLoaded;
+  unsigned int ak8jets_softdropPuppiSubjet1_loadedEpoch;
   vector<float> *ak8jets_softdropPuppiSubjet2_;
   TBranch *ak8jets_softdropPuppiSubjet2_branch;
-  bool     ak8jets_softdropPuppiSubjet2_isLoaded;
+  unsigned int ak8jets_softdropPuppiSubjet2_loadedEpoch;
   vector<float> *ak8jets_puppi_softdropMass_;
   TBranch *ak8jets_puppi_softdropMass_branch;
-  bool     ak8jets_puppi_softdropMass_isLoaded;
+  unsigned int ak8jets_puppi_softdropMass_loadedEpoch;
   vector<float> *ak8jets_puppi_nJettinessTau1_;
   TBranch *ak8jets_puppi_nJettinessTau1_branch;
-  bool     ak8jets_puppi_nJettinessTau1_isLoaded;
+  unsigned int ak8jets_puppi_nJettinessTau1_loadedEpoch;
   vector<float> *ak8jets_puppi_nJettinessTau2_;
   TBranch *ak8jets_puppi_nJettinessTau2_branch;
-  bool     ak8jets_puppi_nJettinessTau2_isLoaded;
+  unsigned int ak8jets_puppi_nJettinessTau2_loadedEpoch;
   vector<float> *ak8jets_puppi_eta_;
   TBranch *ak8jets_puppi_eta_branch;
-  bool     ak8jets_puppi_eta_isLoaded;
+  unsigned int ak8jets_puppi_eta_loadedEpoch;
   vector<float> *ak8jets_puppi_phi_;
   TBranch *ak8jets_puppi_phi_branch;
-  bool     ak8jets_puppi_phi_isLoaded;
+  unsigned int ak8jets_puppi_phi_loadedEpoch;
   vector<float> *ak8jets_puppi_pt_;
   TBranch *ak8jets_puppi_pt_branch;
-  bool     ak8jets_puppi_pt_isLoaded;
+  unsigned int ak8jets_puppi_pt_loadedEpoch;
   vector<float> *ak8jets_puppi_mass_;
   TBranch *ak8jets_puppi_mass_branch;
-  bool     ak8jets_puppi_mass_isLoaded;
+  unsigned int ak8jets_puppi_mass_loadedEpoch;
   float    met_pt_;
   TBranch *met_pt_branch;
-  bool     met_pt_isLoaded;
+  unsigned int met_pt_loadedEpoch;
   float    met_phi_;
   TBranch *met_phi_branch;
-  bool     met_phi_isLoaded;
+  unsigned int met_phi_loadedEpoch;
   float    met_up_pt_;
   TBranch *met_up_pt_branch;
-  bool     met_up_pt_isLoaded;
+  unsigned int met_up_pt_loadedEpoch;
   float    met_up_phi_;
   TBranch *met_up_phi_branch;
-  bool     met_up_phi_isLoaded;
+  unsigned int met_up_phi_loadedEpoch;
   float    met_dn_pt_;
   TBranch *met_dn_pt_branch;
-  bool     met_dn_pt_isLoaded;
+  unsigned int met_dn_pt_loadedEpoch;
   float    met_dn_phi_;
   TBranch *met_dn_phi_branch;
-  bool     met_dn_phi_isLoaded;
+  unsigned int met_dn_phi_loadedEpoch;
   float    met_gen_pt_;
   TBranch *met_gen_pt_branch;
-  bool     met_gen_pt_isLoaded;
+  unsigned int met_gen_pt_loadedEpoch;
   float    met_gen_phi_;
   TBranch *met_gen_phi_branch;
-  bool     met_gen_phi_isLoaded;
+  unsigned int met_gen_phi_loadedEpoch;
   int      firstgoodvertex_;
   TBranch *firstgoodvertex_branch;
-  bool     firstgoodvertex_isLoaded;
+  unsigned int firstgoodvertex_loadedEpoch;
   int      nTrueInt_;
   TBranch *nTrueInt_branch;
-  bool     nTrueInt_isLoaded;
+  unsigned int nTrueInt_loadedEpoch;
   int      nVert_;
   TBranch *nVert_branch;
-  bool     nVert_isLoaded;
+  unsigned int nVert_loadedEpoch;
   int      nisoTrack_mt2_cleaned_VVV_cutbased_veto_;
   TBranch *nisoTrack_mt2_cleaned_VVV_cutbased_veto_branch;
-  bool     nisoTrack_mt2_cleaned_VVV_cutbased_veto_isLoaded;
+  unsigned int nisoTrack_mt2_cleaned_VVV_cutbased_veto_loadedEpoch;
   float    weight_btagsf_;
   TBranch *weight_btagsf_branch;
-  bool     weight_btagsf_isLoaded;
+  unsigned int weight_btagsf_loadedEpoch;
   float    weight_btagsf_heavy_DN_;
   TBranch *weight_btagsf_heavy_DN_branch;
-  bool     weight_btagsf_heavy_DN_isLoaded;
+  unsigned int weight_btagsf_heavy_DN_loadedEpoch;
   float    weight_btagsf_heavy_UP_;
   TBranch *weight_btagsf_heavy_UP_branch;
-  bool     weight_btagsf_heavy_UP_isLoaded;
+  unsigned int weight_btagsf_heavy_UP_loadedEpoch;
   float    weight_btagsf_light_DN_;
   TBranch *weight_btagsf_light_DN_branch;
-  bool     weight_btagsf_light_DN_isLoaded;
+  unsigned int weight_btagsf_light_DN_loadedEpoch;
   float    weight_btagsf_light_UP_;
   TBranch *weight_btagsf_light_UP_branch;
-  bool     weight_btagsf_light_UP_isLoaded;
+  unsigned int weight_btagsf_light_UP_loadedEpoch;
   float    gen_ht_;
   TBranch *gen_ht_branch;
-  bool     gen_ht_isLoaded;
+  unsigned int gen_ht_loadedEpoch;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genPart_p4_;
   TBranch *genPart_p4_branch;
-  bool     genPart_p4_isLoaded;
+  unsigned int genPart_p4_loadedEpoch;
   vector<int> *genPart_motherId_;
   TBranch *genPart_motherId_branch;
-  bool     genPart_motherId_isLoaded;
+  unsigned int genPart_motherId_loadedEpoch;
   vector<int> *genPart_pdgId_;
   TBranch *genPart_pdgId_branch;
-  bool     genPart_pdgId_isLoaded;
+  unsigned int genPart_pdgId_loadedEpoch;
   vector<int> *genPart_charge_;
   TBranch *genPart_charge_branch;
-  bool     genPart_charge_isLoaded;
+  unsigned int genPart_charge_loadedEpoch;
   vector<int> *genPart_status_;
   TBranch *genPart_status_branch;
-  bool     genPart_status_isLoaded;
+  unsigned int genPart_status_loadedEpoch;
   int      ngenLep_;
   TBranch *ngenLep_branch;
-  bool     ngenLep_isLoaded;
+  unsigned int ngenLep_loadedEpoch;
   int      ngenLepFromTau_;
   TBranch *ngenLepFromTau_branch;
-  bool     ngenLepFromTau_isLoaded;
+  unsigned int ngenLepFromTau_loadedEpoch;
   int      Flag_AllEventFilters_;
   TBranch *Flag_AllEventFilters_branch;
-  bool     Flag_AllEventFilters_isLoaded;
+  unsigned int Flag_AllEventFilters_loadedEpoch;
   int      Flag_EcalDeadCellTriggerPrimitiveFilter_;
   TBranch *Flag_EcalDeadCellTriggerPrimitiveFilter_branch;
-  bool     Flag_EcalDeadCellTriggerPrimitiveFilter_isLoaded;
+  unsigned int Flag_EcalDeadCellTriggerPrimitiveFilter_loadedEpoch;
   int      Flag_HBHEIsoNoiseFilter_;
   TBranch *Flag_HBHEIsoNoiseFilter_branch;
-  bool     Flag_HBHEIsoNoiseFilter_isLoaded;
+  unsigned int Flag_HBHEIsoNoiseFilter_loadedEpoch;
   int      Flag_HBHENoiseFilter_;
   TBranch *Flag_HBHENoiseFilter_branch;
-  bool     Flag_HBHENoiseFilter_isLoaded;
+  unsigned int Flag_HBHENoiseFilter_loadedEpoch;
   int      Flag_badChargedCandidateFilter_;
   TBranch *Flag_badChargedCandidateFilter_branch;
-  bool     Flag_badChargedCandidateFilter_isLoaded;
+  unsigned int Flag_badChargedCandidateFilter_loadedEpoch;
   int      Flag_badMuonFilter_;
   TBranch *Flag_badMuonFilter_branch;
-  bool     Flag_badMuonFilter_isLoaded;
+  unsigned int Flag_badMuonFilter_loadedEpoch;
   int      Flag_badMuonFilterv2_;
   TBranch *Flag_badMuonFilterv2_branch;
-  bool     Flag_badMuonFilterv2_isLoaded;
+  unsigned int Flag_badMuonFilterv2_loadedEpoch;
   int      Flag_badChargedCandidateFilterv2_;
   TBranch *Flag_badChargedCandidateFilterv2_branch;
-  bool     Flag_badChargedCandidateFilterv2_isLoaded;
+  unsigned int Flag_badChargedCandidateFilterv2_loadedEpoch;
   int      Flag_eeBadScFilter_;
   TBranch *Flag_eeBadScFilter_branch;
-  bool     Flag_eeBadScFilter_isLoaded;
+  unsigned int Flag_eeBadScFilter_loadedEpoch;
   int      Flag_ecalBadCalibFilter_;
   TBranch *Flag_ecalBadCalibFilter_branch;
-  bool     Flag_ecalBadCalibFilter_isLoaded;
+  unsigned int Flag_ecalBadCalibFilter_loadedEpoch;
   int      Flag_globalTightHalo2016_;
   TBranch *Flag_globalTightHalo2016_branch;
-  bool     Flag_globalTightHalo2016_isLoaded;
+  unsigned int Flag_globalTightHalo2016_loadedEpoch;
   int      Flag_goodVertices_;
   TBranch *Flag_goodVertices_branch;
-  bool     Flag_goodVertices_isLoaded;
+  unsigned int Flag_goodVertices_loadedEpoch;
   int      Flag_ecalLaserCorrFilter_;
   TBranch *Flag_ecalLaserCorrFilter_branch;
-  bool     Flag_ecalLaserCorrFilter_isLoaded;
+  unsigned int Flag_ecalLaserCorrFilter_loadedEpoch;
   int      Flag_hcalLaserEventFilter_;
   TBranch *Flag_hcalLaserEventFilter_branch;
-  bool     Flag_hcalLaserEventFilter_isLoaded;
+  unsigned int Flag_hcalLaserEventFilter_loadedEpoch;
   int      Flag_trackingFailureFilter_;
   TBranch *Flag_trackingFailureFilter_branch;
-  bool     Flag_trackingFailureFilter_isLoaded;
+  unsigned int Flag_trackingFailureFilter_loadedEpoch;
   int      Flag_CSCTightHaloFilter_;
   TBranch *Flag_CSCTightHaloFilter_branch;
-  bool     Flag_CSCTightHaloFilter_isLoaded;
+  unsigned int Flag_CSCTightHaloFilter_loadedEpoch;
   int      Flag_CSCTightHalo2015Filter_;
   TBranch *Flag_CSCTightHalo2015Filter_branch;
-  bool     Flag_CSCTightHalo2015Filter_isLoaded;
+  unsigned int Flag_CSCTightHalo2015Filter_loadedEpoch;
   int      Flag_badMuons_;
   TBranch *Flag_badMuons_branch;
-  bool     Flag_badMuons_isLoaded;
+  unsigned int Flag_badMuons_loadedEpoch;
   int      Flag_duplicateMuons_;
   TBranch *Flag_duplicateMuons_branch;
-  bool     Flag_duplicateMuons_isLoaded;
+  unsigned int Flag_duplicateMuons_loadedEpoch;
   int      Flag_noBadMuons_;
   TBranch *Flag_noBadMuons_branch;
-  bool     Flag_noBadMuons_isLoaded;
+  unsigned int Flag_noBadMuons_loadedEpoch;
   int      fastsimfilt_;
   TBranch *fastsimfilt_branch;
-  bool     fastsimfilt_isLoaded;
+  unsigned int fastsimfilt_loadedEpoch;
   int      nVlep_;
   TBranch *nVlep_branch;
-  bool     nVlep_isLoaded;
+  unsigned int nVlep_loadedEpoch;
   int      nTlep_;
   TBranch *nTlep_branch;
-  bool     nTlep_isLoaded;
+  unsigned int nTlep_loadedEpoch;
   int      nTlepSS_;
   TBranch *nTlepSS_branch;
-  bool     nTlepSS_isLoaded;
+  unsigned int nTlepSS_loadedEpoch;
   int      nLlep_;
   TBranch *nLlep_branch;
-  bool     nLlep_isLoaded;
+  unsigned int nLlep_loadedEpoch;
   int      nSFOS_;
   TBranch *nSFOS_branch;
-  bool     nSFOS_isLoaded;
+  unsigned int nSFOS_loadedEpoch;
   int      nSFOSinZ_;
   TBranch *nSFOSinZ_branch;
-  bool     nSFOSinZ_isLoaded;
+  unsigned int nSFOSinZ_loadedEpoch;
   int      nj_;
   TBranch *nj_branch;
-  bool     nj_isLoaded;
+  unsigned int nj_loadedEpoch;
   int      nj_up_;
   TBranch *nj_up_branch;
-  bool     nj_up_isLoaded;
+  unsigned int nj_up_loadedEpoch;
   int      nj_dn_;
   TBranch *nj_dn_branch;
-  bool     nj_dn_isLoaded;
+  unsigned int nj_dn_loadedEpoch;
   int      nj30_;
   TBranch *nj30_branch;
-  bool     nj30_isLoaded;
+  unsigned int nj30_loadedEpoch;
   int      nj30_up_;
   TBranch *nj30_up_branch;
-  bool     nj30_up_isLoaded;
+  unsigned int nj30_up_loadedEpoch;
   int      nj30_dn_;
   TBranch *nj30_dn_branch;
-  bool     nj30_dn_isLoaded;
+  unsigned int nj30_dn_loadedEpoch;
   int      nb_;
   TBranch *nb_branch;
-  bool     nb_isLoaded;
+  unsigned int nb_loadedEpoch;
   int      nb_up_;
   TBranch *nb_up_branch;
-  bool     nb_up_isLoaded;
+  unsigned int nb_up_loadedEpoch;
   int      nb_dn_;
   TBranch *nb_dn_branch;
-  bool     nb_dn_isLoaded;
+  unsigned int nb_dn_loadedEpoch;
   float    Mjj_;
   TBranch *Mjj_branch;
-  bool     Mjj_isLoaded;
+  unsigned int Mjj_loadedEpoch;
   float    Mjj_up_;
   TBranch *Mjj_up_branch;
-  bool     Mjj_up_isLoaded;
+  unsigned int Mjj_up_loadedEpoch;
   float    Mjj_dn_;
   TBranch *Mjj_dn_branch;
-  bool     Mjj_dn_isLoaded;
+  unsigned int Mjj_dn_loadedEpoch;
   float    DRjj_;
   TBranch *DRjj_branch;
-  bool     DRjj_isLoaded;
+  unsigned int DRjj_loadedEpoch;
   float    DRjj_up_;
   TBranch *DRjj_up_branch;
-  bool     DRjj_up_isLoaded;
+  unsigned int DRjj_up_loadedEpoch;
   float    DRjj_dn_;
   TBranch *DRjj_dn_branch;
-  bool     DRjj_dn_isLoaded;
+  unsigned int DRjj_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_;
   TBranch *jet0_wtag_p4_branch;
-  bool     jet0_wtag_p4_isLoaded;
+  unsigned int jet0_wtag_p4_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_up_;
   TBranch *jet0_wtag_p4_up_branch;
-  bool     jet0_wtag_p4_up_isLoaded;
+  unsigned int jet0_wtag_p4_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_dn_;
   TBranch *jet0_wtag_p4_dn_branch;
-  bool     jet0_wtag_p4_dn_isLoaded;
+  unsigned int jet0_wtag_p4_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_;
   TBranch *jet1_wtag_p4_branch;
-  bool     jet1_wtag_p4_isLoaded;
+  unsigned int jet1_wtag_p4_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_up_;
   TBranch *jet1_wtag_p4_up_branch;
-  bool     jet1_wtag_p4_up_isLoaded;
+  unsigned int jet1_wtag_p4_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_dn_;
   TBranch *jet1_wtag_p4_dn_branch;
-  bool     jet1_wtag_p4_dn_isLoaded;
+  unsigned int jet1_wtag_p4_dn_loadedEpoch;
   float    MjjDR1_;
   TBranch *MjjDR1_branch;
-  bool     MjjDR1_isLoaded;
+  unsigned int MjjDR1_loadedEpoch;
   float    MjjDR1_up_;
   TBranch *MjjDR1_up_branch;
-  bool     MjjDR1_up_isLoaded;
+  unsigned int MjjDR1_up_loadedEpoch;
   float    MjjDR1_dn_;
   TBranch *MjjDR1_dn_branch;
-  bool     MjjDR1_dn_isLoaded;
+  unsigned int MjjDR1_dn_loadedEpoch;
   float    DRjjDR1_;
   TBranch *DRjjDR1_branch;
-  bool     DRjjDR1_isLoaded;
+  unsigned int DRjjDR1_loadedEpoch;
   float    DRjjDR1_up_;
   TBranch *DRjjDR1_up_branch;
-  bool     DRjjDR1_up_isLoaded;
+  unsigned int DRjjDR1_up_loadedEpoch;
   float    DRjjDR1_dn_;
   TBranch *DRjjDR1_dn_branch;
-  bool     DRjjDR1_dn_isLoaded;
+  unsigned int DRjjDR1_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_;
   TBranch *jet0_wtag_p4_DR1_branch;
-  bool     jet0_wtag_p4_DR1_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_up_;
   TBranch *jet0_wtag_p4_DR1_up_branch;
-  bool     jet0_wtag_p4_DR1_up_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet0_wtag_p4_DR1_dn_;
   TBranch *jet0_wtag_p4_DR1_dn_branch;
-  bool     jet0_wtag_p4_DR1_dn_isLoaded;
+  unsigned int jet0_wtag_p4_DR1_dn_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_;
   TBranch *jet1_wtag_p4_DR1_branch;
-  bool     jet1_wtag_p4_DR1_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_up_;
   TBranch *jet1_wtag_p4_DR1_up_branch;
-  bool     jet1_wtag_p4_DR1_up_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_up_loadedEpoch;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jet1_wtag_p4_DR1_dn_;
   TBranch *jet1_wtag_p4_DR1_dn_branch;
-  bool     jet1_wtag_p4_DR1_dn_isLoaded;
+  unsigned int jet1_wtag_p4_DR1_dn_loadedEpoch;
   float    MjjVBF_;
   TBranch *MjjVBF_branch;
-  bool     MjjVBF_isLoaded;
+  unsigned int MjjVBF_loadedEpoch;
   float    MjjVBF_up_;
   TBranch *MjjVBF_up_branch;
-  bool     MjjVBF_up_isLoaded;
+  unsigned int MjjVBF_up_loadedEpoch;
   float    MjjVBF_dn_;
   TBranch *MjjVBF_dn_branch;
-  bool     MjjVBF_dn_isLoaded;
+  unsigned int MjjVBF_dn_loadedEpoch;
   float    DetajjVBF_;
   TBranch *DetajjVBF_branch;
-  bool     DetajjVBF_isLoaded;
+  unsigned int DetajjVBF_loadedEpoch;
   float    DetajjVBF_up_;
   TBranch *DetajjVBF_up_branch;
-  bool     DetajjVBF_up_isLoaded;
+  unsigned int DetajjVBF_up_loadedEpoch;
   float    DetajjVBF_dn_;
   TBranch *DetajjVBF_dn_branch;
-  bool     DetajjVBF_dn_isLoaded;
+  unsigned int DetajjVBF_dn_loadedEpoch;
   float    MjjL_;
   TBranch *MjjL_branch;
-  bool     MjjL_isLoaded;
+  unsigned int MjjL_loadedEpoch;
   float    MjjL_up_;
   TBranch *MjjL_up_branch;
-  bool     MjjL_up_isLoaded;
+  unsigned int MjjL_up_loadedEpoch;
   float    MjjL_dn_;
   TBranch *MjjL_dn_branch;
-  bool     MjjL_dn_isLoaded;
+  unsigned int MjjL_dn_loadedEpoch;
   float    DetajjL_;
   TBranch *DetajjL_branch;
-  bool     DetajjL_isLoaded;
+  unsigned int DetajjL_loadedEpoch;
   float    DetajjL_up_;
   TBranch *DetajjL_up_branch;
-  bool     DetajjL_up_isLoaded;
+  unsigned int DetajjL_up_loadedEpoch;
   float    DetajjL_dn_;
   TBranch *DetajjL_dn_branch;
-  bool     DetajjL_dn_isLoaded;
+  unsigned int DetajjL_dn_loadedEpoch;
   float    MllSS_;
   TBranch *MllSS_branch;
-  bool     MllSS_isLoaded;
+  unsigned int MllSS_loadedEpoch;
   float    MeeSS_;
   TBranch *MeeSS_branch;
-  bool     MeeSS_isLoaded;
+  unsigned int MeeSS_loadedEpoch;
   float    Mll3L_;
   TBranch *Mll3L_branch;
-  bool     Mll3L_isLoaded;
+  unsigned int Mll3L_loadedEpoch;
   float    Mee3L_;
   TBranch *Mee3L_branch;
-  bool     Mee3L_isLoaded;
+  unsigned int Mee3L_loadedEpoch;
   float    Mll3L1_;
   TBranch *Mll3L1_branch;
-  bool     Mll3L1_isLoaded;
+  unsigned int Mll3L1_loadedEpoch;
   float    M3l_;
   TBranch *M3l_branch;
-  bool     M3l_isLoaded;
+  unsigned int M3l_loadedEpoch;
   float    Pt3l_;
   TBranch *Pt3l_branch;
-  bool     Pt3l_isLoaded;
+  unsigned int Pt3l_loadedEpoch;
   float    M01_;
   TBranch *M01_branch;
-  bool     M01_isLoaded;
+  unsigned int M01_loadedEpoch;
   float    M02_;
   TBranch *M02_branch;
-  bool     M02_isLoaded;
+  unsigned int M02_loadedEpoch;
   float    M12_;
   TBranch *M12_branch;
-  bool     M12_isLoaded;
+  unsigned int M12_loadedEpoch;
   int      isSFOS01_;
   TBranch *isSFOS01_branch;
-  bool     isSFOS01_isLoaded;
+  unsigned int isSFOS01_loadedEpoch;
   int      isSFOS02_;
   TBranch *isSFOS02_branch;
-  bool     isSFOS02_isLoaded;
+  unsigned int isSFOS02_loadedEpoch;
   int      isSFOS12_;
   TBranch *isSFOS12_branch;
-  bool     isSFOS12_isLoaded;
+  unsigned int isSFOS12_loadedEpoch;
   float    DPhi3lMET_;
   TBranch *DPhi3lMET_branch;
-  bool     DPhi3lMET_isLoaded;
+  unsigned int DPhi3lMET_loadedEpoch;
   float    DPhi3lMET_up_;
   TBranch *DPhi3lMET_up_branch;
-  bool     DPhi3lMET_up_isLoaded;
+  unsigned int DPhi3lMET_up_loadedEpoch;
   float    DPhi3lMET_dn_;
   TBranch *DPhi3lMET_dn_branch;
-  bool     DPhi3lMET_dn_isLoaded;
+  unsigned int DPhi3lMET_dn_loadedEpoch;
   float    DPhi3lMET_gen_;
   TBranch *DPhi3lMET_gen_branch;
-  bool     DPhi3lMET_gen_isLoaded;
+  unsigned int DPhi3lMET_gen_loadedEpoch;
   float    MTmax_;
   TBranch *MTmax_branch;
-  bool     MTmax_isLoaded;
+  unsigned int MTmax_loadedEpoch;
   float    MTmax_up_;
   TBranch *MTmax_up_branch;
-  bool     MTmax_up_isLoaded;
+  unsigned int MTmax_up_loadedEpoch;
   float    MTmax_dn_;
   TBranch *MTmax_dn_branch;
-  bool     MTmax_dn_isLoaded;
+  unsigned int MTmax_dn_loadedEpoch;
   float    MTmax_gen_;
   TBranch *MTmax_gen_branch;
-  bool     MTmax_gen_isLoaded;
+  unsigned int MTmax_gen_loadedEpoch;
   float    MTmin_;
   TBranch *MTmin_branch;
-  bool     MTmin_isLoaded;
+  unsigned int MTmin_loadedEpoch;
   float    MTmin_up_;
   TBranch *MTmin_up_branch;
-  bool     MTmin_up_isLoaded;
+  unsigned int MTmin_up_loadedEpoch;
   float    MTmin_dn_;
   TBranch *MTmin_dn_branch;
-  bool     MTmin_dn_isLoaded;
+  unsigned int MTmin_dn_loadedEpoch;
   float    MTmin_gen_;
   TBranch *MTmin_gen_branch;
-  bool     MTmin_gen_isLoaded;
+  unsigned int MTmin_gen_loadedEpoch;
   float    MT3rd_;
   TBranch *MT3rd_branch;
-  bool     MT3rd_isLoaded;
+  unsigned int MT3rd_loadedEpoch;
   float    MT3rd_up_;
   TBranch *MT3rd_up_branch;
-  bool     MT3rd_up_isLoaded;
+  unsigned int MT3rd_up_loadedEpoch;
   float    MT3rd_dn_;
   TBranch *MT3rd_dn_branch;
-  bool     MT3rd_dn_isLoaded;
+  unsigned int MT3rd_dn_loadedEpoch;
   float    MT3rd_gen_;
   TBranch *MT3rd_gen_branch;
-  bool     MT3rd_gen_isLoaded;
+  unsigned int MT3rd_gen_loadedEpoch;
   float    MTmax3L_;
   TBranch *MTmax3L_branch;
-  bool     MTmax3L_isLoaded;
+  unsigned int MTmax3L_loadedEpoch;
   float    MTmax3L_up_;
   TBranch *MTmax3L_up_branch;
-  bool     MTmax3L_up_isLoaded;
+  unsigned int MTmax3L_up_loadedEpoch;
   float    MTmax3L_dn_;
   TBranch *MTmax3L_dn_branch;
-  bool     MTmax3L_dn_isLoaded;
+  unsigned int MTmax3L_dn_loadedEpoch;
   float    MTmax3L_gen_;
   TBranch *MTmax3L_gen_branch;
-  bool     MTmax3L_gen_isLoaded;
+  unsigned int MTmax3L_gen_loadedEpoch;
   int      passSSee_;
   TBranch *passSSee_branch;
-  bool     passSSee_isLoaded;
+  unsigned int passSSee_loadedEpoch;
   int      passSSem_;
   TBranch *passSSem_branch;
-  bool     passSSem_isLoaded;
+  unsigned int passSSem_loadedEpoch;
   int      passSSmm_;
   TBranch *passSSmm_branch;
-  bool     passSSmm_isLoaded;
+  unsigned int passSSmm_loadedEpoch;
   int      lep_idx0_SS_;
   TBranch *lep_idx0_SS_branch;
-  bool     lep_idx0_SS_isLoaded;
+  unsigned int lep_idx0_SS_loadedEpoch;
   int      lep_idx1_SS_;
   TBranch *lep_idx1_SS_branch;
-  bool     lep_idx1_SS_isLoaded;
+  unsigned int lep_idx1_SS_loadedEpoch;
   TString *bkgtype_;
   TBranch *bkgtype_branch;
-  bool     bkgtype_isLoaded;
+  unsigned int bkgtype_loadedEpoch;
   int      vetophoton_;
   TBranch *vetophoton_branch;
-  bool     vetophoton_isLoaded;
+  unsigned int vetophoton_loadedEpoch;
   float    purewgt_;
   TBranch *purewgt_branch;
-  bool     purewgt_isLoaded;
+  unsigned int purewgt_loadedEpoch;
   float    purewgt_up_;
   TBranch *purewgt_up_branch;
-  bool     purewgt_up_isLoaded;
+  unsigned int purewgt_up_loadedEpoch;
   float    purewgt_dn_;
   TBranch *purewgt_dn_branch;
-  bool     purewgt_dn_isLoaded;
+  unsigned int purewgt_dn_loadedEpoch;
   float    ffwgt_;
   TBranch *ffwgt_branch;
-  bool     ffwgt_isLoaded;
+  unsigned int ffwgt_loadedEpoch;
   float    ffwgt_up_;
   TBranch *ffwgt_up_branch;
-  bool     ffwgt_up_isLoaded;
+  unsigned int ffwgt_up_loadedEpoch;
   float    ffwgt_dn_;
   TBranch *ffwgt_dn_branch;
-  bool     ffwgt_dn_isLoaded;
+  unsigned int ffwgt_dn_loadedEpoch;
   float    ffwgt_el_up_;
   TBranch *ffwgt_el_up_branch;
-  bool     ffwgt_el_up_isLoaded;
+  unsigned int ffwgt_el_up_loadedEpoch;
   float    ffwgt_el_dn_;
   TBranch *ffwgt_el_dn_branch;
-  bool     ffwgt_el_dn_isLoaded;
+  unsigned int ffwgt_el_dn_loadedEpoch;
   float    ffwgt_mu_up_;
   TBranch *ffwgt_mu_up_branch;
-  bool     ffwgt_mu_up_isLoaded;
+  unsigned int ffwgt_mu_up_loadedEpoch;
   float    ffwgt_mu_dn_;
   TBranch *ffwgt_mu_dn_branch;
-  bool     ffwgt_mu_dn_isLoaded;
+  unsigned int ffwgt_mu_dn_loadedEpoch;
   float    ffwgt_closure_up_;
   TBranch *ffwgt_closure_up_branch;
-  bool     ffwgt_closure_up_isLoaded;
+  unsigned int ffwgt_closure_up_loadedEpoch;
   float    ffwgt_closure_dn_;
   TBranch *ffwgt_closure_dn_branch;
-  bool     ffwgt_closure_dn_isLoaded;
+  unsigned int ffwgt_closure_dn_loadedEpoch;
   float    ffwgt_closure_el_up_;
   TBranch *ffwgt_closure_el_up_branch;
-  bool     ffwgt_closure_el_up_isLoaded;
+  unsigned int ffwgt_closure_el_up_loadedEpoch;
   float    ffwgt_closure_el_dn_;
   TBranch *ffwgt_closure_el_dn_branch;
-  bool     ffwgt_closure_el_dn_isLoaded;
+  unsigned int ffwgt_closure_el_dn_loadedEpoch;
   float    ffwgt_closure_mu_up_;
   TBranch *ffwgt_closure_mu_up_branch;
-  bool     ffwgt_closure_mu_up_isLoaded;
+  unsigned int ffwgt_closure_mu_up_loadedEpoch;
   float    ffwgt_closure_mu_dn_;
   TBranch *ffwgt_closure_mu_dn_branch;
-  bool     ffwgt_closure_mu_dn_isLoaded;
+  unsigned int ffwgt_closure_mu_dn_loadedEpoch;
   float    ffwgt_full_up_;
   TBranch *ffwgt_full_up_branch;
-  bool     ffwgt_full_up_isLoaded;
+  unsigned int ffwgt_full_up_loadedEpoch;
   float    ffwgt_full_dn_;
   TBranch *ffwgt_full_dn_branch;
-  bool     ffwgt_full_dn_isLoaded;
+  unsigned int ffwgt_full_dn_loadedEpoch;
   float    ffwgtqcd_;
   TBranch *ffwgtqcd_branch;
-  bool     ffwgtqcd_isLoaded;
+  unsigned int ffwgtqcd_loadedEpoch;
   float    ffwgtqcd_up_;
   TBranch *ffwgtqcd_up_branch;
-  bool     ffwgtqcd_up_isLoaded;
+  unsigned int ffwgtqcd_up_loadedEpoch;
   float    ffwgtqcd_dn_;
   TBranch *ffwgtqcd_dn_branch;
-  bool     ffwgtqcd_dn_isLoaded;
+  unsigned int ffwgtqcd_dn_loadedEpoch;
   float    lepsf_;
   TBranch *lepsf_branch;
-  bool     lepsf_isLoaded;
+  unsigned int lepsf_loadedEpoch;
   float    lepsf_up_;
   TBranch *lepsf_up_branch;
-  bool     lepsf_up_isLoaded;
+  unsigned int lepsf_up_loadedEpoch;
   float    lepsf_dn_;
   TBranch *lepsf_dn_branch;
-  bool     lepsf_dn_isLoaded;
+  unsigned int lepsf_dn_loadedEpoch;
   float    trigeff_;
   TBranch *trigeff_branch;
-  bool     trigeff_isLoaded;
+  unsigned int trigeff_loadedEpoch;
   float    trigeff_up_;
   TBranch *trigeff_up_branch;
-  bool     trigeff_up_isLoaded;
+  unsigned int trigeff_up_loadedEpoch;
   float    trigeff_dn_;
   TBranch *trigeff_dn_branch;
-  bool     trigeff_dn_isLoaded;
+  unsigned int trigeff_dn_loadedEpoch;
   float    trigsf_;
   TBranch *trigsf_branch;
-  bool     trigsf_isLoaded;
+  unsigned int trigsf_loadedEpoch;
   float    trigsf_up_;
   TBranch *trigsf_up_branch;
-  bool     trigsf_up_isLoaded;
+  unsigned int trigsf_up_loadedEpoch;
   float    trigsf_dn_;
   TBranch *trigsf_dn_branch;
-  bool     trigsf_dn_isLoaded;
+  unsigned int trigsf_dn_loadedEpoch;
   float    musmear_sf_;
   TBranch *musmear_sf_branch;
-  bool     musmear_sf_isLoaded;
+  unsigned int musmear_sf_loadedEpoch;
 public: 
 void Init(TTree *tree);
 void GetEntry(unsigned int idx); 
+void ResetLoadEpochs(); 
 void LoadAllBranches(); 
   const int &run();
   const int &lumi();
@@ -1,8 +1,37 @@
 #include "frtree.h"
 #include "rooutil/rooutil.h"
+#include "../analysis/fasthistogram.h"
 
 int closureEvtType();
 
+// Histograms booked at every cut of the cutflow and filled into FastHistogram (flat arrays of sums of weights) instead of TH1::Fill()
+// The cuts are not evaluated again: after cutflow.fill() the cut tree is walked once in depth-first order, reading the pass
+// and the weight (product of the weights of the cut and all the cuts above it) that the cutflow stored in each cut and skipping
+// the cuts below a failed cut. The histograms are written with the names of the RooUtil ones (cut + "__" + variable) at the end.
+class CutHistograms
+{
+    public:
+        void addHistogram(TString name, unsigned int nbins, float min, float max, std::function<float()> variable);
+        void addHistogram(TString name, std::vector<float> boundaries, std::function<float()> variable);
+        void bookHistograms(RooUtil::CutTree& root) { book(&root); }
+        void fill(); // after cutflow.fill()
+        void saveOutput(TFile* ofile);
+
+    private:
+        void book(RooUtil::CutTree* node);
+        float getValue(unsigned int ivariable);
+
+        std::vector<TString> names;
+        std::vector<FastAxis> axes;
+        std::vector<std::function<float()>> variables;
+        std::vector<float> values;
+        std::vector<char> evaluated;
+
+        std::vector<RooUtil::CutTree*> cuts; // in depth-first order
+        std::vector<unsigned int> subtree_end;
+        std::vector<std::vector<FastHistogram>> histograms; // of every variable at each cut
+};
+
 // ./process INPUTFILEPATH OUTPUTFILEPATH [NEVENTS]
 int main(int argc, char** argv)
 {
@@ -208,7 +237,7 @@ int main(int argc, char** argv)
     cutflow.printCuts();
 
     // Histogram utility object that is used to define the histograms
-    RooUtil::Histograms histograms;
+    CutHistograms histograms;
     histograms.addHistogram("Mll"                , 180 , 60 , 120      , [&]() { return fr.MllSS()                               ;} );
     histograms.addHistogram("MT"                 , 180 , 0  , 180      , [&]() { return MT                                       ;} );
     histograms.addHistogram("MET"                , 180 , 0  , 250      , [&]() { return fr.met_pt()                              ;} );
@@ -240,7 +269,7 @@ int main(int argc, char** argv)
     cutflow.bookCutflows();
 
     // Book Histograms
-    cutflow.bookHistograms(histograms); // if just want to book everywhere
+    histograms.bookHistograms(cutflow.cuttree); // booked everywhere
 
 
     // Looping input file
@@ -266,9 +295,11 @@ int main(int argc, char** argv)
         oneelloose_cuts = (fr.nVlep() == 1) * (fr.lep_pt()[0] > 25.) * (fr.lep_pass_VVV_cutbased_fo()[0] == 1) * (abs(fr.lep_pdgId()[0])==11) * (fr.mc_HLT_SingleIsoEl23() > 0) * (jet_pt0>40.);
 
         cutflow.fill();
+        histograms.fill();
     }
 
     // Writing output file
+    histograms.saveOutput(ofile);
     cutflow.saveOutput();
 
     // The below can be sometimes crucial
@@ -327,3 +358,83 @@ int closureEvtType()
     else
         return -1;
 }
+
+//_______________________________________________________________________________________________________
+void CutHistograms::addHistogram(TString name, unsigned int nbins, float min, float max, std::function<float()> variable)
+{
+    names.push_back(name);
+    axes.push_back(FastAxis(nbins, min, max));
+    variables.push_back(variable);
+    values.push_back(0);
+    evaluated.push_back(false);
+}
+
+//_______________________________________________________________________________________________________
+void CutHistograms::addHistogram(TString name, std::vector<float> boundaries, std::function<float()> variable)
+{
+    names.push_back(name);
+    axes.push_back(FastAxis(boundaries));
+    variables.push_back(variable);
+    values.push_back(0);
+    evaluated.push_back(false);
+}
+
+//_______________________________________________________________________________________________________
+void CutHistograms::book(RooUtil::CutTree* node)
+{
+    unsigned int icut = cuts.size();
+    cuts.push_back(node);
+    subtree_end.push_back(0);
+    histograms.push_back(std::vector<FastHistogram>());
+    for (unsigned int ivariable = 0; ivariable < names.size(); ++ivariable)
+        histograms.back().push_back(FastHistogram(node->name + "__" + names[ivariable], axes[ivariable]));
+    for (auto& child : node->children)
+        book(child);
+    subtree_end[icut] = cuts.size();
+}
+
+//_______________________________________________________________________________________________________
+float CutHistograms::getValue(unsigned int ivariable)
+{
+    // A variable is evaluated once per event however many cuts it is filled at
+    if (not evaluated[ivariable])
+    {
+        values[ivariable] = variables[ivariable]();
+        evaluated[ivariable] = true;
+    }
+    return values[ivariable];
+}
+
+//_______________________________________________________________________________________________________
+void CutHistograms::fill()
+{
+    std::fill(evaluated.begin(), evaluated.end(), false);
+    unsigned int icut = 0;
+    while (icut < cuts.size())
+    {
+        // The results of the cuts below a failed cut are left from an earlier event, so the whole subtree is skipped
+        RooUtil::CutTree* cut = cuts[icut];
+        if (not cut->pass)
+        {
+            icut = subtree_end[icut];
+            continue;
+        }
+        for (unsigned int ivariable = 0; ivariable < histograms[icut].size(); ++ivariable)
+            histograms[icut][ivariable].fill(getValue(ivariable), cut->weight);
+        ++icut;
+    }
+}
+
+//_______________________________________________________________________________________________________
+void CutHistograms::saveOutput(TFile* ofile)
+{
+    for (auto& cut_histograms : histograms)
+    {
+        for (auto& histogram : cut_histograms)
+        {
+            TH1F* hist = histogram.toTH1F();
+            ofile->WriteTObject(hist);
+            delete hist;
+        }
+    }
+}
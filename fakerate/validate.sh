@@ -0,0 +1,61 @@
+#!/bin/bash
+
+# Checks that the fake rate looper of the working tree gives the same histograms and cutflows as the one of another git
+# revision (branch, tag or commit) on one baby, e.g. the revision before the histograms were filled into FastHistogram:
+#
+#   sh validate.sh /path/to/fakerate_baby.root BEFORE_REVISION
+#
+# The looper of the given revision is built in a temporary git worktree (with the rooutil of this checkout), the one of the
+# working tree is ./doAnalysis (run make first). Both outputs are compared with ../analysis/compareoutputs.py, up to a
+# relative tolerance of 1e-5 since the TH1F of the fill histograms only agree up to float rounding (see fasthistogram.h).
+# Exits with 1 if any histogram differs.
+
+#_____________________________________________________________________________________________
+# Help message
+help()
+{
+    echo "Error - Usage:"
+    echo "$0 INPUT_BABY BEFORE_REVISION [LEPVERSION=0] [NEVENTS=20000]"
+    exit 1
+}
+
+if [ -z $1 ]; then help; fi
+if [ -z $2 ]; then help; fi
+
+INPUT=$1
+BEFORE=$2
+LEPVERSION=${3:-0}
+NEVENTS=${4:-20000}
+HERE=$(pwd)
+WORKDIR=${HERE}/validate_$(basename ${INPUT} .root)
+mkdir -p ${WORKDIR}
+
+#_____________________________________________________________________________________________
+# Build the looper of the given revision
+git -C .. worktree add --detach ${WORKDIR}/before ${BEFORE} > /dev/null || exit 1
+rmdir ${WORKDIR}/before/fakerate/rooutil 2> /dev/null
+ln -sfn ${HERE}/rooutil ${WORKDIR}/before/fakerate/rooutil
+if ! make -C ${WORKDIR}/before/fakerate -j > ${WORKDIR}/before.log 2>&1; then
+    echo "Could not build the looper at ${BEFORE} (see ${WORKDIR}/before.log)"
+    git -C .. worktree remove --force ${WORKDIR}/before
+    exit 1
+fi
+
+#_____________________________________________________________________________________________
+# Run both from this directory (same histmap/) and compare
+NFAILED=0
+if ! ${WORKDIR}/before/fakerate/doAnalysis ${INPUT} ${WORKDIR}/reference.root ${LEPVERSION} ${NEVENTS} > ${WORKDIR}/reference.log 2>&1; then
+    echo "The looper at ${BEFORE} failed (see ${WORKDIR}/reference.log)"
+    NFAILED=1
+elif ! ./doAnalysis ${INPUT} ${WORKDIR}/output.root ${LEPVERSION} ${NEVENTS} > ${WORKDIR}/output.log 2>&1; then
+    echo "The looper of the working tree failed (see ${WORKDIR}/output.log)"
+    NFAILED=1
+elif python ../analysis/compareoutputs.py ${WORKDIR}/reference.root ${WORKDIR}/output.root 1e-5 > ${WORKDIR}/output.diff; then
+    echo "PASSED: working tree against ${BEFORE}"
+else
+    echo "FAILED: working tree against ${BEFORE} (see ${WORKDIR}/output.diff)"
+    NFAILED=1
+fi
+
+git -C .. worktree remove --force ${WORKDIR}/before
+exit ${NFAILED}